@@ -1,6 +1,13 @@
 #pragma once
 
 #include "ShaderLab/Core/ShaderLabData.h"
+#include "ShaderLab/Core/PlaybackEventIndex.h"
+#include "ShaderLab/Graphics/TransientTexturePool.h"
+#if !SHADERLAB_TINY_PLAYER
+#include "ShaderLab/Audio/AudioClock.h"
+#include "ShaderLab/Graphics/Dx12DescriptorCache.h"
+#include "ShaderLab/Graphics/TextureUploadQueue.h"
+#endif
 #include <d3d12.h>
 #include <wrl/client.h>
 #include <vector>
@@ -17,6 +24,10 @@ class Swapchain;
 class PreviewRenderer;
 class AudioSystem;
 class ShaderCompiler;
+class ShaderJobScheduler;
+class IShaderJobCompiler;
+struct ShaderJob;
+struct ShaderJobResult;
 
 class DemoPlayer {
 public:
@@ -59,7 +70,21 @@ private:
                                         int sceneIndex,
                                         double timeSeconds);
     bool EnsureTransitionPipeline(const std::string& transitionPresetStem);
+    // Frame slot of the command list being recorded; partitions per-frame descriptor tables.
+    uint32_t GetFrameSlot() const;
     void PrimeRuntimeResources();
+    void LoadBakedFileTextures();
+#if !SHADERLAB_TINY_PLAYER
+    void CollectAudioCandidates(const AudioClip& clip,
+                                std::vector<std::string>& outPackageCandidates,
+                                std::vector<std::string>& outDiskCandidates) const;
+    void LoadOneShotBank();
+#endif
+    void StartShaderJobs();
+    void CancelShaderJobs();
+    // Returns true once every queued job has been applied (or the batch was cancelled).
+    bool PollShaderJobs();
+    bool ApplyShaderJobResult(const ShaderJob& job, ShaderJobResult& result);
     
     // Core Refs
     Device* m_device = nullptr;
@@ -69,9 +94,13 @@ private:
     AudioSystem* m_audio = nullptr;
     ShaderCompiler* m_compiler = nullptr; 
     bool m_compilerReady = false;
+    ShaderJobScheduler* m_shaderJobs = nullptr;
+    IShaderJobCompiler* m_shaderJobCompiler = nullptr;
 
     // Data
     ProjectData m_project;
+    PlaybackEventIndex m_eventIndex;
+    std::vector<std::pair<int, const TrackerRow*>> m_triggeredRows;
     
     // Loading State
     enum class LoadingStage {
@@ -92,11 +121,21 @@ private:
     float m_activeSceneOffset = 0.0f; // Offset in beats relative to scene start
     double m_activeSceneStartBeat = 0.0;
     Transport m_transport; // Runtime transport state
+#if !SHADERLAB_TINY_PLAYER
+    AudioClockFilter m_audioClock;        // Music cursor -> transport time
+    AudioClockPublisher m_clockSnapshot;  // Transport position for readers off the update thread
+#endif
     
     // Render Resources
     uint32_t m_width = 0;
     uint32_t m_height = 0;
     
+    TransientTexturePool m_transientTextures; // Post-FX and compute intermediates
+#if !SHADERLAB_TINY_PLAYER
+    Dx12DescriptorCache m_descriptorCache; // Compute chain tables
+    TextureUploadQueue m_textureUploads;   // Baked file textures, uploaded once while loading
+#endif
+    
     ComPtr<ID3D12Resource> m_dummyTexture;
     ComPtr<ID3D12DescriptorHeap> m_dummySrvHeap;
     ComPtr<ID3D12DescriptorHeap> m_dummyRtvHeap;
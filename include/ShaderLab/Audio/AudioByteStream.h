@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ShaderLab {
+
+// Read-only, seekable bytes for the music decoder. The decoder pulls compressed data
+// on demand, so a track never has to sit in memory decoded:
+//  - a view borrows bytes that outlive the stream (a mapped pack entry);
+//  - an owned buffer holds a pack entry that had to be decompressed first.
+class AudioByteStream {
+public:
+    enum class Origin { Start, Current, End };
+
+    AudioByteStream() = default;
+    ~AudioByteStream();
+
+    AudioByteStream(const AudioByteStream&) = delete;
+    AudioByteStream& operator=(const AudioByteStream&) = delete;
+
+    bool OpenView(std::span<const uint8_t> bytes);
+    bool OpenOwned(std::vector<uint8_t> bytes);
+    void Close();
+
+    size_t Read(void* out, size_t bytes);
+    bool Seek(int64_t offset, Origin origin);
+    uint64_t Tell() const { return m_position; }
+    uint64_t Size() const { return m_size; }
+
+    // Bytes the stream holds in memory itself (views and mapped data excluded).
+    size_t GetResidentBytes() const { return m_owned.size(); }
+
+private:
+    std::span<const uint8_t> m_view;
+    std::vector<uint8_t> m_owned;
+
+    uint64_t m_size = 0;
+    uint64_t m_position = 0;
+};
+
+} // namespace ShaderLab
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace ShaderLab {
+
+// One reading of the music clock, taken on the thread that updates the transport.
+struct AudioClockSample {
+    bool valid = false;                // A sound is playing and the cursor could be read
+    uint64_t cursorFrames = 0;         // Frames the engine has mixed for the sound
+    uint32_t sampleRate = 0;
+    double outputLatencySeconds = 0.0; // Mixed but not yet audible (device buffer)
+
+    // Converted in double: a float loses whole frames within minutes at 48 kHz.
+    double CursorSeconds() const {
+        return sampleRate > 0 ? static_cast<double>(cursorFrames) / static_cast<double>(sampleRate) : 0.0;
+    }
+};
+
+struct AudioClockTelemetry {
+    double driftSeconds = 0.0;  // Smoothed (audio - transport) error
+    double jitterSeconds = 0.0; // RMS of the per-update error
+    double rate = 1.0;          // Transport seconds per wall second
+    double latencySeconds = 0.0;
+    uint32_t resyncs = 0;       // Seeks, xruns and loops that snapped the clock
+    uint64_t updates = 0;
+};
+
+// Second-order PLL that follows the audio cursor. The cursor advances in device-period
+// steps and is read at an unrelated frame rate, so sampling it raw makes visuals stutter;
+// the filter runs a wall-clock-driven estimate and bends its phase and rate toward each
+// reading instead. Large errors (seek, underrun, loop) snap rather than slew.
+// No audio or GPU state: feed it synthetic clocks to check its behaviour.
+class AudioClockFilter {
+public:
+    struct Settings {
+        double phaseGain = 0.1;        // Share of the error removed per update
+        double rateGain = 0.005;       // Rate change per second of error
+        double maxRateDeviation = 0.05;
+        double resyncThresholdSeconds = 0.1;
+    };
+
+    AudioClockFilter() = default;
+    explicit AudioClockFilter(const Settings& settings) : m_settings(settings) {}
+
+    // Returns the transport time for `wallSeconds`: audible audio time, smoothed.
+    double Update(double wallSeconds, double audioSeconds, double outputLatencySeconds);
+    void Reset();
+
+    bool IsLocked() const { return m_locked; }
+    const AudioClockTelemetry& GetTelemetry() const { return m_telemetry; }
+
+private:
+    Settings m_settings;
+    bool m_locked = false;
+    double m_lastWallSeconds = 0.0;
+    double m_position = 0.0;
+    double m_rate = 1.0;
+    double m_meanSquareError = 0.0;
+    AudioClockTelemetry m_telemetry;
+};
+
+// Transport position published for readers on other threads (render, overlay).
+struct AudioClockSnapshot {
+    double timeSeconds = 0.0;
+    double wallSeconds = 0.0; // When timeSeconds was valid
+    double rate = 1.0;
+    float bpm = 0.0f;
+    bool playing = false;
+
+    // Extrapolated position at a later wall time.
+    double TimeAt(double wallNowSeconds) const {
+        return playing ? timeSeconds + (wallNowSeconds - wallSeconds) * rate : timeSeconds;
+    }
+};
+
+// Single-writer seqlock: Publish never blocks, Read retries while a write is in flight.
+class AudioClockPublisher {
+public:
+    void Publish(const AudioClockSnapshot& snapshot);
+    AudioClockSnapshot Read() const;
+
+private:
+    std::atomic<uint32_t> m_sequence{0};
+    std::atomic<double> m_timeSeconds{0.0};
+    std::atomic<double> m_wallSeconds{0.0};
+    std::atomic<double> m_rate{1.0};
+    std::atomic<float> m_bpm{0.0f};
+    std::atomic<bool> m_playing{false};
+};
+
+} // namespace ShaderLab
@@ -1,7 +1,12 @@
 #pragma once
 
+#include "ShaderLab/Audio/AudioClock.h"
+#include "ShaderLab/Audio/OneShotBank.h"
+
+#include <cstdint>
 #include <string>
 #include <memory>
+#include <span>
 #include <vector>
 
 // Forward declare miniaudio types
@@ -10,15 +15,26 @@ typedef struct ma_sound ma_sound;
 
 namespace ShaderLab {
 
+class AudioByteStream;
+
 class AudioSystem {
 public:
     AudioSystem();
     ~AudioSystem();
 
     bool Initialize();
+    // Engine without an output device: nothing plays, frames are pulled with ReadFrames
+    // (headless tools and checks).
+    bool InitializeWithoutDevice(uint32_t sampleRate = 48000, uint32_t channels = 2);
     void Shutdown();
 
-    bool LoadAudio(const std::string& filepath); // Loads background audio
+    // Background music is decoded while it plays; only the compressed source stays open.
+    bool LoadAudio(const std::string& filepath);
+    // Borrows bytes that must outlive playback, such as a mapped pack entry.
+    bool LoadAudioFromView(std::span<const uint8_t> bytes);
+    // Takes ownership, for pack entries that had to be decompressed.
+    bool LoadAudioFromBuffer(std::vector<uint8_t> bytes);
+    // Copies the bytes once; prefer the overloads above when the caller can hand them over.
     bool LoadAudioFromMemory(const void* data, size_t size);
 
     void Play();
@@ -27,19 +43,40 @@ public:
     void Seek(float timeInSeconds);
     void SetVolume(float volume); // 0.0 to 1.0
 
+    // Decodes one-shots up front; triggers then play from a fixed voice pool.
+    bool LoadOneShots(const std::vector<OneShotSource>& sources, std::string& outErrors,
+                      uint32_t voiceCount = OneShotBank::kDefaultVoiceCount);
+    void UnloadOneShots();
+    bool HasOneShot(int index) const;
+    bool TriggerOneShot(int index, float volume = 1.0f);
+    OneShotStats GetOneShotStats() const;
+    // Opens and decodes the file on every call; for clips not in the bank.
     void PlayOneShot(const std::string& filepath);
 
     bool IsPlaying() const;
     float GetPlaybackTime() const;  // In seconds
     float GetDuration() const;      // In seconds
+    // Raw music cursor plus the device's reported output latency, for AudioClockFilter.
+    AudioClockSample SampleClock() const;
+
+    // Mixes the next frames of an engine created with InitializeWithoutDevice (interleaved float).
+    uint64_t ReadFrames(float* out, uint64_t frameCount);
+    // Compressed bytes the music stream keeps in memory (0 for views and resource-manager streams).
+    size_t GetStreamResidentBytes() const;
 
 private:
+    bool InitializeEngine(bool withDevice, uint32_t sampleRate, uint32_t channels);
+    bool LoadAudioStream(std::unique_ptr<AudioByteStream> stream);
+    void UnloadMusic();
+
     ma_engine* m_engine = nullptr;
     ma_sound* m_sound = nullptr; // Background sound
     
-    // For memory playback
+    // Streamed playback: the decoder pulls from m_stream as the sound plays
     void* m_decoder = nullptr; // ma_decoder opaque
-    std::vector<uint8_t> m_audioBuffer;
+    std::unique_ptr<AudioByteStream> m_stream;
+
+    OneShotBank m_oneShots;
 
     bool m_initialized = false;
 };
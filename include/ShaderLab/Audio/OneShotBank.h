@@ -0,0 +1,82 @@
+#pragma once
+
+#include "ShaderLab/Audio/OneShotVoice.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+typedef struct ma_engine ma_engine;
+
+namespace ShaderLab {
+
+// Encoded one-shot handed to OneShotBank::Load; the bytes only need to live for the call.
+struct OneShotSource {
+    int index = -1; // Caller's key, e.g. the clip's position in ProjectData::audioLibrary
+    std::string name;
+    std::span<const uint8_t> encoded;
+};
+
+struct OneShotStats {
+    uint32_t samples = 0;
+    uint64_t decodedBytes = 0;
+    uint32_t voices = 0;
+    uint32_t activeVoices = 0;
+    uint32_t peakActiveVoices = 0;
+    uint64_t triggers = 0;
+    uint64_t steals = 0;          // Triggers that cut off the oldest sounding voice
+    uint64_t missedTriggers = 0;  // Unknown index
+    double lastTriggerLatencyMs = 0.0; // Trigger() to the mixer picking the voice up
+    double maxTriggerLatencyMs = 0.0;
+};
+
+// One-shots decoded to the engine's PCM format at load time and played from a fixed voice
+// pool. Every voice is a sound that stays started and outputs silence while idle, so a
+// trigger only publishes the sample to a voice through atomics (see OneShotVoice): no
+// allocation, no file I/O and no miniaudio calls on the trigger path. When all voices
+// sound, the oldest one is stolen.
+class OneShotBank {
+public:
+    static constexpr uint32_t kDefaultVoiceCount = 16;
+
+    OneShotBank();
+    ~OneShotBank();
+
+    OneShotBank(const OneShotBank&) = delete;
+    OneShotBank& operator=(const OneShotBank&) = delete;
+
+    // Replaces the bank. Sources that fail to decode are listed in outErrors and skipped.
+    bool Load(ma_engine* engine, const std::vector<OneShotSource>& sources, uint32_t voiceCount, std::string& outErrors);
+    void Unload();
+
+    bool HasSample(int index) const;
+    bool Trigger(int index, float volume = 1.0f);
+    void StopAll();
+
+    OneShotStats GetStats() const;
+
+private:
+    struct Voice;
+    friend struct OneShotVoiceCallbacks;
+
+    void RecordTriggerLatency(int64_t nanoseconds);
+
+    std::vector<std::unique_ptr<OneShotSample>> m_samples; // Indexed by OneShotSource::index
+    std::vector<std::unique_ptr<Voice>> m_voices;
+    uint64_t m_triggerSequence = 0;
+
+    uint32_t m_sampleCount = 0;
+    uint64_t m_decodedBytes = 0;
+    uint64_t m_triggers = 0;
+    uint64_t m_steals = 0;
+    uint64_t m_missedTriggers = 0;
+    uint32_t m_peakActiveVoices = 0;
+    std::atomic<uint64_t> m_lastLatencyNs{0};
+    std::atomic<uint64_t> m_maxLatencyNs{0};
+};
+
+} // namespace ShaderLab
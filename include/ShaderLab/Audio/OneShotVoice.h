@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ShaderLab {
+
+// A one-shot decoded to the engine's PCM format: interleaved float frames.
+struct OneShotSample {
+    std::string name;
+    std::vector<float> pcm;
+    uint64_t frames = 0;
+};
+
+// Playback state of one pooled voice, shared by the trigger thread and the audio thread.
+// Trigger() publishes a sample under a per-voice sequence (odd while the fields are being
+// written); Read() picks up each new generation once and reports when it has finished
+// with it. A voice is free only once the audio thread has finished the latest generation,
+// so a hit that lands while the previous one is ending is never overwritten unheard.
+// Holds no miniaudio state: OneShotBank wraps it in a data source, tests call Read directly.
+class OneShotVoice {
+public:
+    void Configure(uint32_t channels) { m_channels = channels; }
+    uint32_t GetChannels() const { return m_channels; }
+
+    // Trigger thread.
+    void Trigger(const OneShotSample* sample, float volume, int64_t triggerNanoseconds);
+    // Silences everything triggered so far; a later Trigger plays normally.
+    void Stop();
+    bool IsSounding() const;
+
+    // Audio thread: writes frameCount frames (silence when idle). Returns true when a new
+    // trigger was picked up, with its Trigger() timestamp in outTriggerNanoseconds.
+    bool Read(float* out, uint64_t frameCount, int64_t& outTriggerNanoseconds);
+
+private:
+    // Trigger() -> audio thread
+    std::atomic<uint64_t> m_sequence{0};
+    std::atomic<const OneShotSample*> m_pending{nullptr};
+    std::atomic<float> m_pendingVolume{1.0f};
+    std::atomic<int64_t> m_pendingTriggerNs{0};
+    std::atomic<uint64_t> m_stopGeneration{0}; // Generations up to this one are silenced
+
+    // Audio thread -> Trigger()
+    std::atomic<uint64_t> m_finishedGeneration{0};
+
+    // Audio thread only
+    uint64_t m_playingGeneration = 0;
+    const OneShotSample* m_playing = nullptr;
+    uint64_t m_cursor = 0;
+    float m_volume = 1.0f;
+
+    uint32_t m_channels = 0;
+};
+
+} // namespace ShaderLab
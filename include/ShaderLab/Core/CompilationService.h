@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ShaderLab/Core/ShaderBytecodeCache.h"
 #include "ShaderLab/Shader/ShaderCompiler.h"
 
 #include <string>
@@ -29,6 +30,10 @@ public:
                                                      const std::string& shaderEntryPoint,
                                                      const std::wstring& sourceName,
                                                      ShaderCompileMode mode) = 0;
+
+    // Persistent bytecode cache, owned by the caller and shared between services (it locks
+    // internally). Services without one keep compiling every time.
+    virtual void SetBytecodeCache(ShaderBytecodeCache* cache) { (void)cache; }
 };
 
 } // namespace ShaderLab
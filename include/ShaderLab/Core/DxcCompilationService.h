@@ -27,9 +27,18 @@ public:
                                              const std::wstring& sourceName,
                                              ShaderCompileMode mode) override;
 
+    void SetBytecodeCache(ShaderBytecodeCache* cache) override;
+
 private:
+    ShaderCompileResult CompileWrapped(const std::string& wrappedSource,
+                                       const std::string& entryPoint,
+                                       const std::string& target,
+                                       const std::wstring& sourceName,
+                                       ShaderCompileMode mode);
+
     std::unique_ptr<ShaderCompiler> m_compiler;
     bool m_initialized = false;
+    ShaderBytecodeCache* m_bytecodeCache = nullptr; // Not owned
 };
 
 } // namespace ShaderLab
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ShaderLab {
+
+// One image to decode. When `encoded` is empty the worker reads `path` from disk;
+// pack readers hand the file bytes over directly and `path` is only a label.
+struct ImageDecodeJob {
+    uint64_t id = 0;
+    std::string path;
+    std::vector<uint8_t> encoded;
+};
+
+// Tightly packed RGBA8 pixels, or an error.
+struct DecodedImage {
+    uint64_t id = 0;
+    std::string path;
+    bool success = false;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::vector<uint8_t> rgba;
+    std::string error;
+};
+
+struct ImageDecodeStats {
+    uint64_t imagesDecoded = 0;
+    uint64_t imagesFailed = 0;
+    uint64_t encodedBytes = 0;
+    uint64_t decodedBytes = 0;
+    uint64_t budgetWaits = 0;     // Workers that had to wait for in-flight memory
+    uint64_t peakBytesInFlight = 0;
+    double decodeSeconds = 0.0;   // Summed over workers
+};
+
+// Decodes images with stb_image on worker threads and hands them back in submission
+// order. Memory held by an image (encoded plus decoded bytes) counts against the
+// budget from the moment a worker reserves it until Poll() delivers the image; a
+// worker waits for room unless its image is the oldest undelivered one, so the
+// pool always makes progress even when a single image exceeds the budget.
+// With zero workers every image is decoded inline inside Poll(). Holds no GPU
+// state, so it runs headless.
+class ImageDecodePool {
+public:
+    static constexpr uint64_t kDefaultMaxBytesInFlight = 256ull * 1024ull * 1024ull;
+
+    ImageDecodePool() = default;
+    ~ImageDecodePool();
+
+    ImageDecodePool(const ImageDecodePool&) = delete;
+    ImageDecodePool& operator=(const ImageDecodePool&) = delete;
+
+    // Stops any previous workers; queued and undelivered images are dropped.
+    void Start(uint32_t workerCount, uint64_t maxBytesInFlight = kDefaultMaxBytesInFlight);
+    void Stop();
+
+    void Submit(ImageDecodeJob job);
+    // Moves up to maxResults finished images, in submission order, into outImages.
+    size_t Poll(std::vector<DecodedImage>& outImages, size_t maxResults);
+    // Blocks until the oldest pending image is ready; false when nothing is pending.
+    bool WaitNext(DecodedImage& outImage);
+    // Blocks until every submitted image is delivered into outImages.
+    void Drain(std::vector<DecodedImage>& outImages);
+
+    bool IsIdle() const;
+    size_t PendingCount() const;
+    ImageDecodeStats GetStats() const;
+
+    // Leaves one hardware thread for the render loop.
+    static uint32_t DefaultWorkerCount();
+    // Decodes on the calling thread; no budget applies.
+    static DecodedImage Decode(const ImageDecodeJob& job);
+
+private:
+    struct Slot {
+        ImageDecodeJob job;
+        DecodedImage image;
+        uint64_t reservedBytes = 0;
+        bool ready = false;
+    };
+
+    void WorkerLoop();
+    // Called with the lock held for the slot at `sequence`; returns with it held.
+    void DecodeSlot(size_t sequence, std::unique_lock<std::mutex>& lock);
+    size_t DeliverLocked(std::unique_lock<std::mutex>& lock, std::vector<DecodedImage>& outImages, size_t maxResults, bool wait);
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_budgetReleased;
+    std::condition_variable m_imageReady;
+    std::vector<std::thread> m_workers;
+    // Undelivered images in submission order; m_slots[0] has sequence number m_nextDeliver.
+    std::deque<Slot> m_slots;
+    size_t m_nextJob = 0;      // Next sequence number a worker takes
+    size_t m_nextDeliver = 0;  // Next sequence number Poll() hands out
+    uint64_t m_maxBytesInFlight = kDefaultMaxBytesInFlight;
+    uint64_t m_bytesInFlight = 0;
+    bool m_stopping = false;
+    ImageDecodeStats m_stats;
+};
+
+} // namespace ShaderLab
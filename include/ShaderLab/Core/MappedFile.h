@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace ShaderLab {
+
+// Read-only mapping of a whole file. Pages are faulted in on first touch, so a
+// caller that only inspects a footer and a directory never pulls the rest of the
+// file from disk.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::string& path);
+    void Close();
+
+    bool IsOpen() const { return m_open; }
+    const uint8_t* Data() const { return m_data; }
+    uint64_t Size() const { return m_size; }
+
+    // Returns an empty span if [offset, offset + size) is outside the mapping.
+    std::span<const uint8_t> Range(uint64_t offset, uint64_t size) const;
+
+private:
+    bool m_open = false;
+    const uint8_t* m_data = nullptr;
+    uint64_t m_size = 0;
+#if defined(_WIN32)
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#else
+    int m_fd = -1;
+#endif
+};
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ShaderLab {
+namespace PackCodec {
+
+// SLZ2 entry framing (16 bytes, little endian):
+// [ 'S' 'L' 'Z' '2' ][ codec u8 ][ reserved u8 x3 ][ rawSize u32 ][ compressedSize u32 ][ block ]
+//
+// Both codecs emit the same LZ4-style block format, so the runtime carries a
+// single small decoder. The high-ratio level only spends more time searching.
+
+enum class Level : uint8_t {
+    Fast,
+    High
+};
+
+constexpr uint8_t kCodecLz4Fast = 1;
+constexpr uint8_t kCodecLz4High = 2;
+constexpr size_t kHeaderSize = 16;
+
+struct FrameHeader {
+    uint8_t codec = 0;
+    uint32_t rawSize = 0;
+    uint32_t compressedSize = 0;
+};
+
+size_t CompressBound(size_t inputSize);
+
+// Raw block API. CompressBlock returns the block size, or 0 if dst is too small.
+size_t CompressBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity, Level level);
+// Fails unless the block decodes to exactly dstSize bytes.
+bool DecompressBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+
+bool ReadFrameHeader(std::span<const uint8_t> input, FrameHeader& outHeader);
+
+// Returns false when the input does not shrink; callers then store it raw.
+bool Compress(std::span<const uint8_t> input, Level level, std::vector<uint8_t>& output);
+bool Decompress(std::span<const uint8_t> input, std::vector<uint8_t>& output);
+
+const char* CodecName(uint8_t codec);
+
+}
+}
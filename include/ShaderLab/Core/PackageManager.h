@@ -1,10 +1,9 @@
 #pragma once
 
+#include "ShaderLab/Core/MappedFile.h"
 #include <string>
 #include <vector>
-#if !SHADERLAB_TINY_PLAYER
-#include <map>
-#endif
+#include <span>
 #include <cstdint>
 
 namespace ShaderLab {
@@ -20,24 +19,28 @@ public:
     static PackageManager& Get();
 
     bool Initialize(); // Analyze current executable
+    bool InitializeFromFile(const std::string& packedFilePath); // Analyze any packed file (tools/tests)
     bool IsPacked() const { return m_isPacked; }
 
     // Returns empty vector if not found or error
     std::vector<uint8_t> GetFile(const std::string& path);
+    // Zero-copy view into the mapped pack. Empty if not found or stored compressed.
+    std::span<const uint8_t> GetFileView(const std::string& path) const;
     bool HasFile(const std::string& path) const;
 
 private:
     PackageManager() = default;
 
+    const PackedEntry* FindEntry(const std::string& path) const;
+    void InsertEntry(PackedEntry&& entry);
+    void RebuildIndex();
+
     bool m_initialized = false;
     bool m_isPacked = false;
     std::string m_exePath;
-    uint64_t m_packRequestOffset = 0; // Where the pack data starts in the file
-#if SHADERLAB_TINY_PLAYER
+    MappedFile m_file;
     std::vector<PackedEntry> m_directory;
-#else
-    std::map<std::string, PackedEntry> m_directory;
-#endif
+    std::vector<uint32_t> m_index; // Open-addressed hash slots into m_directory (power-of-two size)
 };
 
 }
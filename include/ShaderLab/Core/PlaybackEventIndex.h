@@ -0,0 +1,38 @@
+#pragma once
+
+#include "ShaderLab/Core/ShaderLabData.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ShaderLab {
+
+// Beat-sorted view of a track's rows. Range queries and next-scene lookups are
+// binary searches instead of scans over every row for every beat, which keeps
+// seeks and stalled frames that span hundreds of beats cheap on long tracks.
+// Rows are referenced by index, so row contents may be edited freely; Sync()
+// rebuilds only when DemoTrack::rowsVersion changes.
+class PlaybackEventIndex {
+public:
+    // Returns true when the index had to be rebuilt.
+    bool Sync(const DemoTrack& track);
+    void Build(const DemoTrack& track);
+    void Clear();
+
+    // Same order as scanning beat by beat over track.rows: ascending beat, then row order.
+    void CollectRows(const DemoTrack& track,
+                     int fromBeatExclusive,
+                     int toBeatInclusive,
+                     std::vector<std::pair<int, const TrackerRow*>>& outRows) const;
+    // First scene row strictly after afterBeat (earliest row order on ties), or null.
+    const TrackerRow* FindNextSceneRow(const DemoTrack& track, int afterBeat) const;
+
+private:
+    std::vector<std::pair<int, uint32_t>> m_rowsByBeat;   // (beat, row index), stable by row index
+    std::vector<std::pair<int, uint32_t>> m_sceneRowsByBeat;
+    uint64_t m_rowsVersion = 0;
+    bool m_built = false;
+};
+
+} // namespace ShaderLab
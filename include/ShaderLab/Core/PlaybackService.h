@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ShaderLab/Audio/AudioClock.h"
+#include "ShaderLab/Core/PlaybackEventIndex.h"
 #include "ShaderLab/Core/ShaderLabData.h"
 
 #include <utility>
@@ -34,9 +36,18 @@ struct SceneTransitionResolution {
     double targetStartBeat = 0.0;
 };
 
+// Keep one instance per track owner: the event index is cached between calls and
+// only rebuilt when the track's rows change.
 class PlaybackService {
 public:
     void AdvanceClock(Transport& transport, double wallNowSeconds, float fallbackDtSeconds) const;
+    // Follows the music clock when the transport's clock source asks for it and `sample` is
+    // valid; otherwise resets the filter and falls back to AdvanceClock.
+    void AdvanceClockFromAudio(Transport& transport,
+                               AudioClockFilter& filter,
+                               const AudioClockSample& sample,
+                               double wallNowSeconds,
+                               float fallbackDtSeconds) const;
     int ComputeCurrentBeat(const Transport& transport, float fallbackBpm) const;
     double BeatToSeconds(double beat, float bpm) const;
     void SeekToBeat(Transport& transport, DemoTrack& track, int beat) const;
@@ -56,6 +67,9 @@ public:
                                                            int currentSceneIndex,
                                                            float currentSceneOffset,
                                                            double currentSceneStartBeat) const;
+
+private:
+    mutable PlaybackEventIndex m_eventIndex;
 };
 
 } // namespace ShaderLab
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "ShaderLab/Core/ShaderLabData.h"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ShaderLab {
+namespace ProjectBinary {
+
+// Compact runtime encoding of ProjectData. project.json stays the authoring format;
+// the build emits this next to it so players can skip JSON parsing and linked-file reads.
+//
+// Layout (little endian). Sections are 4-byte aligned arrays of fixed-size records and all
+// offsets are absolute, so the file is decoded in place from a mapping or a pack view:
+// [ Header ]
+// [ String index: uint32 offset, uint32 length per string (string 0 is empty) ]
+// [ String bytes (deduplicated, shader sources inline) ]
+// [ Scenes ][ Bindings ][ PostFx ][ Compute ][ Audio ][ Track rows ]
+
+constexpr uint32_t kVersion = 1;
+
+bool Encode(const ProjectData& project, std::vector<uint8_t>& output);
+// Fails on a foreign magic, another version or any out-of-range reference.
+bool Decode(std::span<const uint8_t> input, ProjectData& outProject);
+bool IsProjectBinary(std::span<const uint8_t> input);
+
+}
+}
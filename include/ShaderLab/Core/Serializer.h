@@ -1,7 +1,11 @@
 #pragma once
 
 #include "ShaderLab/Core/ShaderLabData.h"
+#include <cstdint>
+#include <functional>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace ShaderLab {
 namespace Serializer {
@@ -11,10 +15,40 @@ namespace Serializer {
         std::string packedPath;
     };
 
+    enum class PackCompression {
+        None,
+        Fast, // LZ4-class, cheap to encode
+        High  // Same bitstream, slower match search for a better ratio
+    };
+
+    struct PackOptions {
+        bool includeProjectManifest = true;
+        PackCompression compression = PackCompression::None;
+        // Threads reading and compressing entries; 0 uses every hardware thread.
+        // Output bytes do not depend on this value.
+        uint32_t workerThreads = 0;
+        // Optional; receives per-entry ratio and decode throughput lines.
+        std::function<void(const std::string&)> log;
+    };
+
+    struct PackStats {
+        size_t entryCount = 0;
+        size_t compressedEntryCount = 0;
+        size_t dedupedEntryCount = 0; // Entries pointing at another entry's bytes
+        uint64_t rawBytes = 0;
+        uint64_t storedBytes = 0;
+        uint64_t dedupSavedBytes = 0;
+    };
+
     bool SaveProject(const ProjectData& project, const std::string& filepath);
     bool LoadProject(const std::string& filepath, ProjectData& outProject);
     bool LoadProjectFromJson(const std::string& jsonContent, ProjectData& outProject); // Helper
 
+    // Runtime binary encoding (see ProjectBinary.h). Shader sources are stored inline.
+    bool SaveProjectBinary(const ProjectData& project, const std::string& filepath);
+    bool LoadProjectBinary(const std::string& filepath, ProjectData& outProject);
+    bool LoadProjectFromBinary(std::span<const uint8_t> data, ProjectData& outProject);
+
     // Asset packing helper: Copies referenced files to 'assets' subdir next to output file and rebases paths
     bool ExportProject(const ProjectData& project, const std::string& outputFile);
 
@@ -29,6 +63,12 @@ namespace Serializer {
                         const std::string& projectJsonPath,
                         const std::vector<PackedExtraFile>& extraFiles,
                         bool includeProjectManifest);
+    bool PackExecutable(const std::string& sourceExe,
+                        const std::string& outputExe,
+                        const std::string& projectJsonPath,
+                        const std::vector<PackedExtraFile>& extraFiles,
+                        const PackOptions& options,
+                        PackStats* outStats = nullptr);
 
 }
 }
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ShaderLab {
+
+struct ShaderBytecodeCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t stores = 0;
+    uint64_t evictions = 0;
+    uint64_t entryCount = 0;
+    uint64_t bytesOnDisk = 0;
+};
+
+// Content-addressed store of compiled shader bytecode, one file per entry under a
+// directory. Entries are written to a temporary file and renamed into place, so a
+// crash never leaves a torn entry behind; anything that fails validation on load
+// is deleted and reported as a miss. The directory is bounded by size and evicts
+// least-recently-used entries (recency survives restarts through file mtimes).
+// All members are safe to call from several threads.
+class ShaderBytecodeCache {
+public:
+    static constexpr uint64_t kDefaultMaxBytes = 256ull * 1024ull * 1024ull;
+
+    struct Key {
+        uint64_t lo = 0;
+        uint64_t hi = 0;
+        bool operator==(const Key& other) const { return lo == other.lo && hi == other.hi; }
+    };
+
+    // Every input that changes the produced bytecode must be part of the key.
+    static Key MakeKey(std::string_view source,
+                       std::string_view entryPoint,
+                       std::string_view target,
+                       uint32_t compileFlags,
+                       std::string_view compilerVersion);
+
+    // The key only covers the source text, so anything that #includes other files
+    // cannot be cached: an edited header would otherwise keep serving stale bytecode.
+    static bool IsCacheableSource(std::string_view source);
+
+    bool Open(const std::string& directory, uint64_t maxBytes = kDefaultMaxBytes);
+    void Close();
+    bool IsOpen() const;
+    std::string GetDirectory() const;
+
+    bool Load(const Key& key, std::vector<uint8_t>& outBytecode);
+    bool Store(const Key& key, std::span<const uint8_t> bytecode);
+
+    ShaderBytecodeCacheStats GetStats() const;
+
+private:
+    struct Entry {
+        uint64_t size = 0;
+        std::list<std::string>::iterator recency;
+    };
+
+    void TouchLocked(Entry& entry);
+    void RemoveLocked(const std::string& name);
+    void EvictLocked();
+
+    mutable std::mutex m_mutex;
+    std::string m_directory;
+    uint64_t m_maxBytes = kDefaultMaxBytes;
+    uint64_t m_totalBytes = 0;
+    uint64_t m_tempCounter = 0;
+    std::list<std::string> m_recency; // Most recently used at the front
+    std::unordered_map<std::string, Entry> m_entries;
+    ShaderBytecodeCacheStats m_stats;
+};
+
+}
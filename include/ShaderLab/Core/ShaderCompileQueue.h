@@ -0,0 +1,107 @@
+#pragma once
+
+#include "ShaderLab/Core/CompilationService.h"
+
+#include <d3d12.h>
+#include <wrl/client.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ShaderLab {
+
+struct ShaderCompileOutput;
+
+// One editor compile. Self-contained: workers never read live scene data.
+struct ShaderCompileRequest {
+    uint64_t target = 0; // What is being compiled (e.g. a scene); newer requests supersede older ones
+    std::string source;
+    std::vector<CompilationTextureBinding> bindings;
+    std::string entryPoint = "main";
+    std::wstring sourceName;
+    ShaderCompileMode mode = ShaderCompileMode::Live;
+    // Runs on the worker after a successful compile, e.g. to create the pipeline state.
+    // Returns false and fills output.error when the bytecode cannot be used.
+    std::function<bool(ShaderCompileOutput&)> finalize;
+};
+
+struct ShaderCompileOutput {
+    uint64_t target = 0;
+    uint64_t generation = 0;
+    std::string source; // The text that was compiled
+    ShaderCompileResult result;
+    Microsoft::WRL::ComPtr<ID3D12PipelineState> pipelineState; // Set by finalize
+    std::string error;  // Finalize failure
+    double compileSeconds = 0.0;
+};
+
+struct ShaderCompileQueueStats {
+    uint64_t submitted = 0;
+    uint64_t coalesced = 0; // Queued requests replaced by a newer one for the same target
+    uint64_t discarded = 0; // Finished compiles whose target had moved on (cancelled or superseded)
+    uint64_t delivered = 0;
+    double lastCompileSeconds = 0.0;
+};
+
+// Compiles editor shaders off the UI thread. Each target has at most one queued request:
+// submitting again replaces it, and a compile already running for that target is
+// superseded, so its result is dropped when it finishes. DXC cannot be interrupted, so
+// cancellation means the result never reaches the caller. Live requests queue ahead of
+// Build requests so an edit never waits behind an optimized recompile. Poll() hands back
+// only the latest generation per target, on the caller's thread, which is where pipeline
+// states are swapped in. With zero workers requests run inline inside Poll(), so a fake
+// ICompilationService drives the queue deterministically.
+class ShaderCompileQueue {
+public:
+    ShaderCompileQueue() = default;
+    ~ShaderCompileQueue();
+
+    ShaderCompileQueue(const ShaderCompileQueue&) = delete;
+    ShaderCompileQueue& operator=(const ShaderCompileQueue&) = delete;
+
+    // The service is used only by the queue's threads (or the Poll caller when inline).
+    void Start(ICompilationService* service, uint32_t workerCount = 1);
+    void Stop();
+
+    // Returns the request's generation.
+    uint64_t Submit(ShaderCompileRequest request);
+    void Cancel(uint64_t target);
+    bool IsPending(uint64_t target) const;
+
+    size_t Poll(std::vector<ShaderCompileOutput>& outResults);
+
+    ShaderCompileQueueStats GetStats() const;
+
+private:
+    struct Job {
+        uint64_t generation = 0;
+        ShaderCompileRequest request;
+    };
+
+    void WorkerLoop();
+    ShaderCompileOutput Run(Job& job);
+    void FinishLocked(ShaderCompileOutput&& output);
+
+    ICompilationService* m_service = nullptr;
+    std::vector<std::thread> m_workers;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    bool m_stopping = false;
+
+    std::deque<Job> m_queue;
+    std::unordered_map<uint64_t, uint64_t> m_latestGeneration; // Per target
+    std::vector<std::pair<uint64_t, uint64_t>> m_running;     // (target, generation) being compiled
+    std::vector<ShaderCompileOutput> m_finished;
+    uint64_t m_nextGeneration = 0;
+    ShaderCompileQueueStats m_stats;
+};
+
+} // namespace ShaderLab
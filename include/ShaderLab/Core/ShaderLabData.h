@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <cstddef>
@@ -22,6 +24,7 @@ struct TextureBinding {
     std::string filePath;
     ComPtr<ID3D12Resource> textureResource;
     bool fileTextureValid = false;
+    uint64_t fileDecodeTicket = 0; // Pending image decode (editor only); 0 when none
     TextureType type = TextureType::Texture2D; 
 };
 
@@ -52,10 +55,26 @@ struct DemoTrack {
     std::vector<TrackerRow> rows;
     int currentBeat = 0;
     int lastTriggeredBeat = -1;
+    // Stamp of the current row layout. Anything that adds or removes rows or changes a row's
+    // beat or scene must call MarkRowsChanged(); PlaybackService rebuilds its event index
+    // only when the stamp differs. Stamps are unique process-wide, so copies of a track
+    // share one only while their rows are identical.
+    uint64_t rowsVersion = 0;
+
+    void MarkRowsChanged() {
+        static std::atomic<uint64_t> s_nextRowsVersion{0};
+        rowsVersion = ++s_nextRowsVersion;
+    }
 };
 
 enum class TransportState { Stopped, Playing, Paused };
 
+// What drives transport.timeSeconds while playing.
+enum class TransportClockSource {
+    AudioDevice, // Music cursor through AudioClockFilter; wall clock while no music plays
+    Wall         // Integrated frame deltas only
+};
+
 struct Transport { // Renamed from PreviewTransport for genera use
     TransportState state = TransportState::Stopped;
     double timeSeconds = 0.0;
@@ -63,6 +82,8 @@ struct Transport { // Renamed from PreviewTransport for genera use
     bool freezeTime = false;
     bool freezeBeat = false;
     float bpm = 140.0f;
+    TransportClockSource clockSource = TransportClockSource::AudioDevice;
+    double audioOriginSeconds = 0.0; // Transport time at which the playing music started
 };
 
 struct Scene {
@@ -153,6 +174,8 @@ struct Scene {
     ComPtr<ID3D12DescriptorHeap> rtvHeap;
     ComPtr<ID3D12PipelineState> pipelineState;
     size_t compiledShaderBytes = 0;
+    bool pipelineOptimized = false; // Live (-Od) pipeline replaced by the background Build compile
+    size_t pipelineSourceHash = 0;   // Source the pipeline was compiled from
     bool textureValid = false;
     bool isDirty = true;
 
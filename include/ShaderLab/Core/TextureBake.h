@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace ShaderLab {
+
+// Shape of a baked texture. Cube sources are a horizontal strip of six square faces in
+// +X, -X, +Y, -Y, +Z, -Z order; 3D sources are a horizontal strip of square depth slices.
+enum class BakedTextureLayout : uint32_t {
+    Texture2D = 0,
+    TextureCube = 1,
+    Texture3D = 2
+};
+
+// Where one subresource sits in the payload. Offsets and row pitches follow the D3D12
+// copy rules, so the payload can be copied into an upload buffer as one block and each
+// subresource copied out with a placed footprint built from these fields.
+struct BakedSubresource {
+    uint64_t offset = 0; // From the start of the payload
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t depth = 0;
+    uint32_t rowPitch = 0;
+};
+
+// A parsed container; `payload` points into the bytes that were parsed.
+struct BakedTextureView {
+    BakedTextureLayout layout = BakedTextureLayout::Texture2D;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t depthOrArraySize = 1; // Depth for 3D, 6 for cubes, 1 otherwise
+    uint32_t mipLevels = 1;
+    // D3D12 subresource order: every mip of array slice 0, then slice 1, ...
+    std::vector<BakedSubresource> subresources;
+    std::span<const uint8_t> payload;
+};
+
+// Build-time conversion of decoded RGBA8 pixels into a GPU-ready container with a full
+// box-filtered mip chain. Holds no GPU state, so the build tooling runs it anywhere.
+namespace TextureBake {
+
+constexpr const char* kExtension = ".sltex";
+constexpr uint32_t kRowPitchAlignment = 256;  // D3D12_TEXTURE_DATA_PITCH_ALIGNMENT
+constexpr uint32_t kPlacementAlignment = 512; // D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT
+
+bool Bake(const uint8_t* rgba, uint32_t width, uint32_t height, BakedTextureLayout layout,
+          std::vector<uint8_t>& outContainer, std::string& outError);
+bool Parse(std::span<const uint8_t> container, BakedTextureView& outView);
+
+uint32_t MipCount(uint32_t width, uint32_t height, uint32_t depth);
+
+} // namespace TextureBake
+
+} // namespace ShaderLab
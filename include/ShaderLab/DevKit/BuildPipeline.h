@@ -65,6 +65,7 @@ struct BuildRequest {
     bool runtimeDebugLog = false;
     bool compactTrackDebugLog = false;
     bool microDeveloperBuild = false;
+    uint32_t workerThreadCount = 0; // Parallel build stages; 0 uses every hardware thread.
     std::unordered_map<std::string, std::vector<std::string>> microUbershaderKeepEntrypointsBySignature;
 };
 
@@ -73,6 +74,11 @@ struct BuildResult {
     bool budgetHit = true;
     uint64_t finalExeBytes = 0;
     uint64_t budgetBytes = 0;
+    uint64_t packDedupSavedBytes = 0;
+    uint64_t shaderMinifySavedBytes = 0; // Micro ubershader module source, before DXC
+    uint32_t texturesBaked = 0;
+    int64_t textureBakeSavedBytes = 0; // Source image bytes minus baked bytes; negative when baking grew them
+    double textureDecodeMsAvoided = 0.0;
     std::string report;
 };
 
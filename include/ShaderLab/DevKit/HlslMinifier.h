@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace ShaderLab {
+
+struct HlslMinifyOptions {
+    bool renameHelpers = true;   // Functions defined in the source, except preserveNames
+    bool renameLocals = true;    // Parameters and local variables
+    bool shortenNumbers = true;  // 0.500 -> .5, 1.0e+03 -> 1e3
+    std::unordered_set<std::string> preserveNames; // Functions called from outside the source (entrypoints, shared helpers)
+    // For sources concatenated into one file: helpers must not take another source's
+    // file-scope names, and nothing may take a name another source #defines.
+    const std::unordered_set<std::string>* reservedGlobalNames = nullptr;
+    const std::unordered_set<std::string>* reservedMacroNames = nullptr;
+};
+
+struct HlslMinifyStats {
+    size_t inputBytes = 0;
+    size_t outputBytes = 0;
+    uint32_t renamedHelpers = 0;
+    uint32_t renamedLocals = 0;
+    uint32_t shortenedNumbers = 0;
+};
+
+// Size-minifies a shader module: renames helpers, parameters and locals to the shortest
+// free names (most used first), shortens float literals and drops whitespace that does not
+// separate tokens. Names the engine binds to (iTime, iChannelN, ...), intrinsics, globals,
+// struct members and anything used by a preprocessor directive keep their spelling.
+// Output depends only on the input and options.
+std::string MinifyHlsl(std::string_view source, const HlslMinifyOptions& options, HlslMinifyStats* outStats = nullptr);
+
+// Adds the names the source declares or uses outside function bodies.
+void CollectHlslFileScopeNames(std::string_view source, std::unordered_set<std::string>& outNames);
+// Adds every identifier used by the source's preprocessor directives.
+void CollectHlslDirectiveNames(std::string_view source, std::unordered_set<std::string>& outNames);
+
+// Names the shader wrapper declares or binds by name: constants, iChannelN, iSamplerN.
+bool IsHlslEngineName(std::string_view name);
+
+// Shortest spelling of a decimal float literal (0.500 -> .5, 1000.0 -> 1e3), or empty when
+// it cannot be shortened. Integers and hex literals are left alone.
+std::string ShortenHlslFloatLiteral(std::string_view text);
+
+} // namespace ShaderLab
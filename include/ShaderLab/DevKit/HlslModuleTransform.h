@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace ShaderLab {
+
+// Everything the pack build does to one module's text, applied from a single token stream.
+struct ModuleSourceTransform {
+    std::string entrypointName;
+    bool remapEntrypoint = false;     // Rename or adapt main/mainImage/... to entrypointName
+    bool scopeLocalFunctions = false; // Prefix helpers with the entrypoint so modules can share one source
+    const std::unordered_set<std::string>* preserveGlobalNames = nullptr;
+    std::vector<std::pair<size_t, size_t>> removeRanges; // Byte ranges [begin, end) on token boundaries
+    bool compact = false;             // Drop comments and collapse whitespace
+};
+
+// Entrypoint remapping: an existing entrypointName definition is kept, otherwise main is
+// renamed, otherwise an adapter calling mainImage/sceneMain/... or the first float4
+// function is appended, and as a last resort a magenta stub.
+std::string TransformModuleSource(const std::string& shaderCode, const ModuleSourceTransform& transform);
+
+struct MicroHelperDedupStats {
+    uint32_t sharedHelpers = 0; // Helpers now defined once for several modules
+    uint32_t removedCopies = 0;
+    size_t bytesBefore = 0;
+    size_t bytesAfter = 0;
+};
+
+// Helpers pasted into several modules (hash21, rot2d, SDF primitives) collapse into the copy
+// in the first module that defines them; later modules drop theirs and call that one, under
+// its name. Two helpers match when their tokens match (name aside), with calls to module
+// helpers compared by what those helpers match. A helper stays per module when it reads a
+// module global, struct or macro, which may differ between modules, or when a different
+// helper, or any module's file-scope or macro name, has its name: that is a real conflict,
+// left to BuildPipeline::AnalyzeMicroUbershaderConflicts. entrypoints[i] is never treated as
+// a helper of modules[i].
+// Returns the shared helper names, which must not be scoped per module.
+std::unordered_set<std::string> DeduplicateMicroHelpers(std::vector<std::string>& modules,
+                                                        const std::vector<std::string>& entrypoints,
+                                                        MicroHelperDedupStats* outStats = nullptr);
+
+} // namespace ShaderLab
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ShaderLab {
+
+enum class HlslTokenKind : uint8_t {
+    Identifier,
+    Number,
+    String,     // "..." or '...'
+    Punctuator, // Operators and brackets; multi-character operators are one token
+    Directive,  // Whole preprocessor line, continuations included
+    Whitespace,
+    Comment
+};
+
+struct HlslToken {
+    HlslTokenKind kind = HlslTokenKind::Whitespace;
+    std::string_view text; // View into the tokenized source
+    uint32_t offset = 0;
+
+    bool IsTrivia() const {
+        return kind == HlslTokenKind::Whitespace || kind == HlslTokenKind::Comment || kind == HlslTokenKind::Directive;
+    }
+    bool Is(std::string_view value) const { return text == value; }
+};
+
+// Lexes HLSL source once. Tokens cover every byte of the source, so transforms can
+// rewrite it losslessly; the "code" view skips whitespace, comments and directives.
+// The source must outlive the stream.
+class HlslTokenStream {
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    explicit HlslTokenStream(std::string_view source);
+
+    std::string_view Source() const { return m_source; }
+    const std::vector<HlslToken>& Tokens() const { return m_tokens; }
+
+    size_t CodeCount() const { return m_code.size(); }
+    const HlslToken& Code(size_t codeIndex) const { return m_tokens[m_code[codeIndex]]; }
+    size_t TokenIndex(size_t codeIndex) const { return m_code[codeIndex]; }
+    bool CodeIs(size_t codeIndex, std::string_view value) const {
+        return codeIndex < m_code.size() && Code(codeIndex).text == value;
+    }
+
+    // Code index of the bracket matching the (, [ or { / ), ] or } at codeIndex, or npos.
+    size_t MatchingBracket(size_t codeIndex) const { return m_match[codeIndex]; }
+    // Number of enclosing { } around the code token; braces count as outside themselves.
+    uint32_t BraceDepth(size_t codeIndex) const { return m_braceDepth[codeIndex]; }
+
+private:
+    std::string_view m_source;
+    std::vector<HlslToken> m_tokens;
+    std::vector<uint32_t> m_code;
+    std::vector<size_t> m_match;
+    std::vector<uint32_t> m_braceDepth;
+};
+
+// A function definition at file scope. Indices are code indices into the stream.
+struct HlslFunction {
+    size_t returnType = HlslTokenStream::npos;
+    size_t name = HlslTokenStream::npos;
+    size_t openParen = HlslTokenStream::npos;
+    size_t closeParen = HlslTokenStream::npos;
+    size_t openBrace = HlslTokenStream::npos;
+    size_t closeBrace = HlslTokenStream::npos;
+};
+
+// Definitions only: prototypes, struct members and calls are skipped. An output semantic
+// between the parameter list and the body (": SV_Target") is allowed.
+std::vector<HlslFunction> FindHlslFunctions(const HlslTokenStream& stream);
+
+// True when the identifier at codeIndex is used as a free function name: followed by '('
+// and not a member access.
+bool IsHlslFreeCall(const HlslTokenStream& stream, size_t codeIndex);
+
+// Collects edits against a token stream and writes the result in one pass. Indices are
+// token indices (HlslTokenStream::TokenIndex). Later edits to the same token win.
+class HlslRewriter {
+public:
+    enum class Layout {
+        Preserve, // Untouched tokens and trivia are copied verbatim
+        Compact,  // Comments dropped, whitespace runs collapsed to one space, directives kept on their own lines
+        Minimal   // Like Compact, but a space is kept only where the neighbouring tokens would otherwise merge
+    };
+
+    explicit HlslRewriter(const HlslTokenStream& stream) : m_stream(stream) {}
+
+    void Replace(size_t tokenIndex, std::string text);
+    void Remove(size_t firstToken, size_t lastToken); // Inclusive
+    void Append(std::string text);
+
+    std::string Emit(Layout layout) const;
+
+private:
+    struct Edit {
+        size_t first = 0;
+        size_t last = 0;
+        std::string text;
+    };
+
+    const HlslTokenStream& m_stream;
+    std::vector<Edit> m_edits;
+    std::string m_append;
+};
+
+} // namespace ShaderLab
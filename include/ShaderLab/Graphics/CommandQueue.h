@@ -1,10 +1,12 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
 #include <d3d12.h>
 #include <wrl/client.h>
+#include "ShaderLab/Graphics/FrameFenceRing.h"
 
 namespace ShaderLab {
 
@@ -14,28 +16,51 @@ class Device;
 
 class CommandQueue {
 public:
+    static constexpr uint32_t kMaxFramesInFlight = FrameFenceRing::kMaxFramesInFlight;
+
     CommandQueue();
     ~CommandQueue();
 
-    bool Initialize(Device* device, D3D12_COMMAND_LIST_TYPE type);
+    // framesInFlight is clamped to [1, kMaxFramesInFlight]; each frame slot owns an allocator.
+    bool Initialize(Device* device, D3D12_COMMAND_LIST_TYPE type, uint32_t framesInFlight = 1);
     void Shutdown();
 
     ID3D12CommandQueue* GetQueue() const { return m_queue.Get(); }
     ID3D12GraphicsCommandList* GetCommandList() const { return m_commandList.Get(); }
+    uint32_t GetFramesInFlight() const { return m_frameRing.GetFramesInFlight(); }
+    uint32_t GetFrameSlot() const { return m_frameRing.GetCurrentSlot(); }
 
+    // Waits until the current slot's previous frame has finished. Call once per frame before CPU
+    // work that may touch resources the GPU reads (uploads, descriptor writes, releases);
+    // ResetCommandList begins the frame itself only if the caller has not.
+    void BeginFrame();
     void ResetCommandList();
     void ExecuteCommandList();
+    // Signals the fence for the submitted frame and advances to the next slot without waiting.
+    uint64_t EndFrame();
     void WaitForGPU();
     uint64_t SignalFence();
+    uint64_t GetCompletedFenceValue() const;
+
+    // Keeps an object alive until the GPU has finished the frame currently being recorded. Use
+    // for textures, descriptor heaps and pipelines that are replaced while frames in flight may
+    // still reference them.
+    void RetireWhenComplete(ComPtr<IUnknown> object);
 
 private:
+    void WaitForFenceValue(uint64_t fenceValue);
+
     ComPtr<ID3D12CommandQueue> m_queue;
-    ComPtr<ID3D12CommandAllocator> m_commandAllocator;
+    ComPtr<ID3D12CommandAllocator> m_commandAllocators[kMaxFramesInFlight];
     ComPtr<ID3D12GraphicsCommandList> m_commandList;
     ComPtr<ID3D12Fence> m_fence;
 
     uint64_t m_fenceValue = 0;
     HANDLE m_fenceEvent = nullptr;
+    FrameFenceRing m_frameRing;
+    bool m_frameBegun = false;
+    std::vector<ComPtr<IUnknown>> m_retiredThisFrame;
+    FenceRetireQueue<ComPtr<IUnknown>> m_retired;
 };
 
 } // namespace ShaderLab
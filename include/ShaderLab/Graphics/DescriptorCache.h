@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ShaderLab {
+
+enum class DescriptorViewKind : uint8_t {
+    Texture2D,
+    TextureCube,
+    Texture3D,
+    RWTexture2D,
+    ConstantBuffer
+};
+
+// One descriptor of a table. `source` identifies the viewed resource (0 = null view);
+// two bindings with equal fields produce identical descriptors.
+struct DescriptorBinding {
+    uint64_t source = 0;
+    uint32_t detail = 0; // DXGI_FORMAT for texture views, byte size for constant buffers
+    DescriptorViewKind kind = DescriptorViewKind::Texture2D;
+
+    bool operator==(const DescriptorBinding& other) const {
+        return source == other.source && detail == other.detail && kind == other.kind;
+    }
+    bool operator!=(const DescriptorBinding& other) const { return !(*this == other); }
+};
+
+// Creates views in the shader-visible heap the cache manages. The D3D12 implementation
+// lives in Dx12DescriptorCache; a counting fake is enough to drive the cache without a device.
+class IDescriptorWriter {
+public:
+    virtual ~IDescriptorWriter() = default;
+    virtual void WriteDescriptor(uint32_t heapIndex, const DescriptorBinding& binding) = 0;
+    // The range no longer backs any table; drop whatever the writer keeps for it.
+    virtual void ReleaseDescriptors(uint32_t firstIndex, uint32_t count) = 0;
+};
+
+struct DescriptorCacheStats {
+    uint32_t descriptorWrites = 0;
+    uint32_t tableHits = 0;      // Stable table already held the requested views
+    uint32_t tableMisses = 0;    // Stable table created or rewritten
+    uint32_t ringTables = 0;     // Tables written to the ring (dynamic, or stable copy still in use)
+    uint32_t failedTables = 0;   // No room in either region
+    uint32_t stableTables = 0;   // Live stable tables at the end of the frame
+    uint32_t ringDescriptorsInUse = 0;
+};
+
+// Descriptor allocation for one shader-visible heap, split into two regions:
+//  - stable tables, keyed by the caller and rewritten only when a bound view changes;
+//  - a ring for tables that are only valid for the current frame.
+// A stable table that the GPU may still read (used this frame or by a frame in flight)
+// is never rewritten in place; the changed table goes to the ring instead, and the
+// stable copy is refreshed on a later frame. Ring space is reclaimed framesInFlight
+// frames after it was written. Holds no GPU state; all writes go through the writer.
+class DescriptorCache {
+public:
+    static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+    static constexpr uint32_t kMaxIdleFrames = 120;
+
+    void Initialize(IDescriptorWriter* writer, uint32_t stableCapacity, uint32_t ringCapacity);
+    void Reset();
+
+    // Call once per frame after the frame slot has been waited on.
+    void BeginFrame(uint32_t framesInFlight);
+
+    // Heap index of a table holding `bindings`, or kInvalidIndex when both regions are full.
+    uint32_t AcquireTable(uint64_t key, const DescriptorBinding* bindings, uint32_t count);
+    uint32_t AllocateDynamic(const DescriptorBinding* bindings, uint32_t count);
+
+    // Mixes an owner address and a variant (e.g. a history phase) into a table key.
+    static uint64_t MakeKey(const void* owner, uint32_t variant);
+
+    uint32_t GetCapacity() const { return m_stableCapacity + m_ringCapacity; }
+    const DescriptorCacheStats& GetStats() const { return m_stats; }
+    // Stats of the last completed frame, for display.
+    const DescriptorCacheStats& GetLastFrameStats() const { return m_lastFrameStats; }
+
+private:
+    struct Table {
+        uint32_t first = 0;
+        uint64_t lastUsedFrame = 0;
+        std::vector<DescriptorBinding> bindings;
+    };
+
+    bool IsInFlight(uint64_t frame) const { return frame + m_framesInFlight > m_frameIndex; }
+    uint32_t AllocateStable(uint32_t count);
+    void FreeStable(uint32_t first, uint32_t count);
+    uint32_t AllocateRing(uint32_t count);
+    void RetireRing();
+    void ReleaseRingRange(uint64_t begin, uint64_t end);
+
+    IDescriptorWriter* m_writer = nullptr;
+    uint32_t m_stableCapacity = 0;
+    uint32_t m_ringCapacity = 0;
+    uint32_t m_framesInFlight = 1;
+    uint64_t m_frameIndex = 1;
+
+    std::unordered_map<uint64_t, Table> m_tables;
+    std::vector<std::pair<uint32_t, uint32_t>> m_freeRanges; // (first, count), sorted by first
+
+    // Ring positions grow monotonically; the heap index is m_stableCapacity + position % capacity.
+    uint64_t m_ringHead = 0;
+    uint64_t m_ringTail = 0;
+    std::deque<std::pair<uint64_t, uint64_t>> m_ringFrames; // (frame, head at frame end)
+
+    DescriptorCacheStats m_stats;
+    DescriptorCacheStats m_lastFrameStats;
+};
+
+} // namespace ShaderLab
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "ShaderLab/Graphics/DescriptorCache.h"
+
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <vector>
+
+using Microsoft::WRL::ComPtr;
+
+namespace ShaderLab {
+
+class Device;
+
+// Shader-visible CBV/SRV/UAV heap driven by a DescriptorCache. Every resource a
+// descriptor points at is referenced until that descriptor is released, so a
+// destroyed texture can never be recycled at an address a cached table still
+// compares equal to.
+class Dx12DescriptorCache final : public IDescriptorWriter {
+public:
+    static constexpr uint32_t kDefaultStableDescriptors = 1024;
+    static constexpr uint32_t kDefaultRingDescriptors = 1024;
+
+    bool Initialize(Device* device,
+                    uint32_t stableDescriptors = kDefaultStableDescriptors,
+                    uint32_t ringDescriptors = kDefaultRingDescriptors);
+    void Shutdown();
+    bool IsInitialized() const { return m_heap != nullptr; }
+
+    void BeginFrame(uint32_t framesInFlight) { m_cache.BeginFrame(framesInFlight); }
+
+    // Stable table for `key`; false when the heap is full.
+    bool AcquireTable(uint64_t key, const DescriptorBinding* bindings, uint32_t count, D3D12_GPU_DESCRIPTOR_HANDLE& outTable);
+    // Table valid for the current frame only.
+    bool AllocateDynamic(const DescriptorBinding* bindings, uint32_t count, D3D12_GPU_DESCRIPTOR_HANDLE& outTable);
+
+    ID3D12DescriptorHeap* GetHeap() const { return m_heap.Get(); }
+    const DescriptorCacheStats& GetLastFrameStats() const { return m_cache.GetLastFrameStats(); }
+
+    static DescriptorBinding TextureView(ID3D12Resource* resource,
+                                         DescriptorViewKind kind = DescriptorViewKind::Texture2D,
+                                         DXGI_FORMAT format = DXGI_FORMAT_R8G8B8A8_UNORM);
+    static DescriptorBinding ConstantBufferView(ID3D12Resource* buffer, uint32_t sizeInBytes);
+
+    void WriteDescriptor(uint32_t heapIndex, const DescriptorBinding& binding) override;
+    void ReleaseDescriptors(uint32_t firstIndex, uint32_t count) override;
+
+private:
+    D3D12_GPU_DESCRIPTOR_HANDLE GpuHandle(uint32_t heapIndex) const;
+
+    ID3D12Device* m_device = nullptr;
+    ComPtr<ID3D12DescriptorHeap> m_heap;
+    D3D12_CPU_DESCRIPTOR_HANDLE m_cpuStart = {};
+    D3D12_GPU_DESCRIPTOR_HANDLE m_gpuStart = {};
+    uint32_t m_step = 0;
+    std::vector<ComPtr<ID3D12Resource>> m_referenced; // One per heap descriptor
+    DescriptorCache m_cache;
+};
+
+} // namespace ShaderLab
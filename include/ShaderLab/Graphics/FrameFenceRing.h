@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <utility>
+
+namespace ShaderLab {
+
+// Bookkeeping for N frames in flight, independent of any graphics API: the owner
+// signals a monotonically increasing fence after each frame and reports how far
+// the GPU has got. Each slot remembers the value its last submission signalled,
+// so slot resources (command allocators, per-frame buffers) may be reused once
+// the fence has reached that value.
+class FrameFenceRing {
+public:
+    static constexpr uint32_t kMaxFramesInFlight = 4;
+
+    explicit FrameFenceRing(uint32_t framesInFlight = 1) { Reset(framesInFlight); }
+
+    void Reset(uint32_t framesInFlight) {
+        m_framesInFlight = framesInFlight < 1 ? 1 : (framesInFlight > kMaxFramesInFlight ? kMaxFramesInFlight : framesInFlight);
+        m_currentSlot = 0;
+        for (uint64_t& value : m_slotFenceValues) {
+            value = 0;
+        }
+    }
+
+    uint32_t GetFramesInFlight() const { return m_framesInFlight; }
+    uint32_t GetCurrentSlot() const { return m_currentSlot; }
+
+    // Fence value the current slot must reach before it is recorded into again (0 = unused slot).
+    uint64_t GetSlotWaitValue() const { return m_slotFenceValues[m_currentSlot]; }
+
+    // Records the value signalled after the current slot's submission and moves to the next slot.
+    void EndFrame(uint64_t signalledValue) {
+        m_slotFenceValues[m_currentSlot] = signalledValue;
+        m_currentSlot = (m_currentSlot + 1) % m_framesInFlight;
+    }
+
+private:
+    uint32_t m_framesInFlight = 1;
+    uint32_t m_currentSlot = 0;
+    uint64_t m_slotFenceValues[kMaxFramesInFlight] = {};
+};
+
+// Objects that the GPU may still reference, each tagged with the fence value after
+// which it is safe to destroy. Payload destructors do the releasing (ComPtr, etc.).
+template <typename Payload>
+class FenceRetireQueue {
+public:
+    // Fence values must be pushed in non-decreasing order, which holds for a single queue.
+    void Push(uint64_t fenceValue, Payload payload) {
+        m_entries.emplace_back(fenceValue, std::move(payload));
+    }
+
+    // Destroys every payload whose fence value is <= completedValue; returns how many.
+    size_t Collect(uint64_t completedValue) {
+        size_t released = 0;
+        while (!m_entries.empty() && m_entries.front().first <= completedValue) {
+            m_entries.pop_front();
+            ++released;
+        }
+        return released;
+    }
+
+    void Clear() { m_entries.clear(); }
+    size_t Size() const { return m_entries.size(); }
+
+private:
+    std::deque<std::pair<uint64_t, Payload>> m_entries;
+};
+
+} // namespace ShaderLab
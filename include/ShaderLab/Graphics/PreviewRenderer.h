@@ -10,6 +10,7 @@ using Microsoft::WRL::ComPtr;
 
 namespace ShaderLab {
 
+class CommandQueue;
 class Device;
 class ShaderCompiler;
 struct ShaderCompileResult;
@@ -40,6 +41,10 @@ public:
     // Create pipeline state from pre-compiled bytecode
     ComPtr<ID3D12PipelineState> CreatePSOFromBytecode(const std::vector<uint8_t>& psBytecode);
 
+    // Call once per frame after the queue has begun it: reads back the GPU time recorded the last
+    // time this frame slot was used, which that wait guarantees has been resolved.
+    void BeginFrame(CommandQueue* queue);
+
     // Render to the specified render target using specific PSO
     void Render(ID3D12GraphicsCommandList* commandList,
                 ID3D12PipelineState* pipelineState,
@@ -76,9 +81,10 @@ private:
     
     std::vector<uint8_t> m_vertexShaderBytecode;
 
-    // Timestamp queries
+    // Timestamp queries: a start/end pair and a readback region per frame slot
     ComPtr<ID3D12QueryHeap> m_queryHeap;
     ComPtr<ID3D12Resource> m_queryResultBuffer;
+    uint32_t m_queryFrameSlot = 0;
     uint64_t m_gpuFrequency = 0;
     float m_lastGPUTimeMs = 0.0f;
     size_t m_lastCompiledPixelShaderSize = 0;
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ShaderLab {
+
+struct SceneRenderGraphStats {
+    uint32_t passesRequested = 0; // Scheduled passes this frame, including repeats
+    uint32_t passesRendered = 0;
+    uint32_t passesSkipped = 0;   // Already rendered this frame at the same scene time
+    uint32_t graphRebuilds = 0;   // Lifetime count
+    uint32_t cycleEdges = 0;      // Bindings ignored because they close a cycle
+};
+
+// Frame graph over scene-to-scene texture bindings. It holds no GPU state, only
+// scene indices. The graph is rebuilt only when the binding edges change; that
+// rebuild also finds cycle edges, so rendering needs no cycle checks. For each
+// root it gives a dependencies-first schedule of the reachable scenes. Within a
+// frame, a scene already rendered at the same time is skipped, so a scene
+// shared by several consumers renders once.
+class SceneRenderGraph {
+public:
+    // dependencies[i] lists the scenes sampled by scene i, in binding order. Returns true
+    // when the graph was rebuilt.
+    bool Sync(const std::vector<std::vector<int>>& dependencies);
+
+    // Dependencies-first order of every scene reachable from root, root last. Edges that
+    // lead back into the current path are dropped, matching the old recursive walk.
+    const std::vector<int>& GetSchedule(int root);
+
+    void BeginFrame();
+    // True when the pass must be recorded; false when it already ran this frame at `time`.
+    bool BeginPass(int sceneIndex, double time);
+
+    const std::vector<std::pair<int, int>>& GetCycleEdges() const { return m_cycleEdges; }
+    const SceneRenderGraphStats& GetStats() const { return m_stats; }
+    // Stats of the last completed frame, for display.
+    const SceneRenderGraphStats& GetLastFrameStats() const { return m_lastFrameStats; }
+
+private:
+    void FindCycleEdges();
+
+    std::vector<std::vector<int>> m_dependencies;
+    std::vector<std::pair<int, int>> m_cycleEdges;
+    std::unordered_map<int, std::vector<int>> m_schedules;
+    std::vector<double> m_renderedTime;
+    std::vector<uint8_t> m_renderedThisFrame;
+    SceneRenderGraphStats m_stats;
+    SceneRenderGraphStats m_lastFrameStats;
+    bool m_built = false;
+};
+
+} // namespace ShaderLab
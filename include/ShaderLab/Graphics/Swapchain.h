@@ -33,6 +33,7 @@ public:
 
     uint32_t GetWidth() const { return m_width; }
     uint32_t GetHeight() const { return m_height; }
+    CommandQueue* GetCommandQueue() const { return m_commandQueue; }
 
 private:
     void CreateRenderTargetViews();
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "ShaderLab/Core/TextureBake.h"
+#include "ShaderLab/Graphics/UploadRingAllocator.h"
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+
+using Microsoft::WRL::ComPtr;
+
+namespace ShaderLab {
+
+class Device;
+
+struct TextureUploadStats {
+    uint64_t texturesUploaded = 0;
+    uint64_t submissions = 0;
+    uint64_t bytesStaged = 0;
+    uint64_t stagingStalls = 0;    // Waits for older copies to free staging space
+    uint64_t dedicatedUploads = 0; // Textures larger than the whole staging buffer
+};
+
+// Uploads textures through one persistent, mapped staging buffer on a dedicated
+// copy queue. Queued textures are recorded into a single command list and sent
+// together by Submit(); Poll() runs each texture's callback once the copy fence
+// has passed, so the texture can be bound from that frame on without any GPU
+// wait on the graphics queue. Textures are created in COMMON state: the copy
+// queue promotes them to COPY_DEST, they decay back afterwards, and graphics
+// work promotes them to a shader-resource state on first read.
+class TextureUploadQueue {
+public:
+    using ReadyCallback = std::function<void(ID3D12Resource*)>;
+    static constexpr uint64_t kDefaultStagingBytes = 64ull * 1024ull * 1024ull;
+
+    TextureUploadQueue() = default;
+    ~TextureUploadQueue();
+
+    TextureUploadQueue(const TextureUploadQueue&) = delete;
+    TextureUploadQueue& operator=(const TextureUploadQueue&) = delete;
+
+    bool Initialize(Device* device, uint64_t stagingBytes = kDefaultStagingBytes);
+    // Waits for copies in flight; callbacks of unfinished work are dropped.
+    void Shutdown();
+    bool IsInitialized() const { return m_queue != nullptr; }
+
+    // Creates an RGBA8 texture and stages its pixels for the next Submit().
+    bool QueueTexture2D(const void* rgba, uint32_t width, uint32_t height,
+                        ComPtr<ID3D12Resource>& outTexture, ReadyCallback onReady = nullptr);
+    // Creates the texture a baked container describes (all mips, cube faces or depth slices).
+    // The payload is already in copy layout, so it is staged with a single memcpy.
+    bool QueueBakedTexture(const BakedTextureView& baked,
+                           ComPtr<ID3D12Resource>& outTexture, ReadyCallback onReady = nullptr);
+    // Sends every queued copy as one command list; returns its fence value (0 = nothing queued).
+    uint64_t Submit();
+    // Runs callbacks of finished submissions, in submission order, and reclaims staging space.
+    void Poll();
+    // Submit, wait for all copies, Poll.
+    void Flush();
+
+    size_t GetInFlightCount() const { return m_inFlight.size(); }
+    const TextureUploadStats& GetStats() const { return m_stats; }
+
+private:
+    struct Upload {
+        ComPtr<ID3D12Resource> texture;
+        ReadyCallback onReady;
+    };
+    struct Batch {
+        uint64_t fenceValue = 0;
+        ComPtr<ID3D12CommandAllocator> allocator;
+        std::vector<Upload> uploads;
+        std::vector<ComPtr<ID3D12Resource>> dedicatedBuffers;
+    };
+
+    bool EnsureRecording();
+    uint64_t AllocateStaging(uint64_t size);
+    // Staging space for one texture: ring space, or a dedicated buffer when it would not fit.
+    // outBaseOffset is where the bytes start inside outSource.
+    bool AcquireStaging(uint64_t size, ID3D12Resource*& outSource, uint8_t*& outDestination, uint64_t& outBaseOffset);
+    // Records one copy per subresource from `source`; on failure nothing is recorded.
+    bool RecordTextureCopies(ID3D12Resource* source, ComPtr<ID3D12Resource>& texture,
+                             const D3D12_PLACED_SUBRESOURCE_FOOTPRINT* footprints, uint32_t count,
+                             uint64_t stagedBytes, ReadyCallback onReady);
+    void WaitForFenceValue(uint64_t fenceValue);
+
+    Device* m_device = nullptr;
+    ComPtr<ID3D12CommandQueue> m_queue;
+    ComPtr<ID3D12GraphicsCommandList> m_commandList;
+    ComPtr<ID3D12Fence> m_fence;
+    HANDLE m_fenceEvent = nullptr;
+    uint64_t m_fenceValue = 0;
+
+    ComPtr<ID3D12Resource> m_staging;
+    uint8_t* m_stagingMapped = nullptr;
+    UploadRingAllocator m_ring;
+
+    bool m_recording = false;
+    Batch m_open;
+    std::deque<Batch> m_inFlight;
+    std::vector<ComPtr<ID3D12CommandAllocator>> m_freeAllocators;
+    TextureUploadStats m_stats;
+};
+
+} // namespace ShaderLab
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace ShaderLab {
+
+// Textures are interchangeable only when every field matches. format and flags
+// carry DXGI_FORMAT / D3D12_RESOURCE_FLAGS values, kept as integers so the
+// planner builds and tests without D3D12 headers.
+struct TransientTextureKey {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t format = 0;
+    uint32_t flags = 0;
+
+    bool operator==(const TransientTextureKey& other) const {
+        return width == other.width && height == other.height &&
+               format == other.format && flags == other.flags;
+    }
+    bool operator!=(const TransientTextureKey& other) const { return !(*this == other); }
+};
+
+// One transient texture, alive from the start of firstPass to the end of lastPass.
+struct TransientTextureRequest {
+    TransientTextureKey key;
+    uint64_t bytes = 0;
+    uint32_t firstPass = 0;
+    uint32_t lastPass = 0;
+};
+
+struct TransientTexturePlan {
+    std::vector<uint32_t> slotOfRequest;   // Physical texture each request maps to
+    std::vector<TransientTextureKey> slotKeys;
+    std::vector<uint64_t> slotBytes;
+    uint64_t naiveBytes = 0;  // One texture per request
+    uint64_t pooledBytes = 0; // Sum of physical textures
+};
+
+// Assigns requests to physical textures so that requests with the same key and
+// disjoint lifetimes share memory. Greedy by first pass, which is optimal for
+// interval lifetimes within a key.
+TransientTexturePlan PlanTransientTextures(const std::vector<TransientTextureRequest>& requests);
+
+} // namespace ShaderLab
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "ShaderLab/Graphics/TransientTexturePlanner.h"
+
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <vector>
+
+using Microsoft::WRL::ComPtr;
+
+namespace ShaderLab {
+
+class CommandQueue;
+class Device;
+
+// Recycles intermediate render targets (post-FX ping-pong, compute outputs)
+// between passes instead of keeping a private pair per scene. A texture
+// released by one pass is handed to the next pass that asks for the same key
+// within the frame; single-queue ordering plus the callers' state transitions
+// make that reuse safe. Textures idle for kMaxIdleFrames leave the pool and are
+// retired through the command queue, which frees them once every frame that
+// could still reference them has completed.
+class TransientTexturePool {
+public:
+    static constexpr uint32_t kMaxIdleFrames = 120;
+
+    void Initialize(Device* device) { m_device = device; }
+    void Shutdown();
+
+    // Returns a texture in PIXEL_SHADER_RESOURCE state that no other pass holds, or null.
+    ID3D12Resource* Acquire(uint32_t width, uint32_t height, DXGI_FORMAT format, D3D12_RESOURCE_FLAGS flags);
+    // Returns false for textures the pool does not own (scene outputs, history textures).
+    bool Release(ID3D12Resource* texture);
+    // Frame boundary: releases everything still held and retires idle textures to queue.
+    void BeginFrame(CommandQueue* queue);
+
+    uint64_t GetAllocatedBytes() const { return m_allocatedBytes; }
+    uint64_t GetPeakAllocatedBytes() const { return m_peakAllocatedBytes; }
+    size_t GetTextureCount() const { return m_entries.size(); }
+
+private:
+    struct Entry {
+        ComPtr<ID3D12Resource> texture;
+        TransientTextureKey key;
+        uint64_t bytes = 0;
+        uint64_t lastUsedFrame = 0;
+        bool inUse = false;
+    };
+
+    Device* m_device = nullptr;
+    std::vector<Entry> m_entries;
+    uint64_t m_frameIndex = 0;
+    uint64_t m_allocatedBytes = 0;
+    uint64_t m_peakAllocatedBytes = 0;
+};
+
+} // namespace ShaderLab
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <utility>
+
+namespace ShaderLab {
+
+// Byte ranges of a persistent staging buffer, handed out in submission order and
+// reclaimed by fence value. Allocations made since the last Submit() belong to
+// the submission tagged there; Retire() frees every submission the GPU has
+// finished. No GPU state is held, so a simulated fence can drive it.
+class UploadRingAllocator {
+public:
+    static constexpr uint64_t kInvalidOffset = UINT64_MAX;
+
+    void Reset(uint64_t capacity);
+
+    // Offset of `size` bytes aligned to `alignment` (a power of two), or kInvalidOffset when
+    // the free space cannot hold it until older submissions retire.
+    uint64_t Allocate(uint64_t size, uint64_t alignment);
+    // Tags everything allocated since the previous call with fenceValue (non-decreasing).
+    void Submit(uint64_t fenceValue);
+    // Frees submissions whose fence value is <= completedFenceValue.
+    void Retire(uint64_t completedFenceValue);
+
+    uint64_t GetCapacity() const { return m_capacity; }
+    uint64_t GetUsedBytes() const { return m_head - m_tail; }
+    bool HasPendingAllocations() const { return m_head != m_submittedHead; }
+    // Fence value whose completion frees the oldest in-flight submission (0 = none).
+    uint64_t GetOldestFenceValue() const { return m_submissions.empty() ? 0 : m_submissions.front().first; }
+
+private:
+    uint64_t m_capacity = 0;
+    // Positions grow monotonically; the buffer offset is position % capacity.
+    uint64_t m_head = 0;
+    uint64_t m_tail = 0;
+    uint64_t m_submittedHead = 0;
+    std::deque<std::pair<uint64_t, uint64_t>> m_submissions; // (fence value, head at submit)
+};
+
+} // namespace ShaderLab
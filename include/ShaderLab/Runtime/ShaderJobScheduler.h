@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ShaderLab {
+
+enum class ShaderJobKind : uint8_t {
+    Scene,
+    PostFx,
+    Compute,
+    Transition
+};
+
+// Self-contained description of one shader; workers never read live project data.
+struct ShaderJob {
+    ShaderJobKind kind = ShaderJobKind::Scene;
+    int sceneIndex = -1;
+    int effectIndex = -1;        // Post-FX / compute index within the scene
+    std::string label;           // Scene or effect name, transition stem
+    std::string precompiledPath; // Packed or on-disk bytecode
+    std::string sourceCode;      // Runtime compile fallback when no bytecode exists
+    std::string entryPoint;
+};
+
+struct ShaderJobResult {
+    bool success = false;
+    std::vector<uint8_t> bytecode;
+    std::string error;
+};
+
+// Produces bytecode for a job. Called concurrently from worker threads, so
+// implementations must not touch render-thread or device state.
+class IShaderJobCompiler {
+public:
+    virtual ~IShaderJobCompiler() = default;
+    virtual ShaderJobResult Compile(const ShaderJob& job) = 0;
+};
+
+// Fans shader jobs out to worker threads and hands results back to the caller
+// in submission order, so pipeline creation order does not depend on timing.
+// With zero workers every job runs inline inside Poll(), which lets a fake
+// compiler drive the scheduler deterministically without threads.
+class ShaderJobScheduler {
+public:
+    struct Completed {
+        ShaderJob job;
+        ShaderJobResult result;
+    };
+
+    ShaderJobScheduler() = default;
+    ~ShaderJobScheduler();
+
+    ShaderJobScheduler(const ShaderJobScheduler&) = delete;
+    ShaderJobScheduler& operator=(const ShaderJobScheduler&) = delete;
+
+    // Cancels any running batch before starting the new one.
+    void Start(IShaderJobCompiler* compiler, std::vector<ShaderJob> jobs, uint32_t workerCount);
+    // Moves up to maxResults finished jobs, in submission order, into outCompleted.
+    size_t Poll(std::vector<Completed>& outCompleted, size_t maxResults);
+    // Drops jobs that have not started and waits for running ones; their results are discarded.
+    void Cancel();
+
+    size_t TotalCount() const { return m_jobs.size(); }
+    size_t DeliveredCount() const { return m_nextDeliver; }
+    bool IsCancelled() const { return m_cancelled.load(); }
+    bool IsFinished() const { return IsCancelled() || m_nextDeliver >= m_jobs.size(); }
+
+    // Leaves one hardware thread for the render loop.
+    static uint32_t DefaultWorkerCount();
+
+private:
+    void WorkerLoop();
+    void JoinWorkers();
+
+    IShaderJobCompiler* m_compiler = nullptr;
+    std::vector<ShaderJob> m_jobs;
+    std::vector<ShaderJobResult> m_results;
+    std::vector<uint8_t> m_ready;
+    size_t m_nextJob = 0;
+    size_t m_nextDeliver = 0;
+    std::atomic<bool> m_cancelled{false};
+    std::mutex m_mutex;
+    std::vector<std::thread> m_workers;
+};
+
+} // namespace ShaderLab
@@ -63,6 +63,11 @@ public:
                                           const std::wstring& sourceName = L"shader.hlsl",
                                           ShaderCompileMode mode = ShaderCompileMode::Live);
 
+    // DXC version and commit, e.g. "dxc 1.8 (4640, 2b3a8d...)"; empty until Initialize succeeds.
+    const std::string& GetCompilerVersion() const { return m_versionString; }
+    // Argument line used for a mode, minus entry point and target. Part of bytecode cache keys.
+    std::string GetCompileArgumentsText(ShaderCompileMode mode);
+
 private:
     using DxcCreateInstanceProc = HRESULT (WINAPI*)(REFCLSID, REFIID, LPVOID*);
 
@@ -76,6 +81,7 @@ private:
     ComPtr<IDxcIncludeHandler> m_includeHandler;
     HMODULE m_dxcModule = nullptr;
     DxcCreateInstanceProc m_dxcCreateInstance = nullptr;
+    std::string m_versionString;
 };
 
 } // namespace ShaderLab
@@ -15,6 +15,13 @@
 #include "TextEditor.h"
 #include "ShaderLab/DevKit/BuildPipeline.h"
 #include "ShaderLab/Core/ShaderLabData.h"
+#include "ShaderLab/Core/ImageDecodePool.h"
+#include "ShaderLab/Core/PlaybackService.h"
+#include "ShaderLab/Core/ShaderBytecodeCache.h"
+#include "ShaderLab/Core/ShaderCompileQueue.h"
+#include "ShaderLab/Graphics/Dx12DescriptorCache.h"
+#include "ShaderLab/Graphics/SceneRenderGraph.h"
+#include "ShaderLab/Graphics/TextureUploadQueue.h"
 
 using Microsoft::WRL::ComPtr;
 
@@ -195,8 +202,21 @@ private:
     void CreatePreviewTexture(uint32_t width, uint32_t height);
     void CreateTitlebarIconTexture();
     void CreateDummyTexture();
+    // Releases `object` once every frame that may reference it has retired on the GPU.
+    void RetireGpuObject(ComPtr<IUnknown> object);
+    // Call before a scene is erased or overwritten; frames in flight may still use its resources.
+    void RetireSceneGpuObjects(Scene& scene);
+    void RetireEffectGpuObjects(Scene::PostFXEffect& effect);
+    void RetireEffectGpuObjects(Scene::ComputeEffect& effect);
+    // For fixed ImGui heap slots that are rewritten in place.
+    void WaitForGpuIdle();
+    bool EnsureDescriptorCache();
+    // ImGui heap index for a descriptor rewritten every frame (thumbnails, About logo); each
+    // frame slot has its own copy past the fixed descriptors.
+    UINT GetImGuiFrameDescriptorIndex(UINT index) const;
     void EnsureSceneTexture(int sceneIndex, uint32_t width, uint32_t height);
     void RenderScene(ID3D12GraphicsCommandList* commandList, int sceneIndex, uint32_t width, uint32_t height, double time);
+    void RenderScenePass(ID3D12GraphicsCommandList* commandList, int sceneIndex, uint32_t width, uint32_t height, double time);
     bool RenderPreviewTexture(ID3D12GraphicsCommandList* commandList);
     void EnsurePostFxResources(Scene& scene, uint32_t width, uint32_t height);
     void EnsurePostFxPreviewResources(uint32_t width, uint32_t height);
@@ -282,9 +302,23 @@ private:
     void InitializeCodeEditors();
     void LoadGlobalUiBuildSettings();
     void SaveGlobalUiBuildSettings() const;
-    bool LoadTextureFromFile(const std::string& path, ComPtr<ID3D12Resource>& outResource);
+    void RequestFileTexture(TextureBinding& binding);
+    void PumpFileTextureDecodes();
     void CreateTextureFromData(const void* data, int width, int height, int channels, ComPtr<ID3D12Resource>& outResource);
+    void MarkFileTextureReady(ID3D12Resource* texture);
     bool CompileScene(int sceneIndex);
+    bool SubmitSceneCompile(int sceneIndex);
+    void SubmitSceneOptimizeCompile(int sceneIndex);
+    void CancelSceneCompiles(int sceneIndex);
+    void ApplySceneOptimizeResult(int sceneIndex, ShaderCompileOutput& output);
+    void SampleScenePreviewTierTiming();
+    void PumpSceneCompiles();
+    bool ApplySceneCompileResult(int sceneIndex,
+                                 const std::string& source,
+                                 const ShaderCompileResult& compileResult,
+                                 const ComPtr<ID3D12PipelineState>& pso,
+                                 const std::vector<std::string>& extraErrors,
+                                 bool updateEditorState);
     void SyncPostFxEditorToSelection();
     void SyncComputeEditorToSelection();
     bool CompileComputeEffect(Scene::ComputeEffect& effect, std::vector<Diagnostic>& outDiagnostics);
@@ -315,6 +349,9 @@ private:
     void EnsureThemeBackgroundTexture();
     void DrawThemeBackgroundTiled();
 
+    // ImGui font (0), Preview (1), Theme background (126), Titlebar icon (127); thumbnails (2+) and
+    // the About logo use the same indices inside their frame slot's range.
+    static constexpr UINT kImGuiFixedDescriptors = 128;
     ComPtr<ID3D12DescriptorHeap> m_srvHeap;
     ImGuiContext* m_context = nullptr;
     bool m_initialized = false;
@@ -343,7 +380,15 @@ private:
     Swapchain* m_swapchainRef = nullptr;
     PreviewRenderer* m_previewRenderer = nullptr;
     AudioSystem* m_audioSystem = nullptr;
+    // One on-disk bytecode cache shared by both compilation services; declared first so it outlives them
+    ShaderBytecodeCache m_shaderBytecodeCache;
     std::unique_ptr<ICompilationService> m_compilationService;
+    // Editor scene compiles run on m_sceneCompiles' worker with their own DXC instance
+    std::unique_ptr<ICompilationService> m_sceneCompileService;
+    ShaderCompileQueue m_sceneCompiles;
+    // Smoothed preview GPU time of the active scene per tier: [0] Live, [1] Build
+    float m_scenePreviewTierGpuMs[2] = {};
+    size_t m_scenePreviewTierSourceHash = 0;
 
     // Preview Texture (Final/Active)
     ComPtr<ID3D12Resource> m_previewTexture;
@@ -367,7 +412,10 @@ private:
 
     // Scene management
     DemoTrack m_track;
+    PlaybackService m_playbackService; // Caches the track's event index between frames
+    AudioClockFilter m_audioClock;     // Smooths the music cursor into transport time
     std::vector<AudioClip> m_audioLibrary;
+    std::string m_oneShotBankKey; // Library one-shots the audio system's bank was built from
     int m_activeMusicIndex = -1;
 
     std::vector<Scene> m_scenes;
@@ -399,11 +447,19 @@ private:
     
     // Transition Resources
     ComPtr<ID3D12PipelineState> m_transitionPSO;
-    ComPtr<ID3D12DescriptorHeap> m_transitionSrvHeap;
     std::string m_compiledTransitionStem;
 
-    // Cycle detection
-    std::vector<int> m_renderStack;
+    // Scene binding graph: schedules dependencies once per frame, cycles resolved on rebuild
+    SceneRenderGraph m_sceneRenderGraph;
+    std::vector<std::vector<int>> m_sceneDependencies;
+    // Shader-visible heap for scene channel tables, rewritten only when a binding changes
+    Dx12DescriptorCache m_descriptorCache;
+    // File textures upload on the copy queue; bindings become valid when their copy lands
+    TextureUploadQueue m_textureUploads;
+    // File images decode on worker threads and are handed to m_textureUploads as they finish
+    ImageDecodePool m_imageDecodes;
+    bool m_imageDecodesStarted = false;
+    uint64_t m_nextImageDecodeId = 1;
 
     // Callbacks
     std::function<void(int)> m_restartCallback;
@@ -417,6 +473,7 @@ private:
     std::string m_workspaceProjectsPath;
     std::string m_workspaceSnippetsPath;
     std::string m_workspacePostFxPath;
+    std::string m_workspaceShaderCachePath;
     bool m_workspaceExplicitlyConfigured = false;
     bool m_workspaceSelectionPromptPending = false;
     HWND m_hwnd = nullptr;
@@ -449,7 +506,6 @@ private:
     // Post FX preview resources (draft)
     ComPtr<ID3D12Resource> m_postFxPreviewTextureA;
     ComPtr<ID3D12Resource> m_postFxPreviewTextureB;
-    ComPtr<ID3D12DescriptorHeap> m_postFxPreviewSrvHeap;
     ComPtr<ID3D12DescriptorHeap> m_postFxPreviewRtvHeap;
     uint32_t m_postFxPreviewWidth = 0;
     uint32_t m_postFxPreviewHeight = 0;
@@ -479,6 +535,7 @@ private:
     void ResetTransitionState(bool clearActiveScene);
     void ResetTransportTimelineState();
     void StopAudioAndClearMusicState();
+    void RefreshOneShotBank();
     void ApplyPlaybackActiveScene(int index);
     void BeginSceneTransition(int beat,
                               double durationBeats,
@@ -493,6 +550,7 @@ private:
     void InsertSnippetIntoEditor(const std::string& snippetCode);
     void ResolveWorkspaceRootPath();
     void EnsureWorkspaceFolders();
+    void ConfigureShaderBytecodeCache();
     void CreateNewProjectInWorkspace(const std::string& projectNameHint);
     void ChooseWorkspaceFolder();
 
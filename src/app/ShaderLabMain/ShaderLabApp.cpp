@@ -74,7 +74,7 @@ bool ShaderLabApp::Initialize(HWND hwnd, uint32_t width, uint32_t height) {
     }
 
     m_commandQueue = std::make_unique<CommandQueue>();
-    if (!m_commandQueue->Initialize(m_device.get(), D3D12_COMMAND_LIST_TYPE_DIRECT)) {
+    if (!m_commandQueue->Initialize(m_device.get(), D3D12_COMMAND_LIST_TYPE_DIRECT, Swapchain::BUFFER_COUNT)) {
         MessageBoxW(hwnd, L"Failed to initialize Command Queue", L"Initialization Error", MB_OK | MB_ICONERROR);
         return false;
     }
@@ -260,8 +260,8 @@ void ShaderLabApp::Render() {
     const bool previewVsyncEnabled = m_ui ? m_ui->IsPreviewVsyncEnabled() : true;
     m_swapchain->Present(previewVsyncEnabled);
 
-    // Wait for GPU (simple approach for now)
-    m_commandQueue->WaitForGPU();
+    // The next ResetCommandList waits for this frame's slot, so CPU work in between overlaps the GPU
+    m_commandQueue->EndFrame();
 }
 
 void ShaderLabApp::OnResize(uint32_t width, uint32_t height) {
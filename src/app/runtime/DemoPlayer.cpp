@@ -13,8 +13,10 @@
 #if !SHADERLAB_TINY_PLAYER
 #include "ShaderLab/Audio/AudioSystem.h"
 #endif
+#include "ShaderLab/Graphics/CommandQueue.h"
 #if !SHADERLAB_TINY_PLAYER
 #include "ShaderLab/Core/Serializer.h"
+#include "ShaderLab/Runtime/ShaderJobScheduler.h"
 #endif
 #include "ShaderLab/Core/PackageManager.h" 
 #include "stb_image.h"
@@ -22,6 +24,7 @@
 #include <cmath>
 #include <climits>
 #include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <cctype>
 #include <array>
@@ -34,6 +37,8 @@
 #include <fstream>
 #if !SHADERLAB_TINY_PLAYER
 #include <filesystem>
+#include <iterator>
+#include <span>
 #endif
 
 #ifndef SHADERLAB_RUNTIME_IMGUI
@@ -92,7 +97,11 @@ static const char* GetTransitionPackedPathForStem(const std::string& transitionP
 static std::string GetTransitionShaderSourceForStem(const std::string& transitionPresetStem);
 
 constexpr uint32_t kComputeHistorySlots = 8;
-constexpr uint32_t kComputeDescriptorCount = 11; // t0 + t1..t8 + u0 + b0
+constexpr uint32_t kComputeDescriptorCount = 10; // t0 + t1..t8 + u0; b0 is a root CBV
+constexpr uint32_t kMaxComputeDispatchesPerFrame = 64;
+// Scene, post-FX and transition tables are rewritten while recording, so each frame slot
+// gets its own copy and a frame still in flight never sees the next frame's descriptors.
+constexpr uint32_t kSceneTableDescriptors = 8;
 
 #if !SHADERLAB_TINY_PLAYER
 struct ComputeDispatchParams {
@@ -106,23 +115,34 @@ struct ComputeDispatchParams {
     uint32_t frame;
 };
 
-struct RuntimeComputeSceneResources {
-    ComPtr<ID3D12Resource> textureA;
-    ComPtr<ID3D12Resource> textureB;
-    uint32_t width = 0;
-    uint32_t height = 0;
-};
-
 ComPtr<ID3D12RootSignature> g_runtimeComputeRootSignature;
-ComPtr<ID3D12DescriptorHeap> g_runtimeComputeDescriptorHeap;
 ComPtr<ID3D12Resource> g_runtimeComputeParamsBuffer;
 uint8_t* g_runtimeComputeParamsMapped = nullptr;
-std::unordered_map<int, RuntimeComputeSceneResources> g_runtimeComputeSceneResources;
+uint32_t g_runtimeComputeParamsFrameSlot = 0;
+uint32_t g_runtimeComputeParamsUsed = 0;
 
 uint32_t Align256(uint32_t value) {
     return (value + 255u) & ~255u;
 }
 
+// Dispatch constants live in one 256-byte slice per dispatch, kMaxComputeDispatchesPerFrame
+// slices per frame slot; a slot is only reused after its previous frame has completed.
+void BeginRuntimeComputeParamsFrame(uint32_t frameSlot) {
+    g_runtimeComputeParamsFrameSlot = frameSlot;
+    g_runtimeComputeParamsUsed = 0;
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS WriteRuntimeComputeParams(const ComputeDispatchParams& params) {
+    if (!g_runtimeComputeParamsMapped || !g_runtimeComputeParamsBuffer ||
+        g_runtimeComputeParamsUsed >= kMaxComputeDispatchesPerFrame) {
+        return 0;
+    }
+    const uint32_t stride = Align256(static_cast<uint32_t>(sizeof(ComputeDispatchParams)));
+    const uint32_t slice = g_runtimeComputeParamsFrameSlot * kMaxComputeDispatchesPerFrame + g_runtimeComputeParamsUsed++;
+    std::memcpy(g_runtimeComputeParamsMapped + static_cast<size_t>(slice) * stride, &params, sizeof(params));
+    return g_runtimeComputeParamsBuffer->GetGPUVirtualAddress() + static_cast<UINT64>(slice) * stride;
+}
+
 UINT DescriptorStep(ID3D12Device* device) {
     return device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 }
@@ -170,11 +190,6 @@ bool EnsureRuntimeComputeRootSignature(Device* deviceRef) {
     outputRange.NumDescriptors = 1;
     outputRange.BaseShaderRegister = 0;
 
-    D3D12_DESCRIPTOR_RANGE cbvRange = {};
-    cbvRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_CBV;
-    cbvRange.NumDescriptors = 1;
-    cbvRange.BaseShaderRegister = 0;
-
     D3D12_ROOT_PARAMETER rootParams[4] = {};
     rootParams[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
     rootParams[0].DescriptorTable.NumDescriptorRanges = 1;
@@ -191,9 +206,8 @@ bool EnsureRuntimeComputeRootSignature(Device* deviceRef) {
     rootParams[2].DescriptorTable.pDescriptorRanges = &outputRange;
     rootParams[2].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
 
-    rootParams[3].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
-    rootParams[3].DescriptorTable.NumDescriptorRanges = 1;
-    rootParams[3].DescriptorTable.pDescriptorRanges = &cbvRange;
+    rootParams[3].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+    rootParams[3].Descriptor.ShaderRegister = 0;
     rootParams[3].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
 
     D3D12_ROOT_SIGNATURE_DESC rootDesc = {};
@@ -219,23 +233,14 @@ bool EnsureRuntimeComputeDispatchResources(Device* deviceRef) {
     if (!deviceRef) return false;
     ID3D12Device* device = deviceRef->GetDevice();
 
-    if (!g_runtimeComputeDescriptorHeap) {
-        D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
-        heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-        heapDesc.NumDescriptors = kComputeDescriptorCount;
-        heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-        if (FAILED(device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(g_runtimeComputeDescriptorHeap.ReleaseAndGetAddressOf())))) {
-            return false;
-        }
-    }
-
     if (!g_runtimeComputeParamsBuffer) {
         D3D12_HEAP_PROPERTIES heapProps = {};
         heapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
 
         D3D12_RESOURCE_DESC bufferDesc = {};
         bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-        bufferDesc.Width = Align256(static_cast<uint32_t>(sizeof(ComputeDispatchParams)));
+        bufferDesc.Width = static_cast<UINT64>(Align256(static_cast<uint32_t>(sizeof(ComputeDispatchParams)))) *
+                           kMaxComputeDispatchesPerFrame * CommandQueue::kMaxFramesInFlight;
         bufferDesc.Height = 1;
         bufferDesc.DepthOrArraySize = 1;
         bufferDesc.MipLevels = 1;
@@ -637,6 +642,109 @@ static void DebugLogProjectSummary(const ProjectData& project) {
 #endif
 }
 
+#if !SHADERLAB_TINY_PLAYER
+static bool HasEnabledPostFx(const Scene& scene) {
+    for (const auto& fx : scene.postFxChain) {
+        if (fx.enabled) return true;
+    }
+    return false;
+}
+
+static bool HasEnabledCompute(const Scene& scene) {
+    for (const auto& effect : scene.computeEffectChain) {
+        if (effect.enabled) return true;
+    }
+    return false;
+}
+
+// Transient requests for one GetSceneFinalTexture call, following the same acquire/release
+// order as ApplyPostFxChain and ApplyComputeChain. The chain output is held to frame end.
+static void AppendSceneTransientRequests(const Scene& scene,
+                                         uint32_t width,
+                                         uint32_t height,
+                                         uint64_t textureBytes,
+                                         uint32_t& pass,
+                                         std::vector<TransientTextureRequest>& outRequests) {
+    constexpr uint32_t kFrameEnd = UINT32_MAX;
+    TransientTextureKey key;
+    key.width = width;
+    key.height = height;
+    key.format = static_cast<uint32_t>(DXGI_FORMAT_R8G8B8A8_UNORM);
+
+    ++pass; // Scene pass itself renders into the persistent scene texture
+    int heldPostFxOutput = -1;
+    if (HasEnabledPostFx(scene)) {
+        const uint32_t begin = pass + 1;
+        for (const auto& fx : scene.postFxChain) {
+            if (fx.enabled) ++pass;
+        }
+        key.flags = static_cast<uint32_t>(D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET);
+        heldPostFxOutput = static_cast<int>(outRequests.size());
+        outRequests.push_back({key, textureBytes, begin, kFrameEnd});
+        outRequests.push_back({key, textureBytes, begin, pass});
+    }
+    if (HasEnabledCompute(scene)) {
+        const uint32_t begin = pass + 1;
+        for (const auto& effect : scene.computeEffectChain) {
+            if (effect.enabled) ++pass;
+        }
+        key.flags = static_cast<uint32_t>(D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS);
+        outRequests.push_back({key, textureBytes, begin, kFrameEnd});
+        outRequests.push_back({key, textureBytes, begin, pass});
+        if (heldPostFxOutput >= 0) {
+            outRequests[static_cast<size_t>(heldPostFxOutput)].lastPass = pass;
+        }
+    }
+}
+
+// Compares per-scene intermediates (the old layout) with the pooled peak. The worst
+// frame is a transition, which holds two scene outputs, so every ordered pair is planned.
+static void DebugLogRenderTargetBudget(const ProjectData& project, uint32_t width, uint32_t height) {
+    if (width == 0 || height == 0) return;
+
+    constexpr uint64_t kPlacementAlignment = 64ull * 1024ull;
+    const uint64_t textureBytes = ((static_cast<uint64_t>(width) * height * 4ull) + kPlacementAlignment - 1) & ~(kPlacementAlignment - 1);
+
+    uint64_t persistentBytes = 0;
+    uint64_t naiveBytes = 0;
+    for (const auto& scene : project.scenes) {
+        persistentBytes += textureBytes * (scene.outputType == TextureType::TextureCube ? 6u : 1u);
+        for (const auto& fx : scene.postFxChain) {
+            if (fx.enabled) persistentBytes += textureBytes * kPostFxHistoryCount;
+        }
+        for (const auto& effect : scene.computeEffectChain) {
+            if (effect.enabled) {
+                const int historyCount = (std::max)(0, (std::min)(effect.historyCount, static_cast<int>(kComputeHistorySlots)));
+                persistentBytes += textureBytes * static_cast<uint64_t>(historyCount);
+            }
+        }
+        naiveBytes += textureBytes * ((HasEnabledPostFx(scene) ? 2u : 0u) + (HasEnabledCompute(scene) ? 2u : 0u));
+    }
+
+    uint64_t pooledPeakBytes = 0;
+    std::vector<TransientTextureRequest> requests;
+    for (size_t from = 0; from < project.scenes.size(); ++from) {
+        for (size_t to = from; to < project.scenes.size(); ++to) {
+            requests.clear();
+            uint32_t pass = 0;
+            AppendSceneTransientRequests(project.scenes[from], width, height, textureBytes, pass, requests);
+            AppendSceneTransientRequests(project.scenes[to], width, height, textureBytes, pass, requests);
+            pooledPeakBytes = (std::max)(pooledPeakBytes, PlanTransientTextures(requests).pooledBytes);
+        }
+    }
+
+    auto megabytes = [](uint64_t bytes) {
+        char text[32] = {};
+        std::snprintf(text, sizeof(text), "%.1f MB", static_cast<double>(bytes) / (1024.0 * 1024.0));
+        return std::string(text);
+    };
+    DebugLog("[vram] Render targets at " + std::to_string(width) + "x" + std::to_string(height) +
+             ": scene outputs + history " + megabytes(persistentBytes) +
+             ", intermediates per scene " + megabytes(naiveBytes) +
+             " -> pooled peak " + megabytes(pooledPeakBytes));
+}
+#endif
+
 static int TransitionSlotIndexFromStem(const std::string& transitionPresetStem) {
     const std::string canonicalStem = CanonicalTransitionStem(transitionPresetStem);
     for (size_t i = 0; i < kTransitionSlotCount; ++i) {
@@ -664,6 +772,160 @@ static const char* GetTransitionPackedPathForStem(const std::string& transitionP
     return "";
 }
 
+static void MarkUsedTransitionSlots(const ProjectData& project, bool (&usedSlots)[kTransitionSlotCount]) {
+    for (const auto& row : project.track.rows) {
+        if (row.transitionPresetStem.empty()) {
+            continue;
+        }
+        const int transitionIndex = TransitionSlotIndexFromStem(row.transitionPresetStem);
+        if (transitionIndex >= 0 && transitionIndex < static_cast<int>(kTransitionSlotCount)) {
+            usedSlots[transitionIndex] = true;
+        }
+    }
+}
+
+#if !SHADERLAB_TINY_PLAYER
+static bool CompileRuntimeComputeBytecode(const std::string& source,
+                                          const std::string& entryPoint,
+                                          std::vector<uint8_t>& outBytecode,
+                                          std::string* outError = nullptr) {
+    outBytecode.clear();
+    if (source.empty()) {
+        return false;
+    }
+    const std::string resolvedEntryPoint = entryPoint.empty() ? "main" : entryPoint;
+    ComPtr<ID3DBlob> shaderBlob;
+    ComPtr<ID3DBlob> errorBlob;
+    if (FAILED(D3DCompile(source.c_str(),
+                          source.size(),
+                          "compute_runtime.hlsl",
+                          nullptr,
+                          nullptr,
+                          resolvedEntryPoint.c_str(),
+                          "cs_5_0",
+                          D3DCOMPILE_ENABLE_STRICTNESS,
+                          0,
+                          shaderBlob.GetAddressOf(),
+                          errorBlob.GetAddressOf()))) {
+        if (outError && errorBlob) {
+            outError->assign(static_cast<const char*>(errorBlob->GetBufferPointer()), errorBlob->GetBufferSize());
+        }
+        return false;
+    }
+    if (!shaderBlob) {
+        return false;
+    }
+    const uint8_t* begin = static_cast<const uint8_t*>(shaderBlob->GetBufferPointer());
+    outBytecode.assign(begin, begin + shaderBlob->GetBufferSize());
+    return !outBytecode.empty();
+}
+
+// Worker-side half of runtime shader preparation: resolves bytecode from the pack or disk and
+// falls back to compiling compute sources. Touches no device or project state.
+static ShaderJobResult ProduceRuntimeShaderBytecode(const ShaderJob& job, const std::string& manifestPath) {
+    ShaderJobResult result;
+    if (!job.precompiledPath.empty()) {
+        if (PackageManager::Get().IsPacked()) {
+            if (PackageManager::Get().HasFile(job.precompiledPath)) {
+                result.bytecode = PackageManager::Get().GetFile(job.precompiledPath);
+            }
+        } else {
+            LoadBytecodeFromPathCandidates(job.precompiledPath, manifestPath, result.bytecode);
+        }
+    }
+
+    if (result.bytecode.empty() && job.kind == ShaderJobKind::Compute) {
+        CompileRuntimeComputeBytecode(job.sourceCode, job.entryPoint, result.bytecode, &result.error);
+    }
+
+    result.success = !result.bytecode.empty();
+    if (!result.success && result.error.empty()) {
+        result.error = job.precompiledPath.empty() ? "no precompiled shader path" : "missing shader data: " + job.precompiledPath;
+    }
+    return result;
+}
+
+class RuntimeShaderJobCompiler final : public IShaderJobCompiler {
+public:
+    explicit RuntimeShaderJobCompiler(std::string manifestPath) : m_manifestPath(std::move(manifestPath)) {}
+
+    ShaderJobResult Compile(const ShaderJob& job) override {
+        return ProduceRuntimeShaderBytecode(job, m_manifestPath);
+    }
+
+private:
+    std::string m_manifestPath;
+};
+
+static ShaderJob MakeSceneShaderJob(const Scene& scene, int sceneIndex) {
+    ShaderJob job;
+    job.kind = ShaderJobKind::Scene;
+    job.sceneIndex = sceneIndex;
+    job.label = scene.name;
+    job.precompiledPath = scene.precompiledPath;
+    return job;
+}
+
+static ShaderJob MakePostFxShaderJob(const Scene::PostFXEffect& effect, int sceneIndex, int fxIndex) {
+    ShaderJob job;
+    job.kind = ShaderJobKind::PostFx;
+    job.sceneIndex = sceneIndex;
+    job.effectIndex = fxIndex;
+    job.label = effect.name;
+    job.precompiledPath = effect.precompiledPath;
+    return job;
+}
+
+static ShaderJob MakeComputeShaderJob(const Scene::ComputeEffect& effect, int sceneIndex, int computeIndex) {
+    ShaderJob job;
+    job.kind = ShaderJobKind::Compute;
+    job.sceneIndex = sceneIndex;
+    job.effectIndex = computeIndex;
+    job.label = effect.name;
+    job.precompiledPath = effect.precompiledPath;
+    job.sourceCode = effect.shaderCode;
+    job.entryPoint = effect.entryPoint;
+    return job;
+}
+
+static bool CreatePostFxPipeline(PreviewRenderer* renderer, Scene::PostFXEffect& effect, const std::vector<uint8_t>& bytecode) {
+    if (!renderer || bytecode.empty()) {
+        return false;
+    }
+    effect.pipelineState = renderer->CreatePSOFromBytecode(bytecode);
+    if (!effect.pipelineState) {
+        return false;
+    }
+    effect.isDirty = false;
+    effect.lastCompiledCode = effect.shaderCode;
+    return true;
+}
+
+static bool CreateRuntimeComputePipeline(Device* device, Scene::ComputeEffect& effect, const std::vector<uint8_t>& bytecode) {
+    if (!device || bytecode.empty()) {
+        return false;
+    }
+    if (!EnsureRuntimeComputeRootSignature(device)) {
+        return false;
+    }
+
+    D3D12_COMPUTE_PIPELINE_STATE_DESC desc = {};
+    desc.pRootSignature = g_runtimeComputeRootSignature.Get();
+    desc.CS = { bytecode.data(), bytecode.size() };
+
+    ComPtr<ID3D12PipelineState> pso;
+    if (FAILED(device->GetDevice()->CreateComputePipelineState(&desc, IID_PPV_ARGS(pso.GetAddressOf())))) {
+        return false;
+    }
+
+    effect.pipelineState = pso;
+    effect.compiledShaderBytes = bytecode.size();
+    effect.isDirty = false;
+    effect.lastCompiledCode = effect.shaderCode;
+    return true;
+}
+#endif
+
 struct TinyTrackMetadata {
     int sceneCount = 0;
     std::vector<int16_t> sceneModuleIndices;
@@ -770,6 +1032,7 @@ static bool LoadCompactTrackBinaryFromBytesTiny(const std::vector<uint8_t>& byte
         row.isBeat = false;
         decoded.rows.push_back(row);
     }
+    decoded.MarkRowsChanged();
 
     track = std::move(decoded);
     if (outMeta) {
@@ -904,6 +1167,7 @@ static bool LoadCompactTrackBinaryFromBytes(const std::vector<uint8_t>& bytes, D
         row.isBeat = false;
         decoded.rows.push_back(row);
     }
+    decoded.MarkRowsChanged();
 
     track = std::move(decoded);
     if (outMeta) {
@@ -1174,26 +1438,10 @@ static bool BuildTinyProjectFromAssets(ProjectData& project,
     project.track.bpm = 120.0f;
     project.track.lengthBeats = 1;
     project.track.rows.clear();
+    project.track.MarkRowsChanged();
     return true;
 }
 
-static const TrackerRow* FindNextSceneRow(const DemoTrack& track, int afterBeat) {
-    const TrackerRow* bestRow = nullptr;
-    int bestBeat = INT_MAX;
-    for (const auto& row : track.rows) {
-        if (row.sceneIndex >= 0 && row.rowId > afterBeat && row.rowId < bestBeat) {
-            bestBeat = row.rowId;
-            bestRow = &row;
-        }
-    }
-    return bestRow;
-}
-
-static int FindNextSceneIndex(const DemoTrack& track, int afterBeat) {
-    const TrackerRow* row = FindNextSceneRow(track, afterBeat);
-    return row ? row->sceneIndex : -1;
-}
-
 static void ComputeShaderMusicalTiming(const Transport& transport,
                                        float& outIBeat,
                                        float& outIBar,
@@ -1307,9 +1555,16 @@ void DemoPlayer::Shutdown() {
     if (m_audio) { m_audio->Shutdown(); delete m_audio; m_audio = nullptr; }
 #else
     m_audio = nullptr;
+#endif
+#if !SHADERLAB_TINY_PLAYER
+    CancelShaderJobs();
+    if (m_shaderJobs) { delete m_shaderJobs; m_shaderJobs = nullptr; }
 #endif
     if (m_renderer) { m_renderer->Shutdown(); delete m_renderer; m_renderer = nullptr; }
+    m_transientTextures.Shutdown();
 #if !SHADERLAB_TINY_PLAYER
+    m_descriptorCache.Shutdown();
+    m_textureUploads.Shutdown();
     if (m_compiler) { m_compiler->Shutdown(); delete m_compiler; m_compiler = nullptr; }
 #else
     m_compiler = nullptr;
@@ -1321,6 +1576,7 @@ void DemoPlayer::Shutdown() {
 bool DemoPlayer::Initialize(HWND hwnd, Device* device, Swapchain* swapchain, int width, int height) {
     m_device = device;
     m_swapchain = swapchain;
+    m_transientTextures.Initialize(device);
 
     PackageManager::Get().Initialize();
     if (PackageManager::Get().HasFile(kPackedVertexShaderPath)) {
@@ -1460,6 +1716,9 @@ bool DemoPlayer::Initialize(HWND hwnd, Device* device, Swapchain* swapchain, int
 }
 
 void DemoPlayer::LoadProject(const std::string& manifestPath) {
+#if !SHADERLAB_TINY_PLAYER
+    CancelShaderJobs();
+#endif
     m_manifestPath = manifestPath;
     m_loadingFailed = false;
 
@@ -1564,6 +1823,9 @@ bool DemoPlayer::EnsureTransitionPipeline(const std::string& transitionPresetSte
 }
 
 void DemoPlayer::PrimeRuntimeResources() {
+#if !SHADERLAB_TINY_PLAYER
+    LoadBakedFileTextures();
+#endif
     for (int sceneIndex = 0; sceneIndex < static_cast<int>(m_project.scenes.size()); ++sceneIndex) {
         EnsureSceneTexture(sceneIndex);
         auto& scene = m_project.scenes[static_cast<size_t>(sceneIndex)];
@@ -1573,95 +1835,363 @@ void DemoPlayer::PrimeRuntimeResources() {
     }
 
     bool usedTransitions[kTransitionSlotCount] = {};
-    for (const auto& row : m_project.track.rows) {
-        if (row.transitionPresetStem.empty()) {
+    MarkUsedTransitionSlots(m_project, usedTransitions);
+
+    for (size_t i = 0; i < kTransitionSlotCount; ++i) {
+        if (!usedTransitions[i]) {
             continue;
         }
-        const int transitionIndex = TransitionSlotIndexFromStem(row.transitionPresetStem);
-        if (transitionIndex >= 0 && transitionIndex < static_cast<int>(kTransitionSlotCount)) {
-            usedTransitions[transitionIndex] = true;
+        EnsureTransitionPipeline(kTransitionSlotStems[i]);
+    }
+}
+
+#if !SHADERLAB_TINY_PLAYER
+void DemoPlayer::StartShaderJobs() {
+    CancelShaderJobs();
+
+    std::vector<ShaderJob> jobs;
+    for (int sceneIndex = 0; sceneIndex < static_cast<int>(m_project.scenes.size()); ++sceneIndex) {
+        const auto& scene = m_project.scenes[static_cast<size_t>(sceneIndex)];
+        jobs.push_back(MakeSceneShaderJob(scene, sceneIndex));
+        for (size_t fxIndex = 0; fxIndex < scene.postFxChain.size(); ++fxIndex) {
+            jobs.push_back(MakePostFxShaderJob(scene.postFxChain[fxIndex], sceneIndex, static_cast<int>(fxIndex)));
+        }
+        for (size_t computeIndex = 0; computeIndex < scene.computeEffectChain.size(); ++computeIndex) {
+            jobs.push_back(MakeComputeShaderJob(scene.computeEffectChain[computeIndex], sceneIndex, static_cast<int>(computeIndex)));
         }
     }
 
+    // Transition bytecode is only loaded here; PrimeRuntimeResources builds the PSOs from the cache.
+    bool usedTransitions[kTransitionSlotCount] = {};
+    MarkUsedTransitionSlots(m_project, usedTransitions);
     for (size_t i = 0; i < kTransitionSlotCount; ++i) {
-        if (!usedTransitions[i]) {
+        const char* packedPath = GetTransitionPackedPathForStem(kTransitionSlotStems[i]);
+        if (!usedTransitions[i] || !packedPath || !*packedPath) {
             continue;
         }
-        EnsureTransitionPipeline(kTransitionSlotStems[i]);
+        ShaderJob job;
+        job.kind = ShaderJobKind::Transition;
+        job.label = kTransitionSlotStems[i];
+        job.precompiledPath = packedPath;
+        jobs.push_back(std::move(job));
     }
+
+    if (!m_shaderJobs) {
+        m_shaderJobs = new ShaderJobScheduler();
+    }
+    m_shaderJobCompiler = new RuntimeShaderJobCompiler(m_manifestPath);
+    m_shaderJobs->Start(m_shaderJobCompiler, std::move(jobs), ShaderJobScheduler::DefaultWorkerCount());
 }
 
-// Minimal helpers
-static ComPtr<ID3D12Resource> LoadTexture(Device* dev, const std::string& path) {
-    (void)dev;
-    (void)path;
-    // ... Implementation omitted for brevity
-    return nullptr;
+void DemoPlayer::CancelShaderJobs() {
+    if (m_shaderJobs) {
+        m_shaderJobs->Cancel();
+    }
+    // Workers are joined by Cancel(), so the compiler can go.
+    if (m_shaderJobCompiler) { delete m_shaderJobCompiler; m_shaderJobCompiler = nullptr; }
 }
 
+bool DemoPlayer::PollShaderJobs() {
+    if (!m_shaderJobs) {
+        return true;
+    }
 
-void DemoPlayer::Update(double wallTime, float dt) {
-    if (m_loadingFailed) {
-        return;
+    std::vector<ShaderJobScheduler::Completed> completed;
+    m_shaderJobs->Poll(completed, completed.max_size());
+    for (auto& entry : completed) {
+        if (!ApplyShaderJobResult(entry.job, entry.result) && entry.job.kind == ShaderJobKind::Scene) {
+            TinyTrace("CompileScene failed at index " + std::to_string(entry.job.sceneIndex));
+            RuntimeErr("E200", "scene compile failed");
+            m_loadingStatus = "Compile failed at scene " + std::to_string(entry.job.sceneIndex);
+        }
     }
 
-#if !SHADERLAB_TINY_PLAYER
-    auto loadAudioClip = [&](const auto& clip, bool packedAssets) {
-        if (!m_audio) {
+    if (!m_shaderJobs->IsFinished()) {
+        m_loadingStatus = "Compiling shaders " + std::to_string(m_shaderJobs->DeliveredCount()) + "/" + std::to_string(m_shaderJobs->TotalCount());
+        return false;
+    }
+
+    CancelShaderJobs();
+    return true;
+}
+
+// Render-thread half: turns worker bytecode into pipeline state objects.
+bool DemoPlayer::ApplyShaderJobResult(const ShaderJob& job, ShaderJobResult& result) {
+    if (!m_renderer || !m_rendererReady) {
+        return false;
+    }
+
+    if (job.kind == ShaderJobKind::Transition) {
+        if (!result.success) {
+            SHADERLAB_RT_DEBUG_LOG_ERROR("Transition shader unavailable: " + job.label + " (" + result.error + ")");
             return false;
         }
+        m_transitionBytecode[job.label] = std::move(result.bytecode);
+        return true;
+    }
 
-        std::vector<std::string> packageCandidates;
-        packageCandidates.push_back(clip.path);
+    if (job.sceneIndex < 0 || job.sceneIndex >= static_cast<int>(m_project.scenes.size())) {
+        return false;
+    }
+    auto& scene = m_project.scenes[static_cast<size_t>(job.sceneIndex)];
 
-        std::string normalizedPath = clip.path;
-        std::replace(normalizedPath.begin(), normalizedPath.end(), '\\', '/');
-        if (normalizedPath != clip.path) {
-            packageCandidates.push_back(normalizedPath);
+    if (job.kind == ShaderJobKind::Scene) {
+        if (!result.success) {
+            SHADERLAB_RT_DEBUG_LOG_ERROR("Missing precompiled scene shader for scene " + scene.name + " (" + result.error + ")");
+            return false;
         }
+        scene.pipelineState = m_renderer->CreatePSOFromBytecode(result.bytecode);
+        if (!scene.pipelineState) {
+            SHADERLAB_RT_DEBUG_LOG_ERROR("Failed to create PSO from precompiled shader for scene " + scene.name);
+            RuntimeErr("E208", "precompiled scene pso create failed");
+            return false;
+        }
+        SHADERLAB_RT_DEBUG_LOG("Scene PSO created from precompiled shader: " + scene.name);
+        return true;
+    }
 
-        std::filesystem::path clipPathFs(clip.path);
-        const std::string clipFileName = clipPathFs.filename().string();
-        if (!clipFileName.empty()) {
-            packageCandidates.push_back("assets/audio/" + clipFileName);
-            packageCandidates.push_back("audio/" + clipFileName);
+    if (job.kind == ShaderJobKind::PostFx) {
+        if (job.effectIndex < 0 || job.effectIndex >= static_cast<int>(scene.postFxChain.size())) {
+            return false;
         }
+        auto& effect = scene.postFxChain[static_cast<size_t>(job.effectIndex)];
+        if (!CreatePostFxPipeline(m_renderer, effect, result.bytecode)) {
+            SHADERLAB_RT_DEBUG_LOG_ERROR("Failed to compile post fx for scene " + scene.name + " (" + effect.name + ")");
+            return false;
+        }
+        return true;
+    }
 
-        if (packedAssets) {
+    if (job.effectIndex < 0 || job.effectIndex >= static_cast<int>(scene.computeEffectChain.size())) {
+        return false;
+    }
+    auto& effect = scene.computeEffectChain[static_cast<size_t>(job.effectIndex)];
+    if (!CreateRuntimeComputePipeline(m_device, effect, result.bytecode)) {
+        SHADERLAB_RT_DEBUG_LOG_ERROR("Failed to compile compute fx for scene " + scene.name + " (" + effect.name + ")");
+        return false;
+    }
+    return true;
+}
+#endif
+
+#if !SHADERLAB_TINY_PLAYER
+// File bindings name containers baked by the build; the player never decodes PNG/JPG.
+// Each container is staged with one memcpy and every texture lands in a single copy batch.
+void DemoPlayer::LoadBakedFileTextures() {
+    std::unordered_map<std::string, ComPtr<ID3D12Resource>> loaded;
+    for (auto& scene : m_project.scenes) {
+        for (auto& binding : scene.bindings) {
+            binding.fileTextureValid = false;
+            binding.textureResource.Reset();
+            if (binding.bindingType != BindingType::File || binding.filePath.empty()) {
+                continue;
+            }
+            auto loadedIt = loaded.find(binding.filePath);
+            if (loadedIt != loaded.end()) {
+                binding.textureResource = loadedIt->second;
+                continue;
+            }
+            loaded[binding.filePath] = nullptr;
+            if (std::filesystem::path(binding.filePath).extension() != TextureBake::kExtension) {
+                DebugLog("[texture] Skipping unbaked file: " + binding.filePath);
+                continue;
+            }
+            if (!m_textureUploads.IsInitialized() && !m_textureUploads.Initialize(m_device)) {
+                DebugLogError("[texture] Copy queue unavailable");
+                return;
+            }
+
+            std::vector<uint8_t> bytesCopy;
+            std::span<const uint8_t> bytes;
+            if (PackageManager::Get().IsPacked()) {
+                bytes = PackageManager::Get().GetFileView(binding.filePath);
+                if (bytes.empty()) {
+                    bytesCopy = PackageManager::Get().GetFile(binding.filePath);
+                    bytes = bytesCopy;
+                }
+            } else {
+                std::filesystem::path diskPath(binding.filePath);
+                if (diskPath.is_relative() && !m_manifestPath.empty()) {
+                    diskPath = std::filesystem::path(m_manifestPath).parent_path() / diskPath;
+                }
+                std::ifstream file(diskPath, std::ios::binary);
+                bytesCopy.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+                bytes = bytesCopy;
+            }
+
+            BakedTextureView baked;
+            if (!TextureBake::Parse(bytes, baked) || !m_textureUploads.QueueBakedTexture(baked, binding.textureResource)) {
+                DebugLogError("[texture] Failed to load baked texture: " + binding.filePath);
+                continue;
+            }
+            loaded[binding.filePath] = binding.textureResource;
+        }
+    }
+
+    if (!m_textureUploads.IsInitialized()) {
+        return;
+    }
+    m_textureUploads.Flush();
+    for (auto& scene : m_project.scenes) {
+        for (auto& binding : scene.bindings) {
+            binding.fileTextureValid = binding.bindingType == BindingType::File && binding.textureResource != nullptr;
+        }
+    }
+    const TextureUploadStats& stats = m_textureUploads.GetStats();
+    DebugLog("[texture] " + std::to_string(stats.texturesUploaded) + " baked textures, " +
+             std::to_string(stats.bytesStaged) + " bytes staged in " + std::to_string(stats.submissions) + " copy batch(es)");
+}
+#endif
+
+
+#if !SHADERLAB_TINY_PLAYER
+void DemoPlayer::CollectAudioCandidates(const AudioClip& clip,
+                                        std::vector<std::string>& outPackageCandidates,
+                                        std::vector<std::string>& outDiskCandidates) const {
+    outPackageCandidates.clear();
+    outDiskCandidates.clear();
+    outPackageCandidates.push_back(clip.path);
+
+    std::string normalizedPath = clip.path;
+    std::replace(normalizedPath.begin(), normalizedPath.end(), '\\', '/');
+    if (normalizedPath != clip.path) {
+        outPackageCandidates.push_back(normalizedPath);
+    }
+
+    std::filesystem::path clipPathFs(clip.path);
+    const std::string clipFileName = clipPathFs.filename().string();
+    if (!clipFileName.empty()) {
+        outPackageCandidates.push_back("assets/audio/" + clipFileName);
+        outPackageCandidates.push_back("audio/" + clipFileName);
+    }
+
+    if (!clip.path.empty()) {
+        outDiskCandidates.push_back(clip.path);
+    }
+
+    if (!normalizedPath.empty() && normalizedPath != clip.path) {
+        outDiskCandidates.push_back(normalizedPath);
+    }
+
+    if (!m_manifestPath.empty()) {
+        const std::filesystem::path manifestDir = std::filesystem::path(m_manifestPath).parent_path();
+        if (!manifestDir.empty()) {
+            outDiskCandidates.push_back((manifestDir / clip.path).string());
+            if (!clipFileName.empty()) {
+                outDiskCandidates.push_back((manifestDir / "assets" / "audio" / clipFileName).string());
+                outDiskCandidates.push_back((manifestDir / "audio" / clipFileName).string());
+            }
+        }
+    }
+}
+
+void DemoPlayer::LoadOneShotBank() {
+    if (!m_audio) {
+        return;
+    }
+
+    // Encoded bytes only need to live until the bank has decoded them.
+    std::vector<std::vector<uint8_t>> ownedBytes;
+    std::vector<OneShotSource> sources;
+    ownedBytes.reserve(m_project.audioLibrary.size());
+    const bool packed = PackageManager::Get().IsPacked();
+    std::vector<std::string> packageCandidates;
+    std::vector<std::string> diskCandidates;
+    for (size_t i = 0; i < m_project.audioLibrary.size(); ++i) {
+        const AudioClip& clip = m_project.audioLibrary[i];
+        if (clip.type != AudioType::OneShot) {
+            continue;
+        }
+        CollectAudioCandidates(clip, packageCandidates, diskCandidates);
+
+        OneShotSource source;
+        source.index = static_cast<int>(i);
+        source.name = clip.name.empty() ? clip.path : clip.name;
+        if (packed) {
             for (const auto& candidate : packageCandidates) {
                 if (!PackageManager::Get().HasFile(candidate)) {
                     continue;
                 }
-
-                auto audioData = PackageManager::Get().GetFile(candidate);
-                if (!audioData.empty() && m_audio->LoadAudioFromMemory(audioData.data(), audioData.size())) {
-                    return true;
+                source.encoded = PackageManager::Get().GetFileView(candidate);
+                if (source.encoded.empty()) {
+                    ownedBytes.push_back(PackageManager::Get().GetFile(candidate));
+                    source.encoded = ownedBytes.back();
+                }
+                if (!source.encoded.empty()) {
+                    break;
                 }
             }
         }
+        for (size_t c = 0; source.encoded.empty() && c < diskCandidates.size(); ++c) {
+            std::ifstream file(diskCandidates[c], std::ios::binary);
+            if (!file.is_open()) {
+                continue;
+            }
+            ownedBytes.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            source.encoded = ownedBytes.back();
+        }
 
-        std::vector<std::string> diskCandidates;
-        diskCandidates.push_back(clip.path);
+        if (source.encoded.empty()) {
+            DebugLogError("One-shot not found: " + clip.path);
+            continue;
+        }
+        sources.push_back(std::move(source));
+    }
 
-        if (!normalizedPath.empty() && normalizedPath != clip.path) {
-            diskCandidates.push_back(normalizedPath);
+    if (sources.empty()) {
+        m_audio->UnloadOneShots();
+        return;
+    }
+
+    std::string errors;
+    m_audio->LoadOneShots(sources, errors);
+    if (!errors.empty()) {
+        DebugLogError("One-shot decode failed:\n" + errors);
+    }
+    const OneShotStats stats = m_audio->GetOneShotStats();
+    DebugLog("One-shots: " + std::to_string(stats.samples) + " decoded (" +
+             std::to_string(stats.decodedBytes / 1024) + " KB PCM), " + std::to_string(stats.voices) + " voices");
+}
+#endif
+
+void DemoPlayer::Update(double wallTime, float dt) {
+    if (m_loadingFailed) {
+        return;
+    }
+
+#if !SHADERLAB_TINY_PLAYER
+    auto loadAudioClip = [&](const auto& clip, bool packedAssets) {
+        if (!m_audio) {
+            return false;
         }
 
-        if (!m_manifestPath.empty()) {
-            const std::filesystem::path manifestDir = std::filesystem::path(m_manifestPath).parent_path();
-            if (!manifestDir.empty()) {
-                diskCandidates.push_back((manifestDir / clip.path).string());
-                if (!clipFileName.empty()) {
-                    diskCandidates.push_back((manifestDir / "assets" / "audio" / clipFileName).string());
-                    diskCandidates.push_back((manifestDir / "audio" / clipFileName).string());
+        std::vector<std::string> packageCandidates;
+        std::vector<std::string> diskCandidates;
+        CollectAudioCandidates(clip, packageCandidates, diskCandidates);
+
+        if (packedAssets) {
+            for (const auto& candidate : packageCandidates) {
+                if (!PackageManager::Get().HasFile(candidate)) {
+                    continue;
+                }
+
+                // Stored entries stream straight from the mapped pack; compressed ones are inflated once.
+                const auto audioView = PackageManager::Get().GetFileView(candidate);
+                if (!audioView.empty()) {
+                    if (m_audio->LoadAudioFromView(audioView)) {
+                        return true;
+                    }
+                    continue;
+                }
+                if (m_audio->LoadAudioFromBuffer(PackageManager::Get().GetFile(candidate))) {
+                    SHADERLAB_RT_DEBUG_LOG("Music inflated from pack: " + candidate + " (" +
+                                           std::to_string(m_audio->GetStreamResidentBytes() / 1024) + " KB resident)");
+                    return true;
                 }
             }
         }
 
         for (const auto& candidate : diskCandidates) {
-            if (candidate.empty()) {
-                continue;
-            }
             if (m_audio->LoadAudio(candidate)) {
                 return true;
             }
@@ -1731,32 +2261,59 @@ void DemoPlayer::Update(double wallTime, float dt) {
             }
 #else
             if (packed) {
-                std::cout << "Packed build detected. Loading project.json from executable." << std::endl;
-                if (PackageManager::Get().HasFile("project.json")) {
+                // Prefer the binary manifest; it decodes straight from the mapped pack.
+                if (PackageManager::Get().HasFile("project.bin")) {
+                    std::cout << "Packed build detected. Loading project.bin from executable." << std::endl;
+                    std::span<const uint8_t> binaryView = PackageManager::Get().GetFileView("project.bin");
+                    std::vector<uint8_t> binaryCopy;
+                    if (binaryView.empty()) {
+                        binaryCopy = PackageManager::Get().GetFile("project.bin");
+                        binaryView = binaryCopy;
+                    }
+                    loaded = Serializer::LoadProjectFromBinary(binaryView, m_project);
+                }
+
+                const bool hasJsonManifest = PackageManager::Get().HasFile("project.json");
+                if (!loaded && hasJsonManifest) {
+                    std::cout << "Packed build detected. Loading project.json from executable." << std::endl;
                     auto data = PackageManager::Get().GetFile("project.json");
                     std::string jsonStr(data.begin(), data.end());
                     loaded = Serializer::LoadProjectFromJson(jsonStr, m_project);
+                }
 
-                    if (loaded && PackageManager::Get().HasFile("assets/track.bin")) {
-                        auto trackData = PackageManager::Get().GetFile("assets/track.bin");
-                        std::string trackError;
-                        if (!LoadCompactTrackBinaryFromBytes(trackData, m_project.track, nullptr, trackError)) {
+                if (loaded && PackageManager::Get().HasFile("assets/track.bin")) {
+                    auto trackData = PackageManager::Get().GetFile("assets/track.bin");
+                    std::string trackError;
+                    if (!LoadCompactTrackBinaryFromBytes(trackData, m_project.track, nullptr, trackError)) {
 #if SHADERLAB_COMPACT_TRACK_DEBUG
-                            SHADERLAB_RT_DEBUG_LOG_ERROR("Failed to load compact track binary: " + trackError);
+                        SHADERLAB_RT_DEBUG_LOG_ERROR("Failed to load compact track binary: " + trackError);
 #endif
-                        }
+                    }
 #if SHADERLAB_COMPACT_TRACK_DEBUG
-                        else {
-                            SHADERLAB_RT_DEBUG_LOG("Loaded compact track binary from packed executable.");
-                        }
-#endif
+                    else {
+                        SHADERLAB_RT_DEBUG_LOG("Loaded compact track binary from packed executable.");
                     }
-                } else {
+#endif
+                } else if (!loaded && !hasJsonManifest) {
                     RuntimeErr("E206", "packed build missing project.json");
                 }
             } else {
-                std::cout << "No pack detected. Loading project from disk: " << m_manifestPath << std::endl;
-                loaded = Serializer::LoadProject(m_manifestPath, m_project);
+                // A project.bin written next to the manifest by the build wins unless the JSON is newer.
+                const std::filesystem::path manifestPath(m_manifestPath);
+                const std::filesystem::path binaryPath = manifestPath.parent_path() / "project.bin";
+                std::error_code binaryTimeEc;
+                std::error_code manifestTimeEc;
+                const auto binaryTime = std::filesystem::last_write_time(binaryPath, binaryTimeEc);
+                const auto manifestTime = std::filesystem::last_write_time(manifestPath, manifestTimeEc);
+                const bool binaryCurrent = !binaryTimeEc && (manifestTimeEc || binaryTime >= manifestTime);
+                if (binaryCurrent) {
+                    std::cout << "No pack detected. Loading binary project from disk: " << binaryPath.string() << std::endl;
+                    loaded = Serializer::LoadProjectBinary(binaryPath.string(), m_project);
+                }
+                if (!loaded) {
+                    std::cout << "No pack detected. Loading project from disk: " << m_manifestPath << std::endl;
+                    loaded = Serializer::LoadProject(m_manifestPath, m_project);
+                }
 
                 if (loaded) {
                     DemoTrack decodedTrack;
@@ -1788,6 +2345,9 @@ void DemoPlayer::Update(double wallTime, float dt) {
                     m_project.transport.bpm = 120.0f;
                 }
                 DebugLogProjectSummary(m_project);
+#if !SHADERLAB_TINY_PLAYER
+                DebugLogRenderTargetBudget(m_project, m_width, m_height);
+#endif
 
 #if SHADERLAB_RUNTIME_DEBUG_LOG && !SHADERLAB_TINY_PLAYER
                 if (packed) {
@@ -1830,29 +2390,40 @@ void DemoPlayer::Update(double wallTime, float dt) {
     #if !SHADERLAB_TINY_PLAYER
             bool packed = PackageManager::Get().IsPacked();
             for(auto& clip : m_project.audioLibrary) {
+                if (clip.type == AudioType::OneShot) {
+                    continue;
+                }
                 loadAudioClip(clip, packed);
             }
+            LoadOneShotBank();
     #endif
             m_compilationIndex = 0;
 
             m_loadingStage = LoadingStage::CompilingShaders;
             m_loadingStatus = "Compiling shaders";
+    #if !SHADERLAB_TINY_PLAYER
+            StartShaderJobs();
+    #endif
             return;
         }
 
         if (m_loadingStage == LoadingStage::CompilingShaders) {
-            if (m_compilationIndex < (int)m_project.scenes.size()) {
+#if SHADERLAB_TINY_PLAYER
+            const bool shadersPending = m_compilationIndex < (int)m_project.scenes.size();
+            if (shadersPending) {
                 m_loadingStatus = "Compiling scene " + std::to_string(m_compilationIndex + 1) + "/" + std::to_string(m_project.scenes.size());
                 const bool ok = CompileScene(m_compilationIndex);
                 if (!ok) {
                     TinyTrace("CompileScene failed at index " + std::to_string(m_compilationIndex));
-#if !SHADERLAB_TINY_PLAYER
-                    RuntimeErr("E200", "scene compile failed");
-#endif
                     m_loadingStatus = "Compile failed at scene " + std::to_string(m_compilationIndex);
                 }
                 m_compilationIndex++;
-            } else {
+            }
+#else
+            // Workers load and compile bytecode; PSOs are created here as results arrive in order.
+            const bool shadersPending = !PollShaderJobs();
+#endif
+            if (!shadersPending) {
                 PrimeRuntimeResources();
                 m_transport = m_project.transport;
                 m_transport.state = TransportState::Playing;
@@ -1870,7 +2441,20 @@ void DemoPlayer::Update(double wallTime, float dt) {
     }
 
     if (m_transport.state == TransportState::Playing) {
+#if !SHADERLAB_TINY_PLAYER
+        // The music's device clock drives time while it plays; frame deltas otherwise.
+        const AudioClockSample audioClock = m_audio ? m_audio->SampleClock() : AudioClockSample{};
+        if (audioClock.valid && m_transport.clockSource == TransportClockSource::AudioDevice) {
+            m_transport.timeSeconds = (std::max)(0.0, m_audioClock.Update(wallTime,
+                                                                          m_transport.audioOriginSeconds + audioClock.CursorSeconds(),
+                                                                          audioClock.outputLatencySeconds));
+        } else {
+            m_audioClock.Reset();
+            m_transport.timeSeconds += dt;
+        }
+#else
         m_transport.timeSeconds += dt;
+#endif
         
         // Input Handling for Debug Overlay (Alt+D)
 #if SHADERLAB_RUNTIME_IMGUI
@@ -1912,6 +2496,13 @@ void DemoPlayer::Update(double wallTime, float dt) {
                 m_transport.timeSeconds = 0;
                 m_project.track.currentBeat = 0;
                 m_project.track.lastTriggeredBeat = -1;
+#if !SHADERLAB_TINY_PLAYER
+                // Music rows re-trigger from the top; left running, the music clock would pull time past the end again.
+                if (m_audio) {
+                    m_audio->Stop();
+                }
+                m_audioClock.Reset();
+#endif
             } else {
                 m_transport.state = TransportState::Stopped;
 #if !SHADERLAB_TINY_PLAYER
@@ -1924,76 +2515,81 @@ void DemoPlayer::Update(double wallTime, float dt) {
         }
 
         if (track.currentBeat > track.lastTriggeredBeat) {
-             for (int b = track.lastTriggeredBeat + 1; b <= track.currentBeat; ++b) {
-                 for(auto& row : track.rows) {
-                     if (row.rowId == b) {
-                         // Scene
-                         if (!row.transitionPresetStem.empty() && row.transitionDuration > 0) {
-                            m_transitionActive = true;
-                            m_transitionFromIndex = m_activeSceneIndex;
-                            m_transitionFromOffset = m_activeSceneOffset;
-                            m_transitionFromStartBeat = m_activeSceneStartBeat;
-                            m_transitionToStartBeat = static_cast<double>(b);
-                            int target = row.sceneIndex;
-                            float targetOffset = row.timeOffset;
-
-                            if (target == -1) {
-                                const TrackerRow* nextRow = FindNextSceneRow(track, b);
-                                if (nextRow) {
-                                    target = nextRow->sceneIndex;
-                                    targetOffset = nextRow->timeOffset;
-                                    m_transitionToStartBeat = static_cast<double>(nextRow->rowId);
-                                }
-                            }
-
-                            if (target == -1) {
-                                target = m_activeSceneIndex;
-                                targetOffset = m_activeSceneOffset;
-                                m_transitionToStartBeat = m_activeSceneStartBeat;
-                            } else if (target == m_activeSceneIndex) {
-                                targetOffset = m_activeSceneOffset;
-                                m_transitionToStartBeat = m_activeSceneStartBeat;
-                            }
-                            m_transitionToIndex = target;
-                            m_transitionToOffset = targetOffset;
-                            m_transitionStartBeat = (double)b;
-                            m_transitionDurationBeats = (double)row.transitionDuration;
-                            m_currentTransitionStem = row.transitionPresetStem;
-                            m_pendingActiveScene = target;
-                         } else if (row.sceneIndex >= 0) {
-                             if (m_transitionJustCompletedBeat == row.rowId &&
-                                 row.sceneIndex == m_activeSceneIndex) {
-                                 continue;
-                             }
-                             if (m_transitionActive && row.sceneIndex == m_pendingActiveScene) {
-                                 continue;
-                             }
-                             m_transitionActive = false;
-                             SetActiveScene(row.sceneIndex);
-                             m_activeSceneStartBeat = static_cast<double>(b);
-                             m_activeSceneOffset = row.timeOffset;
-                         }
+             m_eventIndex.Sync(track);
+             m_eventIndex.CollectRows(track, track.lastTriggeredBeat, track.currentBeat, m_triggeredRows);
+             for (const auto& triggered : m_triggeredRows) {
+                 const int b = triggered.first;
+                 const TrackerRow& row = *triggered.second;
+                 // Scene
+                 if (!row.transitionPresetStem.empty() && row.transitionDuration > 0) {
+                    m_transitionActive = true;
+                    m_transitionFromIndex = m_activeSceneIndex;
+                    m_transitionFromOffset = m_activeSceneOffset;
+                    m_transitionFromStartBeat = m_activeSceneStartBeat;
+                    m_transitionToStartBeat = static_cast<double>(b);
+                    int target = row.sceneIndex;
+                    float targetOffset = row.timeOffset;
+
+                    if (target == -1) {
+                        const TrackerRow* nextRow = m_eventIndex.FindNextSceneRow(track, b);
+                        if (nextRow) {
+                            target = nextRow->sceneIndex;
+                            targetOffset = nextRow->timeOffset;
+                            m_transitionToStartBeat = static_cast<double>(nextRow->rowId);
+                        }
+                    }
+
+                    if (target == -1) {
+                        target = m_activeSceneIndex;
+                        targetOffset = m_activeSceneOffset;
+                        m_transitionToStartBeat = m_activeSceneStartBeat;
+                    } else if (target == m_activeSceneIndex) {
+                        targetOffset = m_activeSceneOffset;
+                        m_transitionToStartBeat = m_activeSceneStartBeat;
+                    }
+                    m_transitionToIndex = target;
+                    m_transitionToOffset = targetOffset;
+                    m_transitionStartBeat = (double)b;
+                    m_transitionDurationBeats = (double)row.transitionDuration;
+                    m_currentTransitionStem = row.transitionPresetStem;
+                    m_pendingActiveScene = target;
+                 } else if (row.sceneIndex >= 0) {
+                     if (m_transitionJustCompletedBeat == row.rowId &&
+                         row.sceneIndex == m_activeSceneIndex) {
+                         continue;
+                     }
+                     if (m_transitionActive && row.sceneIndex == m_pendingActiveScene) {
+                         continue;
+                     }
+                     m_transitionActive = false;
+                     SetActiveScene(row.sceneIndex);
+                     m_activeSceneStartBeat = static_cast<double>(b);
+                     m_activeSceneOffset = row.timeOffset;
+                 }
                          
 #if !SHADERLAB_TINY_PLAYER
-                         // Audio
-                         if (row.musicIndex >= 0 && row.musicIndex < (int)m_project.audioLibrary.size() && m_audio) {
-                             auto& clip = m_project.audioLibrary[row.musicIndex];
-                             if (loadAudioClip(clip, PackageManager::Get().IsPacked())) {
-                                 m_audio->Play();
-                             }
-                             if(clip.bpm > 0) m_transport.bpm = clip.bpm;
-                         }
+                 // Audio
+                 if (row.musicIndex >= 0 && row.musicIndex < (int)m_project.audioLibrary.size() && m_audio) {
+                     auto& clip = m_project.audioLibrary[row.musicIndex];
+                     if (loadAudioClip(clip, PackageManager::Get().IsPacked())) {
+                         m_audio->Play();
+                         m_transport.audioOriginSeconds = static_cast<double>(b) * 60.0 / static_cast<double>((std::max)(1.0f, m_transport.bpm));
+                     }
+                     if(clip.bpm > 0) m_transport.bpm = clip.bpm;
+                 }
+                 // One-shot: plays from the preloaded bank, no I/O here
+                 if (row.oneShotIndex >= 0 && m_audio) {
+                     m_audio->TriggerOneShot(row.oneShotIndex);
+                 }
 #endif
-                         // Stop
-                         if (row.stop) {
-                             m_transport.state = TransportState::Stopped;
+                 // Stop
+                 if (row.stop) {
+                     m_transport.state = TransportState::Stopped;
 #if !SHADERLAB_TINY_PLAYER
-                             if (m_audio) {
-                                 m_audio->Stop();
-                             }
-#endif
-                         }
+                     if (m_audio) {
+                         m_audio->Stop();
                      }
+#endif
                  }
              }
              track.lastTriggeredBeat = track.currentBeat;
@@ -2001,6 +2597,16 @@ void DemoPlayer::Update(double wallTime, float dt) {
         m_transitionJustCompletedBeat = -1;
     }
 
+#if !SHADERLAB_TINY_PLAYER
+    AudioClockSnapshot snapshot;
+    snapshot.timeSeconds = m_transport.timeSeconds;
+    snapshot.wallSeconds = wallTime;
+    snapshot.rate = m_audioClock.IsLocked() ? m_audioClock.GetTelemetry().rate : 1.0;
+    snapshot.bpm = m_transport.bpm;
+    snapshot.playing = m_transport.state == TransportState::Playing;
+    m_clockSnapshot.Publish(snapshot);
+#endif
+
 #if SHADERLAB_RUNTIME_DEBUG_LOG && !SHADERLAB_TINY_PLAYER
     if (m_transport.state != m_debugLastTransportState) {
         SHADERLAB_RT_DEBUG_LOG(
@@ -2057,43 +2663,9 @@ bool DemoPlayer::CompileScene(int sceneIndex) {
     return sceneReady;
 #else
 
-    if (!scene.precompiledPath.empty()) {
-        std::vector<uint8_t> data;
-        if (PackageManager::Get().IsPacked()) {
-            if (PackageManager::Get().HasFile(scene.precompiledPath)) {
-                data = PackageManager::Get().GetFile(scene.precompiledPath);
-                SHADERLAB_RT_DEBUG_LOG("Loaded packed scene shader: " + scene.precompiledPath + " (" + std::to_string(data.size()) + " bytes)");
-            } else {
-                SHADERLAB_RT_DEBUG_LOG_ERROR("Packed scene shader is missing: " + scene.precompiledPath);
-            }
-        } else {
-            std::string resolvedPath;
-            LoadBytecodeFromPathCandidates(scene.precompiledPath, m_manifestPath, data, &resolvedPath);
-            if (!data.empty()) {
-                SHADERLAB_RT_DEBUG_LOG("Loaded disk scene shader: " + resolvedPath + " (" + std::to_string(data.size()) + " bytes)");
-            }
-        }
-
-        if (!data.empty()) {
-            scene.pipelineState = m_renderer->CreatePSOFromBytecode(data);
-            if (scene.pipelineState) {
-                SHADERLAB_RT_DEBUG_LOG("Scene PSO created from precompiled shader: " + scene.name);
-                sceneReady = true;
-            } else {
-                SHADERLAB_RT_DEBUG_LOG_ERROR("Failed to create PSO from precompiled shader for scene " + scene.name);
-#if !SHADERLAB_TINY_PLAYER
-                RuntimeErr("E208", "precompiled scene pso create failed");
-#endif
-            }
-        }
-        if (data.empty()) {
-            SHADERLAB_RT_DEBUG_LOG_ERROR("No precompiled scene shader data for: " + scene.name);
-        }
-    }
-
-    if (!sceneReady) {
-        SHADERLAB_RT_DEBUG_LOG_ERROR("Missing precompiled scene shader for scene " + scene.name);
-    }
+    ShaderJob sceneJob = MakeSceneShaderJob(scene, sceneIndex);
+    ShaderJobResult sceneResult = ProduceRuntimeShaderBytecode(sceneJob, m_manifestPath);
+    sceneReady = ApplyShaderJobResult(sceneJob, sceneResult);
 
     for (size_t fxIndex = 0; fxIndex < scene.postFxChain.size(); ++fxIndex) {
         auto& fx = scene.postFxChain[fxIndex];
@@ -2114,6 +2686,11 @@ bool DemoPlayer::CompileScene(int sceneIndex) {
 #endif
 }
 
+uint32_t DemoPlayer::GetFrameSlot() const {
+    CommandQueue* queue = m_swapchain ? m_swapchain->GetCommandQueue() : nullptr;
+    return queue ? queue->GetFrameSlot() : 0;
+}
+
 void DemoPlayer::EnsureSceneTexture(int sceneIndex) {
     if (sceneIndex < 0 || sceneIndex >= (int)m_project.scenes.size()) return;
     auto& scene = m_project.scenes[sceneIndex];
@@ -2153,7 +2730,7 @@ void DemoPlayer::EnsureSceneTexture(int sceneIndex) {
             
         D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
         heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-        heapDesc.NumDescriptors = 8 * kMaxPostFxChain;
+        heapDesc.NumDescriptors = kSceneTableDescriptors * CommandQueue::kMaxFramesInFlight;
         heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
         m_device->GetDevice()->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&scene.srvHeap));
 
@@ -2171,48 +2748,16 @@ void DemoPlayer::EnsureSceneTexture(int sceneIndex) {
 void DemoPlayer::EnsurePostFxResources(Scene& scene) {
     if (m_width == 0 || m_height == 0 || !m_device) return;
 
-    bool needsCreate = !scene.postFxTextureA || !scene.postFxTextureB;
-    if (scene.postFxTextureA) {
-        auto desc = scene.postFxTextureA->GetDesc();
-        if (desc.Width != m_width || desc.Height != m_height) needsCreate = true;
-    }
-    if (!needsCreate) return;
+    // Ping-pong targets come from m_transientTextures per pass; only descriptors stay per scene.
+    if (scene.postFxSrvHeap && scene.postFxRtvHeap) return;
 
-    scene.postFxTextureA.Reset();
-    scene.postFxTextureB.Reset();
     scene.postFxSrvHeap.Reset();
     scene.postFxRtvHeap.Reset();
     scene.postFxValid = false;
 
-    D3D12_HEAP_PROPERTIES heapProps = { D3D12_HEAP_TYPE_DEFAULT };
-    D3D12_RESOURCE_DESC texDesc = {};
-    texDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
-    texDesc.Width = m_width;
-    texDesc.Height = m_height;
-    texDesc.DepthOrArraySize = 1;
-    texDesc.MipLevels = 1;
-    texDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-    texDesc.SampleDesc.Count = 1;
-    texDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
-
-    float clearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
-    D3D12_CLEAR_VALUE clearValue = {};
-    clearValue.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-    memcpy(clearValue.Color, clearColor, sizeof(clearColor));
-
-    m_device->GetDevice()->CreateCommittedResource(
-        &heapProps, D3D12_HEAP_FLAG_NONE, &texDesc,
-        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
-        &clearValue, IID_PPV_ARGS(&scene.postFxTextureA));
-
-    m_device->GetDevice()->CreateCommittedResource(
-        &heapProps, D3D12_HEAP_FLAG_NONE, &texDesc,
-        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
-        &clearValue, IID_PPV_ARGS(&scene.postFxTextureB));
-
     D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
     heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-    heapDesc.NumDescriptors = 8 * kMaxPostFxChain;
+    heapDesc.NumDescriptors = kSceneTableDescriptors * kMaxPostFxChain * CommandQueue::kMaxFramesInFlight;
     heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
     m_device->GetDevice()->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&scene.postFxSrvHeap));
 
@@ -2282,41 +2827,13 @@ bool DemoPlayer::CompilePostFxEffect(Scene::PostFXEffect& effect, int sceneIndex
     }
     return false;
 #else
-    (void)sceneIndex;
-    (void)fxIndex;
-
-    if (!effect.precompiledPath.empty()) {
-        std::vector<uint8_t> data;
-        if (PackageManager::Get().IsPacked()) {
-            if (PackageManager::Get().HasFile(effect.precompiledPath)) {
-                data = PackageManager::Get().GetFile(effect.precompiledPath);
-                SHADERLAB_RT_DEBUG_LOG("Loaded packed post FX shader: " + effect.precompiledPath + " (" + std::to_string(data.size()) + " bytes)");
-            } else {
-                SHADERLAB_RT_DEBUG_LOG_ERROR("Packed post FX shader is missing: " + effect.precompiledPath);
-            }
-        } else {
-            std::string resolvedPath;
-            LoadBytecodeFromPathCandidates(effect.precompiledPath, m_manifestPath, data, &resolvedPath);
-            if (!data.empty()) {
-                SHADERLAB_RT_DEBUG_LOG("Loaded disk post FX shader: " + resolvedPath + " (" + std::to_string(data.size()) + " bytes)");
-            }
-        }
-
-        if (!data.empty()) {
-            effect.pipelineState = m_renderer->CreatePSOFromBytecode(data);
-            if (effect.pipelineState) {
-                effect.isDirty = false;
-                effect.lastCompiledCode = effect.shaderCode;
-                SHADERLAB_RT_DEBUG_LOG("Post FX PSO created from precompiled shader: " + effect.name);
-                return true;
-            }
-        }
-        if (data.empty()) {
-            SHADERLAB_RT_DEBUG_LOG_ERROR("No precompiled post FX shader data for: " + effect.name);
-        }
+    const ShaderJobResult result = ProduceRuntimeShaderBytecode(MakePostFxShaderJob(effect, sceneIndex, fxIndex), m_manifestPath);
+    if (CreatePostFxPipeline(m_renderer, effect, result.bytecode)) {
+        SHADERLAB_RT_DEBUG_LOG("Post FX PSO created from precompiled shader: " + effect.name);
+        return true;
     }
 
-    SHADERLAB_RT_DEBUG_LOG_ERROR("Missing precompiled post FX shader for: " + effect.name);
+    SHADERLAB_RT_DEBUG_LOG_ERROR("Missing precompiled post FX shader for: " + effect.name + " (" + result.error + ")");
 
     return false;
 #endif
@@ -2329,68 +2846,10 @@ bool DemoPlayer::CompileComputeEffect(Scene::ComputeEffect& effect, int sceneInd
     (void)computeIndex;
     return false;
 #else
-    (void)sceneIndex;
-    (void)computeIndex;
     if (!m_device) return false;
-    if (!EnsureRuntimeComputeRootSignature(m_device)) return false;
 
-    std::vector<uint8_t> bytecode;
-
-    if (!effect.precompiledPath.empty()) {
-        if (PackageManager::Get().IsPacked()) {
-            if (PackageManager::Get().HasFile(effect.precompiledPath)) {
-                bytecode = PackageManager::Get().GetFile(effect.precompiledPath);
-            }
-        } else {
-            LoadBytecodeFromPathCandidates(effect.precompiledPath, m_manifestPath, bytecode);
-        }
-    }
-
-    if (bytecode.empty()) {
-        if (effect.shaderCode.empty()) {
-            return false;
-        }
-        const std::string entryPoint = effect.entryPoint.empty() ? "main" : effect.entryPoint;
-        ComPtr<ID3DBlob> shaderBlob;
-        ComPtr<ID3DBlob> errorBlob;
-        if (FAILED(D3DCompile(effect.shaderCode.c_str(),
-                              effect.shaderCode.size(),
-                              "compute_runtime.hlsl",
-                              nullptr,
-                              nullptr,
-                              entryPoint.c_str(),
-                              "cs_5_0",
-                              D3DCOMPILE_ENABLE_STRICTNESS,
-                              0,
-                              shaderBlob.GetAddressOf(),
-                              errorBlob.GetAddressOf()))) {
-            return false;
-        }
-        if (!shaderBlob) {
-            return false;
-        }
-        const uint8_t* begin = static_cast<const uint8_t*>(shaderBlob->GetBufferPointer());
-        bytecode.assign(begin, begin + shaderBlob->GetBufferSize());
-    }
-
-    if (bytecode.empty()) {
-        return false;
-    }
-
-    D3D12_COMPUTE_PIPELINE_STATE_DESC desc = {};
-    desc.pRootSignature = g_runtimeComputeRootSignature.Get();
-    desc.CS = { bytecode.data(), bytecode.size() };
-
-    ComPtr<ID3D12PipelineState> pso;
-    if (FAILED(m_device->GetDevice()->CreateComputePipelineState(&desc, IID_PPV_ARGS(pso.GetAddressOf())))) {
-        return false;
-    }
-
-    effect.pipelineState = pso;
-    effect.compiledShaderBytes = bytecode.size();
-    effect.isDirty = false;
-    effect.lastCompiledCode = effect.shaderCode;
-    return true;
+    const ShaderJobResult result = ProduceRuntimeShaderBytecode(MakeComputeShaderJob(effect, sceneIndex, computeIndex), m_manifestPath);
+    return CreateRuntimeComputePipeline(m_device, effect, result.bytecode);
 #endif
 }
 
@@ -2447,6 +2906,9 @@ ID3D12Resource* DemoPlayer::ApplyComputeChain(ID3D12GraphicsCommandList* command
     if (!EnsureRuntimeComputeRootSignature(m_device) || !EnsureRuntimeComputeDispatchResources(m_device)) {
         return inputTexture;
     }
+    if (!m_descriptorCache.IsInitialized() && !m_descriptorCache.Initialize(m_device)) {
+        return inputTexture;
+    }
 
     bool anyEnabled = false;
     for (const auto& effect : chain) {
@@ -2457,27 +2919,22 @@ ID3D12Resource* DemoPlayer::ApplyComputeChain(ID3D12GraphicsCommandList* command
     }
     if (!anyEnabled) return inputTexture;
 
-    auto& resources = g_runtimeComputeSceneResources[sceneIndex];
-    const bool recreate = !resources.textureA || !resources.textureB || resources.width != m_width || resources.height != m_height;
-    if (recreate) {
-        resources = {};
-        if (!CreateRuntimeUavTexture(m_device, m_width, m_height, resources.textureA) ||
-            !CreateRuntimeUavTexture(m_device, m_width, m_height, resources.textureB)) {
-            resources = {};
-            return inputTexture;
-        }
-        resources.width = m_width;
-        resources.height = m_height;
+    ID3D12Resource* outputA = m_transientTextures.Acquire(m_width, m_height, DXGI_FORMAT_R8G8B8A8_UNORM, D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS);
+    ID3D12Resource* outputB = m_transientTextures.Acquire(m_width, m_height, DXGI_FORMAT_R8G8B8A8_UNORM, D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS);
+    // Keeps the chain's result held and hands the other target back to the pool.
+    auto finish = [&](ID3D12Resource* result) {
+        if (result != outputA) m_transientTextures.Release(outputA);
+        if (result != outputB) m_transientTextures.Release(outputB);
+        return result;
+    };
+    if (!outputA || !outputB) {
+        return finish(inputTexture);
     }
 
     ID3D12Device* device = m_device->GetDevice();
     const UINT step = DescriptorStep(device);
-    const auto heapCpu = g_runtimeComputeDescriptorHeap->GetCPUDescriptorHandleForHeapStart();
-    const auto heapGpu = g_runtimeComputeDescriptorHeap->GetGPUDescriptorHandleForHeapStart();
 
     ID3D12Resource* currentInput = inputTexture;
-    ID3D12Resource* outputA = resources.textureA.Get();
-    ID3D12Resource* outputB = resources.textureB.Get();
     ID3D12Resource* currentOutput = outputA;
 
     for (auto& effect : chain) {
@@ -2490,22 +2947,15 @@ ID3D12Resource* DemoPlayer::ApplyComputeChain(ID3D12GraphicsCommandList* command
 
         EnsureComputeHistory(effect);
 
-        D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-        srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-        srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-        srvDesc.Texture2D.MipLevels = 1;
-
-        D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
-        uavDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-        uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
-
-        D3D12_CPU_DESCRIPTOR_HANDLE inputCpu = heapCpu;
-        device->CreateShaderResourceView(currentInput, &srvDesc, inputCpu);
+        if (!g_runtimeComputeParamsMapped || !g_runtimeComputeParamsBuffer) {
+            return finish(currentInput);
+        }
 
+        // t0 input, t1..t8 history (newest first), u0 output. History rotates each frame, so
+        // one table is kept per history phase and steady-state frames write nothing.
+        DescriptorBinding views[kComputeDescriptorCount];
+        views[0] = Dx12DescriptorCache::TextureView(currentInput);
         for (uint32_t i = 0; i < kComputeHistorySlots; ++i) {
-            D3D12_CPU_DESCRIPTOR_HANDLE histCpu = heapCpu;
-            histCpu.ptr += static_cast<SIZE_T>(step) * (1 + i);
             ID3D12Resource* historyRes = nullptr;
             const int historyCount = static_cast<int>(effect.historyTextures.size());
             if (historyCount > 0) {
@@ -2515,15 +2965,14 @@ ID3D12Resource* DemoPlayer::ApplyComputeChain(ID3D12GraphicsCommandList* command
                 historyRes = effect.historyTextures[static_cast<size_t>(readIndex)].Get();
             }
             if (!historyRes) historyRes = currentInput;
-            device->CreateShaderResourceView(historyRes, &srvDesc, histCpu);
+            views[1 + i] = Dx12DescriptorCache::TextureView(historyRes);
         }
+        views[9] = Dx12DescriptorCache::TextureView(currentOutput, DescriptorViewKind::RWTexture2D);
 
-        D3D12_CPU_DESCRIPTOR_HANDLE outputCpu = heapCpu;
-        outputCpu.ptr += static_cast<SIZE_T>(step) * 9;
-        device->CreateUnorderedAccessView(currentOutput, nullptr, &uavDesc, outputCpu);
-
-        if (!g_runtimeComputeParamsMapped || !g_runtimeComputeParamsBuffer) {
-            return currentInput;
+        D3D12_GPU_DESCRIPTOR_HANDLE tableGpu = {};
+        const uint64_t tableKey = DescriptorCache::MakeKey(&effect, static_cast<uint32_t>(effect.historyIndex));
+        if (!m_descriptorCache.AcquireTable(tableKey, views, kComputeDescriptorCount, tableGpu)) {
+            continue;
         }
 
         ComputeDispatchParams params{};
@@ -2535,14 +2984,10 @@ ID3D12Resource* DemoPlayer::ApplyComputeChain(ID3D12GraphicsCommandList* command
         params.invWidth = m_width > 0 ? 1.0f / static_cast<float>(m_width) : 0.0f;
         params.invHeight = m_height > 0 ? 1.0f / static_cast<float>(m_height) : 0.0f;
         params.frame = static_cast<uint32_t>(m_transport.timeSeconds * 60.0);
-        std::memcpy(g_runtimeComputeParamsMapped, &params, sizeof(params));
-
-        D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = {};
-        cbvDesc.BufferLocation = g_runtimeComputeParamsBuffer->GetGPUVirtualAddress();
-        cbvDesc.SizeInBytes = Align256(static_cast<uint32_t>(sizeof(ComputeDispatchParams)));
-        D3D12_CPU_DESCRIPTOR_HANDLE cbvCpu = heapCpu;
-        cbvCpu.ptr += static_cast<SIZE_T>(step) * 10;
-        device->CreateConstantBufferView(&cbvDesc, cbvCpu);
+        const D3D12_GPU_VIRTUAL_ADDRESS paramsAddress = WriteRuntimeComputeParams(params);
+        if (paramsAddress == 0) {
+            return finish(currentInput);
+        }
 
         D3D12_RESOURCE_BARRIER beginBarriers[2] = {};
         beginBarriers[0].Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
@@ -2558,23 +3003,21 @@ ID3D12Resource* DemoPlayer::ApplyComputeChain(ID3D12GraphicsCommandList* command
         beginBarriers[1].Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
         commandList->ResourceBarrier(2, beginBarriers);
 
-        ID3D12DescriptorHeap* heaps[] = { g_runtimeComputeDescriptorHeap.Get() };
+        ID3D12DescriptorHeap* heaps[] = { m_descriptorCache.GetHeap() };
         commandList->SetDescriptorHeaps(1, heaps);
         commandList->SetComputeRootSignature(g_runtimeComputeRootSignature.Get());
         commandList->SetPipelineState(effect.pipelineState.Get());
 
-        D3D12_GPU_DESCRIPTOR_HANDLE inputGpu = heapGpu;
-        D3D12_GPU_DESCRIPTOR_HANDLE historyGpu = heapGpu;
+        D3D12_GPU_DESCRIPTOR_HANDLE inputGpu = tableGpu;
+        D3D12_GPU_DESCRIPTOR_HANDLE historyGpu = tableGpu;
         historyGpu.ptr += static_cast<UINT64>(step) * 1;
-        D3D12_GPU_DESCRIPTOR_HANDLE outputGpu = heapGpu;
+        D3D12_GPU_DESCRIPTOR_HANDLE outputGpu = tableGpu;
         outputGpu.ptr += static_cast<UINT64>(step) * 9;
-        D3D12_GPU_DESCRIPTOR_HANDLE cbvGpu = heapGpu;
-        cbvGpu.ptr += static_cast<UINT64>(step) * 10;
 
         commandList->SetComputeRootDescriptorTable(0, inputGpu);
         commandList->SetComputeRootDescriptorTable(1, historyGpu);
         commandList->SetComputeRootDescriptorTable(2, outputGpu);
-        commandList->SetComputeRootDescriptorTable(3, cbvGpu);
+        commandList->SetComputeRootConstantBufferView(3, paramsAddress);
 
         const uint32_t tgx = (std::max)(1u, effect.threadGroupX);
         const uint32_t tgy = (std::max)(1u, effect.threadGroupY);
@@ -2632,7 +3075,7 @@ ID3D12Resource* DemoPlayer::ApplyComputeChain(ID3D12GraphicsCommandList* command
         currentOutput = (currentOutput == outputA) ? outputB : outputA;
     }
 
-    return currentInput;
+    return finish(currentInput);
 #endif
 }
 
@@ -2649,7 +3092,15 @@ ID3D12Resource* DemoPlayer::ApplyPostFxChain(ID3D12GraphicsCommandList* commandL
     if (!anyEnabled) return inputTexture;
 
     EnsurePostFxResources(scene);
-    if (!scene.postFxTextureA || !scene.postFxTextureB || !scene.postFxSrvHeap || !scene.postFxRtvHeap) return inputTexture;
+    if (!scene.postFxSrvHeap || !scene.postFxRtvHeap) return inputTexture;
+
+    ID3D12Resource* ping = m_transientTextures.Acquire(m_width, m_height, DXGI_FORMAT_R8G8B8A8_UNORM, D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET);
+    ID3D12Resource* pong = m_transientTextures.Acquire(m_width, m_height, DXGI_FORMAT_R8G8B8A8_UNORM, D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET);
+    if (!ping || !pong) {
+        m_transientTextures.Release(ping);
+        m_transientTextures.Release(pong);
+        return inputTexture;
+    }
 
     auto device = m_device->GetDevice();
     auto handleStep = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
@@ -2692,8 +3143,6 @@ ID3D12Resource* DemoPlayer::ApplyPostFxChain(ID3D12GraphicsCommandList* commandL
         }
     };
 
-    ID3D12Resource* ping = scene.postFxTextureA.Get();
-    ID3D12Resource* pong = scene.postFxTextureB.Get();
     ID3D12Resource* currentInput = inputTexture;
     ID3D12Resource* currentOutput = ping;
 
@@ -2740,7 +3189,7 @@ ID3D12Resource* DemoPlayer::ApplyPostFxChain(ID3D12GraphicsCommandList* commandL
         barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
         commandList->ResourceBarrier(1, &barrier);
 
-        int baseSlot = passIndex * 8;
+        const int baseSlot = static_cast<int>((GetFrameSlot() * kMaxPostFxChain + passIndex) * kSceneTableDescriptors);
         bindInput(currentInput, fx, baseSlot);
         ID3D12DescriptorHeap* heaps[] = { scene.postFxSrvHeap.Get() };
         commandList->SetDescriptorHeaps(1, heaps);
@@ -2801,6 +3250,10 @@ ID3D12Resource* DemoPlayer::ApplyPostFxChain(ID3D12GraphicsCommandList* commandL
         passIndex++;
     }
 
+    // The output stays held until the frame ends; the other target is free for the next pass.
+    if (currentInput != ping) m_transientTextures.Release(ping);
+    if (currentInput != pong) m_transientTextures.Release(pong);
+
     scene.postFxValid = true;
     return currentInput;
 }
@@ -2818,7 +3271,11 @@ ID3D12Resource* DemoPlayer::GetSceneFinalTexture(ID3D12GraphicsCommandList* comm
     }
 #if !SHADERLAB_TINY_PLAYER
     if (!scene.computeEffectChain.empty()) {
-        output = ApplyComputeChain(commandList, sceneIndex, scene.computeEffectChain, output, timeSeconds);
+        ID3D12Resource* computeOutput = ApplyComputeChain(commandList, sceneIndex, scene.computeEffectChain, output, timeSeconds);
+        if (computeOutput != output) {
+            m_transientTextures.Release(output);
+        }
+        output = computeOutput;
     }
 #endif
     return output;
@@ -2848,10 +3305,12 @@ void DemoPlayer::RenderScene(ID3D12GraphicsCommandList* cmd, int sceneIndex, dou
     if (!scene.pipelineState) { m_renderStack.pop_back(); return; }
 
     // 2. Bindings
+    const UINT sceneTableOffset = GetFrameSlot() * kSceneTableDescriptors;
     if (scene.srvHeap) {
         auto device = m_device->GetDevice();
         auto handleStep = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
         auto startHandle = scene.srvHeap->GetCPUDescriptorHandleForHeapStart();
+        startHandle.ptr += static_cast<SIZE_T>(sceneTableOffset) * handleStep;
         
         for (int i=0; i<8; ++i) {
             D3D12_CPU_DESCRIPTOR_HANDLE dest = startHandle;
@@ -2880,6 +3339,23 @@ void DemoPlayer::RenderScene(ID3D12GraphicsCommandList* cmd, int sceneIndex, dou
                              }
                         }
                     }
+#if !SHADERLAB_TINY_PLAYER
+                    if (b.bindingType == BindingType::File && b.fileTextureValid && b.textureResource) {
+                        // Baked textures carry their full mip chain; the view shape follows the resource.
+                        srcRes = b.textureResource.Get();
+                        const D3D12_RESOURCE_DESC resDesc = srcRes->GetDesc();
+                        if (resDesc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D) {
+                            srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE3D;
+                            srvDesc.Texture3D.MipLevels = resDesc.MipLevels;
+                        } else if (b.type == TextureType::TextureCube && resDesc.DepthOrArraySize == 6) {
+                            srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
+                            srvDesc.TextureCube.MipLevels = resDesc.MipLevels;
+                        } else {
+                            srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+                            srvDesc.Texture2D.MipLevels = resDesc.MipLevels;
+                        }
+                    }
+#endif
                     
                     if (srcRes) {
                         device->CreateShaderResourceView(srcRes, &srvDesc, dest);
@@ -2924,8 +3400,14 @@ void DemoPlayer::RenderScene(ID3D12GraphicsCommandList* cmd, int sceneIndex, dou
     float fBarBeat = 0.0f;
     float fBarBeat16 = 0.0f;
     ComputeShaderMusicalTiming(m_transport, iBeat, iBar, fBeat, fBarBeat, fBarBeat16);
+    D3D12_GPU_DESCRIPTOR_HANDLE sceneTable = {};
+    if (scene.srvHeap) {
+        sceneTable = scene.srvHeap->GetGPUDescriptorHandleForHeapStart();
+        sceneTable.ptr += static_cast<UINT64>(sceneTableOffset) *
+                          m_device->GetDevice()->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    }
     m_renderer->Render(cmd, scene.pipelineState.Get(), scene.texture.Get(), rtvHandle,
-                       scene.srvHeap ? scene.srvHeap->GetGPUDescriptorHandleForHeapStart() : D3D12_GPU_DESCRIPTOR_HANDLE{},
+                       sceneTable,
                        m_width, m_height, (float)time, iBeat, iBar, fBarBeat16, fBeat, fBarBeat);
 
     // Barrier: RT -> Resource
@@ -2996,12 +3478,18 @@ void DemoPlayer::Render(ID3D12GraphicsCommandList* cmd, ID3D12Resource* renderTa
         float fBarBeat16 = 0.0f;
         ComputeShaderMusicalTiming(m_transport, iBeat, iBar, fBeat, fBarBeat, fBarBeat16);
 
+        D3D12_GPU_DESCRIPTOR_HANDLE sceneTable = {};
+        if (scene.srvHeap) {
+            sceneTable = scene.srvHeap->GetGPUDescriptorHandleForHeapStart();
+            sceneTable.ptr += static_cast<UINT64>(GetFrameSlot() * kSceneTableDescriptors) *
+                              m_device->GetDevice()->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        }
         m_renderer->Render(
             cmd,
             scene.pipelineState.Get(),
             renderTarget,
             rtvHandle,
-            scene.srvHeap ? scene.srvHeap->GetGPUDescriptorHandleForHeapStart() : D3D12_GPU_DESCRIPTOR_HANDLE{},
+            sceneTable,
             m_width,
             m_height,
             static_cast<float>(sceneTime),
@@ -3084,6 +3572,35 @@ void DemoPlayer::Render(ID3D12GraphicsCommandList* cmd, ID3D12Resource* renderTa
             } else {
                 ImGui::Text("Scene: %d", m_activeSceneIndex);
                 if (m_transitionActive) ImGui::TextColored(ImVec4(0.4f,1.0f,0.4f,1.0f), "Transition Active");
+                ImGui::Text("RT pool: %zu textures, %.1f MB (peak %.1f MB)",
+                            m_transientTextures.GetTextureCount(),
+                            static_cast<double>(m_transientTextures.GetAllocatedBytes()) / (1024.0 * 1024.0),
+                            static_cast<double>(m_transientTextures.GetPeakAllocatedBytes()) / (1024.0 * 1024.0));
+                const DescriptorCacheStats& descriptorStats = m_descriptorCache.GetLastFrameStats();
+                ImGui::Text("Descriptors: %u writes, %u/%u tables reused",
+                            descriptorStats.descriptorWrites,
+                            descriptorStats.tableHits,
+                            descriptorStats.tableHits + descriptorStats.tableMisses + descriptorStats.ringTables);
+#if !SHADERLAB_TINY_PLAYER
+                const AudioClockSnapshot clock = m_clockSnapshot.Read();
+                const AudioClockTelemetry& clockStats = m_audioClock.GetTelemetry();
+                if (m_audioClock.IsLocked()) {
+                    ImGui::Text("Audio clock: %.3f s, drift %+.2f ms, jitter %.2f ms, rate %.4f",
+                                clock.timeSeconds, clockStats.driftSeconds * 1000.0, clockStats.jitterSeconds * 1000.0, clockStats.rate);
+                    ImGui::Text("Output latency: %.1f ms, resyncs %u", clockStats.latencySeconds * 1000.0, clockStats.resyncs);
+                } else {
+                    ImGui::Text("Audio clock: free-running (%.3f s)", clock.timeSeconds);
+                }
+                if (m_audio) {
+                    const OneShotStats oneShots = m_audio->GetOneShotStats();
+                    if (oneShots.voices > 0) {
+                        ImGui::Text("One-shots: %u/%u voices (peak %u), %llu steals, latency %.2f ms (max %.2f)",
+                                    oneShots.activeVoices, oneShots.voices, oneShots.peakActiveVoices,
+                                    static_cast<unsigned long long>(oneShots.steals),
+                                    oneShots.lastTriggerLatencyMs, oneShots.maxTriggerLatencyMs);
+                    }
+                }
+#endif
             }
         }
         ImGui::End();
@@ -3152,6 +3669,14 @@ void DemoPlayer::Render(ID3D12GraphicsCommandList* cmd, ID3D12Resource* renderTa
     }
 
     m_renderStack.clear(); 
+    m_transientTextures.BeginFrame(m_swapchain ? m_swapchain->GetCommandQueue() : nullptr);
+#if !SHADERLAB_TINY_PLAYER
+    if (m_descriptorCache.IsInitialized()) {
+        CommandQueue* queue = m_swapchain ? m_swapchain->GetCommandQueue() : nullptr;
+        m_descriptorCache.BeginFrame(queue ? queue->GetFramesInFlight() : 1);
+    }
+    BeginRuntimeComputeParamsFrame(GetFrameSlot());
+#endif
 
     if (m_transitionActive) {
          float beatsPerSec = m_transport.bpm / 60.0f;
@@ -3186,14 +3711,16 @@ void DemoPlayer::Render(ID3D12GraphicsCommandList* cmd, ID3D12Resource* renderTa
              if (m_transitionPSO) {
                  if (!m_transitionSrvHeap) {
                     D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
-                    heapDesc.NumDescriptors = 8; 
+                    heapDesc.NumDescriptors = kSceneTableDescriptors * CommandQueue::kMaxFramesInFlight;
                     heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
                     heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
                     m_device->GetDevice()->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&m_transitionSrvHeap));
                  }
                  auto device = m_device->GetDevice();
                  auto handleStep = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+                 const UINT transitionTableOffset = GetFrameSlot() * kSceneTableDescriptors;
                  auto start = m_transitionSrvHeap->GetCPUDescriptorHandleForHeapStart();
+                 start.ptr += static_cast<SIZE_T>(transitionTableOffset) * handleStep;
                  
                  auto Bind = [&](ID3D12Resource* res, int slot) {
                      D3D12_CPU_DESCRIPTOR_HANDLE dest = start;
@@ -3230,8 +3757,10 @@ void DemoPlayer::Render(ID3D12GraphicsCommandList* cmd, ID3D12Resource* renderTa
                  float fBarBeat = 0.0f;
                  float fBarBeat16 = 0.0f;
                  ComputeShaderMusicalTiming(m_transport, iBeat, iBar, fBeat, fBarBeat, fBarBeat16);
+                 D3D12_GPU_DESCRIPTOR_HANDLE transitionTable = m_transitionSrvHeap->GetGPUDescriptorHandleForHeapStart();
+                 transitionTable.ptr += static_cast<UINT64>(transitionTableOffset) * handleStep;
                  m_renderer->Render(cmd, m_transitionPSO.Get(), renderTarget, rtvHandle,
-                     m_transitionSrvHeap->GetGPUDescriptorHandleForHeapStart(), m_width, m_height, (float)progress,
+                     transitionTable, m_width, m_height, (float)progress,
                      iBeat, iBar, fBarBeat16, fBeat, fBarBeat);
              } else {
                  float clearColor[] = {0, 0, 0, 1};
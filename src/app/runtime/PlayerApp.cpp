@@ -335,7 +335,7 @@ int RunPlayerApp(HINSTANCE hInstance, const PlayerLaunchOptions& options) {
 #endif
 
     g_Resources.commandQueue = new CommandQueue();
-    if (!g_Resources.commandQueue->Initialize(g_Resources.device, D3D12_COMMAND_LIST_TYPE_DIRECT)) {
+    if (!g_Resources.commandQueue->Initialize(g_Resources.device, D3D12_COMMAND_LIST_TYPE_DIRECT, Swapchain::BUFFER_COUNT)) {
 #if !SHADERLAB_TINY_PLAYER
         RuntimeStartupPolicy::EmitRuntimeError("E103", "command queue init failed");
 #endif
@@ -442,6 +442,7 @@ int RunPlayerApp(HINSTANCE hInstance, const PlayerLaunchOptions& options) {
             double dt = static_cast<double>(currTime.QuadPart - lastTime.QuadPart) / static_cast<double>(freq.QuadPart);
             lastTime = currTime;
 
+            g_Resources.commandQueue->BeginFrame();
             g_Resources.player->Update(0.0, static_cast<float>(dt));
 
             g_Resources.commandQueue->ResetCommandList();
@@ -469,7 +470,7 @@ int RunPlayerApp(HINSTANCE hInstance, const PlayerLaunchOptions& options) {
 
             g_Resources.commandQueue->ExecuteCommandList();
             g_Resources.swapchain->Present(g_Runtime.vsyncEnabled);
-            g_Resources.commandQueue->WaitForGPU();
+            g_Resources.commandQueue->EndFrame();
 
             g_Runtime.fpsAccumSeconds += dt;
             g_Runtime.fpsAccumFrames += 1;
@@ -64,6 +64,7 @@ bool PresentInitialBlackFrame(CommandQueue* commandQueue, Swapchain* swapchain)
 
     commandQueue->ExecuteCommandList();
     swapchain->Present(true);
+    commandQueue->EndFrame();
     return true;
 }
 
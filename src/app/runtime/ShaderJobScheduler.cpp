@@ -0,0 +1,109 @@
+#include "ShaderLab/Runtime/ShaderJobScheduler.h"
+
+#include <algorithm>
+
+namespace ShaderLab {
+
+ShaderJobScheduler::~ShaderJobScheduler() {
+    Cancel();
+}
+
+uint32_t ShaderJobScheduler::DefaultWorkerCount() {
+    const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    if (hardwareThreads <= 1) {
+        return 1;
+    }
+    return (std::min)(hardwareThreads - 1, 8u);
+}
+
+void ShaderJobScheduler::Start(IShaderJobCompiler* compiler, std::vector<ShaderJob> jobs, uint32_t workerCount) {
+    Cancel();
+
+    m_compiler = compiler;
+    m_jobs = std::move(jobs);
+    m_results.assign(m_jobs.size(), ShaderJobResult{});
+    m_ready.assign(m_jobs.size(), 0);
+    m_nextJob = 0;
+    m_nextDeliver = 0;
+    m_cancelled.store(false);
+
+    if (!m_compiler) {
+        m_cancelled.store(true);
+        return;
+    }
+
+    const size_t threadCount = (std::min)(static_cast<size_t>(workerCount), m_jobs.size());
+    m_workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        m_workers.emplace_back(&ShaderJobScheduler::WorkerLoop, this);
+    }
+}
+
+void ShaderJobScheduler::WorkerLoop() {
+    for (;;) {
+        size_t jobIndex = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_cancelled.load() || m_nextJob >= m_jobs.size()) {
+                return;
+            }
+            jobIndex = m_nextJob++;
+        }
+
+        ShaderJobResult result = m_compiler->Compile(m_jobs[jobIndex]);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_cancelled.load()) {
+            return;
+        }
+        m_results[jobIndex] = std::move(result);
+        m_ready[jobIndex] = 1;
+    }
+}
+
+size_t ShaderJobScheduler::Poll(std::vector<Completed>& outCompleted, size_t maxResults) {
+    size_t delivered = 0;
+    while (delivered < maxResults && !IsFinished()) {
+        const size_t index = m_nextDeliver;
+        if (m_workers.empty()) {
+            // Inline mode: the caller's thread does the work, one job per slot.
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_nextJob = index + 1;
+            }
+            m_results[index] = m_compiler->Compile(m_jobs[index]);
+            m_ready[index] = 1;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_ready[index]) {
+                break;
+            }
+            outCompleted.push_back({m_jobs[index], std::move(m_results[index])});
+            m_results[index] = ShaderJobResult{};
+            ++m_nextDeliver;
+        }
+        ++delivered;
+    }
+    return delivered;
+}
+
+void ShaderJobScheduler::Cancel() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cancelled.store(true);
+    }
+    JoinWorkers();
+}
+
+void ShaderJobScheduler::JoinWorkers() {
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    m_workers.clear();
+}
+
+} // namespace ShaderLab
@@ -147,7 +147,7 @@ int RunPlayerApp(HINSTANCE hInstance, const PlayerLaunchOptions& options) {
     }
 
     g_resources.commandQueue = new CommandQueue();
-    if (!g_resources.commandQueue->Initialize(g_resources.device, D3D12_COMMAND_LIST_TYPE_DIRECT)) {
+    if (!g_resources.commandQueue->Initialize(g_resources.device, D3D12_COMMAND_LIST_TYPE_DIRECT, Swapchain::BUFFER_COUNT)) {
         ShutdownTinyRuntimeResources();
         return -1;
     }
@@ -187,6 +187,7 @@ int RunPlayerApp(HINSTANCE hInstance, const PlayerLaunchOptions& options) {
             const double dt = static_cast<double>(currTime.QuadPart - lastTime.QuadPart) / static_cast<double>(freq.QuadPart);
             lastTime = currTime;
 
+            g_resources.commandQueue->BeginFrame();
             g_resources.player->Update(0.0, static_cast<float>(dt));
 
             g_resources.commandQueue->ResetCommandList();
@@ -213,7 +214,7 @@ int RunPlayerApp(HINSTANCE hInstance, const PlayerLaunchOptions& options) {
 
             g_resources.commandQueue->ExecuteCommandList();
             g_resources.swapchain->Present(g_runtime.vsyncEnabled);
-            g_resources.commandQueue->WaitForGPU();
+            g_resources.commandQueue->EndFrame();
         }
     }
 
@@ -3,6 +3,7 @@
 #include <windows.h>
 
 #include <algorithm>
+#include <cstdlib>
 #include <filesystem>
 #include <iostream>
 #include <string>
@@ -69,7 +70,8 @@ void PrintUsage() {
         << "  [--restricted-compact-track]\n"
         << "  [--runtime-debug]\n"
         << "  [--compact-debug]\n"
-        << "  [--micro-dev]\n";
+        << "  [--micro-dev]\n"
+        << "  [--threads <count>]   (0 = all hardware threads)\n";
 }
 
 } // namespace
@@ -105,6 +107,8 @@ int main(int argc, char** argv) {
         } else if (arg == "--micro-dev") {
             request.microDeveloperBuild = true;
             request.runtimeDebugLog = true;
+        } else if (arg == "--threads" && i + 1 < argc) {
+            request.workerThreadCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
         } else if (arg == "--help" || arg == "-h") {
             PrintUsage();
             return 0;
@@ -0,0 +1,67 @@
+#include "ShaderLab/Audio/AudioByteStream.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace ShaderLab {
+
+AudioByteStream::~AudioByteStream() {
+    Close();
+}
+
+bool AudioByteStream::OpenView(std::span<const uint8_t> bytes) {
+    Close();
+    if (bytes.empty()) {
+        return false;
+    }
+    m_view = bytes;
+    m_size = bytes.size();
+    return true;
+}
+
+bool AudioByteStream::OpenOwned(std::vector<uint8_t> bytes) {
+    Close();
+    if (bytes.empty()) {
+        return false;
+    }
+    m_owned = std::move(bytes);
+    m_view = m_owned;
+    m_size = m_owned.size();
+    return true;
+}
+
+void AudioByteStream::Close() {
+    m_view = {};
+    m_owned.clear();
+    m_owned.shrink_to_fit();
+    m_size = 0;
+    m_position = 0;
+}
+
+size_t AudioByteStream::Read(void* out, size_t bytes) {
+    const size_t available = static_cast<size_t>((std::min)(static_cast<uint64_t>(bytes), m_size - m_position));
+    if (available == 0 || !out) {
+        return 0;
+    }
+    std::memcpy(out, m_view.data() + m_position, available);
+    m_position += available;
+    return available;
+}
+
+bool AudioByteStream::Seek(int64_t offset, Origin origin) {
+    int64_t base = 0;
+    if (origin == Origin::Current) {
+        base = static_cast<int64_t>(m_position);
+    } else if (origin == Origin::End) {
+        base = static_cast<int64_t>(m_size);
+    }
+    const int64_t target = base + offset;
+    if (target < 0 || static_cast<uint64_t>(target) > m_size) {
+        return false;
+    }
+    m_position = static_cast<uint64_t>(target);
+    return true;
+}
+
+} // namespace ShaderLab
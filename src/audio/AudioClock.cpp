@@ -0,0 +1,97 @@
+#include "ShaderLab/Audio/AudioClock.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ShaderLab {
+
+namespace {
+
+constexpr double kTelemetrySmoothing = 0.05; // EMA weight of the newest error
+
+} // namespace
+
+double AudioClockFilter::Update(double wallSeconds, double audioSeconds, double outputLatencySeconds) {
+    const double measured = audioSeconds - outputLatencySeconds;
+    m_telemetry.latencySeconds = outputLatencySeconds;
+    ++m_telemetry.updates;
+
+    if (!m_locked) {
+        m_locked = true;
+        m_lastWallSeconds = wallSeconds;
+        m_position = measured;
+        m_rate = 1.0;
+        return m_position;
+    }
+
+    const double dt = (std::max)(0.0, wallSeconds - m_lastWallSeconds);
+    m_lastWallSeconds = wallSeconds;
+
+    const double predicted = m_position + dt * m_rate;
+    const double error = measured - predicted;
+    if (std::abs(error) > m_settings.resyncThresholdSeconds) {
+        m_position = measured;
+        m_rate = 1.0;
+        m_meanSquareError = 0.0;
+        m_telemetry.driftSeconds = 0.0;
+        m_telemetry.jitterSeconds = 0.0;
+        m_telemetry.rate = m_rate;
+        ++m_telemetry.resyncs;
+        return m_position;
+    }
+
+    m_position = predicted + m_settings.phaseGain * error;
+    m_rate = (std::clamp)(m_rate + m_settings.rateGain * error,
+                          1.0 - m_settings.maxRateDeviation,
+                          1.0 + m_settings.maxRateDeviation);
+
+    m_telemetry.driftSeconds += kTelemetrySmoothing * (error - m_telemetry.driftSeconds);
+    m_meanSquareError += kTelemetrySmoothing * (error * error - m_meanSquareError);
+    m_telemetry.jitterSeconds = std::sqrt(m_meanSquareError);
+    m_telemetry.rate = m_rate;
+    return m_position;
+}
+
+void AudioClockFilter::Reset() {
+    m_locked = false;
+    m_lastWallSeconds = 0.0;
+    m_position = 0.0;
+    m_rate = 1.0;
+    m_meanSquareError = 0.0;
+    const uint32_t resyncs = m_telemetry.resyncs;
+    m_telemetry = {};
+    m_telemetry.resyncs = resyncs;
+}
+
+void AudioClockPublisher::Publish(const AudioClockSnapshot& snapshot) {
+    const uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed); // Odd: write in progress
+    std::atomic_thread_fence(std::memory_order_release);
+    m_timeSeconds.store(snapshot.timeSeconds, std::memory_order_relaxed);
+    m_wallSeconds.store(snapshot.wallSeconds, std::memory_order_relaxed);
+    m_rate.store(snapshot.rate, std::memory_order_relaxed);
+    m_bpm.store(snapshot.bpm, std::memory_order_relaxed);
+    m_playing.store(snapshot.playing, std::memory_order_relaxed);
+    m_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+AudioClockSnapshot AudioClockPublisher::Read() const {
+    AudioClockSnapshot snapshot;
+    for (;;) {
+        const uint32_t before = m_sequence.load(std::memory_order_acquire);
+        if (before & 1u) {
+            continue;
+        }
+        snapshot.timeSeconds = m_timeSeconds.load(std::memory_order_relaxed);
+        snapshot.wallSeconds = m_wallSeconds.load(std::memory_order_relaxed);
+        snapshot.rate = m_rate.load(std::memory_order_relaxed);
+        snapshot.bpm = m_bpm.load(std::memory_order_relaxed);
+        snapshot.playing = m_playing.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) == before) {
+            return snapshot;
+        }
+    }
+}
+
+} // namespace ShaderLab
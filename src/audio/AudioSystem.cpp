@@ -1,7 +1,9 @@
 #include "ShaderLab/Audio/AudioSystem.h"
+#include "ShaderLab/Audio/AudioByteStream.h"
 
 #define MINIAUDIO_IMPLEMENTATION
 #include <miniaudio.h>
+#include <utility>
 #include <vector>
 
 namespace ShaderLab {
@@ -13,13 +15,27 @@ AudioSystem::~AudioSystem() {
 }
 
 bool AudioSystem::Initialize() {
+    return InitializeEngine(true, 0, 0);
+}
+
+bool AudioSystem::InitializeWithoutDevice(uint32_t sampleRate, uint32_t channels) {
+    return InitializeEngine(false, sampleRate, channels);
+}
+
+bool AudioSystem::InitializeEngine(bool withDevice, uint32_t sampleRate, uint32_t channels) {
     if (m_initialized) {
         return true;
     }
 
     m_engine = new ma_engine();
-    
-    ma_result result = ma_engine_init(nullptr, m_engine);
+
+    ma_engine_config config = ma_engine_config_init();
+    if (!withDevice) {
+        config.noDevice = MA_TRUE;
+        config.sampleRate = sampleRate;
+        config.channels = channels;
+    }
+    ma_result result = ma_engine_init(&config, m_engine);
     if (result != MA_SUCCESS) {
         delete m_engine;
         m_engine = nullptr;
@@ -31,18 +47,8 @@ bool AudioSystem::Initialize() {
 }
 
 void AudioSystem::Shutdown() {
-    if (m_sound) {
-        ma_sound_uninit(m_sound);
-        delete m_sound;
-        m_sound = nullptr;
-    }
-
-    if (m_decoder) {
-        ma_decoder_uninit((ma_decoder*)m_decoder);
-        delete (ma_decoder*)m_decoder;
-        m_decoder = nullptr;
-    }
-    m_audioBuffer.clear();
+    UnloadMusic();
+    m_oneShots.Unload();
 
     if (m_engine) {
         ma_engine_uninit(m_engine);
@@ -53,30 +59,31 @@ void AudioSystem::Shutdown() {
     m_initialized = false;
 }
 
-bool AudioSystem::LoadAudio(const std::string& filepath) {
-    if (!m_initialized) {
-        return false;
-    }
-
-    // Unload previous sound
+void AudioSystem::UnloadMusic() {
     if (m_sound) {
         ma_sound_uninit(m_sound);
         delete m_sound;
         m_sound = nullptr;
     }
-    
-    // Clear old memory resources
     if (m_decoder) {
         ma_decoder_uninit((ma_decoder*)m_decoder);
         delete (ma_decoder*)m_decoder;
         m_decoder = nullptr;
     }
-    m_audioBuffer.clear();
+    m_stream.reset();
+}
 
+bool AudioSystem::LoadAudio(const std::string& filepath) {
+    if (!m_initialized) {
+        return false;
+    }
+
+    UnloadMusic();
+
+    // The resource manager streams the file in pages on its job thread instead of loading it whole.
     m_sound = new ma_sound();
-    
-    ma_result result = ma_sound_init_from_file(m_engine, filepath.c_str(), 
-                                               0, nullptr, nullptr, m_sound);
+    ma_result result = ma_sound_init_from_file(m_engine, filepath.c_str(),
+                                               MA_SOUND_FLAG_STREAM, nullptr, nullptr, m_sound);
     if (result != MA_SUCCESS) {
         delete m_sound;
         m_sound = nullptr;
@@ -86,40 +93,55 @@ bool AudioSystem::LoadAudio(const std::string& filepath) {
     return true;
 }
 
-bool AudioSystem::LoadAudioFromMemory(const void* data, size_t size) {
-    if (!m_initialized || !data || size == 0) return false;
+bool AudioSystem::LoadAudioFromView(std::span<const uint8_t> bytes) {
+    auto stream = std::make_unique<AudioByteStream>();
+    return stream->OpenView(bytes) && LoadAudioStream(std::move(stream));
+}
 
-    if (m_sound) {
-        ma_sound_uninit(m_sound);
-        delete m_sound;
-        m_sound = nullptr;
-    }
-    if (m_decoder) {
-        ma_decoder_uninit((ma_decoder*)m_decoder);
-        delete (ma_decoder*)m_decoder;
-        m_decoder = nullptr;
-    }
+bool AudioSystem::LoadAudioFromBuffer(std::vector<uint8_t> bytes) {
+    auto stream = std::make_unique<AudioByteStream>();
+    return stream->OpenOwned(std::move(bytes)) && LoadAudioStream(std::move(stream));
+}
+
+bool AudioSystem::LoadAudioFromMemory(const void* data, size_t size) {
+    if (!data || size == 0) return false;
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    return LoadAudioFromBuffer(std::vector<uint8_t>(bytes, bytes + size));
+}
 
-    // Keep data alive
-    m_audioBuffer.resize(size);
-    memcpy(m_audioBuffer.data(), data, size);
+bool AudioSystem::LoadAudioStream(std::unique_ptr<AudioByteStream> stream) {
+    if (!m_initialized || !stream) return false;
+
+    UnloadMusic();
+    m_stream = std::move(stream);
+
+    // miniaudio pulls compressed bytes through these as it decodes, including after seeks.
+    const auto onRead = [](ma_decoder* decoder, void* out, size_t bytesToRead, size_t* bytesRead) -> ma_result {
+        const size_t read = static_cast<AudioByteStream*>(decoder->pUserData)->Read(out, bytesToRead);
+        if (bytesRead) *bytesRead = read;
+        return (read == 0 && bytesToRead > 0) ? MA_AT_END : MA_SUCCESS;
+    };
+    const auto onSeek = [](ma_decoder* decoder, ma_int64 offset, ma_seek_origin origin) -> ma_result {
+        AudioByteStream::Origin from = AudioByteStream::Origin::Start;
+        if (origin == ma_seek_origin_current) from = AudioByteStream::Origin::Current;
+        else if (origin == ma_seek_origin_end) from = AudioByteStream::Origin::End;
+        return static_cast<AudioByteStream*>(decoder->pUserData)->Seek(offset, from) ? MA_SUCCESS : MA_ERROR;
+    };
 
     m_decoder = new ma_decoder();
     ma_decoder_config config = ma_decoder_config_init_default();
-    
-    if (ma_decoder_init_memory(m_audioBuffer.data(), size, &config, (ma_decoder*)m_decoder) != MA_SUCCESS) {
+    if (ma_decoder_init(onRead, onSeek, m_stream.get(), &config, (ma_decoder*)m_decoder) != MA_SUCCESS) {
         delete (ma_decoder*)m_decoder;
         m_decoder = nullptr;
+        m_stream.reset();
         return false;
     }
 
     m_sound = new ma_sound();
     if (ma_sound_init_from_data_source(m_engine, (ma_decoder*)m_decoder, 0, nullptr, m_sound) != MA_SUCCESS) {
-        ma_decoder_uninit((ma_decoder*)m_decoder);
-        delete (ma_decoder*)m_decoder;
-        m_decoder = nullptr;
         delete m_sound;
         m_sound = nullptr;
+        UnloadMusic();
         return false;
     }
     return true;
@@ -162,6 +184,30 @@ void AudioSystem::SetVolume(float volume) {
     }
 }
 
+bool AudioSystem::LoadOneShots(const std::vector<OneShotSource>& sources, std::string& outErrors, uint32_t voiceCount) {
+    if (!m_initialized) {
+        outErrors = "audio engine not initialized";
+        return false;
+    }
+    return m_oneShots.Load(m_engine, sources, voiceCount, outErrors);
+}
+
+void AudioSystem::UnloadOneShots() {
+    m_oneShots.Unload();
+}
+
+bool AudioSystem::HasOneShot(int index) const {
+    return m_oneShots.HasSample(index);
+}
+
+bool AudioSystem::TriggerOneShot(int index, float volume) {
+    return m_oneShots.Trigger(index, volume);
+}
+
+OneShotStats AudioSystem::GetOneShotStats() const {
+    return m_oneShots.GetStats();
+}
+
 void AudioSystem::PlayOneShot(const std::string& filepath) {
     if (!m_initialized) return;
     ma_engine_play_sound(m_engine, filepath.c_str(), nullptr);
@@ -185,7 +231,36 @@ float AudioSystem::GetPlaybackTime() const {
     ma_uint32 sampleRate;
     ma_sound_get_data_format(m_sound, nullptr, nullptr, &sampleRate, nullptr, 0);
 
-    return static_cast<float>(cursor) / static_cast<float>(sampleRate);
+    return sampleRate > 0 ? static_cast<float>(static_cast<double>(cursor) / static_cast<double>(sampleRate)) : 0.0f;
+}
+
+AudioClockSample AudioSystem::SampleClock() const {
+    AudioClockSample sample;
+    if (!m_sound || !ma_sound_is_playing(m_sound)) {
+        return sample;
+    }
+
+    ma_uint64 cursor = 0;
+    ma_uint32 sampleRate = 0;
+    if (ma_sound_get_cursor_in_pcm_frames(m_sound, &cursor) != MA_SUCCESS ||
+        ma_sound_get_data_format(m_sound, nullptr, nullptr, &sampleRate, nullptr, 0) != MA_SUCCESS ||
+        sampleRate == 0) {
+        return sample;
+    }
+    sample.valid = true;
+    sample.cursorFrames = cursor;
+    sample.sampleRate = sampleRate;
+
+    // Everything queued in the device's periods is still ahead of the speaker.
+    if (const ma_device* device = ma_engine_get_device(m_engine)) {
+        const ma_uint32 deviceRate = device->playback.internalSampleRate;
+        if (deviceRate > 0) {
+            const double bufferedFrames = static_cast<double>(device->playback.internalPeriodSizeInFrames) *
+                                          static_cast<double>(device->playback.internalPeriods);
+            sample.outputLatencySeconds = bufferedFrames / static_cast<double>(deviceRate);
+        }
+    }
+    return sample;
 }
 
 float AudioSystem::GetDuration() const {
@@ -202,4 +277,17 @@ float AudioSystem::GetDuration() const {
     return static_cast<float>(lengthInFrames) / static_cast<float>(sampleRate);
 }
 
+uint64_t AudioSystem::ReadFrames(float* out, uint64_t frameCount) {
+    if (!m_engine || !out) {
+        return 0;
+    }
+    ma_uint64 framesRead = 0;
+    ma_engine_read_pcm_frames(m_engine, out, frameCount, &framesRead);
+    return framesRead;
+}
+
+size_t AudioSystem::GetStreamResidentBytes() const {
+    return m_stream ? m_stream->GetResidentBytes() : 0;
+}
+
 } // namespace ShaderLab
@@ -0,0 +1,255 @@
+#include "ShaderLab/Audio/OneShotBank.h"
+
+#include <miniaudio.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace ShaderLab {
+
+namespace {
+
+int64_t NowNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+struct OneShotBank::Voice {
+    ma_data_source_base base; // Must stay first: miniaudio hands the data source back as this pointer
+    ma_sound sound;
+    bool dataSourceInitialized = false;
+    bool soundInitialized = false;
+    OneShotBank* bank = nullptr;
+    uint32_t sampleRate = 0;
+    OneShotVoice state;
+    uint64_t startedSequence = 0; // Trigger() thread only
+};
+
+// miniaudio data source callbacks for a voice.
+struct OneShotVoiceCallbacks {
+    // Runs on the audio thread; only touches atomics and the voice's own playback state.
+    static ma_result Read(ma_data_source* dataSource, void* framesOut, ma_uint64 frameCount, ma_uint64* framesRead) {
+        auto* voice = static_cast<OneShotBank::Voice*>(dataSource);
+        int64_t triggerNs = 0;
+        if (voice->state.Read(static_cast<float*>(framesOut), frameCount, triggerNs)) {
+            voice->bank->RecordTriggerLatency(NowNanoseconds() - triggerNs);
+        }
+
+        // Idle voices output silence instead of ending, so the sound never has to be restarted.
+        if (framesRead) *framesRead = frameCount;
+        return MA_SUCCESS;
+    }
+
+    static ma_result Seek(ma_data_source*, ma_uint64) {
+        return MA_SUCCESS;
+    }
+
+    static ma_result GetDataFormat(ma_data_source* dataSource, ma_format* format, ma_uint32* channels,
+                                   ma_uint32* sampleRate, ma_channel* channelMap, size_t channelMapCap) {
+        const auto* voice = static_cast<const OneShotBank::Voice*>(dataSource);
+        if (format) *format = ma_format_f32;
+        if (channels) *channels = voice->state.GetChannels();
+        if (sampleRate) *sampleRate = voice->sampleRate;
+        if (channelMap) {
+            ma_channel_map_init_standard(ma_standard_channel_map_default, channelMap, channelMapCap, voice->state.GetChannels());
+        }
+        return MA_SUCCESS;
+    }
+
+    static ma_result GetCursor(ma_data_source*, ma_uint64* cursor) {
+        if (cursor) *cursor = 0;
+        return MA_SUCCESS;
+    }
+
+    static ma_result GetLength(ma_data_source*, ma_uint64* length) {
+        if (length) *length = 0;
+        return MA_NOT_IMPLEMENTED; // Endless
+    }
+};
+
+static ma_data_source_vtable g_voiceVtable = {
+    OneShotVoiceCallbacks::Read,
+    OneShotVoiceCallbacks::Seek,
+    OneShotVoiceCallbacks::GetDataFormat,
+    OneShotVoiceCallbacks::GetCursor,
+    OneShotVoiceCallbacks::GetLength,
+    nullptr,
+    0
+};
+
+OneShotBank::OneShotBank() = default;
+
+OneShotBank::~OneShotBank() {
+    Unload();
+}
+
+bool OneShotBank::Load(ma_engine* engine, const std::vector<OneShotSource>& sources, uint32_t voiceCount, std::string& outErrors) {
+    Unload();
+    outErrors.clear();
+    if (!engine) {
+        outErrors = "audio engine not initialized";
+        return false;
+    }
+
+    const uint32_t channels = ma_engine_get_channels(engine);
+    const uint32_t sampleRate = ma_engine_get_sample_rate(engine);
+
+    for (const auto& source : sources) {
+        if (source.index < 0 || source.encoded.empty()) {
+            continue;
+        }
+        ma_decoder_config config = ma_decoder_config_init(ma_format_f32, channels, sampleRate);
+        ma_uint64 frames = 0;
+        void* pcm = nullptr;
+        const ma_result result = ma_decode_memory(source.encoded.data(), source.encoded.size(), &config, &frames, &pcm);
+        if (result != MA_SUCCESS || !pcm || frames == 0) {
+            if (pcm) ma_free(pcm, nullptr);
+            outErrors += source.name + ": " + ma_result_description(result) + "\n";
+            continue;
+        }
+
+        auto sample = std::make_unique<OneShotSample>();
+        sample->name = source.name;
+        sample->frames = frames;
+        const float* samples = static_cast<const float*>(pcm);
+        sample->pcm.assign(samples, samples + static_cast<size_t>(frames) * channels);
+        ma_free(pcm, nullptr);
+
+        if (static_cast<size_t>(source.index) >= m_samples.size()) {
+            m_samples.resize(static_cast<size_t>(source.index) + 1);
+        }
+        if (!m_samples[static_cast<size_t>(source.index)]) {
+            ++m_sampleCount;
+        } else {
+            m_decodedBytes -= m_samples[static_cast<size_t>(source.index)]->pcm.size() * sizeof(float);
+        }
+        m_decodedBytes += sample->pcm.size() * sizeof(float);
+        m_samples[static_cast<size_t>(source.index)] = std::move(sample);
+    }
+
+    m_voices.reserve(voiceCount);
+    for (uint32_t i = 0; i < voiceCount; ++i) {
+        auto voice = std::make_unique<Voice>();
+        voice->bank = this;
+        voice->state.Configure(channels);
+        voice->sampleRate = sampleRate;
+
+        ma_data_source_config sourceConfig = ma_data_source_config_init();
+        sourceConfig.vtable = &g_voiceVtable;
+        if (ma_data_source_init(&sourceConfig, &voice->base) != MA_SUCCESS) {
+            outErrors += "failed to create one-shot voice\n";
+            break;
+        }
+        voice->dataSourceInitialized = true;
+        if (ma_sound_init_from_data_source(engine, &voice->base,
+                                           MA_SOUND_FLAG_NO_PITCH | MA_SOUND_FLAG_NO_SPATIALIZATION,
+                                           nullptr, &voice->sound) != MA_SUCCESS) {
+            ma_data_source_uninit(&voice->base);
+            outErrors += "failed to create one-shot voice\n";
+            break;
+        }
+        voice->soundInitialized = true;
+        ma_sound_start(&voice->sound);
+        m_voices.push_back(std::move(voice));
+    }
+    return !m_voices.empty();
+}
+
+void OneShotBank::Unload() {
+    // Voices leave the node graph before the PCM they may be reading is freed.
+    for (auto& voice : m_voices) {
+        if (voice->soundInitialized) {
+            ma_sound_uninit(&voice->sound);
+        }
+        if (voice->dataSourceInitialized) {
+            ma_data_source_uninit(&voice->base);
+        }
+    }
+    m_voices.clear();
+    m_samples.clear();
+    m_triggerSequence = 0;
+    m_sampleCount = 0;
+    m_decodedBytes = 0;
+    m_triggers = 0;
+    m_steals = 0;
+    m_missedTriggers = 0;
+    m_peakActiveVoices = 0;
+    m_lastLatencyNs.store(0, std::memory_order_relaxed);
+    m_maxLatencyNs.store(0, std::memory_order_relaxed);
+}
+
+bool OneShotBank::HasSample(int index) const {
+    return index >= 0 && static_cast<size_t>(index) < m_samples.size() && m_samples[static_cast<size_t>(index)];
+}
+
+bool OneShotBank::Trigger(int index, float volume) {
+    if (!HasSample(index) || m_voices.empty()) {
+        ++m_missedTriggers;
+        return false;
+    }
+
+    Voice* target = nullptr;
+    Voice* oldest = nullptr;
+    uint32_t sounding = 0;
+    for (auto& voice : m_voices) {
+        if (!voice->state.IsSounding()) {
+            if (!target) target = voice.get();
+            continue;
+        }
+        ++sounding;
+        if (!oldest || voice->startedSequence < oldest->startedSequence) {
+            oldest = voice.get();
+        }
+    }
+    if (!target) {
+        target = oldest;
+        ++m_steals;
+    } else {
+        ++sounding;
+    }
+
+    target->state.Trigger(m_samples[static_cast<size_t>(index)].get(), volume, NowNanoseconds());
+    target->startedSequence = ++m_triggerSequence;
+
+    ++m_triggers;
+    m_peakActiveVoices = (std::max)(m_peakActiveVoices, sounding);
+    return true;
+}
+
+void OneShotBank::StopAll() {
+    for (auto& voice : m_voices) {
+        voice->state.Stop();
+    }
+}
+
+void OneShotBank::RecordTriggerLatency(int64_t nanoseconds) {
+    const uint64_t latency = nanoseconds > 0 ? static_cast<uint64_t>(nanoseconds) : 0;
+    m_lastLatencyNs.store(latency, std::memory_order_relaxed);
+    uint64_t previousMax = m_maxLatencyNs.load(std::memory_order_relaxed);
+    while (latency > previousMax &&
+           !m_maxLatencyNs.compare_exchange_weak(previousMax, latency, std::memory_order_relaxed)) {
+    }
+}
+
+OneShotStats OneShotBank::GetStats() const {
+    OneShotStats stats;
+    stats.samples = m_sampleCount;
+    stats.decodedBytes = m_decodedBytes;
+    stats.voices = static_cast<uint32_t>(m_voices.size());
+    for (const auto& voice : m_voices) {
+        if (voice->state.IsSounding()) {
+            ++stats.activeVoices;
+        }
+    }
+    stats.peakActiveVoices = m_peakActiveVoices;
+    stats.triggers = m_triggers;
+    stats.steals = m_steals;
+    stats.missedTriggers = m_missedTriggers;
+    stats.lastTriggerLatencyMs = static_cast<double>(m_lastLatencyNs.load(std::memory_order_relaxed)) / 1.0e6;
+    stats.maxTriggerLatencyMs = static_cast<double>(m_maxLatencyNs.load(std::memory_order_relaxed)) / 1.0e6;
+    return stats;
+}
+
+} // namespace ShaderLab
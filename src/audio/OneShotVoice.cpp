@@ -0,0 +1,74 @@
+#include "ShaderLab/Audio/OneShotVoice.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ShaderLab {
+
+void OneShotVoice::Trigger(const OneShotSample* sample, float volume, int64_t triggerNanoseconds) {
+    const uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed); // Odd: write in progress
+    std::atomic_thread_fence(std::memory_order_release);
+    m_pending.store(sample, std::memory_order_relaxed);
+    m_pendingVolume.store(volume, std::memory_order_relaxed);
+    m_pendingTriggerNs.store(triggerNanoseconds, std::memory_order_relaxed);
+    m_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+void OneShotVoice::Stop() {
+    m_stopGeneration.store(m_sequence.load(std::memory_order_relaxed) / 2, std::memory_order_release);
+}
+
+bool OneShotVoice::IsSounding() const {
+    const uint64_t generation = m_sequence.load(std::memory_order_relaxed) / 2;
+    return m_finishedGeneration.load(std::memory_order_acquire) != generation;
+}
+
+bool OneShotVoice::Read(float* out, uint64_t frameCount, int64_t& outTriggerNanoseconds) {
+    const uint32_t channels = m_channels;
+    bool pickedUp = false;
+
+    // A trigger caught mid-write is picked up on the next callback; the audio thread never spins.
+    const uint64_t sequence = m_sequence.load(std::memory_order_acquire);
+    if ((sequence & 1u) == 0 && sequence / 2 != m_playingGeneration) {
+        const OneShotSample* next = m_pending.load(std::memory_order_relaxed);
+        const float volume = m_pendingVolume.load(std::memory_order_relaxed);
+        const int64_t triggerNs = m_pendingTriggerNs.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) == sequence) {
+            m_playingGeneration = sequence / 2;
+            m_playing = next;
+            m_cursor = 0;
+            m_volume = volume;
+            outTriggerNanoseconds = triggerNs;
+            pickedUp = true;
+        }
+    }
+    if (m_playingGeneration <= m_stopGeneration.load(std::memory_order_acquire)) {
+        m_playing = nullptr;
+    }
+
+    uint64_t written = 0;
+    if (const OneShotSample* sample = m_playing) {
+        written = (std::min)(frameCount, sample->frames - m_cursor);
+        const float* src = sample->pcm.data() + m_cursor * channels;
+        const size_t count = static_cast<size_t>(written) * channels;
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = src[i] * m_volume;
+        }
+        m_cursor += written;
+        if (m_cursor >= sample->frames) {
+            m_playing = nullptr;
+        }
+    }
+    if (written < frameCount) {
+        std::memset(out + written * channels, 0, static_cast<size_t>(frameCount - written) * channels * sizeof(float));
+    }
+
+    if (!m_playing) {
+        m_finishedGeneration.store(m_playingGeneration, std::memory_order_release);
+    }
+    return pickedUp;
+}
+
+} // namespace ShaderLab
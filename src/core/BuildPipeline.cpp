@@ -3,18 +3,26 @@
 #include <windows.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "ShaderLab/Core/ImageDecodePool.h"
 #include "ShaderLab/Core/Serializer.h"
 #include "ShaderLab/Core/ShaderLabData.h"
+#include "ShaderLab/Core/TextureBake.h"
+#include "ShaderLab/DevKit/HlslMinifier.h"
+#include "ShaderLab/DevKit/HlslModuleTransform.h"
+#include "ShaderLab/DevKit/HlslTokenizer.h"
 #include "ShaderLab/Shader/ShaderBaseBuild.h"
 #include "ShaderLab/Shader/ShaderBaseVertex.h"
 #include "ShaderLab/Shader/ShaderCompiler.h"
@@ -625,6 +633,100 @@ std::string BuildPixelShaderSource(const std::string& shaderSource,
     return ShaderBase::BuildBuildPixelShaderTemplate(shaderSource, textureDecls, flipFragCoord, shaderEntryPoint);
 }
 
+struct ShaderBuildJob {
+    std::string label;  // Build log name
+    std::string source; // Wrapped, ready for DXC
+    std::wstring sourceName;
+    std::string entryPoint = "PSMain";
+    std::string target = "ps_6_0";
+};
+
+struct ShaderBuildOutput {
+    ShaderCompileResult result;
+    double compileMs = 0.0;
+    size_t sameAs = static_cast<size_t>(-1); // Earlier job with byte-identical input whose result was reused
+};
+
+// Compiles jobs in Build mode on up to workerThreads threads (0: every hardware thread), each
+// with its own ShaderCompiler since a DXC instance is not shared across threads. A job whose
+// input matches an earlier one byte for byte reuses its result. Outputs line up with jobs
+// however workers interleave, and the per-job compile times are logged in job order.
+// Returns false only when no worker could create a compiler.
+bool CompileShaderJobs(const std::vector<ShaderBuildJob>& jobs,
+                       uint32_t workerThreads,
+                       std::vector<ShaderBuildOutput>& outOutputs,
+                       const std::function<void(const std::string&)>& log) {
+    outOutputs.assign(jobs.size(), {});
+    std::vector<size_t> unique;
+    std::unordered_map<size_t, std::vector<size_t>> uniqueByHash;
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        const ShaderBuildJob& job = jobs[i];
+        auto& candidates = uniqueByHash[std::hash<std::string>{}(job.source)];
+        for (size_t candidate : candidates) {
+            const ShaderBuildJob& other = jobs[candidate];
+            if (other.source == job.source && other.entryPoint == job.entryPoint && other.target == job.target) {
+                outOutputs[i].sameAs = candidate;
+                break;
+            }
+        }
+        if (outOutputs[i].sameAs == static_cast<size_t>(-1)) {
+            candidates.push_back(i);
+            unique.push_back(i);
+        }
+    }
+    if (unique.empty()) {
+        return true;
+    }
+
+    uint32_t workers = workerThreads > 0 ? workerThreads : (std::max)(1u, std::thread::hardware_concurrency());
+    workers = (std::min)(workers, static_cast<uint32_t>(unique.size()));
+    std::atomic<size_t> nextJob{0};
+    std::atomic<uint32_t> readyWorkers{0};
+    const auto stageStart = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    threads.reserve(workers);
+    for (uint32_t w = 0; w < workers; ++w) {
+        threads.emplace_back([&] {
+            ShaderCompiler compiler;
+            if (!compiler.Initialize()) {
+                return;
+            }
+            ++readyWorkers;
+            for (size_t u = nextJob++; u < unique.size(); u = nextJob++) {
+                const ShaderBuildJob& job = jobs[unique[u]];
+                ShaderBuildOutput& output = outOutputs[unique[u]];
+                const auto start = std::chrono::steady_clock::now();
+                output.result = compiler.CompileFromSource(job.source, job.entryPoint, job.target, job.sourceName, ShaderCompileMode::Build);
+                output.compileMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (readyWorkers == 0) {
+        return false;
+    }
+    const double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stageStart).count();
+
+    double compileMsTotal = 0.0;
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        ShaderBuildOutput& output = outOutputs[i];
+        if (output.sameAs != static_cast<size_t>(-1)) {
+            output.result = outOutputs[output.sameAs].result;
+            log("  " + jobs[i].label + ": same source as " + jobs[output.sameAs].label);
+            continue;
+        }
+        compileMsTotal += output.compileMs;
+        log("  " + jobs[i].label + ": " + std::to_string(static_cast<int64_t>(output.compileMs)) + " ms" +
+            (output.result.success ? "" : " (failed)"));
+    }
+    log("  " + std::to_string(jobs.size()) + " shaders, " + std::to_string(unique.size()) + " compiled on " +
+        std::to_string(readyWorkers.load()) + " workers: " + std::to_string(static_cast<int64_t>(compileMsTotal)) +
+        " ms of DXC in " + std::to_string(static_cast<int64_t>(wallMs)) + " ms");
+    return true;
+}
+
 bool WriteBinaryFile(const fs::path& path, const std::vector<uint8_t>& data, std::string& outError) {
     std::error_code ec;
     fs::create_directories(path.parent_path(), ec);
@@ -641,6 +743,145 @@ bool WriteBinaryFile(const fs::path& path, const std::vector<uint8_t>& data, std
     return true;
 }
 
+struct TextureBakeSummary {
+    uint32_t baked = 0;
+    uint32_t skipped = 0;
+    uint64_t sourceBytes = 0;
+    uint64_t bakedBytes = 0;
+    double decodeSeconds = 0.0;
+};
+
+BakedTextureLayout ToBakedTextureLayout(TextureType type) {
+    switch (type) {
+        case TextureType::TextureCube: return BakedTextureLayout::TextureCube;
+        case TextureType::Texture3D: return BakedTextureLayout::Texture3D;
+        default: return BakedTextureLayout::Texture2D;
+    }
+}
+
+// Replaces every staged image file binding with a baked container next to it, so the
+// player uploads pixels and mips directly instead of decoding PNG/JPG at launch.
+// Images that cannot be baked keep their original file.
+TextureBakeSummary BakeStagedTextures(ProjectData& project,
+                                      const fs::path& packRoot,
+                                      uint32_t workerThreads,
+                                      const std::function<void(const std::string&)>& log) {
+    struct BakeTarget {
+        BakedTextureLayout layout = BakedTextureLayout::Texture2D;
+        std::vector<TextureBinding*> bindings;
+    };
+    struct SourceImage {
+        std::string path;
+        std::vector<BakeTarget> targets;
+    };
+
+    std::vector<SourceImage> sources;
+    std::unordered_map<std::string, size_t> sourceIndexByPath;
+    for (auto& scene : project.scenes) {
+        for (auto& binding : scene.bindings) {
+            if (binding.bindingType != BindingType::File || binding.filePath.empty() ||
+                fs::path(binding.filePath).extension() == TextureBake::kExtension ||
+                !FileExists(packRoot / binding.filePath)) {
+                continue;
+            }
+            auto [it, inserted] = sourceIndexByPath.emplace(binding.filePath, sources.size());
+            if (inserted) {
+                sources.push_back({binding.filePath, {}});
+            }
+            SourceImage& source = sources[it->second];
+            const BakedTextureLayout layout = ToBakedTextureLayout(binding.type);
+            auto target = std::find_if(source.targets.begin(), source.targets.end(),
+                                       [&](const BakeTarget& t) { return t.layout == layout; });
+            if (target == source.targets.end()) {
+                source.targets.push_back({layout, {}});
+                target = std::prev(source.targets.end());
+            }
+            target->bindings.push_back(&binding);
+        }
+    }
+
+    TextureBakeSummary summary;
+    if (sources.empty()) {
+        return summary;
+    }
+
+    uint32_t workers = workerThreads > 0 ? workerThreads : (std::max)(1u, std::thread::hardware_concurrency());
+    workers = (std::min)(workers, static_cast<uint32_t>(sources.size()));
+    ImageDecodePool decoder;
+    decoder.Start(workers);
+    for (size_t i = 0; i < sources.size(); ++i) {
+        ImageDecodeJob job;
+        job.id = i;
+        job.path = (packRoot / sources[i].path).string();
+        decoder.Submit(std::move(job));
+    }
+
+    std::unordered_set<std::string> usedNames;
+    DecodedImage image;
+    while (decoder.WaitNext(image)) {
+        SourceImage& source = sources[static_cast<size_t>(image.id)];
+        if (!image.success) {
+            summary.skipped += static_cast<uint32_t>(source.targets.size());
+            log("  Bake skipped: " + source.path + " (" + image.error + "), shipping original file");
+            continue;
+        }
+
+        const fs::path sourcePath(source.path);
+        bool allBaked = true;
+        for (const auto& target : source.targets) {
+            std::vector<uint8_t> container;
+            std::string bakeError;
+            if (!TextureBake::Bake(image.rgba.data(), image.width, image.height, target.layout, container, bakeError)) {
+                allBaked = false;
+                ++summary.skipped;
+                log("  Bake skipped: " + source.path + " (" + bakeError + "), shipping original file");
+                continue;
+            }
+
+            const char* layoutSuffix = target.layout == BakedTextureLayout::TextureCube ? ".cube"
+                : (target.layout == BakedTextureLayout::Texture3D ? ".3d" : "");
+            std::string bakedPath;
+            for (int attempt = 0; bakedPath.empty() || usedNames.count(bakedPath) != 0; ++attempt) {
+                const std::string stem = sourcePath.stem().string() + (attempt > 0 ? "_" + std::to_string(attempt) : std::string());
+                bakedPath = (sourcePath.parent_path() / (stem + layoutSuffix + TextureBake::kExtension)).generic_string();
+            }
+
+            std::string writeError;
+            if (!WriteBinaryFile(packRoot / bakedPath, container, writeError)) {
+                allBaked = false;
+                ++summary.skipped;
+                log("  Bake skipped: " + source.path + " (" + writeError + "), shipping original file");
+                continue;
+            }
+            usedNames.insert(bakedPath);
+            for (TextureBinding* binding : target.bindings) {
+                binding->filePath = bakedPath;
+            }
+
+            BakedTextureView view;
+            TextureBake::Parse(container, view);
+            ++summary.baked;
+            summary.bakedBytes += container.size();
+            log("  Baked: " + source.path + " -> " + bakedPath + " (" + std::to_string(view.width) + "x" +
+                std::to_string(view.height) + "x" + std::to_string(view.depthOrArraySize) + ", " +
+                std::to_string(view.mipLevels) + " mips, " + std::to_string(container.size()) + " bytes)");
+        }
+
+        std::error_code ec;
+        const fs::path stagedSource = packRoot / sourcePath;
+        const uint64_t sourceBytes = fs::file_size(stagedSource, ec);
+        if (!ec) {
+            summary.sourceBytes += sourceBytes;
+        }
+        if (allBaked) {
+            // No binding references the original any more, so it stays out of the pack.
+            fs::remove(stagedSource, ec);
+        }
+    }
+    summary.decodeSeconds = decoder.GetStats().decodeSeconds;
+    return summary;
+}
+
 bool EnsureOutputArtifactWritable(const fs::path& outputPath, std::string& outError) {
     std::error_code ec;
     if (!outputPath.parent_path().empty()) {
@@ -756,7 +997,6 @@ void AppendValue(std::vector<uint8_t>& output, const T& value) {
 }
 
 std::string GetTransitionShaderSourceForBuild(const std::string& transitionPresetStem);
-std::string MinifyShaderTextForPack(const std::string& input);
 
 struct TinyModuleMap {
     std::vector<std::string> modules;
@@ -787,104 +1027,25 @@ struct ModuleConflictBinding {
     size_t bodyEnd = 0;
 };
 
-bool IsIdentifierStart(char c) {
-    return std::isalpha(static_cast<unsigned char>(c)) != 0 || c == '_';
-}
-
-bool IsIdentifierChar(char c) {
-    return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_';
-}
-
-std::string ReadIdentifier(const std::string& source, size_t& pos) {
-    if (pos >= source.size() || !IsIdentifierStart(source[pos])) {
-        return {};
-    }
-    const size_t start = pos;
-    ++pos;
-    while (pos < source.size() && IsIdentifierChar(source[pos])) {
-        ++pos;
-    }
-    return source.substr(start, pos - start);
-}
-
-void SkipWhitespace(const std::string& source, size_t& pos) {
-    while (pos < source.size() && std::isspace(static_cast<unsigned char>(source[pos])) != 0) {
-        ++pos;
-    }
-}
-
-size_t FindMatchingPair(const std::string& source, size_t openPos, char open, char close) {
-    if (openPos >= source.size() || source[openPos] != open) {
-        return std::string::npos;
-    }
-    int depth = 0;
-    for (size_t i = openPos; i < source.size(); ++i) {
-        if (source[i] == open) {
-            ++depth;
-        } else if (source[i] == close) {
-            --depth;
-            if (depth == 0) {
-                return i;
-            }
-        }
-    }
-    return std::string::npos;
-}
-
-std::vector<ParsedFunctionDecl> ParseTopLevelFunctions(const std::string& source) {
+std::vector<ParsedFunctionDecl> ParseTopLevelFunctions(const HlslTokenStream& stream) {
     std::vector<ParsedFunctionDecl> out;
+    const std::string_view source = stream.Source();
 
-    size_t scan = 0;
-    while (scan < source.size()) {
-        size_t cursor = scan;
-        const size_t signatureStart = cursor;
-        const std::string returnType = ReadIdentifier(source, cursor);
-        if (returnType.empty()) {
-            ++scan;
-            continue;
-        }
-
-        SkipWhitespace(source, cursor);
-        const std::string functionName = ReadIdentifier(source, cursor);
-        if (functionName.empty()) {
-            scan = cursor;
-            continue;
-        }
-
-        SkipWhitespace(source, cursor);
-        if (cursor >= source.size() || source[cursor] != '(') {
-            scan = cursor;
-            continue;
-        }
-
-        const size_t closeParen = FindMatchingPair(source, cursor, '(', ')');
-        if (closeParen == std::string::npos) {
-            break;
-        }
-
-        size_t bodyCursor = closeParen + 1;
-        SkipWhitespace(source, bodyCursor);
-        if (bodyCursor >= source.size() || source[bodyCursor] != '{') {
-            scan = cursor + 1;
-            continue;
-        }
-
-        const size_t bodyEnd = FindMatchingPair(source, bodyCursor, '{', '}');
-        if (bodyEnd == std::string::npos) {
-            break;
-        }
+    for (const HlslFunction& fn : FindHlslFunctions(stream)) {
+        const std::string_view returnType = stream.Code(fn.returnType).text;
+        const std::string_view functionName = stream.Code(fn.name).text;
+        const size_t paramsStart = stream.Code(fn.openParen).offset + 1;
+        const std::string_view params = source.substr(paramsStart, stream.Code(fn.closeParen).offset - paramsStart);
 
-        const std::string params = source.substr(cursor + 1, closeParen - cursor - 1);
         ParsedFunctionDecl decl;
-        decl.signatureKey = returnType + " " + functionName + "(" + params + ")";
-        decl.signatureDisplay = returnType + " " + functionName + "(" + params + ")";
-        decl.functionName = functionName;
-        decl.signatureStart = signatureStart;
-        decl.bodyStart = bodyCursor;
-        decl.bodyEnd = bodyEnd;
+        decl.signatureKey.reserve(returnType.size() + functionName.size() + params.size() + 3);
+        decl.signatureKey.append(returnType).append(" ").append(functionName).append("(").append(params).append(")");
+        decl.signatureDisplay = decl.signatureKey;
+        decl.functionName = std::string(functionName);
+        decl.signatureStart = stream.Code(fn.returnType).offset;
+        decl.bodyStart = stream.Code(fn.openBrace).offset;
+        decl.bodyEnd = stream.Code(fn.closeBrace).offset;
         out.push_back(std::move(decl));
-
-        scan = bodyEnd + 1;
     }
 
     return out;
@@ -899,7 +1060,8 @@ std::unordered_map<std::string, std::vector<ModuleConflictBinding>> BuildMicroCo
         const std::string moduleLabel =
             (moduleIndex < map.moduleLabels.size()) ? map.moduleLabels[moduleIndex] : std::string();
 
-        const auto functions = ParseTopLevelFunctions(moduleCode);
+        const HlslTokenStream stream(moduleCode);
+        const auto functions = ParseTopLevelFunctions(stream);
         for (const auto& fn : functions) {
             if (fn.functionName.empty() || fn.functionName == moduleEntrypoint) {
                 continue;
@@ -923,236 +1085,14 @@ std::unordered_map<std::string, std::vector<ModuleConflictBinding>> BuildMicroCo
     return grouped;
 }
 
-std::string ScopeLocalFunctionsForModule(
-    const std::string& shaderCode,
-    const std::string& entrypointName,
-    const std::unordered_set<std::string>* preserveGlobalNames = nullptr) {
-    auto isIdentStart = [](char c) {
-        return std::isalpha(static_cast<unsigned char>(c)) != 0 || c == '_';
-    };
-    auto isIdentChar = [](char c) {
-        return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_';
-    };
-
-    auto readIdent = [&](const std::string& src, size_t& pos) -> std::string {
-        if (pos >= src.size() || !isIdentStart(src[pos])) {
-            return {};
-        }
-        const size_t start = pos;
-        ++pos;
-        while (pos < src.size() && isIdentChar(src[pos])) {
-            ++pos;
-        }
-        return src.substr(start, pos - start);
-    };
-
-    auto skipWhitespace = [](const std::string& src, size_t& pos) {
-        while (pos < src.size() && std::isspace(static_cast<unsigned char>(src[pos])) != 0) {
-            ++pos;
-        }
-    };
-
-    auto findMatchingParen = [](const std::string& src, size_t openPos) -> size_t {
-        if (openPos >= src.size() || src[openPos] != '(') {
-            return std::string::npos;
-        }
-        int depth = 0;
-        for (size_t i = openPos; i < src.size(); ++i) {
-            if (src[i] == '(') {
-                ++depth;
-            } else if (src[i] == ')') {
-                --depth;
-                if (depth == 0) {
-                    return i;
-                }
-            }
-        }
-        return std::string::npos;
-    };
-
-    std::unordered_map<std::string, std::string> renameMap;
-    size_t scan = 0;
-    while (scan < shaderCode.size()) {
-        size_t cursor = scan;
-        std::string returnType = readIdent(shaderCode, cursor);
-        if (returnType.empty()) {
-            ++scan;
-            continue;
-        }
-
-        skipWhitespace(shaderCode, cursor);
-        std::string funcName = readIdent(shaderCode, cursor);
-        if (funcName.empty()) {
-            scan = cursor;
-            continue;
-        }
-
-        skipWhitespace(shaderCode, cursor);
-        if (cursor >= shaderCode.size() || shaderCode[cursor] != '(') {
-            scan = cursor;
-            continue;
-        }
-
-        const size_t closeParen = findMatchingParen(shaderCode, cursor);
-        if (closeParen == std::string::npos) {
-            break;
-        }
-
-        size_t bodyCursor = closeParen + 1;
-        skipWhitespace(shaderCode, bodyCursor);
-        if (bodyCursor < shaderCode.size() && shaderCode[bodyCursor] == '{') {
-            if (funcName != entrypointName && (!preserveGlobalNames || preserveGlobalNames->find(funcName) == preserveGlobalNames->end())) {
-                renameMap[funcName] = "__" + entrypointName + "_" + funcName;
-            }
-            scan = bodyCursor + 1;
-            continue;
-        }
-
-        scan = cursor + 1;
-    }
-
-    if (renameMap.empty()) {
-        return shaderCode;
-    }
-
-    std::string out;
-    out.reserve(shaderCode.size() + renameMap.size() * 16);
-
-    size_t pos = 0;
-    while (pos < shaderCode.size()) {
-        if (!isIdentStart(shaderCode[pos])) {
-            out.push_back(shaderCode[pos]);
-            ++pos;
-            continue;
-        }
-
-        size_t tokenStart = pos;
-        ++pos;
-        while (pos < shaderCode.size() && isIdentChar(shaderCode[pos])) {
-            ++pos;
-        }
-        const std::string token = shaderCode.substr(tokenStart, pos - tokenStart);
-
-        size_t lookahead = pos;
-        while (lookahead < shaderCode.size() && std::isspace(static_cast<unsigned char>(shaderCode[lookahead])) != 0) {
-            ++lookahead;
-        }
-
-        const auto it = renameMap.find(token);
-        if (it != renameMap.end() && lookahead < shaderCode.size() && shaderCode[lookahead] == '(') {
-            out += it->second;
-        } else {
-            out += token;
-        }
-    }
-
-    return out;
-}
-
-std::string RemapMainToEntrypoint(const std::string& shaderCode, const std::string& entrypointName) {
-    auto isIdentChar = [](char c) {
-        return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_';
-    };
-
-    auto hasDeclaredFunction = [&](const std::string& source, const std::string& name) -> bool {
-        static const char* returnTypes[] = {"float4", "half4", "fixed4"};
-        for (const char* returnType : returnTypes) {
-            const std::string signatureA = std::string(returnType) + " " + name + "(";
-            const std::string signatureB = std::string(returnType) + " " + name + " (";
-            if (source.find(signatureA) != std::string::npos || source.find(signatureB) != std::string::npos) {
-                return true;
-            }
+size_t CountMicroConflicts(const TinyModuleMap& map) {
+    size_t conflicts = 0;
+    for (const auto& [signatureKey, bindings] : BuildMicroConflictBindings(map)) {
+        if (bindings.size() > 1) {
+            ++conflicts;
         }
-        return false;
-    };
-
-    auto appendAdapter = [&](std::string& source, const std::string& fromName) {
-        source += "\nfloat4 " + entrypointName + "(float2 fragCoord, float2 iResolution, float iTime){ return " +
-                  fromName + "(fragCoord, iResolution, iTime); }\n";
-    };
-
-    auto replaceFunctionDeclName = [&](std::string& source, const std::string& oldName) -> bool {
-        static const char* returnTypes[] = {"float4", "half4", "fixed4"};
-        for (const char* returnType : returnTypes) {
-            const std::string prefix = std::string(returnType) + " ";
-            const std::string compact = prefix + oldName + "(";
-            size_t pos = source.find(compact);
-            if (pos != std::string::npos) {
-                source.replace(pos + prefix.size(), oldName.size(), entrypointName);
-                return true;
-            }
-
-            const std::string spaced = prefix + oldName + " (";
-            pos = source.find(spaced);
-            if (pos != std::string::npos) {
-                source.replace(pos + prefix.size(), oldName.size(), entrypointName);
-                return true;
-            }
-        }
-        return false;
-    };
-
-    std::string out = shaderCode;
-    if (hasDeclaredFunction(out, entrypointName)) {
-        return out;
     }
-
-    if (replaceFunctionDeclName(out, "main")) {
-        return out;
-    }
-
-    static const char* friendlyEntrypoints[] = {
-        "mainImage",
-        "sceneMain",
-        "postFxMain",
-        "transitionMain",
-        "scene",
-        "postfx",
-        "transition",
-        "fxMain",
-        "effectMain",
-        "render"
-    };
-
-    for (const char* candidate : friendlyEntrypoints) {
-        const std::string name(candidate);
-        if (hasDeclaredFunction(out, name)) {
-            appendAdapter(out, name);
-            return out;
-        }
-    }
-
-    size_t scan = 0;
-    while (true) {
-        scan = out.find("float4", scan);
-        if (scan == std::string::npos) {
-            break;
-        }
-        size_t i = scan + 6;
-        while (i < out.size() && std::isspace(static_cast<unsigned char>(out[i])) != 0) {
-            ++i;
-        }
-        size_t nameStart = i;
-        while (i < out.size() && isIdentChar(out[i])) {
-            ++i;
-        }
-        if (i <= nameStart) {
-            scan += 6;
-            continue;
-        }
-        const std::string fnName = out.substr(nameStart, i - nameStart);
-        while (i < out.size() && std::isspace(static_cast<unsigned char>(out[i])) != 0) {
-            ++i;
-        }
-        if (i < out.size() && out[i] == '(' && fnName != entrypointName) {
-            appendAdapter(out, fnName);
-            return out;
-        }
-        scan += 6;
-    }
-
-    out += "\nfloat4 " + entrypointName + "(float2 fragCoord, float2 iResolution, float iTime){ return float4(1.0, 0.0, 1.0, 1.0); }\n";
-    return out;
+    return conflicts;
 }
 
 TinyModuleMap BuildTinyModuleMap(const ProjectData& project, bool scopeLocalFunctionsForUbershader) {
@@ -1170,19 +1110,28 @@ TinyModuleMap BuildTinyModuleMap(const ProjectData& project, bool scopeLocalFunc
         if (idx >= 0 && idx < static_cast<int>(kTransitionSlotCount)) usedTransitions[idx] = true;
     }
 
+    // Byte-identical shaders of the same kind (one post FX on several scenes) share a module,
+    // so the ubershader carries and compiles them once.
+    std::unordered_map<std::string, int16_t> moduleIdBySource;
     auto appendModule = [&](const std::string& shaderCode, const std::string& entrypointName, const std::string& moduleLabel) -> int16_t {
+        const auto [existing, inserted] = moduleIdBySource.emplace(entrypointName.substr(0, 1) + shaderCode, -1);
+        if (!inserted) {
+            return existing->second;
+        }
         const int16_t moduleId = static_cast<int16_t>((std::min)(static_cast<size_t>(32767), map.modules.size()));
-        const std::string remapped = RemapMainToEntrypoint(shaderCode, entrypointName);
-        const std::string scoped = scopeLocalFunctionsForUbershader
-            ? ScopeLocalFunctionsForModule(remapped, entrypointName)
-            : remapped;
-        const std::string compact = MinifyShaderTextForPack(scoped);
+        ModuleSourceTransform transform;
+        transform.entrypointName = entrypointName;
+        transform.remapEntrypoint = true;
+        transform.scopeLocalFunctions = scopeLocalFunctionsForUbershader;
+        transform.compact = true;
+        const std::string compact = TransformModuleSource(shaderCode, transform);
         if (compact.empty()) {
             return -1;
         }
         map.modules.push_back(compact);
         map.moduleEntrypoints.push_back(entrypointName);
         map.moduleLabels.push_back(moduleLabel);
+        existing->second = moduleId;
         return moduleId;
     };
 
@@ -1429,65 +1378,6 @@ const char* GetPackedVertexShaderPath() {
     return "assets/shaders/vertex.cso";
 }
 
-std::string MinifyShaderTextForPack(const std::string& input) {
-    std::string noComments;
-    noComments.reserve(input.size());
-
-    bool inLineComment = false;
-    bool inBlockComment = false;
-    for (size_t i = 0; i < input.size(); ++i) {
-        const char ch = input[i];
-        const char next = (i + 1 < input.size()) ? input[i + 1] : '\0';
-
-        if (inLineComment) {
-            if (ch == '\n') {
-                inLineComment = false;
-                noComments.push_back(ch);
-            }
-            continue;
-        }
-
-        if (inBlockComment) {
-            if (ch == '*' && next == '/') {
-                inBlockComment = false;
-                ++i;
-            }
-            continue;
-        }
-
-        if (ch == '/' && next == '/') {
-            inLineComment = true;
-            ++i;
-            continue;
-        }
-
-        if (ch == '/' && next == '*') {
-            inBlockComment = true;
-            ++i;
-            continue;
-        }
-
-        noComments.push_back(ch);
-    }
-
-    std::string out;
-    out.reserve(noComments.size());
-    bool prevSpace = false;
-    for (char ch : noComments) {
-        const unsigned char uch = static_cast<unsigned char>(ch);
-        if (std::isspace(uch)) {
-            if (!prevSpace) {
-                out.push_back(' ');
-                prevSpace = true;
-            }
-            continue;
-        }
-        out.push_back(ch);
-        prevSpace = false;
-    }
-    return TrimString(out);
-}
-
 std::string BuildMicroUbershaderSource(const TinyModuleMap& map) {
     std::string source;
     for (const auto& moduleCode : map.modules) {
@@ -2117,7 +2007,8 @@ std::vector<MicroUbershaderConflict> BuildPipeline::AnalyzeMicroUbershaderConfli
         return result;
     }
 
-    const TinyModuleMap map = BuildTinyModuleMap(project, false);
+    TinyModuleMap map = BuildTinyModuleMap(project, false);
+    DeduplicateMicroHelpers(map.modules, map.moduleEntrypoints);
     const auto grouped = BuildMicroConflictBindings(map);
     for (const auto& [signatureKey, bindings] : grouped) {
         if (bindings.size() < 2) {
@@ -2165,7 +2056,8 @@ bool BuildPipeline::GenerateMicroUbershaderSource(const std::string& projectPath
         return false;
     }
 
-    const TinyModuleMap map = BuildTinyModuleMap(project, false);
+    TinyModuleMap map = BuildTinyModuleMap(project, false);
+    DeduplicateMicroHelpers(map.modules, map.moduleEntrypoints);
     outSource = BuildMicroUbershaderSource(map);
     if (outSource.empty()) {
         outError = "Generated ubershader source is empty.";
@@ -2991,6 +2883,20 @@ BuildResult BuildPipeline::BuildSelfContained(
         log("  WARNING: One or more assets were not staged. Check [missing] entries above.");
     }
 
+    // Only DemoPlayer reads .sltex; the micro player decodes the staged images itself.
+    if (textureStagedCount > 0 && !useMicroPlayer) {
+        log("Texture bake (RGBA8 + mip chain):");
+        const TextureBakeSummary bake = BakeStagedTextures(project, packRoot, request.workerThreadCount, log);
+        result.texturesBaked = bake.baked;
+        result.textureBakeSavedBytes = static_cast<int64_t>(bake.sourceBytes) - static_cast<int64_t>(bake.bakedBytes);
+        result.textureDecodeMsAvoided = bake.decodeSeconds * 1000.0;
+        const int64_t delta = result.textureBakeSavedBytes;
+        log("  Summary: baked " + std::to_string(bake.baked) + ", skipped " + std::to_string(bake.skipped) +
+            "; source " + std::to_string(bake.sourceBytes) + " bytes -> baked " + std::to_string(bake.bakedBytes) + " bytes (" +
+            (delta >= 0 ? std::to_string(delta) + " saved" : std::to_string(-delta) + " added, before pack compression") +
+            "); launch decode avoided " + std::to_string(static_cast<int64_t>(result.textureDecodeMsAvoided)) + " ms");
+    }
+
     std::vector<Serializer::PackedExtraFile> extraFiles;
     std::string writeError;
 
@@ -3025,11 +2931,22 @@ BuildResult BuildPipeline::BuildSelfContained(
         extraFiles.push_back({vertexPath.string(), GetPackedVertexShaderPath()});
 
         TinyModuleMap tinyModuleMap = BuildTinyModuleMap(project, false);
-        std::unordered_set<std::string> preserveGlobalFunctionNames;
+        // Shared helpers keep their global name through scoping, like conflict winners below
+        MicroHelperDedupStats dedupStats;
+        const size_t conflictsBeforeDedup = CountMicroConflicts(tinyModuleMap);
+        std::unordered_set<std::string> preserveGlobalFunctionNames =
+            DeduplicateMicroHelpers(tinyModuleMap.modules, tinyModuleMap.moduleEntrypoints, &dedupStats);
+        const size_t conflictsAfterDedup = CountMicroConflicts(tinyModuleMap);
+        const size_t conflictsAvoided = conflictsBeforeDedup > conflictsAfterDedup ? conflictsBeforeDedup - conflictsAfterDedup : 0;
+        log("Micro helper dedup: " + std::to_string(dedupStats.sharedHelpers) + " shared helpers replaced " +
+            std::to_string(dedupStats.removedCopies) + " copies; " + std::to_string(dedupStats.bytesBefore) + " -> " +
+            std::to_string(dedupStats.bytesAfter) + " bytes; " + std::to_string(conflictsAvoided) +
+            " signature conflicts avoided");
+        // Conflict losers are dropped in the same token pass that scopes and compacts each module
+        std::unordered_map<int, std::vector<std::pair<size_t, size_t>>> removalsByModule;
 
         if (!request.microUbershaderKeepEntrypointsBySignature.empty()) {
             const auto grouped = BuildMicroConflictBindings(tinyModuleMap);
-            std::unordered_map<int, std::vector<std::pair<size_t, size_t>>> removalsByModule;
 
             for (const auto& [signatureKey, keepEntrypoints] : request.microUbershaderKeepEntrypointsBySignature) {
                 const auto it = grouped.find(signatureKey);
@@ -3039,6 +2956,14 @@ BuildResult BuildPipeline::BuildSelfContained(
 
                 std::unordered_set<std::string> keepSet(keepEntrypoints.begin(), keepEntrypoints.end());
                 const auto& bindings = it->second;
+                // A choice saved before modules were merged may name none of them; dropping every copy would break the build
+                const bool keepsAny = std::any_of(bindings.begin(), bindings.end(), [&](const ModuleConflictBinding& binding) {
+                    return keepSet.find(binding.moduleEntrypoint) != keepSet.end();
+                });
+                if (!keepsAny) {
+                    log("Warning: Ignoring keep choice for " + signatureKey + ": no module with that entrypoint.");
+                    continue;
+                }
                 if (keepSet.size() == 1 && !bindings.empty()) {
                     preserveGlobalFunctionNames.insert(bindings.front().functionName);
                 }
@@ -3050,31 +2975,55 @@ BuildResult BuildPipeline::BuildSelfContained(
                     removalsByModule[binding.moduleIndex].push_back({binding.signatureStart, binding.bodyEnd + 1});
                 }
             }
+        }
 
-            for (auto& [moduleIndex, ranges] : removalsByModule) {
-                if (moduleIndex < 0 || static_cast<size_t>(moduleIndex) >= tinyModuleMap.modules.size()) {
-                    continue;
-                }
-                auto& source = tinyModuleMap.modules[static_cast<size_t>(moduleIndex)];
-                std::sort(ranges.begin(), ranges.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
-                for (const auto& range : ranges) {
-                    if (range.first >= source.size() || range.second > source.size() || range.second <= range.first) {
-                        continue;
-                    }
-                    source.erase(range.first, range.second - range.first);
-                }
+        for (size_t moduleIndex = 0; moduleIndex < tinyModuleMap.modules.size(); ++moduleIndex) {
+            ModuleSourceTransform transform;
+            transform.entrypointName =
+                (moduleIndex < tinyModuleMap.moduleEntrypoints.size()) ? tinyModuleMap.moduleEntrypoints[moduleIndex] : std::string();
+            transform.scopeLocalFunctions = true;
+            transform.preserveGlobalNames = preserveGlobalFunctionNames.empty() ? nullptr : &preserveGlobalFunctionNames;
+            transform.compact = true;
+            const auto removals = removalsByModule.find(static_cast<int>(moduleIndex));
+            if (removals != removalsByModule.end()) {
+                transform.removeRanges = removals->second;
             }
+            tinyModuleMap.modules[moduleIndex] = TransformModuleSource(tinyModuleMap.modules[moduleIndex], transform);
         }
 
+        // Modules share one file: renamed helpers must stay unique across all of them, and no
+        // new name may collide with another module's macros. Developer builds keep the original
+        // names so DXC diagnostics stay readable.
+        std::unordered_set<std::string> reservedGlobalNames;
+        std::unordered_set<std::string> reservedMacroNames;
+        for (const auto& moduleCode : tinyModuleMap.modules) {
+            CollectHlslFileScopeNames(moduleCode, reservedGlobalNames);
+            CollectHlslDirectiveNames(moduleCode, reservedMacroNames);
+        }
+        size_t minifyBytesBefore = 0;
+        size_t minifyBytesAfter = 0;
+        log("Micro module minify (moduleId: bytes before -> after):");
         for (size_t moduleIndex = 0; moduleIndex < tinyModuleMap.modules.size(); ++moduleIndex) {
             const std::string entrypoint =
                 (moduleIndex < tinyModuleMap.moduleEntrypoints.size()) ? tinyModuleMap.moduleEntrypoints[moduleIndex] : std::string();
-            const std::string scoped = ScopeLocalFunctionsForModule(
-                tinyModuleMap.modules[moduleIndex],
-                entrypoint,
-                preserveGlobalFunctionNames.empty() ? nullptr : &preserveGlobalFunctionNames);
-            tinyModuleMap.modules[moduleIndex] = MinifyShaderTextForPack(scoped);
-        }
+            HlslMinifyOptions minify;
+            minify.renameHelpers = !microDeveloperBuild;
+            minify.renameLocals = !microDeveloperBuild;
+            minify.preserveNames = preserveGlobalFunctionNames;
+            minify.preserveNames.insert(entrypoint);
+            minify.reservedGlobalNames = &reservedGlobalNames;
+            minify.reservedMacroNames = &reservedMacroNames;
+            HlslMinifyStats stats;
+            tinyModuleMap.modules[moduleIndex] = MinifyHlsl(tinyModuleMap.modules[moduleIndex], minify, &stats);
+            CollectHlslFileScopeNames(tinyModuleMap.modules[moduleIndex], reservedGlobalNames);
+            minifyBytesBefore += stats.inputBytes;
+            minifyBytesAfter += stats.outputBytes;
+            log("  [" + std::to_string(moduleIndex) + "] " + entrypoint + ": " + std::to_string(stats.inputBytes) + " -> " +
+                std::to_string(stats.outputBytes) + " (" + std::to_string(stats.renamedHelpers) + " helpers, " +
+                std::to_string(stats.renamedLocals) + " locals renamed, " + std::to_string(stats.shortenedNumbers) + " literals shortened)");
+        }
+        result.shaderMinifySavedBytes = (minifyBytesBefore > minifyBytesAfter) ? minifyBytesBefore - minifyBytesAfter : 0;
+        log("  Total: " + std::to_string(minifyBytesBefore) + " -> " + std::to_string(minifyBytesAfter) + " bytes");
 
         log("Micro module table (moduleId -> runtime entrypoint):");
         for (size_t moduleIndex = 0; moduleIndex < tinyModuleMap.modules.size(); ++moduleIndex) {
@@ -3105,13 +3054,31 @@ BuildResult BuildPipeline::BuildSelfContained(
             ubershaderSource.push_back('\n');
         }
 
+        auto moduleEntrypoint = [&](size_t moduleIndex) {
+            return (moduleIndex < tinyModuleMap.moduleEntrypoints.size() && !tinyModuleMap.moduleEntrypoints[moduleIndex].empty())
+                       ? tinyModuleMap.moduleEntrypoints[moduleIndex]
+                       : ("s" + std::to_string(moduleIndex));
+        };
+
+        log("Compiling micro ubershader modules (module: DXC time):");
+        std::vector<ShaderBuildJob> moduleJobs(tinyModuleMap.modules.size());
+        for (size_t moduleIndex = 0; moduleIndex < moduleJobs.size(); ++moduleIndex) {
+            ShaderBuildJob& job = moduleJobs[moduleIndex];
+            job.label = "[" + std::to_string(moduleIndex) + "] " + moduleEntrypoint(moduleIndex);
+            job.source = BuildPixelShaderSource(ubershaderSource, {}, false, moduleEntrypoint(moduleIndex));
+            job.sourceName = L"micro_ubershader.hlsl";
+        }
+        std::vector<ShaderBuildOutput> moduleOutputs;
+        if (!CompileShaderJobs(moduleJobs, request.workerThreadCount, moduleOutputs, log)) {
+            log("Error: DXC not available. Cannot precompile micro ubershader modules.");
+            return result;
+        }
+
+        // Fallbacks are rare and run in module order on this thread's compiler
         std::vector<std::vector<uint8_t>> microModuleBytecode;
         microModuleBytecode.resize(tinyModuleMap.modules.size());
         for (size_t moduleIndex = 0; moduleIndex < tinyModuleMap.modules.size(); ++moduleIndex) {
-            const std::string entrypoint =
-                (moduleIndex < tinyModuleMap.moduleEntrypoints.size() && !tinyModuleMap.moduleEntrypoints[moduleIndex].empty())
-                    ? tinyModuleMap.moduleEntrypoints[moduleIndex]
-                    : ("s" + std::to_string(moduleIndex));
+            const std::string entrypoint = moduleEntrypoint(moduleIndex);
             auto tryCompile = [&](const std::string& source, const wchar_t* sourceName, std::vector<uint8_t>& outBytecode) -> bool {
                 auto psResult = compiler.CompileFromSource(source, "PSMain", "ps_6_0", sourceName, ShaderCompileMode::Build);
                 if (!psResult.success) {
@@ -3122,10 +3089,12 @@ BuildResult BuildPipeline::BuildSelfContained(
                 return true;
             };
 
-            const std::string wrappedCombined = BuildPixelShaderSource(ubershaderSource, {}, false, entrypoint);
-            if (tryCompile(wrappedCombined, L"micro_ubershader.hlsl", microModuleBytecode[moduleIndex])) {
+            ShaderCompileResult& combined = moduleOutputs[moduleIndex].result;
+            if (combined.success) {
+                microModuleBytecode[moduleIndex] = std::move(combined.bytecode);
                 continue;
             }
+            logDiagnostics(combined.diagnostics);
 
             log("Warning: Combined ubershader compile failed at " + entrypoint + ". Retrying module-local compile.");
             const std::string wrappedModuleLocal = BuildPixelShaderSource(tinyModuleMap.modules[moduleIndex], {}, false, entrypoint);
@@ -3200,7 +3169,24 @@ BuildResult BuildPipeline::BuildSelfContained(
             }
         }
 
-        log("Precompiling used transitions");
+        // Transitions, scenes and post FX compile as one parallel stage; files are written and
+        // packed in this order afterwards, so the pack does not depend on worker timing.
+        struct PackedShaderTarget {
+            std::string packedPath;
+            std::string failureMessage;
+            std::string* precompiledPath = nullptr;
+        };
+        std::vector<ShaderBuildJob> shaderJobs;
+        std::vector<PackedShaderTarget> shaderTargets;
+        auto addShaderJob = [&](std::string label, std::string wrapped, const wchar_t* sourceName, PackedShaderTarget target) {
+            ShaderBuildJob job;
+            job.label = std::move(label);
+            job.source = std::move(wrapped);
+            job.sourceName = sourceName;
+            shaderJobs.push_back(std::move(job));
+            shaderTargets.push_back(std::move(target));
+        };
+
         for (size_t transitionIdx = 0; transitionIdx < kTransitionSlotCount; ++transitionIdx) {
             if (!usedTransitions[transitionIdx]) {
                 continue;
@@ -3210,25 +3196,12 @@ BuildResult BuildPipeline::BuildSelfContained(
             if (!packedPath || !*packedPath) continue;
             std::string shaderSource = GetTransitionShaderSourceForBuild(transitionStem);
             std::vector<ShaderBase::TextureBindingDecl> decls = { {0, "Texture2D"}, {1, "Texture2D"} };
-            std::string wrapped = BuildPixelShaderSource(shaderSource, decls);
-            auto psResult = compiler.CompileFromSource(wrapped, "PSMain", "ps_6_0", L"transition.hlsl", ShaderCompileMode::Build);
-            if (!psResult.success) {
-                log("Error: Transition shader precompile failed.");
-                logDiagnostics(psResult.diagnostics);
-                return result;
-            }
-            fs::path transitionPath = packRoot / packedPath;
-            if (!WriteBinaryFile(transitionPath, psResult.bytecode, writeError)) {
-                log("Error: " + writeError);
-                return result;
-            }
-            extraFiles.push_back({transitionPath.string(), packedPath});
+            addShaderJob("Transition " + transitionStem, BuildPixelShaderSource(shaderSource, decls), L"transition.hlsl",
+                         {packedPath, "Error: Transition shader precompile failed.", nullptr});
         }
 
-        log("Precompiling scene and post FX shaders");
         for (size_t i = 0; i < project.scenes.size(); ++i) {
             auto& scene = project.scenes[i];
-            log("Scene " + std::to_string(i) + ": " + scene.name);
             std::vector<ShaderBase::TextureBindingDecl> decls;
             for (const auto& b : scene.bindings) {
                 if (!b.enabled) continue;
@@ -3240,24 +3213,8 @@ BuildResult BuildPipeline::BuildSelfContained(
                 decls.push_back(decl);
             }
 
-            std::string wrapped = BuildPixelShaderSource(scene.shaderCode, decls);
-            log("  Compiling scene shader -> assets/shaders/scene_" + std::to_string(i) + ".cso");
-            auto psResult = compiler.CompileFromSource(wrapped, "PSMain", "ps_6_0", L"scene.hlsl", ShaderCompileMode::Build);
-            if (!psResult.success) {
-                log("Error: Scene shader precompile failed: " + scene.name);
-                logDiagnostics(psResult.diagnostics);
-                return result;
-            }
-
-            std::string scenePackedPath = "assets/shaders/scene_" + std::to_string(i) + ".cso";
-            fs::path scenePath = packRoot / scenePackedPath;
-            if (!WriteBinaryFile(scenePath, psResult.bytecode, writeError)) {
-                log("Error: " + writeError);
-                return result;
-            }
-            scene.precompiledPath = scenePackedPath;
-            extraFiles.push_back({scenePath.string(), scenePackedPath});
-            log("  Packed scene shader: " + scenePackedPath);
+            addShaderJob("Scene " + std::to_string(i) + " " + scene.name, BuildPixelShaderSource(scene.shaderCode, decls), L"scene.hlsl",
+                         {"assets/shaders/scene_" + std::to_string(i) + ".cso", "Error: Scene shader precompile failed: " + scene.name, &scene.precompiledPath});
 
             for (size_t fxIndex = 0; fxIndex < scene.postFxChain.size(); ++fxIndex) {
                 auto& fx = scene.postFxChain[fxIndex];
@@ -3265,25 +3222,39 @@ BuildResult BuildPipeline::BuildSelfContained(
                     fx.precompiledPath.clear();
                     continue;
                 }
-                log("  Compiling post FX [" + std::to_string(fxIndex) + "] " + fx.name + " -> assets/shaders/scene_" + std::to_string(i) + "_fx_" + std::to_string(fxIndex) + ".cso");
-                std::string fxWrapped = BuildPixelShaderSource(fx.shaderCode, {}, true);
-                auto fxResult = compiler.CompileFromSource(fxWrapped, "PSMain", "ps_6_0", L"postfx.hlsl", ShaderCompileMode::Build);
-                if (!fxResult.success) {
-                    log("Error: Post FX precompile failed: " + fx.name);
-                    logDiagnostics(fxResult.diagnostics);
-                    return result;
-                }
+                addShaderJob("Scene " + std::to_string(i) + " post FX [" + std::to_string(fxIndex) + "] " + fx.name,
+                             BuildPixelShaderSource(fx.shaderCode, {}, true), L"postfx.hlsl",
+                             {"assets/shaders/scene_" + std::to_string(i) + "_fx_" + std::to_string(fxIndex) + ".cso",
+                              "Error: Post FX precompile failed: " + fx.name, &fx.precompiledPath});
+            }
+        }
 
-                std::string fxPackedPath = "assets/shaders/scene_" + std::to_string(i) + "_fx_" + std::to_string(fxIndex) + ".cso";
-                fs::path fxPath = packRoot / fxPackedPath;
-                if (!WriteBinaryFile(fxPath, fxResult.bytecode, writeError)) {
-                    log("Error: " + writeError);
-                    return result;
-                }
-                fx.precompiledPath = fxPackedPath;
-                extraFiles.push_back({fxPath.string(), fxPackedPath});
-                log("  Packed post FX shader: " + fxPackedPath);
+        log("Precompiling used transitions, scene and post FX shaders (shader: DXC time):");
+        std::vector<ShaderBuildOutput> shaderOutputs;
+        if (!CompileShaderJobs(shaderJobs, request.workerThreadCount, shaderOutputs, log)) {
+            log("Error: DXC not available. Cannot precompile shaders for self-contained build.");
+            return result;
+        }
+
+        for (size_t jobIndex = 0; jobIndex < shaderJobs.size(); ++jobIndex) {
+            const PackedShaderTarget& target = shaderTargets[jobIndex];
+            const ShaderCompileResult& psResult = shaderOutputs[jobIndex].result;
+            if (!psResult.success) {
+                log(target.failureMessage);
+                logDiagnostics(psResult.diagnostics);
+                return result;
             }
+
+            fs::path shaderPath = packRoot / target.packedPath;
+            if (!WriteBinaryFile(shaderPath, psResult.bytecode, writeError)) {
+                log("Error: " + writeError);
+                return result;
+            }
+            if (target.precompiledPath) {
+                *target.precompiledPath = target.packedPath;
+            }
+            extraFiles.push_back({shaderPath.string(), target.packedPath});
+            log("  Packed shader: " + target.packedPath);
         }
     }
 
@@ -3333,6 +3304,16 @@ BuildResult BuildPipeline::BuildSelfContained(
         return result;
     }
 
+    // The full player prefers the binary manifest; project.json stays for tooling and fallback.
+    const fs::path packProjectBinaryPath = packRoot / "project.bin";
+    if (!useMicroPlayer) {
+        if (!Serializer::SaveProjectBinary(project, packProjectBinaryPath.string())) {
+            log("Error: Failed to write packed binary project manifest.");
+            return result;
+        }
+        extraFiles.push_back({packProjectBinaryPath.string(), "project.bin"});
+    }
+
     log("----------------------------------------");
     log("[5/6] Export clean solution directory");
     fs::path cleanSolutionRoot;
@@ -3376,6 +3357,10 @@ BuildResult BuildPipeline::BuildSelfContained(
             log("Error: " + copyError);
             return result;
         }
+        if (!useMicroPlayer && !CopyPathRecursive(packProjectBinaryPath, packageDir / "project.bin", copyError)) {
+            log("Error: " + copyError);
+            return result;
+        }
         if (!CopyPathRecursive(packRoot / "assets", packageDir / "assets", copyError)) {
             log("Error: " + copyError);
             return result;
@@ -3394,11 +3379,22 @@ BuildResult BuildPipeline::BuildSelfContained(
             return result;
         }
     } else {
+        // Micro players load only precompiled blobs, so entries are compressed;
+        // size-budgeted builds spend extra encode time on the high-ratio search.
+        Serializer::PackOptions packOptions;
+        packOptions.includeProjectManifest = !useMicroPlayer;
+        packOptions.compression = !useMicroPlayer ? Serializer::PackCompression::None
+            : (budgetedBuild ? Serializer::PackCompression::High : Serializer::PackCompression::Fast);
+        packOptions.workerThreads = request.workerThreadCount;
+        packOptions.log = log;
+        Serializer::PackStats packStats;
         artifactOk = Serializer::PackExecutable(playerExe.string(),
                                                 finalArtifactPath.string(),
                                                 packProjectPath.string(),
                                                 extraFiles,
-                                                !useMicroPlayer);
+                                                packOptions,
+                                                &packStats);
+        result.packDedupSavedBytes = packStats.dedupSavedBytes;
         if (!artifactOk) {
             log("Error: PackExecutable failed.");
             log("  sourceExe: " + playerExe.string());
@@ -3432,6 +3428,21 @@ BuildResult BuildPipeline::BuildSelfContained(
             }
         }
 
+        if (result.packDedupSavedBytes > 0) {
+            const std::string dedupReport = "Pack dedup saved " + std::to_string(result.packDedupSavedBytes) + " bytes.";
+            result.report += result.report.empty() ? dedupReport : " " + dedupReport;
+        }
+        if (result.shaderMinifySavedBytes > 0) {
+            // Modules ship as DXC bytecode, so this is HLSL text saved, not artifact bytes.
+            const std::string minifyReport = "Micro module HLSL minified by " + std::to_string(result.shaderMinifySavedBytes) + " bytes before compiling.";
+            result.report += result.report.empty() ? minifyReport : " " + minifyReport;
+        }
+        if (result.texturesBaked > 0) {
+            const std::string bakeReport = "Baked " + std::to_string(result.texturesBaked) + " textures (" +
+                std::to_string(static_cast<int64_t>(result.textureDecodeMsAvoided)) + " ms decode avoided at launch).";
+            result.report += result.report.empty() ? bakeReport : " " + bakeReport;
+        }
+
         log("----------------------------------------");
         if (isPackagedDemo) {
             log("Runtime Target Path: Packaged Demo (.zip with runtime + assets)");
@@ -36,7 +36,7 @@ ShaderCompileResult DxcCompilationService::CompileFromSource(const std::string&
     }
 
     const std::string wrapped = ShaderBase::BuildFragmentShaderTemplate(source, shaderBindings);
-    return m_compiler->CompileFromSource(wrapped, entryPoint, target, sourceName, mode);
+    return CompileWrapped(wrapped, entryPoint, target, sourceName, mode);
 }
 
 ShaderCompileResult DxcCompilationService::CompilePreviewShader(const std::string& shaderSource,
@@ -60,7 +60,38 @@ ShaderCompileResult DxcCompilationService::CompilePreviewShader(const std::strin
     const std::string wrappedSource = ShaderBase::BuildPreviewPixelShaderTemplate(
         shaderSource, bindings, flipFragCoord, shaderEntryPoint);
 
-    return m_compiler->CompileFromSource(wrappedSource, "PSMain", "ps_6_0", sourceName, mode);
+    return CompileWrapped(wrappedSource, "PSMain", "ps_6_0", sourceName, mode);
+}
+
+void DxcCompilationService::SetBytecodeCache(ShaderBytecodeCache* cache) {
+    m_bytecodeCache = cache;
+}
+
+ShaderCompileResult DxcCompilationService::CompileWrapped(const std::string& wrappedSource,
+                                                          const std::string& entryPoint,
+                                                          const std::string& target,
+                                                          const std::wstring& sourceName,
+                                                          ShaderCompileMode mode) {
+    if (!m_bytecodeCache || !m_bytecodeCache->IsOpen() || !ShaderBytecodeCache::IsCacheableSource(wrappedSource)) {
+        return m_compiler->CompileFromSource(wrappedSource, entryPoint, target, sourceName, mode);
+    }
+
+    // The argument line rides along with the compiler version so flag changes invalidate entries.
+    const std::string compilerIdentity = m_compiler->GetCompilerVersion() + "|" + m_compiler->GetCompileArgumentsText(mode);
+    const ShaderBytecodeCache::Key key = ShaderBytecodeCache::MakeKey(
+        wrappedSource, entryPoint, target, static_cast<uint32_t>(mode), compilerIdentity);
+
+    ShaderCompileResult result;
+    if (m_bytecodeCache->Load(key, result.bytecode)) {
+        result.success = true;
+        return result;
+    }
+
+    result = m_compiler->CompileFromSource(wrappedSource, entryPoint, target, sourceName, mode);
+    if (result.success) {
+        m_bytecodeCache->Store(key, result.bytecode);
+    }
+    return result;
 }
 
 } // namespace ShaderLab
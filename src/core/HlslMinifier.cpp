@@ -0,0 +1,511 @@
+#include "ShaderLab/DevKit/HlslMinifier.h"
+
+#include "ShaderLab/DevKit/HlslTokenizer.h"
+
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace ShaderLab {
+
+namespace {
+
+constexpr size_t npos = HlslTokenStream::npos;
+
+// Reserved words and type names a generated name must never spell.
+bool IsHlslKeyword(std::string_view name) {
+    static const std::unordered_set<std::string_view> keywords = {
+        "asm", "auto", "bool", "break", "Buffer", "case", "catch", "cbuffer", "centroid", "char", "class",
+        "column_major", "compile", "const", "continue", "default", "delete", "discard", "do", "double",
+        "dword", "else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend", "goto",
+        "groupshared", "half", "if", "in", "inline", "inout", "int", "interface", "line", "lineadj",
+        "linear", "long", "matrix", "namespace", "new", "nointerpolation", "noperspective", "NULL",
+        "operator", "out", "packoffset", "point", "precise", "private", "protected", "public", "register",
+        "return", "row_major", "sample", "sampler", "shared", "short", "signed", "sizeof", "snorm",
+        "static", "string", "struct", "switch", "tbuffer", "template", "texture", "this", "throw",
+        "triangle", "triangleadj", "true", "try", "typedef", "typename", "uint", "uniform", "union",
+        "unorm", "unsigned", "using", "vector", "virtual", "void", "volatile", "while"
+    };
+    return keywords.find(name) != keywords.end();
+}
+
+// Helpers spelled like an intrinsic are overloads of it; renaming one would change which
+// function a call resolves to.
+bool IsHlslIntrinsic(std::string_view name) {
+    static const std::unordered_set<std::string_view> intrinsics = {
+        "abs", "acos", "all", "any", "asdouble", "asfloat", "asin", "asint", "asuint", "atan", "atan2",
+        "ceil", "clamp", "clip", "cos", "cosh", "countbits", "cross", "ddx", "ddx_coarse", "ddx_fine",
+        "ddy", "ddy_coarse", "ddy_fine", "degrees", "determinant", "distance", "dot", "dst", "exp", "exp2",
+        "f16tof32", "f32tof16", "faceforward", "firstbithigh", "firstbitlow", "floor", "fma", "fmod",
+        "frac", "frexp", "fwidth", "isfinite", "isinf", "isnan", "ldexp", "length", "lerp", "lit", "log",
+        "log10", "log2", "mad", "max", "min", "modf", "msad4", "mul", "noise", "normalize", "pow",
+        "radians", "rcp", "reflect", "refract", "reversebits", "round", "rsqrt", "saturate", "sign",
+        "sin", "sincos", "sinh", "smoothstep", "sqrt", "step", "tan", "tanh", "transpose", "trunc"
+    };
+    return intrinsics.find(name) != intrinsics.end();
+}
+
+// float, float3, float3x3, min16float2, ... and matrix/vector.
+bool IsBuiltinTypeName(std::string_view name) {
+    if (name == "matrix" || name == "vector") {
+        return true;
+    }
+    static constexpr std::string_view scalars[] = {
+        "bool", "int", "uint", "dword", "half", "float", "double",
+        "min16float", "min10float", "min16int", "min12int", "min16uint",
+        "int16_t", "uint16_t", "int32_t", "uint32_t", "int64_t", "uint64_t",
+        "float16_t", "float32_t", "float64_t"
+    };
+    auto isDim = [](char c) { return c >= '1' && c <= '4'; };
+    for (std::string_view scalar : scalars) {
+        if (name.substr(0, scalar.size()) != scalar) {
+            continue;
+        }
+        const std::string_view rest = name.substr(scalar.size());
+        if (rest.empty() || (rest.size() == 1 && isDim(rest[0])) ||
+            (rest.size() == 3 && isDim(rest[0]) && rest[1] == 'x' && isDim(rest[2]))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool IsDeclarationQualifier(std::string_view name) {
+    return name == "const" || name == "static" || name == "precise" || name == "uniform" ||
+           name == "volatile" || name == "row_major" || name == "column_major" || name == "snorm" || name == "unorm";
+}
+
+// Shortest names first: a..Z, then aa, ab, ... (digits allowed after the first character).
+std::string ShortName(size_t index) {
+    static constexpr std::string_view first = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    static constexpr std::string_view rest = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    std::string name(1, first[index % first.size()]);
+    index /= first.size();
+    while (index > 0) {
+        --index;
+        name.push_back(rest[index % rest.size()]);
+        index /= rest.size();
+    }
+    return name;
+}
+
+bool AllDigits(std::string_view text) {
+    return std::all_of(text.begin(), text.end(), [](char c) { return c >= '0' && c <= '9'; });
+}
+
+void CollectDirectiveNames(const HlslTokenStream& stream, std::unordered_set<std::string_view>& outNames) {
+    for (const HlslToken& token : stream.Tokens()) {
+        if (token.kind != HlslTokenKind::Directive) {
+            continue;
+        }
+        const HlslTokenStream directive(token.text.substr(1));
+        for (const HlslToken& inner : directive.Tokens()) {
+            if (inner.kind == HlslTokenKind::Identifier) {
+                outNames.insert(inner.text);
+            }
+        }
+    }
+}
+
+// Per code token: the function whose parameter list or body contains it, or -1.
+std::vector<int> MapFunctionRanges(const HlslTokenStream& stream, const std::vector<HlslFunction>& functions) {
+    std::vector<int> owner(stream.CodeCount(), -1);
+    for (size_t f = 0; f < functions.size(); ++f) {
+        for (size_t ci = functions[f].openParen; ci <= functions[f].closeBrace; ++ci) {
+            owner[ci] = static_cast<int>(f);
+        }
+    }
+    return owner;
+}
+
+// Identifiers used outside functions, skipping member accesses and struct bodies (members
+// are only reachable through '.').
+void CollectFileScopeNames(const HlslTokenStream& stream,
+                           const std::vector<int>& functionOf,
+                           std::unordered_set<std::string_view>& outNames) {
+    const size_t count = stream.CodeCount();
+    for (size_t ci = 0; ci < count; ++ci) {
+        if (functionOf[ci] >= 0) {
+            continue;
+        }
+        const HlslToken& token = stream.Code(ci);
+        if (token.kind != HlslTokenKind::Identifier || (ci > 0 && stream.CodeIs(ci - 1, "."))) {
+            continue;
+        }
+        outNames.insert(token.text);
+        if (token.Is("struct") && ci + 2 < count && stream.CodeIs(ci + 2, "{")) {
+            outNames.insert(stream.Code(ci + 1).text);
+            const size_t close = stream.MatchingBracket(ci + 2);
+            if (close == npos) {
+                break;
+            }
+            ci = close;
+        }
+    }
+}
+
+bool IsDeclaratorEnd(const HlslTokenStream& stream, size_t codeIndex) {
+    return stream.CodeIs(codeIndex, "=") || stream.CodeIs(codeIndex, ";") ||
+           stream.CodeIs(codeIndex, ",") || stream.CodeIs(codeIndex, "[");
+}
+
+// Code indices of parameter names: the last identifier before the semantic, default value
+// or array size of each parameter.
+void FindParameterDeclarators(const HlslTokenStream& stream, const HlslFunction& fn, std::vector<size_t>& outDeclarators) {
+    size_t lastIdentifier = npos;
+    uint32_t identifiers = 0;
+    bool stopped = false;
+    int angleDepth = 0;
+    for (size_t ci = fn.openParen + 1; ci <= fn.closeParen; ++ci) {
+        const HlslToken& token = stream.Code(ci);
+        if (ci == fn.closeParen || (angleDepth == 0 && token.Is(","))) {
+            if (identifiers >= 2 && lastIdentifier != npos) {
+                outDeclarators.push_back(lastIdentifier);
+            }
+            lastIdentifier = npos;
+            identifiers = 0;
+            stopped = false;
+            continue;
+        }
+        if (token.Is("(") || token.Is("[")) {
+            stopped = stopped || token.Is("[");
+            const size_t close = stream.MatchingBracket(ci);
+            if (close == npos || close >= fn.closeParen) {
+                return;
+            }
+            ci = close;
+            continue;
+        }
+        if (token.Is("<")) ++angleDepth;
+        if (token.Is(">") && angleDepth > 0) --angleDepth;
+        if (token.Is(":") || token.Is("=")) {
+            stopped = true;
+        }
+        if (!stopped && token.kind == HlslTokenKind::Identifier) {
+            lastIdentifier = ci;
+            ++identifiers;
+        }
+    }
+}
+
+// Code indices of local variable names declared in the body: `[qualifiers] type name ...`
+// at a statement start (or in a for initializer), including comma-separated declarators.
+void FindLocalDeclarators(const HlslTokenStream& stream,
+                          const HlslFunction& fn,
+                          const std::unordered_set<std::string_view>& structNames,
+                          std::vector<size_t>& outDeclarators) {
+    for (size_t ci = fn.openBrace + 1; ci < fn.closeBrace; ++ci) {
+        const bool statementStart = stream.CodeIs(ci - 1, "{") || stream.CodeIs(ci - 1, ";") || stream.CodeIs(ci - 1, "}") ||
+                                    (stream.CodeIs(ci - 1, "(") && ci >= 2 && stream.CodeIs(ci - 2, "for"));
+        if (!statementStart) {
+            continue;
+        }
+        size_t k = ci;
+        while (k < fn.closeBrace && IsDeclarationQualifier(stream.Code(k).text)) {
+            ++k;
+        }
+        if (k >= fn.closeBrace || stream.Code(k).kind != HlslTokenKind::Identifier) {
+            continue;
+        }
+        const std::string_view type = stream.Code(k).text;
+        if (!IsBuiltinTypeName(type) && structNames.find(type) == structNames.end()) {
+            continue;
+        }
+        ++k;
+        if (stream.CodeIs(k, "<")) {
+            while (k < fn.closeBrace && !stream.CodeIs(k, ">")) ++k;
+            ++k;
+        }
+        if (k >= fn.closeBrace || stream.Code(k).kind != HlslTokenKind::Identifier || !IsDeclaratorEnd(stream, k + 1)) {
+            continue;
+        }
+        outDeclarators.push_back(k);
+
+        for (size_t m = k + 1; m < fn.closeBrace; ++m) {
+            const HlslToken& token = stream.Code(m);
+            if (token.Is("(") || token.Is("[") || token.Is("{")) {
+                const size_t close = stream.MatchingBracket(m);
+                if (close == npos || close >= fn.closeBrace) {
+                    break;
+                }
+                m = close;
+                continue;
+            }
+            if (token.Is(";") || token.Is(")")) {
+                break;
+            }
+            if (token.Is(",") && m + 1 < fn.closeBrace &&
+                stream.Code(m + 1).kind == HlslTokenKind::Identifier && IsDeclaratorEnd(stream, m + 2)) {
+                outDeclarators.push_back(m + 1);
+            }
+        }
+    }
+}
+
+struct RenameCandidate {
+    std::string_view name;
+    uint32_t uses = 0;
+    size_t firstUse = 0;
+    std::string newName;
+};
+
+// Most used names get the shortest spellings; ties keep source order.
+void AssignShortNames(std::vector<RenameCandidate>& candidates, const std::function<bool(const std::string&)>& isTaken) {
+    std::vector<RenameCandidate*> order;
+    order.reserve(candidates.size());
+    for (auto& candidate : candidates) {
+        order.push_back(&candidate);
+    }
+    std::sort(order.begin(), order.end(), [](const RenameCandidate* a, const RenameCandidate* b) {
+        return a->uses != b->uses ? a->uses > b->uses : a->firstUse < b->firstUse;
+    });
+    size_t cursor = 0;
+    for (RenameCandidate* candidate : order) {
+        std::string name;
+        do {
+            name = ShortName(cursor++);
+        } while (isTaken(name));
+        candidate->newName = std::move(name);
+    }
+}
+
+} // namespace
+
+bool IsHlslEngineName(std::string_view name) {
+    static const std::unordered_set<std::string_view> names = {
+        "iTime", "iResolution", "iBeat", "iBar", "fBeat", "fBarBeat", "fBarBeat16",
+        "Constants", "PSInput", "PSMain"
+    };
+    if (names.find(name) != names.end()) {
+        return true;
+    }
+    for (std::string_view prefix : { std::string_view("iChannelSampler"), std::string_view("iChannel"), std::string_view("iSampler") }) {
+        if (name.substr(0, prefix.size()) == prefix && AllDigits(name.substr(prefix.size()))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string ShortenHlslFloatLiteral(std::string_view text) {
+    if (text.size() > 1 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+        return {};
+    }
+    size_t bodyEnd = text.size();
+    if (bodyEnd > 0 && std::string_view("fFhHlL").find(text[bodyEnd - 1]) != std::string_view::npos) {
+        --bodyEnd;
+    }
+    const std::string_view body = text.substr(0, bodyEnd);
+    const std::string_view suffix = text.substr(bodyEnd);
+
+    const size_t exponentPos = body.find_first_of("eE");
+    const std::string_view mantissa = body.substr(0, exponentPos);
+    const size_t dot = mantissa.find('.');
+    if (dot == std::string_view::npos && exponentPos == std::string_view::npos) {
+        return {};
+    }
+
+    std::string_view intPart = mantissa.substr(0, dot);
+    std::string_view fracPart = (dot == std::string_view::npos) ? std::string_view() : mantissa.substr(dot + 1);
+    bool negativeExponent = false;
+    std::string_view exponent;
+    if (exponentPos != std::string_view::npos) {
+        exponent = body.substr(exponentPos + 1);
+        if (!exponent.empty() && (exponent[0] == '+' || exponent[0] == '-')) {
+            negativeExponent = exponent[0] == '-';
+            exponent.remove_prefix(1);
+        }
+        if (exponent.empty()) {
+            return {};
+        }
+    }
+    if (!AllDigits(intPart) || !AllDigits(fracPart) || !AllDigits(exponent)) {
+        return {};
+    }
+
+    while (!intPart.empty() && intPart.front() == '0') intPart.remove_prefix(1);
+    while (!fracPart.empty() && fracPart.back() == '0') fracPart.remove_suffix(1);
+    while (!exponent.empty() && exponent.front() == '0') exponent.remove_prefix(1);
+
+    std::string out;
+    if (intPart.empty() && fracPart.empty()) {
+        out = "0.";
+    } else if (fracPart.empty() && exponent.empty() && intPart.size() > 2 && intPart.substr(intPart.size() - 2) == "00") {
+        // 1000. -> 1e3
+        size_t zeros = 0;
+        while (zeros < intPart.size() && intPart[intPart.size() - 1 - zeros] == '0') ++zeros;
+        out.assign(intPart.substr(0, intPart.size() - zeros));
+        out += "e" + std::to_string(zeros);
+    } else {
+        out.assign(intPart);
+        // An exponent alone makes the literal a float: 1e3
+        if (!fracPart.empty() || exponent.empty()) {
+            out.push_back('.');
+            out.append(fracPart);
+        }
+        if (!exponent.empty()) {
+            out += negativeExponent ? "e-" : "e";
+            out.append(exponent);
+        }
+    }
+    out.append(suffix);
+    return out.size() < text.size() ? out : std::string();
+}
+
+void CollectHlslFileScopeNames(std::string_view source, std::unordered_set<std::string>& outNames) {
+    const HlslTokenStream stream(source);
+    const std::vector<int> functionOf = MapFunctionRanges(stream, FindHlslFunctions(stream));
+    std::unordered_set<std::string_view> names;
+    CollectFileScopeNames(stream, functionOf, names);
+    for (std::string_view name : names) {
+        outNames.emplace(name);
+    }
+}
+
+void CollectHlslDirectiveNames(std::string_view source, std::unordered_set<std::string>& outNames) {
+    const HlslTokenStream stream(source);
+    std::unordered_set<std::string_view> names;
+    CollectDirectiveNames(stream, names);
+    for (std::string_view name : names) {
+        outNames.emplace(name);
+    }
+}
+
+std::string MinifyHlsl(std::string_view source, const HlslMinifyOptions& options, HlslMinifyStats* outStats) {
+    const HlslTokenStream stream(source);
+    const size_t count = stream.CodeCount();
+    const std::vector<HlslFunction> functions = FindHlslFunctions(stream);
+    const std::vector<int> functionOf = MapFunctionRanges(stream, functions);
+    HlslMinifyStats stats;
+    stats.inputBytes = source.size();
+
+    auto isMemberAccess = [&](size_t ci) { return ci > 0 && stream.CodeIs(ci - 1, "."); };
+
+    std::unordered_set<std::string_view> directiveNames;
+    CollectDirectiveNames(stream, directiveNames);
+    std::unordered_set<std::string_view> fileScopeNames;
+    CollectFileScopeNames(stream, functionOf, fileScopeNames);
+    std::unordered_set<std::string_view> structNames;
+    for (size_t ci = 0; ci + 1 < count; ++ci) {
+        if (stream.Code(ci).Is("struct") && stream.Code(ci + 1).kind == HlslTokenKind::Identifier) {
+            structNames.insert(stream.Code(ci + 1).text);
+        }
+    }
+
+    std::unordered_set<std::string_view> helpers;
+    if (options.renameHelpers) {
+        for (const HlslFunction& fn : functions) {
+            const std::string_view name = stream.Code(fn.name).text;
+            if (options.preserveNames.find(std::string(name)) != options.preserveNames.end() ||
+                IsHlslIntrinsic(name) || IsHlslEngineName(name) || directiveNames.count(name) != 0) {
+                continue;
+            }
+            helpers.insert(name);
+        }
+    }
+
+    // Per function: declared names, and which code tokens declare parameters
+    std::vector<std::unordered_set<std::string_view>> localsByFunction(functions.size());
+    std::vector<uint8_t> isParamDeclarator(count, 0);
+    if (options.renameLocals) {
+        std::vector<size_t> declarators;
+        for (size_t f = 0; f < functions.size(); ++f) {
+            declarators.clear();
+            FindParameterDeclarators(stream, functions[f], declarators);
+            for (size_t ci : declarators) isParamDeclarator[ci] = 1;
+            FindLocalDeclarators(stream, functions[f], structNames, declarators);
+            for (size_t ci : declarators) {
+                const std::string_view name = stream.Code(ci).text;
+                // Globals, helpers and macros of the same name would be shadowed differently
+                if (IsHlslEngineName(name) || fileScopeNames.count(name) != 0 || directiveNames.count(name) != 0) {
+                    continue;
+                }
+                localsByFunction[f].insert(name);
+            }
+        }
+    }
+
+    // Classify every identifier; whatever keeps its name is taken for new names.
+    enum : uint8_t { Keep, Helper, Local };
+    std::vector<uint8_t> action(count, Keep);
+    std::unordered_set<std::string> taken;
+    std::vector<RenameCandidate> helperCandidates;
+    std::unordered_map<std::string_view, size_t> helperIndex;
+    std::vector<std::vector<RenameCandidate>> localCandidates(functions.size());
+    std::vector<std::unordered_map<std::string_view, size_t>> localIndex(functions.size());
+    for (size_t ci = 0; ci < count; ++ci) {
+        const HlslToken& token = stream.Code(ci);
+        if (token.kind != HlslTokenKind::Identifier || isMemberAccess(ci)) {
+            continue;
+        }
+        const int f = functionOf[ci];
+        const bool inParams = f >= 0 && ci <= functions[f].closeParen;
+        const bool inBody = f >= 0 && ci >= functions[f].openBrace;
+        if (f >= 0 && localsByFunction[f].count(token.text) != 0 &&
+            ((inParams && isParamDeclarator[ci]) || (inBody && !IsHlslFreeCall(stream, ci)))) {
+            action[ci] = Local;
+            auto [it, inserted] = localIndex[f].emplace(token.text, localCandidates[f].size());
+            if (inserted) localCandidates[f].push_back({token.text, 0, ci, {}});
+            ++localCandidates[f][it->second].uses;
+            continue;
+        }
+        if (helpers.count(token.text) != 0) {
+            action[ci] = Helper;
+            auto [it, inserted] = helperIndex.emplace(token.text, helperCandidates.size());
+            if (inserted) helperCandidates.push_back({token.text, 0, ci, {}});
+            ++helperCandidates[it->second].uses;
+            continue;
+        }
+        taken.emplace(token.text);
+    }
+    for (std::string_view name : directiveNames) {
+        taken.emplace(name);
+    }
+
+    // Locals only shadow globals of other sources, which is harmless; helpers would redefine them.
+    auto isTaken = [&](const std::string& name) {
+        return taken.count(name) != 0 || IsHlslKeyword(name) || IsHlslEngineName(name) || IsBuiltinTypeName(name) ||
+               IsHlslIntrinsic(name) || (options.reservedMacroNames && options.reservedMacroNames->count(name) != 0);
+    };
+    auto isTakenGlobally = [&](const std::string& name) {
+        return isTaken(name) || (options.reservedGlobalNames && options.reservedGlobalNames->count(name) != 0);
+    };
+    AssignShortNames(helperCandidates, isTakenGlobally);
+    for (const auto& candidate : helperCandidates) {
+        taken.insert(candidate.newName);
+        if (candidate.newName != candidate.name) ++stats.renamedHelpers;
+    }
+    for (auto& candidates : localCandidates) {
+        AssignShortNames(candidates, isTaken);
+        for (const auto& candidate : candidates) {
+            if (candidate.newName != candidate.name) ++stats.renamedLocals;
+        }
+    }
+
+    HlslRewriter rewriter(stream);
+    for (size_t ci = 0; ci < count; ++ci) {
+        const HlslToken& token = stream.Code(ci);
+        if (action[ci] == Helper) {
+            rewriter.Replace(stream.TokenIndex(ci), helperCandidates[helperIndex[token.text]].newName);
+        } else if (action[ci] == Local) {
+            const int f = functionOf[ci];
+            rewriter.Replace(stream.TokenIndex(ci), localCandidates[f][localIndex[f][token.text]].newName);
+        } else if (options.shortenNumbers && token.kind == HlslTokenKind::Number) {
+            std::string shortened = ShortenHlslFloatLiteral(token.text);
+            if (!shortened.empty()) {
+                rewriter.Replace(stream.TokenIndex(ci), std::move(shortened));
+                ++stats.shortenedNumbers;
+            }
+        }
+    }
+
+    std::string out = rewriter.Emit(HlslRewriter::Layout::Minimal);
+    stats.outputBytes = out.size();
+    if (outStats) {
+        *outStats = stats;
+    }
+    return out;
+}
+
+} // namespace ShaderLab
@@ -0,0 +1,335 @@
+#include "ShaderLab/DevKit/HlslModuleTransform.h"
+
+#include "ShaderLab/DevKit/HlslMinifier.h"
+#include "ShaderLab/DevKit/HlslTokenizer.h"
+
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+
+namespace ShaderLab {
+
+namespace {
+
+bool IsEntrypointReturnType(std::string_view type) {
+    return type == "float4" || type == "half4" || type == "fixed4";
+}
+
+} // namespace
+
+std::string TransformModuleSource(const std::string& shaderCode, const ModuleSourceTransform& transform) {
+    const HlslTokenStream stream(shaderCode);
+    const std::vector<HlslFunction> functions = FindHlslFunctions(stream);
+    const auto& tokens = stream.Tokens();
+    HlslRewriter rewriter(stream);
+
+    auto isRemoved = [&](size_t offset) {
+        for (const auto& range : transform.removeRanges) {
+            if (offset >= range.first && offset < range.second) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (const auto& range : transform.removeRanges) {
+        if (range.second <= range.first || range.second > shaderCode.size()) {
+            continue;
+        }
+        const auto first = std::lower_bound(tokens.begin(), tokens.end(), range.first, [](const HlslToken& token, size_t offset) {
+            return token.offset < offset;
+        });
+        const auto end = std::lower_bound(first, tokens.end(), range.second, [](const HlslToken& token, size_t offset) {
+            return token.offset < offset;
+        });
+        if (first == tokens.end() || first->offset != range.first || end == first) {
+            continue;
+        }
+        rewriter.Remove(static_cast<size_t>(first - tokens.begin()), static_cast<size_t>(end - tokens.begin()) - 1);
+    }
+
+    const std::string& entrypointName = transform.entrypointName;
+    auto findDeclared = [&](std::string_view name) -> const HlslFunction* {
+        for (const HlslFunction& fn : functions) {
+            if (stream.Code(fn.name).text == name && IsEntrypointReturnType(stream.Code(fn.returnType).text) &&
+                !isRemoved(stream.Code(fn.returnType).offset)) {
+                return &fn;
+            }
+        }
+        return nullptr;
+    };
+
+    // Entrypoint: already declared, renamed from main, or reached through an adapter.
+    const HlslFunction* renamedMain = nullptr;
+    std::string adapterTarget;
+    bool appendFallback = false;
+    if (transform.remapEntrypoint && !findDeclared(entrypointName)) {
+        renamedMain = findDeclared("main");
+        if (!renamedMain) {
+            static const char* friendlyEntrypoints[] = {
+                "mainImage",
+                "sceneMain",
+                "postFxMain",
+                "transitionMain",
+                "scene",
+                "postfx",
+                "transition",
+                "fxMain",
+                "effectMain",
+                "render"
+            };
+            for (const char* candidate : friendlyEntrypoints) {
+                if (findDeclared(candidate)) {
+                    adapterTarget = candidate;
+                    break;
+                }
+            }
+        }
+        if (!renamedMain && adapterTarget.empty()) {
+            for (const HlslFunction& fn : functions) {
+                if (stream.Code(fn.returnType).Is("float4") && !stream.Code(fn.name).Is(entrypointName) &&
+                    !isRemoved(stream.Code(fn.returnType).offset)) {
+                    adapterTarget = std::string(stream.Code(fn.name).text);
+                    break;
+                }
+            }
+            appendFallback = adapterTarget.empty();
+        }
+    }
+
+    std::unordered_map<std::string_view, std::string> renameMap;
+    if (transform.scopeLocalFunctions) {
+        for (const HlslFunction& fn : functions) {
+            const std::string_view name = stream.Code(fn.name).text;
+            if (&fn == renamedMain || name == entrypointName || isRemoved(stream.Code(fn.returnType).offset) ||
+                (transform.preserveGlobalNames &&
+                 transform.preserveGlobalNames->find(std::string(name)) != transform.preserveGlobalNames->end())) {
+                continue;
+            }
+            renameMap.emplace(name, "__" + entrypointName + "_" + std::string(name));
+        }
+        if (renamedMain) {
+            renameMap.erase("main");
+        }
+    }
+
+    if (!renameMap.empty()) {
+        for (size_t i = 0; i < stream.CodeCount(); ++i) {
+            if (stream.Code(i).kind != HlslTokenKind::Identifier || !IsHlslFreeCall(stream, i)) {
+                continue;
+            }
+            const auto it = renameMap.find(stream.Code(i).text);
+            if (it != renameMap.end()) {
+                rewriter.Replace(stream.TokenIndex(i), it->second);
+            }
+        }
+    }
+
+    if (renamedMain) {
+        rewriter.Replace(stream.TokenIndex(renamedMain->name), entrypointName);
+    } else if (!adapterTarget.empty()) {
+        const auto it = renameMap.find(adapterTarget);
+        const std::string target = (it != renameMap.end()) ? it->second : adapterTarget;
+        rewriter.Append("\nfloat4 " + entrypointName + "(float2 fragCoord, float2 iResolution, float iTime){ return " +
+                        target + "(fragCoord, iResolution, iTime); }\n");
+    } else if (appendFallback) {
+        rewriter.Append("\nfloat4 " + entrypointName + "(float2 fragCoord, float2 iResolution, float iTime){ return float4(1.0, 0.0, 1.0, 1.0); }\n");
+    }
+
+    return rewriter.Emit(transform.compact ? HlslRewriter::Layout::Compact : HlslRewriter::Layout::Preserve);
+}
+
+std::unordered_set<std::string> DeduplicateMicroHelpers(std::vector<std::string>& modules,
+                                                        const std::vector<std::string>& entrypoints,
+                                                        MicroHelperDedupStats* outStats) {
+    struct Helper {
+        size_t moduleIndex = 0;
+        HlslFunction fn;
+        std::string_view name;
+        int classId = -1; // -1: never shared
+    };
+
+    const size_t moduleCount = modules.size();
+
+    std::vector<HlslTokenStream> streams;
+    streams.reserve(moduleCount);
+    std::vector<Helper> helpers;
+    std::vector<std::unordered_set<std::string_view>> moduleIdentifiers(moduleCount);
+    std::unordered_map<std::string_view, std::vector<size_t>> helpersByName;
+    std::unordered_set<std::string_view> entrypointNames;
+    std::unordered_set<std::string> fileScopeNames; // All modules, minus the functions each defines
+    std::unordered_map<std::string, int> classByKey;
+    std::vector<std::vector<size_t>> classMembers;
+
+    for (size_t moduleIndex = 0; moduleIndex < moduleCount; ++moduleIndex) {
+        const HlslTokenStream& stream = streams.emplace_back(modules[moduleIndex]);
+        const std::string_view entrypoint =
+            (moduleIndex < entrypoints.size()) ? std::string_view(entrypoints[moduleIndex]) : std::string_view();
+        entrypointNames.insert(entrypoint);
+        const std::vector<HlslFunction> functions = FindHlslFunctions(stream);
+        const size_t count = stream.CodeCount();
+
+        // Names this module defines outside functions: globals, structs, cbuffer members, macros
+        std::vector<uint8_t> inFunction(count, 0);
+        for (const HlslFunction& fn : functions) {
+            std::fill(inFunction.begin() + fn.returnType, inFunction.begin() + fn.closeBrace + 1, 1);
+        }
+        std::unordered_set<std::string> macroNames;
+        CollectHlslDirectiveNames(modules[moduleIndex], macroNames);
+        std::unordered_set<std::string_view> moduleGlobals(macroNames.begin(), macroNames.end());
+        for (size_t ci = 0; ci < count; ++ci) {
+            const HlslToken& token = stream.Code(ci);
+            if (token.kind != HlslTokenKind::Identifier || (ci > 0 && stream.CodeIs(ci - 1, "."))) {
+                continue;
+            }
+            moduleIdentifiers[moduleIndex].insert(token.text);
+            if (inFunction[ci] || ci == 0 || ci + 1 == count ||
+                !(stream.Code(ci - 1).kind == HlslTokenKind::Identifier || stream.CodeIs(ci - 1, ","))) {
+                continue;
+            }
+            const std::string_view next = stream.Code(ci + 1).text;
+            if (next == "=" || next == ";" || next == "[" || next == "," || next == ":" || next == "{") {
+                moduleGlobals.insert(token.text);
+            }
+        }
+
+        // A shared helper spelled like another module's global, struct or macro would clash
+        // with it once the modules are concatenated
+        std::unordered_set<std::string> moduleNames(macroNames);
+        CollectHlslFileScopeNames(modules[moduleIndex], moduleNames);
+        for (const HlslFunction& fn : functions) {
+            moduleNames.erase(std::string(stream.Code(fn.name).text));
+        }
+        fileScopeNames.insert(moduleNames.begin(), moduleNames.end());
+
+        std::unordered_map<std::string_view, size_t> helperByName; // npos when overloaded
+        const size_t firstHelper = helpers.size();
+        for (const HlslFunction& fn : functions) {
+            const std::string_view name = stream.Code(fn.name).text;
+            if (name == entrypoint) {
+                continue;
+            }
+            const auto [it, inserted] = helperByName.emplace(name, helpers.size());
+            if (!inserted) {
+                it->second = HlslTokenStream::npos;
+            }
+            helpersByName[name].push_back(helpers.size());
+            helpers.push_back({moduleIndex, fn, name, -1});
+        }
+
+        // Source order: callees are defined before their callers, so their class is known
+        for (size_t h = firstHelper; h < helpers.size(); ++h) {
+            Helper& helper = helpers[h];
+            if (helperByName[helper.name] == HlslTokenStream::npos) {
+                continue;
+            }
+            std::string key;
+            bool shareable = true;
+            for (size_t ci = helper.fn.returnType; ci <= helper.fn.closeBrace && shareable; ++ci) {
+                if (ci == helper.fn.name) {
+                    continue;
+                }
+                const HlslToken& token = stream.Code(ci);
+                if (token.kind == HlslTokenKind::Identifier && !stream.CodeIs(ci - 1, ".")) {
+                    if (moduleGlobals.count(token.text) != 0) {
+                        shareable = false;
+                        break;
+                    }
+                    const auto callee = helperByName.find(token.text);
+                    if (callee != helperByName.end()) {
+                        if (callee->second == HlslTokenStream::npos || helpers[callee->second].classId < 0) {
+                            shareable = false;
+                            break;
+                        }
+                        key += "@" + std::to_string(helpers[callee->second].classId) + "\x1f";
+                        continue;
+                    }
+                }
+                key.append(token.text);
+                key.push_back('\x1f');
+            }
+            if (!shareable) {
+                continue;
+            }
+            const auto [it, inserted] = classByKey.emplace(std::move(key), static_cast<int>(classMembers.size()));
+            if (inserted) {
+                classMembers.emplace_back();
+            }
+            helper.classId = it->second;
+            classMembers[it->second].push_back(h);
+        }
+    }
+
+    // Per module: definitions to drop and references to point at the shared name
+    std::vector<std::vector<const Helper*>> removals(moduleCount);
+    std::vector<std::unordered_map<std::string_view, std::string_view>> renames(moduleCount);
+    std::unordered_set<std::string> sharedNames;
+    MicroHelperDedupStats stats;
+    for (size_t classId = 0; classId < classMembers.size(); ++classId) {
+        std::vector<size_t> members = classMembers[classId];
+        bool conflicting = false;
+        for (size_t h : members) {
+            for (size_t other : helpersByName[helpers[h].name]) {
+                conflicting = conflicting || helpers[other].classId != static_cast<int>(classId);
+            }
+            conflicting = conflicting || entrypointNames.count(helpers[h].name) != 0 ||
+                          fileScopeNames.count(std::string(helpers[h].name)) != 0;
+        }
+        if (conflicting) {
+            continue;
+        }
+
+        const std::string_view sharedName = helpers[members.front()].name;
+        members.erase(std::remove_if(members.begin() + 1, members.end(), [&](size_t h) {
+            return helpers[h].name != sharedName && moduleIdentifiers[helpers[h].moduleIndex].count(sharedName) != 0;
+        }), members.end());
+        if (members.size() < 2) {
+            continue;
+        }
+
+        sharedNames.emplace(sharedName);
+        ++stats.sharedHelpers;
+        for (size_t m = 1; m < members.size(); ++m) {
+            const Helper& helper = helpers[members[m]];
+            removals[helper.moduleIndex].push_back(&helper);
+            if (helper.name != sharedName) {
+                renames[helper.moduleIndex][helper.name] = sharedName;
+            }
+            ++stats.removedCopies;
+        }
+    }
+
+    std::vector<std::string> rewritten(moduleCount);
+    for (size_t moduleIndex = 0; moduleIndex < moduleCount; ++moduleIndex) {
+        stats.bytesBefore += modules[moduleIndex].size();
+        if (removals[moduleIndex].empty()) {
+            continue;
+        }
+        const HlslTokenStream& stream = streams[moduleIndex];
+        HlslRewriter rewriter(stream);
+        for (size_t ci = 0; ci < stream.CodeCount() && !renames[moduleIndex].empty(); ++ci) {
+            const auto rename = renames[moduleIndex].find(stream.Code(ci).text);
+            if (rename != renames[moduleIndex].end() && (ci == 0 || !stream.CodeIs(ci - 1, "."))) {
+                rewriter.Replace(stream.TokenIndex(ci), std::string(rename->second));
+            }
+        }
+        for (const Helper* helper : removals[moduleIndex]) {
+            rewriter.Remove(stream.TokenIndex(helper->fn.returnType), stream.TokenIndex(helper->fn.closeBrace));
+        }
+        rewritten[moduleIndex] = rewriter.Emit(HlslRewriter::Layout::Preserve);
+    }
+    // Streams view the old text, so modules are swapped only once every rewrite is done
+    for (size_t moduleIndex = 0; moduleIndex < moduleCount; ++moduleIndex) {
+        if (!removals[moduleIndex].empty()) {
+            modules[moduleIndex] = std::move(rewritten[moduleIndex]);
+        }
+        stats.bytesAfter += modules[moduleIndex].size();
+    }
+
+    if (outStats) {
+        *outStats = stats;
+    }
+    return sharedNames;
+}
+
+} // namespace ShaderLab
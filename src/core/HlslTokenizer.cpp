@@ -0,0 +1,388 @@
+#include "ShaderLab/DevKit/HlslTokenizer.h"
+
+#include <algorithm>
+
+namespace ShaderLab {
+
+namespace {
+
+// ASCII only, without the locale lookups of <cctype>; this runs once per source byte.
+bool IsIdentStart(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+bool IsDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+bool IsIdentChar(char c) {
+    return IsIdentStart(c) || IsDigit(c);
+}
+
+bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+size_t LexPunctuator(std::string_view source, size_t pos) {
+    const char c = source[pos];
+    const char next = (pos + 1 < source.size()) ? source[pos + 1] : '\0';
+    switch (c) {
+        case '<':
+        case '>':
+            if (next == c) {
+                return (pos + 2 < source.size() && source[pos + 2] == '=') ? 3 : 2; // << <<= >> >>=
+            }
+            return next == '=' ? 2 : 1;
+        case '&':
+        case '|':
+        case '+':
+            return (next == c || next == '=') ? 2 : 1;
+        case '-':
+            return (next == '-' || next == '=' || next == '>') ? 2 : 1;
+        case '=':
+        case '!':
+        case '*':
+        case '/':
+        case '%':
+        case '^':
+            return next == '=' ? 2 : 1;
+        case ':':
+            return next == ':' ? 2 : 1;
+        default:
+            return 1;
+    }
+}
+
+// True when writing `next` right after `prev` would lex differently than the two tokens.
+bool NeedsSeparator(char prev, bool prevIsNumber, char next) {
+    if (IsIdentChar(prev) && IsIdentChar(next)) return true;
+    if (prevIsNumber && next == '.') return true;
+    // A preprocessing number runs through e+/e-, so 0x1E - 1 must not become 0x1E-1.
+    if (prevIsNumber && (prev == 'e' || prev == 'E') && (next == '+' || next == '-')) return true;
+    if (prev == '.' && IsDigit(next)) return true;
+    if (prev == '/' && (next == '/' || next == '*')) return true;
+    const char pair[2] = { prev, next };
+    return LexPunctuator(std::string_view(pair, 2), 0) == 2;
+}
+
+size_t LexNumber(std::string_view source, size_t pos) {
+    const size_t start = pos;
+    const bool hex = source[pos] == '0' && pos + 1 < source.size() && (source[pos + 1] == 'x' || source[pos + 1] == 'X');
+    while (pos < source.size()) {
+        const char c = source[pos];
+        if (IsIdentChar(c) || c == '.') {
+            ++pos;
+            continue;
+        }
+        // Exponent sign: 1.0e-3
+        if (!hex && (c == '+' || c == '-') && pos > start && (source[pos - 1] == 'e' || source[pos - 1] == 'E')) {
+            ++pos;
+            continue;
+        }
+        break;
+    }
+    return pos - start;
+}
+
+size_t LexDirective(std::string_view source, size_t pos) {
+    const size_t start = pos;
+    while (pos < source.size() && source[pos] != '\n') {
+        if (source[pos] == '\\' && pos + 1 < source.size() && source[pos + 1] == '\n') {
+            pos += 2;
+            continue;
+        }
+        if (source[pos] == '\\' && pos + 2 < source.size() && source[pos + 1] == '\r' && source[pos + 2] == '\n') {
+            pos += 3;
+            continue;
+        }
+        ++pos;
+    }
+    // Trailing \r of a CRLF line stays with the whitespace that follows
+    while (pos > start && source[pos - 1] == '\r') {
+        --pos;
+    }
+    return pos - start;
+}
+
+} // namespace
+
+HlslTokenStream::HlslTokenStream(std::string_view source)
+    : m_source(source) {
+    m_tokens.reserve(source.size() / 3 + 1);
+
+    bool lineStart = true; // Only whitespace since the last newline
+    size_t pos = 0;
+    while (pos < source.size()) {
+        const char c = source[pos];
+        const char next = (pos + 1 < source.size()) ? source[pos + 1] : '\0';
+        HlslTokenKind kind = HlslTokenKind::Punctuator;
+        size_t length = 1;
+
+        if (IsSpace(c)) {
+            kind = HlslTokenKind::Whitespace;
+            while (pos + length < source.size() && IsSpace(source[pos + length])) {
+                ++length;
+            }
+        } else if (c == '/' && next == '/') {
+            kind = HlslTokenKind::Comment;
+            while (pos + length < source.size() && source[pos + length] != '\n') {
+                ++length;
+            }
+        } else if (c == '/' && next == '*') {
+            kind = HlslTokenKind::Comment;
+            const size_t end = source.find("*/", pos + 2);
+            length = (end == std::string_view::npos) ? source.size() - pos : end + 2 - pos;
+        } else if (c == '#' && lineStart) {
+            kind = HlslTokenKind::Directive;
+            length = LexDirective(source, pos);
+        } else if (c == '"' || c == '\'') {
+            kind = HlslTokenKind::String;
+            while (pos + length < source.size() && source[pos + length] != c && source[pos + length] != '\n') {
+                length += (source[pos + length] == '\\' && pos + length + 1 < source.size()) ? 2 : 1;
+            }
+            if (pos + length < source.size() && source[pos + length] == c) {
+                ++length;
+            }
+        } else if (IsIdentStart(c)) {
+            kind = HlslTokenKind::Identifier;
+            while (pos + length < source.size() && IsIdentChar(source[pos + length])) {
+                ++length;
+            }
+        } else if (IsDigit(c) || (c == '.' && IsDigit(next))) {
+            kind = HlslTokenKind::Number;
+            length = LexNumber(source, pos);
+        } else {
+            length = LexPunctuator(source, pos);
+        }
+
+        HlslToken token;
+        token.kind = kind;
+        token.text = source.substr(pos, length);
+        token.offset = static_cast<uint32_t>(pos);
+        m_tokens.push_back(token);
+
+        if (kind == HlslTokenKind::Whitespace) {
+            if (token.text.find('\n') != std::string_view::npos) {
+                lineStart = true;
+            }
+        } else if (kind != HlslTokenKind::Comment) {
+            lineStart = false;
+        }
+        pos += length;
+    }
+
+    m_code.reserve(m_tokens.size() / 2 + 1);
+    for (size_t i = 0; i < m_tokens.size(); ++i) {
+        if (!m_tokens[i].IsTrivia()) {
+            m_code.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    m_match.assign(m_code.size(), npos);
+    m_braceDepth.assign(m_code.size(), 0);
+    std::vector<size_t> open;
+    uint32_t depth = 0;
+    for (size_t i = 0; i < m_code.size(); ++i) {
+        const std::string_view text = Code(i).text;
+        if (text.size() != 1) {
+            m_braceDepth[i] = depth;
+            continue;
+        }
+        const char c = text[0];
+        if (c == '(' || c == '[' || c == '{') {
+            m_braceDepth[i] = depth;
+            if (c == '{') ++depth;
+            open.push_back(i);
+            continue;
+        }
+        if (c == ')' || c == ']' || c == '}') {
+            if (c == '}' && depth > 0) --depth;
+            m_braceDepth[i] = depth;
+            const char expected = (c == ')') ? '(' : (c == ']') ? '[' : '{';
+            // Unbalanced input: unwind to the nearest matching opener
+            for (size_t k = open.size(); k > 0; --k) {
+                if (Code(open[k - 1]).text[0] == expected) {
+                    m_match[open[k - 1]] = i;
+                    m_match[i] = open[k - 1];
+                    open.resize(k - 1);
+                    break;
+                }
+            }
+            continue;
+        }
+        m_braceDepth[i] = depth;
+    }
+}
+
+std::vector<HlslFunction> FindHlslFunctions(const HlslTokenStream& stream) {
+    std::vector<HlslFunction> out;
+    const size_t count = stream.CodeCount();
+    for (size_t i = 0; i + 2 < count; ++i) {
+        if (stream.BraceDepth(i) != 0 ||
+            stream.Code(i).kind != HlslTokenKind::Identifier ||
+            stream.Code(i + 1).kind != HlslTokenKind::Identifier ||
+            !stream.CodeIs(i + 2, "(")) {
+            continue;
+        }
+        const size_t closeParen = stream.MatchingBracket(i + 2);
+        if (closeParen == HlslTokenStream::npos) {
+            continue;
+        }
+
+        size_t bodyOpen = closeParen + 1;
+        if (stream.CodeIs(bodyOpen, ":") && bodyOpen + 1 < count &&
+            stream.Code(bodyOpen + 1).kind == HlslTokenKind::Identifier) {
+            bodyOpen += 2;
+        }
+        if (!stream.CodeIs(bodyOpen, "{")) {
+            i = closeParen;
+            continue;
+        }
+        const size_t bodyClose = stream.MatchingBracket(bodyOpen);
+        if (bodyClose == HlslTokenStream::npos) {
+            break;
+        }
+
+        HlslFunction fn;
+        fn.returnType = i;
+        fn.name = i + 1;
+        fn.openParen = i + 2;
+        fn.closeParen = closeParen;
+        fn.openBrace = bodyOpen;
+        fn.closeBrace = bodyClose;
+        out.push_back(fn);
+        i = bodyClose;
+    }
+    return out;
+}
+
+bool IsHlslFreeCall(const HlslTokenStream& stream, size_t codeIndex) {
+    if (!stream.CodeIs(codeIndex + 1, "(")) {
+        return false;
+    }
+    return codeIndex == 0 || !stream.CodeIs(codeIndex - 1, ".");
+}
+
+void HlslRewriter::Replace(size_t tokenIndex, std::string text) {
+    m_edits.push_back({tokenIndex, tokenIndex, std::move(text)});
+}
+
+void HlslRewriter::Remove(size_t firstToken, size_t lastToken) {
+    if (lastToken < firstToken) {
+        return;
+    }
+    m_edits.push_back({firstToken, lastToken, std::string()});
+}
+
+void HlslRewriter::Append(std::string text) {
+    m_append += text;
+}
+
+std::string HlslRewriter::Emit(Layout layout) const {
+    const auto& tokens = m_stream.Tokens();
+    const bool compact = (layout != Layout::Preserve);
+    const bool minimal = (layout == Layout::Minimal);
+
+    std::vector<size_t> order(m_edits.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return m_edits[a].first < m_edits[b].first;
+    });
+
+    std::string out;
+    out.reserve(m_stream.Source().size() + m_append.size());
+    bool pendingSpace = false;
+    bool lastWasNumber = false;
+
+    // Code text: in Minimal layout a pending space is only written when the tokens would merge.
+    auto emitCode = [&](std::string_view text, bool isNumber) {
+        if (text.empty()) return;
+        if (pendingSpace && !out.empty() && out.back() != '\n' &&
+            (!minimal || NeedsSeparator(out.back(), lastWasNumber, text.front()))) {
+            out.push_back(' ');
+        }
+        pendingSpace = false;
+        out.append(text);
+        lastWasNumber = isNumber;
+    };
+
+    auto emitCompact = [&](std::string_view text) {
+        for (char c : text) {
+            if (IsSpace(c)) {
+                pendingSpace = true;
+                continue;
+            }
+            if (pendingSpace && !out.empty() && out.back() != '\n') {
+                out.push_back(' ');
+            }
+            pendingSpace = false;
+            out.push_back(c);
+        }
+    };
+
+    auto emitToken = [&](const HlslToken& token) {
+        if (!compact) {
+            out.append(token.text);
+            return;
+        }
+        switch (token.kind) {
+            case HlslTokenKind::Whitespace:
+            case HlslTokenKind::Comment:
+                pendingSpace = true;
+                break;
+            case HlslTokenKind::Directive:
+                if (!out.empty() && out.back() != '\n') out.push_back('\n');
+                out.append(token.text);
+                out.push_back('\n');
+                pendingSpace = false;
+                lastWasNumber = false;
+                break;
+            default:
+                // Minimal layout drops the whitespace between tokens, so it always counts as a break
+                if (minimal) pendingSpace = true;
+                emitCode(token.text, token.kind == HlslTokenKind::Number);
+                break;
+        }
+    };
+
+    size_t nextEdit = 0;
+    for (size_t i = 0; i < tokens.size();) {
+        // Edits that start inside an earlier, wider edit are dropped
+        while (nextEdit < order.size() && m_edits[order[nextEdit]].first < i) {
+            ++nextEdit;
+        }
+        if (nextEdit < order.size() && m_edits[order[nextEdit]].first == i) {
+            size_t chosen = nextEdit;
+            while (nextEdit < order.size() && m_edits[order[nextEdit]].first == i) {
+                chosen = nextEdit++;
+            }
+            const Edit& edit = m_edits[order[chosen]];
+            if (minimal) {
+                pendingSpace = true;
+                emitCode(edit.text, tokens[edit.first].kind == HlslTokenKind::Number);
+            } else if (compact) {
+                if (edit.text.empty()) pendingSpace = true;
+                emitCompact(edit.text);
+            } else {
+                out += edit.text;
+            }
+            i = edit.last + 1;
+            continue;
+        }
+        emitToken(tokens[i]);
+        ++i;
+    }
+
+    if (compact) {
+        pendingSpace = true;
+        emitCompact(m_append);
+        while (!out.empty() && IsSpace(out.back())) {
+            out.pop_back();
+        }
+    } else {
+        out += m_append;
+    }
+    return out;
+}
+
+} // namespace ShaderLab
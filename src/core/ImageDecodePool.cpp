@@ -0,0 +1,274 @@
+#include "ShaderLab/Core/ImageDecodePool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <utility>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+namespace ShaderLab {
+
+namespace {
+
+bool ReadFileBytes(const std::string& path, std::vector<uint8_t>& outBytes) {
+    outBytes.clear();
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+    const std::streamoff size = file.tellg();
+    if (size <= 0) {
+        return false;
+    }
+    outBytes.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(outBytes.data()), size));
+}
+
+// Decoded size from the image header, so a worker can reserve memory before decoding.
+uint64_t EstimateDecodedBytes(const std::vector<uint8_t>& encoded) {
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    if (encoded.empty() ||
+        !stbi_info_from_memory(encoded.data(), static_cast<int>(encoded.size()), &width, &height, &channels)) {
+        return 0;
+    }
+    return static_cast<uint64_t>(width) * static_cast<uint64_t>(height) * 4ull;
+}
+
+void DecodeEncoded(const std::vector<uint8_t>& encoded, DecodedImage& image) {
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    stbi_uc* pixels = stbi_load_from_memory(encoded.data(), static_cast<int>(encoded.size()), &width, &height, &channels, 4);
+    if (!pixels || width <= 0 || height <= 0) {
+        if (pixels) {
+            stbi_image_free(pixels);
+        }
+        const char* reason = stbi_failure_reason();
+        image.error = "Failed to decode " + image.path + (reason ? std::string(": ") + reason : std::string());
+        return;
+    }
+    image.width = static_cast<uint32_t>(width);
+    image.height = static_cast<uint32_t>(height);
+    image.rgba.assign(pixels, pixels + static_cast<size_t>(width) * static_cast<size_t>(height) * 4u);
+    image.success = true;
+    stbi_image_free(pixels);
+}
+
+} // namespace
+
+ImageDecodePool::~ImageDecodePool() {
+    Stop();
+}
+
+uint32_t ImageDecodePool::DefaultWorkerCount() {
+    const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    if (hardwareThreads <= 1) {
+        return 1;
+    }
+    return (std::min)(hardwareThreads - 1, 8u);
+}
+
+DecodedImage ImageDecodePool::Decode(const ImageDecodeJob& job) {
+    DecodedImage image;
+    image.id = job.id;
+    image.path = job.path;
+    if (!job.encoded.empty()) {
+        DecodeEncoded(job.encoded, image);
+        return image;
+    }
+    std::vector<uint8_t> encoded;
+    if (!ReadFileBytes(job.path, encoded)) {
+        image.error = "Failed to read " + job.path;
+        return image;
+    }
+    DecodeEncoded(encoded, image);
+    return image;
+}
+
+void ImageDecodePool::Start(uint32_t workerCount, uint64_t maxBytesInFlight) {
+    Stop();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_maxBytesInFlight = maxBytesInFlight;
+    m_stats = {};
+    m_workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&ImageDecodePool::WorkerLoop, this);
+    }
+}
+
+void ImageDecodePool::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+    m_budgetReleased.notify_all();
+    m_imageReady.notify_all();
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_workers.clear();
+    m_slots.clear();
+    m_nextJob = 0;
+    m_nextDeliver = 0;
+    m_bytesInFlight = 0;
+    m_stopping = false;
+}
+
+void ImageDecodePool::Submit(ImageDecodeJob job) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Slot slot;
+        slot.image.id = job.id;
+        slot.image.path = job.path;
+        slot.job = std::move(job);
+        m_slots.push_back(std::move(slot));
+    }
+    m_workAvailable.notify_one();
+}
+
+size_t ImageDecodePool::Poll(std::vector<DecodedImage>& outImages, size_t maxResults) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return DeliverLocked(lock, outImages, maxResults, false);
+}
+
+bool ImageDecodePool::WaitNext(DecodedImage& outImage) {
+    std::vector<DecodedImage> images;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (DeliverLocked(lock, images, 1, true) == 0) {
+        return false;
+    }
+    outImage = std::move(images.front());
+    return true;
+}
+
+void ImageDecodePool::Drain(std::vector<DecodedImage>& outImages) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    DeliverLocked(lock, outImages, SIZE_MAX, true);
+}
+
+bool ImageDecodePool::IsIdle() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_slots.empty();
+}
+
+size_t ImageDecodePool::PendingCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_slots.size();
+}
+
+ImageDecodeStats ImageDecodePool::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void ImageDecodePool::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_workAvailable.wait(lock, [this] {
+            return m_stopping || m_nextJob < m_nextDeliver + m_slots.size();
+        });
+        if (m_stopping) {
+            return;
+        }
+        const size_t sequence = m_nextJob++;
+        DecodeSlot(sequence, lock);
+    }
+}
+
+void ImageDecodePool::DecodeSlot(size_t sequence, std::unique_lock<std::mutex>& lock) {
+    // The slot stays put while unlocked: only ready slots are popped, and Stop() joins first.
+    Slot& slot = m_slots[sequence - m_nextDeliver];
+    lock.unlock();
+
+    const auto startTime = std::chrono::steady_clock::now();
+    DecodedImage& image = slot.image;
+    std::vector<uint8_t> encoded = std::move(slot.job.encoded);
+    const bool haveBytes = !encoded.empty() || ReadFileBytes(slot.job.path, encoded);
+    const uint64_t encodedBytes = encoded.size();
+    const uint64_t reserveBytes = encodedBytes + (haveBytes ? EstimateDecodedBytes(encoded) : 0);
+
+    lock.lock();
+    const auto hasRoom = [&] {
+        return m_stopping || sequence == m_nextDeliver || m_bytesInFlight + reserveBytes <= m_maxBytesInFlight;
+    };
+    if (!hasRoom()) {
+        ++m_stats.budgetWaits;
+        m_budgetReleased.wait(lock, hasRoom);
+    }
+    if (m_stopping) {
+        return;
+    }
+    m_bytesInFlight += reserveBytes;
+    m_stats.peakBytesInFlight = (std::max)(m_stats.peakBytesInFlight, m_bytesInFlight);
+    lock.unlock();
+
+    if (haveBytes) {
+        DecodeEncoded(encoded, image);
+    } else {
+        image.error = "Failed to read " + slot.job.path;
+    }
+    encoded.clear();
+    encoded.shrink_to_fit();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    lock.lock();
+    // From here on only the pixels count against the budget.
+    m_bytesInFlight -= reserveBytes;
+    slot.reservedBytes = image.rgba.size();
+    m_bytesInFlight += slot.reservedBytes;
+    slot.ready = true;
+    if (image.success) {
+        ++m_stats.imagesDecoded;
+        m_stats.decodedBytes += image.rgba.size();
+    } else {
+        ++m_stats.imagesFailed;
+    }
+    m_stats.encodedBytes += encodedBytes;
+    m_stats.decodeSeconds += seconds;
+    m_budgetReleased.notify_all();
+    m_imageReady.notify_all();
+}
+
+size_t ImageDecodePool::DeliverLocked(std::unique_lock<std::mutex>& lock,
+                                      std::vector<DecodedImage>& outImages,
+                                      size_t maxResults,
+                                      bool wait) {
+    size_t delivered = 0;
+    while (delivered < maxResults && !m_slots.empty() && !m_stopping) {
+        if (m_workers.empty() && !m_slots.front().ready) {
+            // Inline mode: the caller's thread decodes, one image per slot.
+            const size_t sequence = m_nextJob++;
+            DecodeSlot(sequence, lock);
+        }
+        if (!m_slots.front().ready) {
+            if (!wait) {
+                break;
+            }
+            m_imageReady.wait(lock, [this] { return m_stopping || m_slots.front().ready; });
+            continue;
+        }
+
+        Slot& slot = m_slots.front();
+        m_bytesInFlight -= slot.reservedBytes;
+        outImages.push_back(std::move(slot.image));
+        m_slots.pop_front();
+        ++m_nextDeliver;
+        ++delivered;
+        // Wakes workers waiting for memory or for their image to become the oldest.
+        m_budgetReleased.notify_all();
+    }
+    return delivered;
+}
+
+} // namespace ShaderLab
@@ -0,0 +1,388 @@
+#include "ShaderLab/Core/PackCodec.h"
+#include <cstring>
+#include <vector>
+
+namespace ShaderLab {
+namespace PackCodec {
+
+namespace {
+
+constexpr char kFrameMagic[4] = {'S', 'L', 'Z', '2'};
+
+constexpr size_t kMinMatch = 4;
+constexpr size_t kLastLiterals = 5;  // Block must end with at least this many literals
+constexpr size_t kMatchFindLimit = 12; // No match may start within this many bytes of the end
+constexpr size_t kMaxOffset = 65535;
+
+constexpr uint32_t kFastHashLog = 14;
+constexpr uint32_t kHighHashLog = 16;
+constexpr size_t kHighWindowMask = 65535;
+constexpr int kHighSearchDepth = 256;
+
+uint32_t Read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+uint32_t HashSequence(uint32_t sequence, uint32_t hashLog) {
+    return (sequence * 2654435761u) >> (32u - hashLog);
+}
+
+size_t CountMatch(const uint8_t* a, const uint8_t* b, const uint8_t* bLimit) {
+    const uint8_t* start = b;
+    while (b < bLimit && *a == *b) {
+        ++a;
+        ++b;
+    }
+    return static_cast<size_t>(b - start);
+}
+
+bool WriteLength(uint8_t*& op, const uint8_t* opEnd, size_t length) {
+    while (length >= 255) {
+        if (op >= opEnd) return false;
+        *op++ = 255;
+        length -= 255;
+    }
+    if (op >= opEnd) return false;
+    *op++ = static_cast<uint8_t>(length);
+    return true;
+}
+
+// matchLength == 0 emits the trailing literal-only sequence.
+bool EmitSequence(uint8_t*& op, const uint8_t* opEnd,
+                  const uint8_t* literals, size_t literalLength,
+                  size_t offset, size_t matchLength) {
+    if (op >= opEnd) return false;
+    uint8_t* token = op++;
+    const size_t literalCode = literalLength < 15 ? literalLength : 15;
+    size_t matchCode = 0;
+    if (matchLength > 0) {
+        matchCode = (matchLength - kMinMatch) < 15 ? (matchLength - kMinMatch) : 15;
+    }
+    *token = static_cast<uint8_t>((literalCode << 4) | matchCode);
+
+    if (literalCode == 15 && !WriteLength(op, opEnd, literalLength - 15)) {
+        return false;
+    }
+    if (literalLength > static_cast<size_t>(opEnd - op)) {
+        return false;
+    }
+    if (literalLength > 0) {
+        std::memcpy(op, literals, literalLength);
+        op += literalLength;
+    }
+
+    if (matchLength == 0) {
+        return true;
+    }
+
+    if (opEnd - op < 2) return false;
+    *op++ = static_cast<uint8_t>(offset & 0xFFu);
+    *op++ = static_cast<uint8_t>((offset >> 8) & 0xFFu);
+
+    if (matchCode == 15 && !WriteLength(op, opEnd, matchLength - kMinMatch - 15)) {
+        return false;
+    }
+    return true;
+}
+
+size_t CompressFast(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity) {
+    uint8_t* op = dst;
+    const uint8_t* opEnd = dst + dstCapacity;
+    size_t anchor = 0;
+
+    if (srcSize > kMatchFindLimit) {
+        std::vector<uint32_t> table(static_cast<size_t>(1u) << kFastHashLog, 0u);
+        const size_t matchLimit = srcSize - kLastLiterals;
+        const size_t ipLimit = srcSize - kMatchFindLimit;
+
+        size_t ip = 1;
+        while (ip <= ipLimit) {
+            const uint32_t sequence = Read32(src + ip);
+            const uint32_t hash = HashSequence(sequence, kFastHashLog);
+            size_t ref = table[hash];
+            table[hash] = static_cast<uint32_t>(ip);
+
+            if (ref >= ip || ip - ref > kMaxOffset || Read32(src + ref) != sequence) {
+                // Skip faster through data that keeps missing.
+                ip += 1 + ((ip - anchor) >> 6);
+                continue;
+            }
+
+            while (ip > anchor && ref > 0 && src[ip - 1] == src[ref - 1]) {
+                --ip;
+                --ref;
+            }
+
+            const size_t matchLength = kMinMatch + CountMatch(src + ref + kMinMatch, src + ip + kMinMatch, src + matchLimit);
+            if (!EmitSequence(op, opEnd, src + anchor, ip - anchor, ip - ref, matchLength)) {
+                return 0;
+            }
+            ip += matchLength;
+            anchor = ip;
+
+            if (ip - 2 <= ipLimit) {
+                table[HashSequence(Read32(src + ip - 2), kFastHashLog)] = static_cast<uint32_t>(ip - 2);
+            }
+        }
+    }
+
+    if (!EmitSequence(op, opEnd, src + anchor, srcSize - anchor, 0, 0)) {
+        return 0;
+    }
+    return static_cast<size_t>(op - dst);
+}
+
+class ChainMatchFinder {
+public:
+    explicit ChainMatchFinder(const uint8_t* src)
+        : m_src(src),
+          m_head(static_cast<size_t>(1u) << kHighHashLog, -1),
+          m_chain(kHighWindowMask + 1, -1) {
+    }
+
+    void InsertUpTo(size_t pos) {
+        while (m_nextInsert < pos) {
+            const uint32_t hash = HashSequence(Read32(m_src + m_nextInsert), kHighHashLog);
+            m_chain[m_nextInsert & kHighWindowMask] = m_head[hash];
+            m_head[hash] = static_cast<int32_t>(m_nextInsert);
+            ++m_nextInsert;
+        }
+    }
+
+    size_t FindLongest(size_t pos, size_t matchLimit, size_t& outOffset) {
+        InsertUpTo(pos);
+        size_t bestLength = 0;
+        const uint32_t sequence = Read32(m_src + pos);
+        int32_t candidate = m_head[HashSequence(sequence, kHighHashLog)];
+        int depth = kHighSearchDepth;
+        while (candidate >= 0 && depth-- > 0) {
+            const size_t ref = static_cast<size_t>(candidate);
+            if (pos - ref > kMaxOffset) {
+                break;
+            }
+            if (m_src[ref + bestLength] == m_src[pos + bestLength] && Read32(m_src + ref) == sequence) {
+                const size_t length = kMinMatch + CountMatch(m_src + ref + kMinMatch, m_src + pos + kMinMatch, m_src + matchLimit);
+                if (length > bestLength) {
+                    bestLength = length;
+                    outOffset = pos - ref;
+                    if (pos + length >= matchLimit) {
+                        break;
+                    }
+                }
+            }
+            const int32_t next = m_chain[ref & kHighWindowMask];
+            if (next >= candidate) {
+                break;
+            }
+            candidate = next;
+        }
+        return bestLength >= kMinMatch ? bestLength : 0;
+    }
+
+private:
+    const uint8_t* m_src;
+    std::vector<int32_t> m_head;
+    std::vector<int32_t> m_chain;
+    size_t m_nextInsert = 0;
+};
+
+size_t CompressHigh(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity) {
+    uint8_t* op = dst;
+    const uint8_t* opEnd = dst + dstCapacity;
+    size_t anchor = 0;
+
+    if (srcSize > kMatchFindLimit) {
+        ChainMatchFinder finder(src);
+        const size_t matchLimit = srcSize - kLastLiterals;
+        const size_t ipLimit = srcSize - kMatchFindLimit;
+
+        size_t ip = 0;
+        while (ip <= ipLimit) {
+            size_t offset = 0;
+            size_t length = finder.FindLongest(ip, matchLimit, offset);
+            if (length == 0) {
+                ++ip;
+                continue;
+            }
+
+            // Lazy evaluation: defer by one byte while that yields a longer match.
+            while (ip + 1 <= ipLimit) {
+                size_t nextOffset = 0;
+                const size_t nextLength = finder.FindLongest(ip + 1, matchLimit, nextOffset);
+                if (nextLength <= length) {
+                    break;
+                }
+                ++ip;
+                length = nextLength;
+                offset = nextOffset;
+            }
+
+            if (!EmitSequence(op, opEnd, src + anchor, ip - anchor, offset, length)) {
+                return 0;
+            }
+            ip += length;
+            anchor = ip;
+        }
+    }
+
+    if (!EmitSequence(op, opEnd, src + anchor, srcSize - anchor, 0, 0)) {
+        return 0;
+    }
+    return static_cast<size_t>(op - dst);
+}
+
+} // namespace
+
+size_t CompressBound(size_t inputSize) {
+    return inputSize + inputSize / 255 + 16;
+}
+
+size_t CompressBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity, Level level) {
+    if (!dst || dstCapacity == 0 || (!src && srcSize > 0)) {
+        return 0;
+    }
+    return level == Level::High
+        ? CompressHigh(src, srcSize, dst, dstCapacity)
+        : CompressFast(src, srcSize, dst, dstCapacity);
+}
+
+bool DecompressBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+    const uint8_t* ip = src;
+    const uint8_t* const ipEnd = src + srcSize;
+    uint8_t* op = dst;
+    uint8_t* const opEnd = dst + dstSize;
+
+    for (;;) {
+        if (ip >= ipEnd) {
+            return false;
+        }
+        const uint8_t token = *ip++;
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15) {
+            uint8_t extra = 0;
+            do {
+                if (ip >= ipEnd) return false;
+                extra = *ip++;
+                literalLength += extra;
+            } while (extra == 255);
+        }
+        if (literalLength > static_cast<size_t>(ipEnd - ip) || literalLength > static_cast<size_t>(opEnd - op)) {
+            return false;
+        }
+        if (literalLength > 0) {
+            std::memcpy(op, ip, literalLength);
+            op += literalLength;
+            ip += literalLength;
+        }
+
+        if (ip == ipEnd) {
+            return op == opEnd;
+        }
+
+        if (ipEnd - ip < 2) {
+            return false;
+        }
+        const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst)) {
+            return false;
+        }
+
+        size_t matchLength = token & 15u;
+        if (matchLength == 15) {
+            uint8_t extra = 0;
+            do {
+                if (ip >= ipEnd) return false;
+                extra = *ip++;
+                matchLength += extra;
+            } while (extra == 255);
+        }
+        matchLength += kMinMatch;
+        if (matchLength > static_cast<size_t>(opEnd - op)) {
+            return false;
+        }
+
+        const uint8_t* match = op - offset;
+        if (offset >= matchLength) {
+            std::memcpy(op, match, matchLength);
+            op += matchLength;
+        } else {
+            // Overlapping copy replicates the repeating pattern.
+            for (size_t i = 0; i < matchLength; ++i) {
+                *op++ = *match++;
+            }
+        }
+    }
+}
+
+bool ReadFrameHeader(std::span<const uint8_t> input, FrameHeader& outHeader) {
+    if (input.size() < kHeaderSize || std::memcmp(input.data(), kFrameMagic, 4) != 0) {
+        return false;
+    }
+    outHeader.codec = input[4];
+    std::memcpy(&outHeader.rawSize, input.data() + 8, sizeof(uint32_t));
+    std::memcpy(&outHeader.compressedSize, input.data() + 12, sizeof(uint32_t));
+    if (outHeader.codec != kCodecLz4Fast && outHeader.codec != kCodecLz4High) {
+        return false;
+    }
+    if (outHeader.rawSize == 0 || outHeader.compressedSize == 0) {
+        return false;
+    }
+    return static_cast<size_t>(outHeader.compressedSize) + kHeaderSize == input.size();
+}
+
+bool Compress(std::span<const uint8_t> input, Level level, std::vector<uint8_t>& output) {
+    output.clear();
+    if (input.empty() || input.size() > static_cast<size_t>(UINT32_MAX)) {
+        return false;
+    }
+
+    output.resize(kHeaderSize + CompressBound(input.size()));
+    const size_t blockSize = CompressBlock(input.data(), input.size(), output.data() + kHeaderSize, output.size() - kHeaderSize, level);
+    if (blockSize == 0 || kHeaderSize + blockSize >= input.size()) {
+        output.clear();
+        return false;
+    }
+
+    const uint8_t codec = level == Level::High ? kCodecLz4High : kCodecLz4Fast;
+    const uint32_t rawSize = static_cast<uint32_t>(input.size());
+    const uint32_t compressedSize = static_cast<uint32_t>(blockSize);
+    std::memcpy(output.data(), kFrameMagic, 4);
+    output[4] = codec;
+    output[5] = 0;
+    output[6] = 0;
+    output[7] = 0;
+    std::memcpy(output.data() + 8, &rawSize, sizeof(uint32_t));
+    std::memcpy(output.data() + 12, &compressedSize, sizeof(uint32_t));
+    output.resize(kHeaderSize + blockSize);
+    return true;
+}
+
+bool Decompress(std::span<const uint8_t> input, std::vector<uint8_t>& output) {
+    output.clear();
+    FrameHeader header;
+    if (!ReadFrameHeader(input, header)) {
+        return false;
+    }
+
+    output.resize(header.rawSize);
+    if (!DecompressBlock(input.data() + kHeaderSize, header.compressedSize, output.data(), output.size())) {
+        output.clear();
+        return false;
+    }
+    return true;
+}
+
+const char* CodecName(uint8_t codec) {
+    switch (codec) {
+    case kCodecLz4Fast: return "lz4-fast";
+    case kCodecLz4High: return "lz4-high";
+    default: return "unknown";
+    }
+}
+
+}
+}
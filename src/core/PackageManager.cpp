@@ -1,179 +1,88 @@
 #include "ShaderLab/Core/PackageManager.h"
+#include "ShaderLab/Core/PackCodec.h"
+#if defined(_WIN32)
 #include <windows.h>
+#else
+#include <climits>
+#include <unistd.h>
+#endif
 #include <algorithm>
 #include <cstring>
 #include <cstdlib>
 #include <new>
-#include "ShaderLab/Core/ShaderLabData.h" // For nlohmann or similar if needed? No, binary format.
 #include <vector>
 
 namespace ShaderLab {
 
-// Magic Footer: SHADERLAB_PACK
-// Followed by uint64 table_offset
-// Followed by magic again? 
-// Let's use a simple format:
+// Packed executable layout (little endian):
 // [ ... EXE DATA ... ]
 // [ PACK DATA ... ]
-// [ DIRECTORY JSON STRING SIZE (uint32) ]
-// [ DIRECTORY JSON STRING ]
+// [ DIRECTORY: uint32 count, then per entry: uint32 pathLen, path bytes, uint64 absOffset, uint64 size ]
+// [ DIRECTORY OFFSET (uint64) ]
 // [ "SHADERLAB_PACK" (14 chars) ]
+//
+// Compressed entries carry an SLZ2 frame (see PackCodec.h).
+//
+// The file is memory-mapped; only the footer and the directory pages are touched
+// during Initialize(). Entries are resolved through an open-addressed hash index.
 
 static const char MAGIC[] = "SHADERLAB_PACK";
 static const size_t MAGIC_LEN = 14;
-static const char COMPRESSED_MAGIC[] = {'S', 'L', 'Z', '1'};
-
-typedef LONG (WINAPI *RtlDecompressBufferFn)(USHORT, PUCHAR, ULONG, PUCHAR, ULONG, PULONG);
-
-static bool TryDecompressPackedData(const std::vector<uint8_t>& input, std::vector<uint8_t>& output) {
-    output.clear();
-    constexpr size_t kHeaderSize = 12;
-
-    if (input.size() < kHeaderSize) {
-        return false;
-    }
-    if (std::memcmp(input.data(), COMPRESSED_MAGIC, 4) != 0) {
-        return false;
-    }
-
-    uint32_t rawSize = 0;
-    uint32_t compressedSize = 0;
-    std::memcpy(&rawSize, input.data() + 4, sizeof(uint32_t));
-    std::memcpy(&compressedSize, input.data() + 8, sizeof(uint32_t));
-
-    if (rawSize == 0 || compressedSize == 0) {
-        return false;
-    }
-    if (static_cast<size_t>(compressedSize) + kHeaderSize != input.size()) {
-        return false;
-    }
-
-    HMODULE ntdll = GetModuleHandleW(L"ntdll.dll");
-    if (!ntdll) {
-        ntdll = LoadLibraryW(L"ntdll.dll");
-    }
-    if (!ntdll) {
-        return false;
-    }
-
-    const auto rtlDecompressBuffer = reinterpret_cast<RtlDecompressBufferFn>(
-        GetProcAddress(ntdll, "RtlDecompressBuffer"));
-    if (!rtlDecompressBuffer) {
-        return false;
-    }
-
-    output.resize(static_cast<size_t>(rawSize));
-    ULONG finalRawSize = 0;
-    constexpr USHORT kLznt1 = 2u;
-    if (rtlDecompressBuffer(
-            kLznt1,
-            reinterpret_cast<PUCHAR>(output.data()),
-            static_cast<ULONG>(output.size()),
-            reinterpret_cast<PUCHAR>(const_cast<uint8_t*>(input.data() + kHeaderSize)),
-            compressedSize,
-            &finalRawSize) != 0) {
-        output.clear();
-        return false;
-    }
-
-    if (finalRawSize != output.size()) {
-        output.clear();
-        return false;
-    }
+static constexpr uint32_t kEmptySlot = 0xFFFFFFFFu;
 
-    return true;
+static bool IsCompressedPackedData(std::span<const uint8_t> input) {
+    PackCodec::FrameHeader header;
+    return PackCodec::ReadFrameHeader(input, header);
 }
 
-static bool ReadWholeFile(const std::string& path, std::vector<uint8_t>& outBytes) {
-    outBytes.clear();
-
-    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
-    if (file == INVALID_HANDLE_VALUE) {
-        return false;
-    }
-
-    LARGE_INTEGER size = {};
-    if (!GetFileSizeEx(file, &size) || size.QuadPart < 0) {
-        CloseHandle(file);
-        return false;
-    }
+static bool TryDecompressPackedData(std::span<const uint8_t> input, std::vector<uint8_t>& output) {
+    return PackCodec::Decompress(input, output);
+}
 
-    if (size.QuadPart == 0) {
-        CloseHandle(file);
-        return true;
-    }
+static char NormalizePackedPathChar(char c) {
+    return c == '\\' ? '/' : c;
+}
 
-    const uint64_t byteCount = static_cast<uint64_t>(size.QuadPart);
-    if (byteCount > static_cast<uint64_t>(SIZE_MAX)) {
-        CloseHandle(file);
-        return false;
+static uint32_t HashPackedPath(const std::string& path) {
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (char c : path) {
+        hash ^= static_cast<uint8_t>(NormalizePackedPathChar(c));
+        hash *= 16777619u;
     }
+    return hash;
+}
 
-    outBytes.resize(static_cast<size_t>(byteCount));
-#if SHADERLAB_TINY_PLAYER
-    DWORD readBytes = 0;
-    if (!ReadFile(file, outBytes.data(), static_cast<DWORD>(outBytes.size()), &readBytes, nullptr) || readBytes != outBytes.size()) {
-        CloseHandle(file);
-        outBytes.clear();
+// Stored paths are compared verbatim; the query is normalized to forward slashes.
+static bool PackedPathMatches(const std::string& stored, const std::string& query) {
+    if (stored.size() != query.size()) {
         return false;
     }
-#else
-    uint8_t* dst = outBytes.data();
-    uint64_t remaining = byteCount;
-
-    while (remaining > 0) {
-        const DWORD chunk = static_cast<DWORD>((std::min)(remaining, static_cast<uint64_t>(0x40000000u)));
-        DWORD chunkRead = 0;
-        if (!ReadFile(file, dst, chunk, &chunkRead, nullptr) || chunkRead == 0) {
-            CloseHandle(file);
-            outBytes.clear();
+    for (size_t i = 0; i < stored.size(); ++i) {
+        if (stored[i] != NormalizePackedPathChar(query[i])) {
             return false;
         }
-        dst += chunkRead;
-        remaining -= chunkRead;
     }
-#endif
-
-    CloseHandle(file);
     return true;
 }
 
-static bool ReadFileRange(const std::string& path, uint64_t offset, std::vector<uint8_t>& outBytes) {
-    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
-    if (file == INVALID_HANDLE_VALUE) {
-        return false;
-    }
-
-    LARGE_INTEGER seekPos = {};
-    seekPos.QuadPart = static_cast<LONGLONG>(offset);
-    if (!SetFilePointerEx(file, seekPos, nullptr, FILE_BEGIN)) {
-        CloseHandle(file);
-        return false;
-    }
-
-#if SHADERLAB_TINY_PLAYER
-    DWORD readBytes = 0;
-    if (!ReadFile(file, outBytes.data(), static_cast<DWORD>(outBytes.size()), &readBytes, nullptr) || readBytes != outBytes.size()) {
-        CloseHandle(file);
+static bool ResolveCurrentExecutablePath(std::string& outPath) {
+#if defined(_WIN32)
+    char exePath[MAX_PATH];
+    const DWORD length = GetModuleFileNameA(NULL, exePath, MAX_PATH);
+    if (length == 0 || length >= MAX_PATH) {
         return false;
     }
+    outPath.assign(exePath, length);
+    return true;
 #else
-    uint8_t* dst = outBytes.data();
-    uint64_t remaining = static_cast<uint64_t>(outBytes.size());
-    while (remaining > 0) {
-        const DWORD chunk = static_cast<DWORD>((std::min)(remaining, static_cast<uint64_t>(0x40000000u)));
-        DWORD chunkRead = 0;
-        if (!ReadFile(file, dst, chunk, &chunkRead, nullptr) || chunkRead == 0) {
-            CloseHandle(file);
-            return false;
-        }
-        dst += chunkRead;
-        remaining -= chunkRead;
+    char exePath[PATH_MAX];
+    const ssize_t length = readlink("/proc/self/exe", exePath, sizeof(exePath) - 1);
+    if (length <= 0) {
+        return false;
     }
-#endif
-
-    CloseHandle(file);
+    outPath.assign(exePath, static_cast<size_t>(length));
     return true;
+#endif
 }
 
 PackageManager& PackageManager::Get() {
@@ -190,155 +99,212 @@ bool PackageManager::Initialize() {
         return true;
     }
 
+    std::string exePath;
+    if (!ResolveCurrentExecutablePath(exePath)) {
+        m_directory.clear();
+        m_index.clear();
+        m_isPacked = false;
+        m_initialized = false;
+        return false;
+    }
+
+    return InitializeFromFile(exePath);
+}
+
+bool PackageManager::InitializeFromFile(const std::string& packedFilePath) {
     m_directory.clear();
+    m_index.clear();
     m_isPacked = false;
     m_initialized = false;
+    m_file.Close();
 
-    char exePath[MAX_PATH];
-    GetModuleFileNameA(NULL, exePath, MAX_PATH);
-    m_exePath = exePath;
-
-    std::vector<uint8_t> bytes;
-    if (!ReadWholeFile(m_exePath, bytes)) {
+    m_exePath = packedFilePath;
+    if (!m_file.Open(m_exePath)) {
         return false;
     }
 
-    if (bytes.size() < MAGIC_LEN + sizeof(uint64_t) + sizeof(uint32_t)) {
+    const uint8_t* bytes = m_file.Data();
+    const uint64_t fileSize = m_file.Size();
+    if (!bytes || fileSize < MAGIC_LEN + sizeof(uint64_t) + sizeof(uint32_t)) {
+        m_file.Close();
         return false;
     }
 
-    const size_t fileSize = bytes.size();
-    const size_t magicOffset = fileSize - MAGIC_LEN;
-    if (std::memcmp(bytes.data() + magicOffset, MAGIC, MAGIC_LEN) != 0) {
+    const uint64_t magicOffset = fileSize - MAGIC_LEN;
+    if (std::memcmp(bytes + magicOffset, MAGIC, MAGIC_LEN) != 0) {
+        m_file.Close();
         return false;
     }
 
-    const size_t dirOffsetPos = fileSize - MAGIC_LEN - sizeof(uint64_t);
+    const uint64_t dirOffsetPos = fileSize - MAGIC_LEN - sizeof(uint64_t);
     uint64_t dirOffset = 0;
-    std::memcpy(&dirOffset, bytes.data() + dirOffsetPos, sizeof(uint64_t));
+    std::memcpy(&dirOffset, bytes + dirOffsetPos, sizeof(uint64_t));
 
     // Validate offset
-    if (dirOffset >= fileSize) {
+    if (dirOffset >= dirOffsetPos) {
+        m_file.Close();
         return false;
     }
 
-    m_isPacked = true;
-    m_packRequestOffset = 0; // Not strictly needed if absolute offsets used.
-
-    size_t cursor = static_cast<size_t>(dirOffset);
-    if (cursor + sizeof(uint32_t) > fileSize) {
+    // The directory ends where the footer begins; never read past it. The manager
+    // only reports packed once every entry has parsed, so a truncated or corrupt
+    // directory never serves a partial file list.
+    const uint64_t dirEnd = dirOffsetPos;
+    uint64_t cursor = dirOffset;
+    auto fail = [this]() {
+        m_directory.clear();
+        m_index.clear();
+        m_file.Close();
         return false;
+    };
+    if (cursor + sizeof(uint32_t) > dirEnd) {
+        return fail();
     }
 
     uint32_t count = 0;
-    std::memcpy(&count, bytes.data() + cursor, sizeof(uint32_t));
+    std::memcpy(&count, bytes + cursor, sizeof(uint32_t));
     cursor += sizeof(uint32_t);
 
-    for(uint32_t i=0; i<count; ++i) {
-        PackedEntry entry;
-        if (cursor + sizeof(uint32_t) > fileSize) {
-            break;
+    // Each entry needs at least 20 bytes, which bounds a corrupt count.
+    const uint64_t maxEntries = (dirEnd - cursor) / (sizeof(uint32_t) + sizeof(uint64_t) * 2);
+    if (count > maxEntries) {
+        return fail();
+    }
+    m_directory.reserve(count);
+    size_t indexSize = 16;
+    while (indexSize < static_cast<size_t>(count) * 2) {
+        indexSize <<= 1;
+    }
+    m_index.assign(indexSize, kEmptySlot);
+
+    for (uint32_t i = 0; i < count; ++i) {
+        if (cursor + sizeof(uint32_t) > dirEnd) {
+            return fail();
         }
         uint32_t pathLen = 0;
-        std::memcpy(&pathLen, bytes.data() + cursor, sizeof(uint32_t));
+        std::memcpy(&pathLen, bytes + cursor, sizeof(uint32_t));
         cursor += sizeof(uint32_t);
         if (pathLen > 1024) {
-            break; // Sanity
+            return fail(); // Sanity
         }
-        if (cursor + pathLen + sizeof(uint64_t) + sizeof(uint64_t) > fileSize) {
-            break;
+        if (cursor + pathLen + sizeof(uint64_t) + sizeof(uint64_t) > dirEnd) {
+            return fail();
         }
-        std::vector<char> pathBuf(pathLen + 1);
-        std::memcpy(pathBuf.data(), bytes.data() + cursor, pathLen);
+
+        PackedEntry entry;
+        entry.path.assign(reinterpret_cast<const char*>(bytes + cursor), pathLen);
         cursor += pathLen;
-        pathBuf[pathLen] = 0;
-        entry.path = pathBuf.data();
-        
-        std::memcpy(&entry.offset, bytes.data() + cursor, sizeof(uint64_t));
+        std::memcpy(&entry.offset, bytes + cursor, sizeof(uint64_t));
         cursor += sizeof(uint64_t);
-        std::memcpy(&entry.size, bytes.data() + cursor, sizeof(uint64_t));
+        std::memcpy(&entry.size, bytes + cursor, sizeof(uint64_t));
         cursor += sizeof(uint64_t);
-        
-        bool replaced = false;
-#if SHADERLAB_TINY_PLAYER
-        for (auto& existing : m_directory) {
-            if (existing.path == entry.path) {
-                existing = entry;
-                replaced = true;
-                break;
-            }
-        }
-        if (!replaced) {
-            m_directory.push_back(entry);
-        }
-#else
-        m_directory[entry.path] = entry;
-#endif
+
+        InsertEntry(std::move(entry));
     }
 
+    m_isPacked = true;
     m_initialized = true;
     return true;
 }
 
-bool PackageManager::HasFile(const std::string& path) const {
-    // Normalize path separators if needed?
-    // Start simple.
-    std::string safePath = path; 
-    std::replace(safePath.begin(), safePath.end(), '\\', '/');
-#if SHADERLAB_TINY_PLAYER
-    for (const auto& entry : m_directory) {
-        if (entry.path == safePath) {
-            return true;
+void PackageManager::RebuildIndex() {
+    size_t indexSize = 16;
+    while (indexSize < m_directory.size() * 2) {
+        indexSize <<= 1;
+    }
+    m_index.assign(indexSize, kEmptySlot);
+
+    const size_t mask = indexSize - 1;
+    for (size_t entryIndex = 0; entryIndex < m_directory.size(); ++entryIndex) {
+        size_t slot = HashPackedPath(m_directory[entryIndex].path) & mask;
+        while (m_index[slot] != kEmptySlot) {
+            slot = (slot + 1) & mask;
         }
+        m_index[slot] = static_cast<uint32_t>(entryIndex);
     }
-    return false;
-#else
-    return m_directory.find(safePath) != m_directory.end();
-#endif
 }
 
-std::vector<uint8_t> PackageManager::GetFile(const std::string& path) {
-    if (!m_isPacked) return {};
-    
-    std::string safePath = path; 
-    std::replace(safePath.begin(), safePath.end(), '\\', '/');
-
-    PackedEntry entry;
-    bool found = false;
-#if SHADERLAB_TINY_PLAYER
-    for (const auto& current : m_directory) {
-        if (current.path == safePath) {
-            entry = current;
-            found = true;
-            break;
+void PackageManager::InsertEntry(PackedEntry&& entry) {
+    if (m_index.empty()) {
+        RebuildIndex();
+    }
+
+    // Later entries with the same path replace earlier ones.
+    const size_t mask = m_index.size() - 1;
+    size_t slot = HashPackedPath(entry.path) & mask;
+    while (m_index[slot] != kEmptySlot) {
+        PackedEntry& existing = m_directory[m_index[slot]];
+        if (existing.path == entry.path) {
+            existing = std::move(entry);
+            return;
         }
+        slot = (slot + 1) & mask;
     }
-#else
-    auto it = m_directory.find(safePath);
-    if (it != m_directory.end()) {
-        entry = it->second;
-        found = true;
+
+    m_index[slot] = static_cast<uint32_t>(m_directory.size());
+    m_directory.push_back(std::move(entry));
+
+    // Keep the load factor at or below one half so probes stay short.
+    if (m_directory.size() * 2 > m_index.size()) {
+        RebuildIndex();
     }
-#endif
-    if (!found) {
+}
+
+const PackedEntry* PackageManager::FindEntry(const std::string& path) const {
+    if (m_index.empty()) {
+        return nullptr;
+    }
+
+    const size_t mask = m_index.size() - 1;
+    size_t slot = HashPackedPath(path) & mask;
+    while (m_index[slot] != kEmptySlot) {
+        const PackedEntry& entry = m_directory[m_index[slot]];
+        if (PackedPathMatches(entry.path, path)) {
+            return &entry;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return nullptr;
+}
+
+bool PackageManager::HasFile(const std::string& path) const {
+    return FindEntry(path) != nullptr;
+}
+
+std::span<const uint8_t> PackageManager::GetFileView(const std::string& path) const {
+    if (!m_isPacked) return {};
+
+    const PackedEntry* entry = FindEntry(path);
+    if (!entry) {
         return {};
     }
 
-    if (entry.size > static_cast<uint64_t>(SIZE_MAX)) {
+    const std::span<const uint8_t> stored = m_file.Range(entry->offset, entry->size);
+    if (IsCompressedPackedData(stored)) {
+        return {};
+    }
+    return stored;
+}
+
+std::vector<uint8_t> PackageManager::GetFile(const std::string& path) {
+    if (!m_isPacked) return {};
+
+    const PackedEntry* entry = FindEntry(path);
+    if (!entry) {
         return {};
     }
 
-    std::vector<uint8_t> data(static_cast<size_t>(entry.size));
-    if (!ReadFileRange(m_exePath, entry.offset, data)) {
+    const std::span<const uint8_t> stored = m_file.Range(entry->offset, entry->size);
+    if (stored.size() != entry->size) {
         return {};
     }
 
     std::vector<uint8_t> decompressed;
-    if (TryDecompressPackedData(data, decompressed)) {
+    if (TryDecompressPackedData(stored, decompressed)) {
         return decompressed;
     }
 
-    return data;
+    return std::vector<uint8_t>(stored.begin(), stored.end());
 }
 
 }
@@ -0,0 +1,73 @@
+#include "ShaderLab/Core/PlaybackEventIndex.h"
+
+#include <algorithm>
+
+namespace ShaderLab {
+
+namespace {
+bool BeatGreater(int beat, const std::pair<int, uint32_t>& entry) {
+    return beat < entry.first;
+}
+}
+
+bool PlaybackEventIndex::Sync(const DemoTrack& track) {
+    if (m_built && track.rowsVersion == m_rowsVersion) {
+        return false;
+    }
+    Build(track);
+    return true;
+}
+
+void PlaybackEventIndex::Build(const DemoTrack& track) {
+    m_rowsByBeat.clear();
+    m_sceneRowsByBeat.clear();
+    m_rowsByBeat.reserve(track.rows.size());
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(track.rows.size()); ++i) {
+        m_rowsByBeat.emplace_back(track.rows[i].rowId, i);
+    }
+    // Index is the tiebreak, so rows on the same beat keep their track order.
+    std::sort(m_rowsByBeat.begin(), m_rowsByBeat.end());
+
+    for (const auto& entry : m_rowsByBeat) {
+        if (track.rows[entry.second].sceneIndex >= 0) {
+            m_sceneRowsByBeat.push_back(entry);
+        }
+    }
+
+    m_rowsVersion = track.rowsVersion;
+    m_built = true;
+}
+
+void PlaybackEventIndex::Clear() {
+    m_rowsByBeat.clear();
+    m_sceneRowsByBeat.clear();
+    m_rowsVersion = 0;
+    m_built = false;
+}
+
+void PlaybackEventIndex::CollectRows(const DemoTrack& track,
+                                     int fromBeatExclusive,
+                                     int toBeatInclusive,
+                                     std::vector<std::pair<int, const TrackerRow*>>& outRows) const {
+    outRows.clear();
+    if (toBeatInclusive <= fromBeatExclusive) {
+        return;
+    }
+
+    auto it = std::upper_bound(m_rowsByBeat.begin(), m_rowsByBeat.end(), fromBeatExclusive, BeatGreater);
+    const auto end = std::upper_bound(it, m_rowsByBeat.end(), toBeatInclusive, BeatGreater);
+    for (; it != end; ++it) {
+        outRows.emplace_back(it->first, &track.rows[it->second]);
+    }
+}
+
+const TrackerRow* PlaybackEventIndex::FindNextSceneRow(const DemoTrack& track, int afterBeat) const {
+    auto it = std::upper_bound(m_sceneRowsByBeat.begin(), m_sceneRowsByBeat.end(), afterBeat, BeatGreater);
+    if (it == m_sceneRowsByBeat.end()) {
+        return nullptr;
+    }
+    return &track.rows[it->second];
+}
+
+} // namespace ShaderLab
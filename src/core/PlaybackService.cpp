@@ -1,27 +1,12 @@
 #include "ShaderLab/Core/PlaybackService.h"
 
 #include <algorithm>
-#include <climits>
 #include <cmath>
 #include <utility>
 #include <vector>
 
 namespace ShaderLab {
 
-namespace {
-const TrackerRow* FindNextSceneRow(const DemoTrack& track, int afterBeat) {
-    const TrackerRow* bestRow = nullptr;
-    int bestBeat = INT_MAX;
-    for (const auto& row : track.rows) {
-        if (row.sceneIndex >= 0 && row.rowId > afterBeat && row.rowId < bestBeat) {
-            bestBeat = row.rowId;
-            bestRow = &row;
-        }
-    }
-    return bestRow;
-}
-}
-
 void PlaybackService::AdvanceClock(Transport& transport, double wallNowSeconds, float fallbackDtSeconds) const {
     if (transport.state != TransportState::Playing || transport.freezeTime) {
         transport.lastFrameWallSeconds = wallNowSeconds;
@@ -37,6 +22,25 @@ void PlaybackService::AdvanceClock(Transport& transport, double wallNowSeconds,
     transport.lastFrameWallSeconds = wallNowSeconds;
 }
 
+void PlaybackService::AdvanceClockFromAudio(Transport& transport,
+                                            AudioClockFilter& filter,
+                                            const AudioClockSample& sample,
+                                            double wallNowSeconds,
+                                            float fallbackDtSeconds) const {
+    const bool followAudio = transport.clockSource == TransportClockSource::AudioDevice && sample.valid &&
+                             transport.state == TransportState::Playing && !transport.freezeTime;
+    if (!followAudio) {
+        filter.Reset();
+        AdvanceClock(transport, wallNowSeconds, fallbackDtSeconds);
+        return;
+    }
+
+    transport.timeSeconds = (std::max)(0.0, filter.Update(wallNowSeconds,
+                                                                    transport.audioOriginSeconds + sample.CursorSeconds(),
+                                                                    sample.outputLatencySeconds));
+    transport.lastFrameWallSeconds = wallNowSeconds;
+}
+
 int PlaybackService::ComputeCurrentBeat(const Transport& transport, float fallbackBpm) const {
     const float bpm = transport.bpm > 0.0f ? transport.bpm : fallbackBpm;
     const float safeBpm = (std::max)(1.0f, bpm);
@@ -83,14 +87,8 @@ void PlaybackService::CollectTriggeredRows(const DemoTrack& track,
     if (toBeatInclusive <= fromBeatExclusive) {
         return;
     }
-
-    for (int beat = fromBeatExclusive + 1; beat <= toBeatInclusive; ++beat) {
-        for (const auto& row : track.rows) {
-            if (row.rowId == beat) {
-                outRows.emplace_back(beat, &row);
-            }
-        }
-    }
+    m_eventIndex.Sync(track);
+    m_eventIndex.CollectRows(track, fromBeatExclusive, toBeatInclusive, outRows);
 }
 
 void PlaybackService::BuildPlaybackEvents(const DemoTrack& track,
@@ -98,6 +96,9 @@ void PlaybackService::BuildPlaybackEvents(const DemoTrack& track,
                                          int toBeatInclusive,
                                          std::vector<PlaybackEvent>& outEvents) const {
     outEvents.clear();
+    if (toBeatInclusive <= fromBeatExclusive) {
+        return;
+    }
 
     std::vector<std::pair<int, const TrackerRow*>> triggeredRows;
     CollectTriggeredRows(track, fromBeatExclusive, toBeatInclusive, triggeredRows);
@@ -157,7 +158,8 @@ SceneTransitionResolution PlaybackService::ResolveSceneTransitionTarget(const De
     resolution.targetStartBeat = static_cast<double>(event.beat);
 
     if (resolution.targetSceneIndex == -1 && event.transitionPresetStem == "crossfade") {
-        const TrackerRow* nextRow = FindNextSceneRow(track, event.beat);
+        m_eventIndex.Sync(track);
+        const TrackerRow* nextRow = m_eventIndex.FindNextSceneRow(track, event.beat);
         if (nextRow) {
             resolution.targetSceneIndex = nextRow->sceneIndex;
             resolution.targetOffset = nextRow->timeOffset;
@@ -0,0 +1,506 @@
+#include "ShaderLab/Core/ProjectBinary.h"
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+namespace ShaderLab {
+namespace ProjectBinary {
+
+namespace {
+
+constexpr char kMagic[4] = {'S', 'L', 'P', 'B'};
+
+struct Section {
+    uint32_t offset;
+    uint32_t count;
+};
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t fileSize;
+    uint32_t stringCount;
+    uint32_t stringIndexOffset;
+    uint32_t stringDataOffset;
+    uint32_t stringDataSize;
+    Section scenes;
+    Section bindings;
+    Section postFx;
+    Section compute;
+    Section audio;
+    Section rows;
+    uint32_t trackName;
+    float trackBpm;
+    int32_t trackLengthBeats;
+    float transportBpm;
+    uint32_t demoTitle;
+    uint32_t demoAuthor;
+    uint32_t demoDescription;
+};
+
+struct SceneRecord {
+    uint32_t name;
+    uint32_t description;
+    uint32_t shaderCode;
+    uint32_t shaderCodePath;
+    uint32_t precompiledPath;
+    uint32_t outputType;
+    uint32_t firstBinding;
+    uint32_t bindingCount;
+    uint32_t firstPostFx;
+    uint32_t postFxCount;
+    uint32_t firstCompute;
+    uint32_t computeCount;
+};
+
+struct BindingRecord {
+    int32_t channelIndex;
+    uint32_t enabled;
+    uint32_t bindingType;
+    int32_t sourceSceneIndex;
+    uint32_t filePath;
+    uint32_t type;
+};
+
+struct PostFxRecord {
+    uint32_t name;
+    uint32_t shaderCode;
+    uint32_t shaderCodePath;
+    uint32_t precompiledPath;
+    uint32_t enabled;
+};
+
+struct ComputeRecord {
+    uint32_t name;
+    uint32_t shaderCode;
+    uint32_t shaderCodePath;
+    uint32_t precompiledPath;
+    uint32_t entryPoint;
+    uint32_t type;
+    uint32_t enabled;
+    float params[4];
+    uint32_t threadGroup[3];
+    int32_t historyCount;
+};
+
+struct AudioRecord {
+    uint32_t name;
+    uint32_t path;
+    uint32_t type;
+    float bpm;
+};
+
+struct RowRecord {
+    int32_t rowId;
+    int32_t sceneIndex;
+    uint32_t transitionPresetStem;
+    uint32_t transitionShaderPath;
+    float transitionDuration;
+    float timeOffset;
+    int32_t musicIndex;
+    int32_t oneShotIndex;
+    uint32_t flags; // bit 0: isBeat, bit 1: stop
+};
+
+static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) == 104, "project binary header layout changed");
+static_assert(sizeof(SceneRecord) == 48 && sizeof(BindingRecord) == 24 && sizeof(PostFxRecord) == 20,
+              "project binary record layout changed");
+static_assert(sizeof(ComputeRecord) == 60 && sizeof(AudioRecord) == 16 && sizeof(RowRecord) == 36,
+              "project binary record layout changed");
+
+class StringTableBuilder {
+public:
+    StringTableBuilder() {
+        Intern(std::string_view());
+    }
+
+    uint32_t Intern(std::string_view value) {
+        const auto found = m_ids.find(value);
+        if (found != m_ids.end()) {
+            return found->second;
+        }
+        const uint32_t id = static_cast<uint32_t>(m_strings.size());
+        m_strings.push_back(value);
+        m_ids.emplace(value, id);
+        return id;
+    }
+
+    const std::vector<std::string_view>& Strings() const { return m_strings; }
+
+private:
+    // Views point into the ProjectData being encoded, which outlives the builder.
+    std::unordered_map<std::string_view, uint32_t> m_ids;
+    std::vector<std::string_view> m_strings;
+};
+
+size_t AlignUp(size_t value) {
+    return (value + 3u) & ~static_cast<size_t>(3u);
+}
+
+template <typename Record>
+void AppendRecords(std::vector<uint8_t>& output, Section& section, const std::vector<Record>& records) {
+    output.resize(AlignUp(output.size()), 0);
+    section.offset = static_cast<uint32_t>(output.size());
+    section.count = static_cast<uint32_t>(records.size());
+    if (!records.empty()) {
+        const size_t start = output.size();
+        output.resize(start + records.size() * sizeof(Record));
+        std::memcpy(output.data() + start, records.data(), records.size() * sizeof(Record));
+    }
+}
+
+class Reader {
+public:
+    explicit Reader(std::span<const uint8_t> input) : m_input(input) {}
+
+    bool ReadHeader(Header& header) const {
+        if (m_input.size() < sizeof(Header)) {
+            return false;
+        }
+        std::memcpy(&header, m_input.data(), sizeof(Header));
+        return true;
+    }
+
+    template <typename Record>
+    bool ReadRecord(const Section& section, uint32_t index, Record& record) const {
+        if (index >= section.count) {
+            return false;
+        }
+        const uint64_t offset = static_cast<uint64_t>(section.offset) + static_cast<uint64_t>(index) * sizeof(Record);
+        if (offset + sizeof(Record) > m_input.size()) {
+            return false;
+        }
+        std::memcpy(&record, m_input.data() + offset, sizeof(Record));
+        return true;
+    }
+
+    bool SectionFits(const Section& section, size_t recordSize) const {
+        return static_cast<uint64_t>(section.offset) + static_cast<uint64_t>(section.count) * recordSize <= m_input.size();
+    }
+
+    bool BindStrings(const Header& header) {
+        const uint64_t indexEnd = static_cast<uint64_t>(header.stringIndexOffset) + static_cast<uint64_t>(header.stringCount) * 8u;
+        const uint64_t dataEnd = static_cast<uint64_t>(header.stringDataOffset) + header.stringDataSize;
+        if (header.stringCount == 0 || indexEnd > m_input.size() || dataEnd > m_input.size()) {
+            return false;
+        }
+        m_stringCount = header.stringCount;
+        m_stringIndex = m_input.data() + header.stringIndexOffset;
+        m_stringData = m_input.data() + header.stringDataOffset;
+        m_stringDataSize = header.stringDataSize;
+        return true;
+    }
+
+    bool ReadString(uint32_t id, std::string& outValue) const {
+        if (id >= m_stringCount) {
+            return false;
+        }
+        uint32_t entry[2];
+        std::memcpy(entry, m_stringIndex + static_cast<size_t>(id) * 8u, sizeof(entry));
+        if (static_cast<uint64_t>(entry[0]) + entry[1] > m_stringDataSize) {
+            return false;
+        }
+        outValue.assign(reinterpret_cast<const char*>(m_stringData) + entry[0], entry[1]);
+        return true;
+    }
+
+private:
+    std::span<const uint8_t> m_input;
+    uint32_t m_stringCount = 0;
+    const uint8_t* m_stringIndex = nullptr;
+    const uint8_t* m_stringData = nullptr;
+    uint32_t m_stringDataSize = 0;
+};
+
+bool RangeFits(uint32_t first, uint32_t count, const Section& section) {
+    return first <= section.count && count <= section.count - first;
+}
+
+} // namespace
+
+bool IsProjectBinary(std::span<const uint8_t> input) {
+    return input.size() >= sizeof(Header) && std::memcmp(input.data(), kMagic, sizeof(kMagic)) == 0;
+}
+
+bool Encode(const ProjectData& project, std::vector<uint8_t>& output) {
+    output.clear();
+
+    StringTableBuilder strings;
+    std::vector<SceneRecord> scenes;
+    std::vector<BindingRecord> bindings;
+    std::vector<PostFxRecord> postFx;
+    std::vector<ComputeRecord> compute;
+    std::vector<AudioRecord> audio;
+    std::vector<RowRecord> rows;
+    scenes.reserve(project.scenes.size());
+    audio.reserve(project.audioLibrary.size());
+    rows.reserve(project.track.rows.size());
+
+    for (const auto& scene : project.scenes) {
+        SceneRecord record = {};
+        record.name = strings.Intern(scene.name);
+        record.description = strings.Intern(scene.description);
+        record.shaderCode = strings.Intern(scene.shaderCode);
+        record.shaderCodePath = strings.Intern(scene.shaderCodePath);
+        record.precompiledPath = strings.Intern(scene.precompiledPath);
+        record.outputType = static_cast<uint32_t>(scene.outputType);
+
+        record.firstBinding = static_cast<uint32_t>(bindings.size());
+        record.bindingCount = static_cast<uint32_t>(scene.bindings.size());
+        for (const auto& bind : scene.bindings) {
+            BindingRecord bindRecord = {};
+            bindRecord.channelIndex = bind.channelIndex;
+            bindRecord.enabled = bind.enabled ? 1u : 0u;
+            bindRecord.bindingType = static_cast<uint32_t>(bind.bindingType);
+            bindRecord.sourceSceneIndex = bind.sourceSceneIndex;
+            bindRecord.filePath = strings.Intern(bind.filePath);
+            bindRecord.type = static_cast<uint32_t>(bind.type);
+            bindings.push_back(bindRecord);
+        }
+
+        record.firstPostFx = static_cast<uint32_t>(postFx.size());
+        record.postFxCount = static_cast<uint32_t>(scene.postFxChain.size());
+        for (const auto& fx : scene.postFxChain) {
+            PostFxRecord fxRecord = {};
+            fxRecord.name = strings.Intern(fx.name);
+            fxRecord.shaderCode = strings.Intern(fx.shaderCode);
+            fxRecord.shaderCodePath = strings.Intern(fx.shaderCodePath);
+            fxRecord.precompiledPath = strings.Intern(fx.precompiledPath);
+            fxRecord.enabled = fx.enabled ? 1u : 0u;
+            postFx.push_back(fxRecord);
+        }
+
+        record.firstCompute = static_cast<uint32_t>(compute.size());
+        record.computeCount = static_cast<uint32_t>(scene.computeEffectChain.size());
+        for (const auto& effect : scene.computeEffectChain) {
+            ComputeRecord computeRecord = {};
+            computeRecord.name = strings.Intern(effect.name);
+            computeRecord.shaderCode = strings.Intern(effect.shaderCode);
+            computeRecord.shaderCodePath = strings.Intern(effect.shaderCodePath);
+            computeRecord.precompiledPath = strings.Intern(effect.precompiledPath);
+            computeRecord.entryPoint = strings.Intern(effect.entryPoint);
+            computeRecord.type = static_cast<uint32_t>(effect.type);
+            computeRecord.enabled = effect.enabled ? 1u : 0u;
+            computeRecord.params[0] = effect.param0;
+            computeRecord.params[1] = effect.param1;
+            computeRecord.params[2] = effect.param2;
+            computeRecord.params[3] = effect.param3;
+            computeRecord.threadGroup[0] = effect.threadGroupX;
+            computeRecord.threadGroup[1] = effect.threadGroupY;
+            computeRecord.threadGroup[2] = effect.threadGroupZ;
+            computeRecord.historyCount = effect.historyCount;
+            compute.push_back(computeRecord);
+        }
+
+        scenes.push_back(record);
+    }
+
+    for (const auto& clip : project.audioLibrary) {
+        AudioRecord record = {};
+        record.name = strings.Intern(clip.name);
+        record.path = strings.Intern(clip.path);
+        record.type = static_cast<uint32_t>(clip.type);
+        record.bpm = clip.bpm;
+        audio.push_back(record);
+    }
+
+    for (const auto& row : project.track.rows) {
+        RowRecord record = {};
+        record.rowId = row.rowId;
+        record.sceneIndex = row.sceneIndex;
+        record.transitionPresetStem = strings.Intern(row.transitionPresetStem);
+        record.transitionShaderPath = strings.Intern(row.transitionShaderPath);
+        record.transitionDuration = row.transitionDuration;
+        record.timeOffset = row.timeOffset;
+        record.musicIndex = row.musicIndex;
+        record.oneShotIndex = row.oneShotIndex;
+        record.flags = (row.isBeat ? 1u : 0u) | (row.stop ? 2u : 0u);
+        rows.push_back(record);
+    }
+
+    Header header = {};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.trackName = strings.Intern(project.track.name);
+    header.trackBpm = project.track.bpm;
+    header.trackLengthBeats = project.track.lengthBeats;
+    header.transportBpm = project.transport.bpm;
+    header.demoTitle = strings.Intern(project.demoTitle);
+    header.demoAuthor = strings.Intern(project.demoAuthor);
+    header.demoDescription = strings.Intern(project.demoDescription);
+
+    const auto& table = strings.Strings();
+    uint64_t stringBytes = 0;
+    for (const auto& value : table) {
+        stringBytes += value.size();
+    }
+    if (stringBytes > UINT32_MAX / 2) {
+        return false;
+    }
+
+    output.resize(sizeof(Header), 0);
+    header.stringCount = static_cast<uint32_t>(table.size());
+    header.stringIndexOffset = static_cast<uint32_t>(output.size());
+    output.resize(output.size() + table.size() * 8u);
+    header.stringDataOffset = static_cast<uint32_t>(output.size());
+    header.stringDataSize = static_cast<uint32_t>(stringBytes);
+
+    uint32_t dataCursor = 0;
+    for (size_t i = 0; i < table.size(); ++i) {
+        const uint32_t entry[2] = {dataCursor, static_cast<uint32_t>(table[i].size())};
+        std::memcpy(output.data() + header.stringIndexOffset + i * 8u, entry, sizeof(entry));
+        output.insert(output.end(), table[i].begin(), table[i].end());
+        dataCursor += entry[1];
+    }
+
+    AppendRecords(output, header.scenes, scenes);
+    AppendRecords(output, header.bindings, bindings);
+    AppendRecords(output, header.postFx, postFx);
+    AppendRecords(output, header.compute, compute);
+    AppendRecords(output, header.audio, audio);
+    AppendRecords(output, header.rows, rows);
+
+    if (output.size() > UINT32_MAX) {
+        output.clear();
+        return false;
+    }
+    header.fileSize = static_cast<uint32_t>(output.size());
+    std::memcpy(output.data(), &header, sizeof(Header));
+    return true;
+}
+
+bool Decode(std::span<const uint8_t> input, ProjectData& outProject) {
+    if (!IsProjectBinary(input)) {
+        return false;
+    }
+
+    Reader reader(input);
+    Header header = {};
+    if (!reader.ReadHeader(header) || header.version != kVersion || header.fileSize != input.size() ||
+        !reader.BindStrings(header)) {
+        return false;
+    }
+
+    if (!reader.SectionFits(header.scenes, sizeof(SceneRecord)) ||
+        !reader.SectionFits(header.bindings, sizeof(BindingRecord)) ||
+        !reader.SectionFits(header.postFx, sizeof(PostFxRecord)) ||
+        !reader.SectionFits(header.compute, sizeof(ComputeRecord)) ||
+        !reader.SectionFits(header.audio, sizeof(AudioRecord)) ||
+        !reader.SectionFits(header.rows, sizeof(RowRecord))) {
+        return false;
+    }
+
+    ProjectData project;
+    bool ok = reader.ReadString(header.trackName, project.track.name) &&
+              reader.ReadString(header.demoTitle, project.demoTitle) &&
+              reader.ReadString(header.demoAuthor, project.demoAuthor) &&
+              reader.ReadString(header.demoDescription, project.demoDescription);
+    project.track.bpm = header.trackBpm;
+    project.track.lengthBeats = header.trackLengthBeats;
+    project.transport.bpm = header.transportBpm;
+
+    project.scenes.resize(header.scenes.count);
+    for (uint32_t sceneIndex = 0; ok && sceneIndex < header.scenes.count; ++sceneIndex) {
+        SceneRecord record = {};
+        Scene& scene = project.scenes[sceneIndex];
+        ok = reader.ReadRecord(header.scenes, sceneIndex, record) &&
+             reader.ReadString(record.name, scene.name) &&
+             reader.ReadString(record.description, scene.description) &&
+             reader.ReadString(record.shaderCode, scene.shaderCode) &&
+             reader.ReadString(record.shaderCodePath, scene.shaderCodePath) &&
+             reader.ReadString(record.precompiledPath, scene.precompiledPath) &&
+             RangeFits(record.firstBinding, record.bindingCount, header.bindings) &&
+             RangeFits(record.firstPostFx, record.postFxCount, header.postFx) &&
+             RangeFits(record.firstCompute, record.computeCount, header.compute);
+        if (!ok) {
+            break;
+        }
+        scene.outputType = static_cast<TextureType>(record.outputType);
+
+        scene.bindings.resize(record.bindingCount);
+        for (uint32_t i = 0; ok && i < record.bindingCount; ++i) {
+            BindingRecord bindRecord = {};
+            TextureBinding& bind = scene.bindings[i];
+            ok = reader.ReadRecord(header.bindings, record.firstBinding + i, bindRecord) &&
+                 reader.ReadString(bindRecord.filePath, bind.filePath);
+            bind.channelIndex = bindRecord.channelIndex;
+            bind.enabled = bindRecord.enabled != 0;
+            bind.bindingType = static_cast<BindingType>(bindRecord.bindingType);
+            bind.sourceSceneIndex = bindRecord.sourceSceneIndex;
+            bind.type = static_cast<TextureType>(bindRecord.type);
+        }
+
+        scene.postFxChain.resize(record.postFxCount);
+        for (uint32_t i = 0; ok && i < record.postFxCount; ++i) {
+            PostFxRecord fxRecord = {};
+            Scene::PostFXEffect& fx = scene.postFxChain[i];
+            ok = reader.ReadRecord(header.postFx, record.firstPostFx + i, fxRecord) &&
+                 reader.ReadString(fxRecord.name, fx.name) &&
+                 reader.ReadString(fxRecord.shaderCode, fx.shaderCode) &&
+                 reader.ReadString(fxRecord.shaderCodePath, fx.shaderCodePath) &&
+                 reader.ReadString(fxRecord.precompiledPath, fx.precompiledPath);
+            fx.enabled = fxRecord.enabled != 0;
+        }
+
+        scene.computeEffectChain.resize(record.computeCount);
+        for (uint32_t i = 0; ok && i < record.computeCount; ++i) {
+            ComputeRecord computeRecord = {};
+            Scene::ComputeEffect& effect = scene.computeEffectChain[i];
+            ok = reader.ReadRecord(header.compute, record.firstCompute + i, computeRecord) &&
+                 reader.ReadString(computeRecord.name, effect.name) &&
+                 reader.ReadString(computeRecord.shaderCode, effect.shaderCode) &&
+                 reader.ReadString(computeRecord.shaderCodePath, effect.shaderCodePath) &&
+                 reader.ReadString(computeRecord.precompiledPath, effect.precompiledPath) &&
+                 reader.ReadString(computeRecord.entryPoint, effect.entryPoint);
+            effect.type = static_cast<Scene::ComputeEffect::Type>(computeRecord.type);
+            effect.enabled = computeRecord.enabled != 0;
+            effect.param0 = computeRecord.params[0];
+            effect.param1 = computeRecord.params[1];
+            effect.param2 = computeRecord.params[2];
+            effect.param3 = computeRecord.params[3];
+            effect.threadGroupX = computeRecord.threadGroup[0];
+            effect.threadGroupY = computeRecord.threadGroup[1];
+            effect.threadGroupZ = computeRecord.threadGroup[2];
+            effect.historyCount = computeRecord.historyCount;
+        }
+    }
+
+    project.audioLibrary.resize(ok ? header.audio.count : 0);
+    for (uint32_t i = 0; ok && i < header.audio.count; ++i) {
+        AudioRecord record = {};
+        AudioClip& clip = project.audioLibrary[i];
+        ok = reader.ReadRecord(header.audio, i, record) &&
+             reader.ReadString(record.name, clip.name) &&
+             reader.ReadString(record.path, clip.path);
+        clip.type = static_cast<AudioType>(record.type);
+        clip.bpm = record.bpm;
+    }
+
+    project.track.rows.resize(ok ? header.rows.count : 0);
+    for (uint32_t i = 0; ok && i < header.rows.count; ++i) {
+        RowRecord record = {};
+        TrackerRow& row = project.track.rows[i];
+        ok = reader.ReadRecord(header.rows, i, record) &&
+             reader.ReadString(record.transitionPresetStem, row.transitionPresetStem) &&
+             reader.ReadString(record.transitionShaderPath, row.transitionShaderPath);
+        row.rowId = record.rowId;
+        row.sceneIndex = record.sceneIndex;
+        row.transitionDuration = record.transitionDuration;
+        row.timeOffset = record.timeOffset;
+        row.musicIndex = record.musicIndex;
+        row.oneShotIndex = record.oneShotIndex;
+        row.isBeat = (record.flags & 1u) != 0;
+        row.stop = (record.flags & 2u) != 0;
+    }
+    project.track.MarkRowsChanged();
+
+    if (!ok) {
+        return false;
+    }
+    outProject = std::move(project);
+    return true;
+}
+
+}
+}
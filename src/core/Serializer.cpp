@@ -1,17 +1,23 @@
 #include "ShaderLab/Core/Serializer.h"
+#include "ShaderLab/Core/MappedFile.h"
+#include "ShaderLab/Core/PackCodec.h"
+#include "ShaderLab/Core/ProjectBinary.h"
 #include <nlohmann/json.hpp>
 #include <algorithm>
 #include <cctype>
 #include <fstream>
 #include <filesystem>
 #include <iostream>
+#include <unordered_map>
 #include <unordered_set>
 #include <cstdlib>
 #include <cstdint>
 #include <cstring>
-#if defined(_WIN32)
-#include <windows.h>
-#endif
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <cstdio>
 
 namespace fs = std::filesystem;
 using json = nlohmann::json;
@@ -20,74 +26,17 @@ namespace ShaderLab {
 
 namespace {
 
-constexpr char kPackedCompressedMagic[4] = {'S', 'L', 'Z', '1'};
-
-#if defined(_WIN32)
-typedef LONG (WINAPI *RtlGetCompressionWorkSpaceSizeFn)(USHORT, PULONG, PULONG);
-typedef LONG (WINAPI *RtlCompressBufferFn)(USHORT, PUCHAR, ULONG, PUCHAR, ULONG, ULONG, PULONG, PVOID);
-
-bool TryCompressPackedEntry(const std::vector<uint8_t>& input, std::vector<uint8_t>& output) {
+bool TryCompressPackedEntry(const std::vector<uint8_t>& input,
+                            PackCodec::Level level,
+                            std::vector<uint8_t>& output) {
     output.clear();
 
     if (input.size() < 256 || input.size() > static_cast<size_t>(UINT32_MAX)) {
         return false;
     }
 
-    HMODULE ntdll = GetModuleHandleW(L"ntdll.dll");
-    if (!ntdll) {
-        ntdll = LoadLibraryW(L"ntdll.dll");
-    }
-    if (!ntdll) {
-        return false;
-    }
-
-    const auto rtlGetCompressionWorkSpaceSize = reinterpret_cast<RtlGetCompressionWorkSpaceSizeFn>(
-        GetProcAddress(ntdll, "RtlGetCompressionWorkSpaceSize"));
-    const auto rtlCompressBuffer = reinterpret_cast<RtlCompressBufferFn>(
-        GetProcAddress(ntdll, "RtlCompressBuffer"));
-    if (!rtlGetCompressionWorkSpaceSize || !rtlCompressBuffer) {
-        return false;
-    }
-
-    constexpr USHORT kFormatAndEngine = static_cast<USHORT>(2u | 0x0100u);
-    ULONG workspaceSize = 0;
-    ULONG fragmentWorkspaceSize = 0;
-    if (rtlGetCompressionWorkSpaceSize(kFormatAndEngine, &workspaceSize, &fragmentWorkspaceSize) != 0 || workspaceSize == 0) {
-        return false;
-    }
-
-    std::vector<uint8_t> workspace(static_cast<size_t>(workspaceSize));
-    std::vector<uint8_t> compressed(input.size() + input.size() / 8 + 1024);
-
-    ULONG compressedSize = 0;
-    if (rtlCompressBuffer(
-            kFormatAndEngine,
-            reinterpret_cast<PUCHAR>(const_cast<uint8_t*>(input.data())),
-            static_cast<ULONG>(input.size()),
-            reinterpret_cast<PUCHAR>(compressed.data()),
-            static_cast<ULONG>(compressed.size()),
-            4096,
-            &compressedSize,
-            workspace.data()) != 0) {
-        return false;
-    }
-
-    constexpr size_t kHeaderSize = 12;
-    if (compressedSize == 0 || (kHeaderSize + static_cast<size_t>(compressedSize)) >= input.size()) {
-        return false;
-    }
-
-    output.resize(kHeaderSize + static_cast<size_t>(compressedSize));
-    std::memcpy(output.data(), kPackedCompressedMagic, 4);
-
-    const uint32_t rawSize = static_cast<uint32_t>(input.size());
-    const uint32_t storedCompressedSize = static_cast<uint32_t>(compressedSize);
-    std::memcpy(output.data() + 4, &rawSize, sizeof(uint32_t));
-    std::memcpy(output.data() + 8, &storedCompressedSize, sizeof(uint32_t));
-    std::memcpy(output.data() + kHeaderSize, compressed.data(), compressedSize);
-    return true;
+    return PackCodec::Compress(input, level, output);
 }
-#endif
 
 std::string NormalizePathSlashes(std::string value) {
     std::replace(value.begin(), value.end(), '\\', '/');
@@ -257,36 +206,213 @@ void ForEachProjectAssetPath(const ProjectData& project, Visitor&& visitor) {
     }
 }
 
+// Writes the packed executable incrementally: the player binary is copied in
+// fixed-size chunks and each entry goes to disk as soon as it is added, so peak
+// memory is bounded by the largest entry rather than the whole pack. The
+// directory and footer are appended by Finish() once every offset is known.
+struct PackStreamWriter {
+    static constexpr size_t kCopyChunkSize = 1u << 20;
+
+    std::ofstream out;
+    std::string outputPath;
+    uint64_t executableSize = 0;
+    uint64_t packSize = 0;
+    bool failed = false;
+
+    bool Open(const std::string& outputPathText) {
+        outputPath = outputPathText;
+        out.open(outputPathText, std::ios::binary | std::ios::trunc);
+        failed = !out.is_open();
+        return !failed;
+    }
+
+    bool CopyExecutable(std::istream& source) {
+        std::vector<char> chunk(kCopyChunkSize);
+        while (source) {
+            source.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            const std::streamsize readCount = source.gcount();
+            if (readCount <= 0) {
+                break;
+            }
+            out.write(chunk.data(), readCount);
+            executableSize += static_cast<uint64_t>(readCount);
+        }
+        failed = failed || source.bad() || !out.good();
+        return !failed;
+    }
+
+    // Returns the entry offset relative to the start of the pack segment.
+    uint64_t WriteEntry(const std::vector<uint8_t>& payload) {
+        const uint64_t offset = packSize;
+        out.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+        packSize += payload.size();
+        failed = failed || !out.good();
+        return offset;
+    }
+
+    // Reads back an already written entry; used to confirm content-hash matches.
+    bool WrittenEntryEquals(uint64_t packOffset, const std::vector<uint8_t>& payload) {
+        out.flush();
+        if (!out.good() || packOffset + payload.size() > packSize) {
+            return false;
+        }
+
+        std::ifstream in(outputPath, std::ios::binary);
+        in.seekg(static_cast<std::streamoff>(executableSize + packOffset));
+        std::vector<char> chunk(std::min(kCopyChunkSize, std::max<size_t>(payload.size(), 1)));
+        size_t compared = 0;
+        while (compared < payload.size()) {
+            const size_t count = std::min(chunk.size(), payload.size() - compared);
+            in.read(chunk.data(), static_cast<std::streamsize>(count));
+            if (static_cast<size_t>(in.gcount()) != count ||
+                std::memcmp(chunk.data(), payload.data() + compared, count) != 0) {
+                return false;
+            }
+            compared += count;
+        }
+        return true;
+    }
+
+    bool Finish(const std::vector<uint8_t>& directoryData) {
+        if (failed) {
+            return false;
+        }
+
+        const uint64_t dirStartOffset = executableSize + packSize;
+        out.write(reinterpret_cast<const char*>(directoryData.data()), static_cast<std::streamsize>(directoryData.size()));
+        out.write(reinterpret_cast<const char*>(&dirStartOffset), sizeof(uint64_t));
+        const char MAGIC[] = "SHADERLAB_PACK";
+        out.write(MAGIC, 14);
+
+        out.flush();
+        failed = !out.good();
+        out.close();
+        return !failed;
+    }
+};
+
+struct PackEntryJob {
+    std::string packedPath;
+    fs::path sourcePath;
+};
+
+struct PreparedPackEntry {
+    std::vector<uint8_t> payload;
+    uint64_t rawSize = 0;
+    uint64_t contentHash = 0;
+    bool compressed = false;
+    std::string logLine;
+};
+
+// Decodes the frame once so a codec fault fails the build instead of the player,
+// and reports the throughput the runtime can expect for this entry.
+bool VerifyCompressedEntry(const std::string& packedPath,
+                           const std::vector<uint8_t>& raw,
+                           const std::vector<uint8_t>& compressed,
+                           std::string& outLogLine) {
+    std::vector<uint8_t> decoded;
+    const auto start = std::chrono::steady_clock::now();
+    const bool decodedOk = PackCodec::Decompress(compressed, decoded);
+    const auto end = std::chrono::steady_clock::now();
+    if (!decodedOk || decoded != raw) {
+        outLogLine = "  Pack entry " + packedPath + ": compressed frame failed verification, storing raw.";
+        return false;
+    }
+
+    PackCodec::FrameHeader header;
+    PackCodec::ReadFrameHeader(compressed, header);
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    const double megabytesPerSecond = seconds > 0.0
+        ? (static_cast<double>(raw.size()) / (1024.0 * 1024.0)) / seconds
+        : 0.0;
+    char line[256];
+    std::snprintf(line, sizeof(line), " %zu -> %zu bytes (%.1f%%), %s, decode %.0f MB/s",
+                  raw.size(),
+                  compressed.size(),
+                  100.0 * static_cast<double>(compressed.size()) / static_cast<double>(raw.size()),
+                  PackCodec::CodecName(header.codec),
+                  megabytesPerSecond);
+    outLogLine = "  Pack entry " + packedPath + ":" + line;
+    return true;
+}
+
+uint64_t HashPackContent(const std::vector<uint8_t>& data) {
+    uint64_t hash = 14695981039346656037ull; // FNV-1a 64
+    for (uint8_t byte : data) {
+        hash ^= byte;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Reads, hashes and compresses one entry. Touches no shared state, so it runs on pack workers.
+void PreparePackEntry(const PackEntryJob& job, Serializer::PackCompression compression, PreparedPackEntry& outEntry) {
+    std::ifstream file(job.sourcePath, std::ios::binary);
+    std::vector<uint8_t> data = ReadStreamBytes(file);
+    outEntry.rawSize = data.size();
+    outEntry.contentHash = HashPackContent(data);
+
+    if (compression != Serializer::PackCompression::None) {
+        const PackCodec::Level level = compression == Serializer::PackCompression::High
+            ? PackCodec::Level::High
+            : PackCodec::Level::Fast;
+        std::vector<uint8_t> compressedData;
+        if (TryCompressPackedEntry(data, level, compressedData) &&
+            VerifyCompressedEntry(job.packedPath, data, compressedData, outEntry.logLine)) {
+            outEntry.payload = std::move(compressedData);
+            outEntry.compressed = true;
+            return;
+        }
+    }
+
+    outEntry.payload = std::move(data);
+}
+
+uint32_t ResolvePackWorkerCount(uint32_t requested, size_t jobCount) {
+    uint32_t workers = requested;
+    if (workers == 0) {
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return static_cast<uint32_t>(std::min<size_t>(workers, std::max<size_t>(jobCount, 1)));
+}
+
+// Entries are collected first (path precedence is decided in insertion order), then read
+// and compressed by a worker pool. Results are committed strictly in job order, so the
+// output is byte-identical for any worker count. Workers stay at most a fixed window ahead
+// of the writer to keep memory bounded.
 struct ExecutablePackAccumulator {
-    explicit ExecutablePackAccumulator(bool enableCompression)
-        : compressEntries(enableCompression) {
+    ExecutablePackAccumulator(const Serializer::PackOptions& packOptions, PackStreamWriter& packWriter)
+        : options(packOptions),
+          writer(packWriter) {
     }
 
-    bool compressEntries = false;
-    std::vector<uint8_t> packBlob;
+    const Serializer::PackOptions& options;
+    PackStreamWriter& writer;
+    std::vector<PackEntryJob> jobs;
     std::vector<PackedEntryInfo> entries;
     std::unordered_set<std::string> packedPathIndex;
+    uint64_t totalRawBytes = 0;
+    uint64_t totalStoredBytes = 0;
+    size_t compressedEntryCount = 0;
+    size_t dedupedEntryCount = 0;
+    uint64_t dedupSavedBytes = 0;
+    uint32_t workerCount = 1;
+    // (content hash, raw size) -> indices into entries that own stored bytes.
+    std::unordered_map<uint64_t, std::vector<size_t>> storedContentIndex;
 
     bool HasPackedPath(const std::string& packedPath) const {
         return packedPathIndex.find(packedPath) != packedPathIndex.end();
     }
 
-    void AddEntryFromData(const std::string& packedPath, const std::vector<uint8_t>& data) {
-        std::vector<uint8_t> compressedData;
-        const std::vector<uint8_t>* payload = &data;
-#if defined(_WIN32)
-        if (compressEntries && TryCompressPackedEntry(data, compressedData)) {
-            payload = &compressedData;
+    void Log(const std::string& message) const {
+        if (options.log) {
+            options.log(message);
         }
-#endif
+    }
 
-        PackedEntryInfo info;
-        info.path = packedPath;
-        info.offset = packBlob.size();
-        info.size = payload->size();
-        entries.push_back(info);
+    void EnqueueEntry(const std::string& packedPath, const fs::path& sourcePath) {
+        jobs.push_back({packedPath, sourcePath});
         packedPathIndex.insert(packedPath);
-        packBlob.insert(packBlob.end(), payload->begin(), payload->end());
     }
 
     void TryAddEntryFromDisk(const fs::path& diskPath, const std::string& packedPathRaw) {
@@ -294,10 +420,7 @@ struct ExecutablePackAccumulator {
         if (HasPackedPath(packedPath) || !fs::exists(diskPath)) {
             return;
         }
-
-        std::ifstream file(diskPath, std::ios::binary);
-        std::vector<uint8_t> data = ReadStreamBytes(file);
-        AddEntryFromData(packedPath, data);
+        EnqueueEntry(packedPath, diskPath);
     }
 
     void TryAddProjectManifest(const std::string& projectJsonPath,
@@ -306,10 +429,7 @@ struct ExecutablePackAccumulator {
         if (!includeProjectManifest || !hasProjectJsonPath) {
             return;
         }
-
-        std::ifstream file(projectJsonPath, std::ios::binary);
-        std::vector<uint8_t> data = ReadStreamBytes(file);
-        AddEntryFromData("project.json", data);
+        EnqueueEntry("project.json", projectJsonPath);
     }
 
     void AddProjectAssets(const ProjectData& project, const fs::path& projectRoot) {
@@ -326,6 +446,152 @@ struct ExecutablePackAccumulator {
             TryAddEntryFromDisk(extra.sourcePath, extra.packedPath);
         }
     }
+
+    static uint64_t StoredContentKey(const PreparedPackEntry& prepared) {
+        return prepared.contentHash ^ (prepared.rawSize * 0x9E3779B97F4A7C15ull);
+    }
+
+    // Identical payloads share one stored range; the directory simply repeats its offset.
+    bool TryShareStoredEntry(const PreparedPackEntry& prepared, PackedEntryInfo& info) {
+        const auto found = storedContentIndex.find(StoredContentKey(prepared));
+        if (found == storedContentIndex.end()) {
+            return false;
+        }
+
+        for (size_t entryIndex : found->second) {
+            const PackedEntryInfo& stored = entries[entryIndex];
+            if (stored.size == prepared.payload.size() &&
+                writer.WrittenEntryEquals(stored.offset, prepared.payload)) {
+                info.offset = stored.offset;
+                info.size = stored.size;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CommitEntry(const PackEntryJob& job, PreparedPackEntry& prepared) {
+        PackedEntryInfo info;
+        info.path = job.packedPath;
+        totalRawBytes += prepared.rawSize;
+
+        if (!prepared.payload.empty() && TryShareStoredEntry(prepared, info)) {
+            ++dedupedEntryCount;
+            dedupSavedBytes += info.size;
+            Log("  Pack entry " + job.packedPath + ": identical content already stored, sharing " +
+                std::to_string(info.size) + " bytes");
+        } else {
+            if (!prepared.logLine.empty()) {
+                Log(prepared.logLine);
+            }
+            info.offset = writer.WriteEntry(prepared.payload);
+            info.size = prepared.payload.size();
+            totalStoredBytes += info.size;
+            if (prepared.compressed) {
+                ++compressedEntryCount;
+            }
+            storedContentIndex[StoredContentKey(prepared)].push_back(entries.size());
+        }
+
+        entries.push_back(info);
+        prepared = PreparedPackEntry{};
+    }
+
+    void WriteEntries() {
+        workerCount = ResolvePackWorkerCount(options.workerThreads, jobs.size());
+        if (workerCount <= 1) {
+            for (const auto& job : jobs) {
+                PreparedPackEntry prepared;
+                PreparePackEntry(job, options.compression, prepared);
+                CommitEntry(job, prepared);
+            }
+            return;
+        }
+
+        const size_t window = static_cast<size_t>(workerCount) * 2;
+        std::vector<PreparedPackEntry> prepared(jobs.size());
+        std::vector<uint8_t> ready(jobs.size(), 0);
+        std::mutex mutex;
+        std::condition_variable workAvailable;
+        std::condition_variable entryReady;
+        size_t nextJob = 0;
+        size_t nextCommit = 0;
+
+        auto worker = [&]() {
+            for (;;) {
+                size_t jobIndex = 0;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    workAvailable.wait(lock, [&]() {
+                        return nextJob >= jobs.size() || nextJob < nextCommit + window;
+                    });
+                    if (nextJob >= jobs.size()) {
+                        return;
+                    }
+                    jobIndex = nextJob++;
+                }
+
+                PreparedPackEntry entry;
+                PreparePackEntry(jobs[jobIndex], options.compression, entry);
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    prepared[jobIndex] = std::move(entry);
+                    ready[jobIndex] = 1;
+                }
+                entryReady.notify_one();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; ++i) {
+            workers.emplace_back(worker);
+        }
+
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            PreparedPackEntry entry;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                entryReady.wait(lock, [&]() { return ready[i] != 0; });
+                entry = std::move(prepared[i]);
+                nextCommit = i + 1;
+            }
+            workAvailable.notify_all();
+            CommitEntry(jobs[i], entry);
+        }
+
+        for (auto& thread : workers) {
+            thread.join();
+        }
+    }
+
+    void LogSummary() const {
+        if (options.compression == Serializer::PackCompression::None && dedupedEntryCount == 0) {
+            return;
+        }
+        char line[256];
+        std::snprintf(line, sizeof(line), "  Pack: %zu entries (%zu compressed, %zu deduplicated), %llu -> %llu bytes, %u worker(s)",
+                      entries.size(),
+                      compressedEntryCount,
+                      dedupedEntryCount,
+                      static_cast<unsigned long long>(totalRawBytes),
+                      static_cast<unsigned long long>(totalStoredBytes),
+                      workerCount);
+        Log(line);
+        if (dedupedEntryCount > 0) {
+            Log("  Pack dedup saved " + std::to_string(dedupSavedBytes) + " bytes");
+        }
+    }
+
+    void FillStats(Serializer::PackStats& stats) const {
+        stats.entryCount = entries.size();
+        stats.compressedEntryCount = compressedEntryCount;
+        stats.dedupedEntryCount = dedupedEntryCount;
+        stats.rawBytes = totalRawBytes;
+        stats.storedBytes = totalStoredBytes;
+        stats.dedupSavedBytes = dedupSavedBytes;
+    }
 };
 
 std::vector<uint8_t> BuildDirectoryBlob(const std::vector<PackedEntryInfo>& packEntries,
@@ -362,29 +628,6 @@ bool EnsureOutputDirectory(const std::string& outputPathText) {
     return true;
 }
 
-bool WritePackedExecutable(const std::string& outputPathText,
-                           const std::vector<uint8_t>& executableData,
-                           const std::vector<uint8_t>& packedData,
-                           const std::vector<uint8_t>& directoryData) {
-    std::ofstream out(outputPathText, std::ios::binary);
-    if (!out.is_open()) {
-        return false;
-    }
-
-    out.write((const char*)executableData.data(), executableData.size());
-    out.write((const char*)packedData.data(), packedData.size());
-
-    uint64_t dirStartOffset = executableData.size() + packedData.size();
-    out.write((const char*)directoryData.data(), directoryData.size());
-
-    out.write((const char*)&dirStartOffset, sizeof(uint64_t));
-    const char MAGIC[] = "SHADERLAB_PACK";
-    out.write(MAGIC, 14);
-
-    out.flush();
-    return out.good();
-}
-
 } // namespace
 
     // Helper conversions - Moved to ShaderLab namespace for ADL
@@ -611,6 +854,7 @@ bool WritePackedExecutable(const std::string& outputPathText,
         j.at("bpm").get_to(t.bpm);
         j.at("len").get_to(t.lengthBeats);
         j.at("rows").get_to(t.rows);
+        t.MarkRowsChanged();
     }
 
     void to_json(json& j, const ProjectData& p) {
@@ -667,6 +911,28 @@ namespace Serializer {
         return true;
     }
 
+    bool SaveProjectBinary(const ProjectData& project, const std::string& filepath) {
+        std::vector<uint8_t> encoded;
+        if (!ProjectBinary::Encode(project, encoded)) return false;
+        std::ofstream o(filepath, std::ios::binary | std::ios::trunc);
+        if (!o.is_open()) return false;
+        o.write(reinterpret_cast<const char*>(encoded.data()), static_cast<std::streamsize>(encoded.size()));
+        return o.good();
+    }
+
+    bool LoadProjectFromBinary(std::span<const uint8_t> data, ProjectData& outProject) {
+        return ProjectBinary::Decode(data, outProject);
+    }
+
+    bool LoadProjectBinary(const std::string& filepath, ProjectData& outProject) {
+        MappedFile file;
+        if (!file.Open(filepath)) return false;
+        if (!ProjectBinary::Decode(file.Range(0, file.Size()), outProject)) return false;
+        // Shader code is inline; only asset paths are rebased like the JSON loader does.
+        ResolveLinkedAssetPaths(outProject, fs::path(filepath).parent_path());
+        return true;
+    }
+
     bool ExportProject(const ProjectData& inputProject, const std::string& outputFile) {
         ProjectData p = inputProject; // Copy to modify paths
         
@@ -869,22 +1135,47 @@ namespace Serializer {
                         const std::string& outputExe,
                         const std::string& projectJsonPath,
                         const std::vector<PackedExtraFile>& extraFiles,
-                        bool includeProjectManifest) {
-        // 1. Read Source EXE
+                        const PackOptions& options,
+                        PackStats* outStats) {
+        const bool includeProjectManifest = options.includeProjectManifest;
+        // 1. Open Source EXE
         std::ifstream src(sourceExe, std::ios::binary);
         if (!src.is_open()) return false;
 
-        std::vector<uint8_t> exeData = ReadStreamBytes(src);
-
         // 2. Load Project to find assets
         ProjectData project;
         const bool hasProjectJsonPath = !projectJsonPath.empty();
         const bool loadProjectAssets = hasProjectJsonPath && includeProjectManifest;
         if (loadProjectAssets && !LoadProject(projectJsonPath, project)) return false;
 
-        // 3. Prepare Pack Data
-        const bool compressPackedEntries = !includeProjectManifest;
-        ExecutablePackAccumulator packAccumulator(compressPackedEntries);
+        // 3. Stream EXE and pack data to the output
+        // Layout: [EXE][PACK_DATA][DIRECTORY_BLOB][DIR_OFFSET_U64][MAGIC]
+        if (!EnsureOutputDirectory(outputExe)) {
+            return false;
+        }
+
+        // The source is streamed while the output is written, so they must differ.
+        std::error_code sameFileEc;
+        if (fs::exists(outputExe, sameFileEc) && fs::equivalent(sourceExe, outputExe, sameFileEc)) {
+            return false;
+        }
+
+        PackStreamWriter writer;
+        const auto discardOutput = [&]() {
+            writer.out.close();
+            std::error_code removeEc;
+            fs::remove(outputExe, removeEc);
+        };
+        if (!writer.Open(outputExe)) {
+            return false;
+        }
+        if (!writer.CopyExecutable(src)) {
+            discardOutput();
+            return false;
+        }
+        src.close();
+
+        ExecutablePackAccumulator packAccumulator(options, writer);
         packAccumulator.TryAddProjectManifest(projectJsonPath, includeProjectManifest, hasProjectJsonPath);
 
         const fs::path projectRoot = hasProjectJsonPath ? fs::path(projectJsonPath).parent_path() : fs::path();
@@ -893,17 +1184,30 @@ namespace Serializer {
             packAccumulator.AddProjectAssets(project, projectRoot);
         }
         packAccumulator.AddExtraFiles(extraFiles);
+        packAccumulator.WriteEntries();
+        packAccumulator.LogSummary();
 
-        // 4. Create Directory Blob
-        std::vector<uint8_t> dirBlob = BuildDirectoryBlob(packAccumulator.entries, exeData.size());
-
-        // 5. Write Output EXE
-        // Layout: [EXE][PACK_DATA][DIRECTORY_BLOB][DIR_OFFSET_U64][MAGIC]
-        if (!EnsureOutputDirectory(outputExe)) {
+        // 4. Append Directory and Footer
+        const std::vector<uint8_t> dirBlob = BuildDirectoryBlob(packAccumulator.entries, writer.executableSize);
+        if (!writer.Finish(dirBlob)) {
+            discardOutput();
             return false;
         }
+        if (outStats) {
+            packAccumulator.FillStats(*outStats);
+        }
+        return true;
+    }
 
-        return WritePackedExecutable(outputExe, exeData, packAccumulator.packBlob, dirBlob);
+    bool PackExecutable(const std::string& sourceExe,
+                        const std::string& outputExe,
+                        const std::string& projectJsonPath,
+                        const std::vector<PackedExtraFile>& extraFiles,
+                        bool includeProjectManifest) {
+        PackOptions options;
+        options.includeProjectManifest = includeProjectManifest;
+        options.compression = includeProjectManifest ? PackCompression::None : PackCompression::Fast;
+        return PackExecutable(sourceExe, outputExe, projectJsonPath, extraFiles, options);
     }
 
     bool PackExecutable(const std::string& sourceExe, const std::string& outputExe, const std::string& projectJsonPath, const std::vector<PackedExtraFile>& extraFiles) {
@@ -0,0 +1,314 @@
+#include "ShaderLab/Core/ShaderBytecodeCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace ShaderLab {
+
+namespace {
+
+// Entry file: header followed by the bytecode.
+constexpr char kEntryMagic[4] = {'S', 'L', 'B', 'C'};
+constexpr uint32_t kEntryVersion = 1;
+constexpr const char* kEntryExtension = ".dxil";
+
+struct EntryHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t keyLo;
+    uint64_t keyHi;
+    uint64_t payloadSize;
+    uint64_t payloadHash;
+};
+static_assert(sizeof(EntryHeader) == 40, "Shader cache entry header layout changed");
+
+uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull; // FNV-1a 64
+    }
+    return hash;
+}
+
+// Length-prefixed so ("ab", "c") and ("a", "bc") hash differently.
+uint64_t HashField(uint64_t hash, std::string_view field) {
+    const uint64_t length = field.size();
+    hash = HashBytes(hash, &length, sizeof(length));
+    return HashBytes(hash, field.data(), field.size());
+}
+
+std::string KeyToName(const ShaderBytecodeCache::Key& key) {
+    static const char* kHex = "0123456789abcdef";
+    std::string name(32, '0');
+    for (int i = 0; i < 16; ++i) {
+        name[15 - i] = kHex[(key.hi >> (i * 4)) & 0xF];
+        name[31 - i] = kHex[(key.lo >> (i * 4)) & 0xF];
+    }
+    return name + kEntryExtension;
+}
+
+} // namespace
+
+ShaderBytecodeCache::Key ShaderBytecodeCache::MakeKey(std::string_view source,
+                                                      std::string_view entryPoint,
+                                                      std::string_view target,
+                                                      uint32_t compileFlags,
+                                                      std::string_view compilerVersion) {
+    // Two FNV-1a streams with different bases and field order make up a 128-bit key.
+    Key key;
+    key.lo = 14695981039346656037ull;
+    key.lo = HashField(key.lo, source);
+    key.lo = HashField(key.lo, entryPoint);
+    key.lo = HashField(key.lo, target);
+    key.lo = HashBytes(key.lo, &compileFlags, sizeof(compileFlags));
+    key.lo = HashField(key.lo, compilerVersion);
+
+    key.hi = 0x84222325cbf29ce4ull;
+    key.hi = HashField(key.hi, compilerVersion);
+    key.hi = HashBytes(key.hi, &compileFlags, sizeof(compileFlags));
+    key.hi = HashField(key.hi, target);
+    key.hi = HashField(key.hi, entryPoint);
+    key.hi = HashField(key.hi, source);
+    return key;
+}
+
+bool ShaderBytecodeCache::IsCacheableSource(std::string_view source) {
+    // Line scan rather than a full preprocess: a directive inside a block comment
+    // only costs a cache miss.
+    size_t lineStart = 0;
+    while (lineStart < source.size()) {
+        size_t lineEnd = source.find('\n', lineStart);
+        if (lineEnd == std::string_view::npos) {
+            lineEnd = source.size();
+        }
+        std::string_view line = source.substr(lineStart, lineEnd - lineStart);
+        const size_t hash = line.find_first_not_of(" \t\r\v\f");
+        if (hash != std::string_view::npos && line[hash] == '#') {
+            line.remove_prefix(hash + 1);
+            const size_t directive = line.find_first_not_of(" \t");
+            if (directive != std::string_view::npos && line.substr(directive).starts_with("include")) {
+                return false;
+            }
+        }
+        lineStart = lineEnd + 1;
+    }
+    return true;
+}
+
+bool ShaderBytecodeCache::Open(const std::string& directory, uint64_t maxBytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_directory.clear();
+    m_recency.clear();
+    m_entries.clear();
+    m_totalBytes = 0;
+    m_maxBytes = maxBytes;
+    m_stats = {};
+
+    if (directory.empty()) {
+        return false;
+    }
+
+    std::error_code ec;
+    fs::create_directories(directory, ec);
+    if (!fs::is_directory(directory, ec)) {
+        return false;
+    }
+
+    struct Found {
+        std::string name;
+        uint64_t size;
+        fs::file_time_type lastUse;
+    };
+    std::vector<Found> found;
+    for (fs::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+        std::error_code entryEc;
+        if (!it->is_regular_file(entryEc)) {
+            continue;
+        }
+        const fs::path& path = it->path();
+        if (path.extension() != kEntryExtension) {
+            // Leftover temporaries from an interrupted write.
+            if (path.filename().string().find(".tmp") != std::string::npos) {
+                fs::remove(path, entryEc);
+            }
+            continue;
+        }
+        const uint64_t size = it->file_size(entryEc);
+        if (entryEc) {
+            continue;
+        }
+        const fs::file_time_type lastUse = it->last_write_time(entryEc);
+        found.push_back({path.filename().string(), size, lastUse});
+    }
+
+    std::sort(found.begin(), found.end(), [](const Found& a, const Found& b) {
+        return a.lastUse > b.lastUse;
+    });
+    for (const auto& item : found) {
+        m_recency.push_back(item.name);
+        m_entries[item.name] = Entry{item.size, std::prev(m_recency.end())};
+        m_totalBytes += item.size;
+    }
+
+    m_directory = directory;
+    EvictLocked();
+    return true;
+}
+
+void ShaderBytecodeCache::Close() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_directory.clear();
+    m_recency.clear();
+    m_entries.clear();
+    m_totalBytes = 0;
+}
+
+bool ShaderBytecodeCache::IsOpen() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_directory.empty();
+}
+
+std::string ShaderBytecodeCache::GetDirectory() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_directory;
+}
+
+bool ShaderBytecodeCache::Load(const Key& key, std::vector<uint8_t>& outBytecode) {
+    outBytecode.clear();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_directory.empty()) {
+        return false;
+    }
+
+    const std::string name = KeyToName(key);
+    auto entryIt = m_entries.find(name);
+    if (entryIt == m_entries.end()) {
+        ++m_stats.misses;
+        return false;
+    }
+
+    const fs::path path = fs::path(m_directory) / name;
+    bool valid = false;
+    {
+        std::ifstream file(path, std::ios::binary);
+        EntryHeader header = {};
+        if (file.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+            std::memcmp(header.magic, kEntryMagic, sizeof(kEntryMagic)) == 0 &&
+            header.version == kEntryVersion &&
+            header.keyLo == key.lo && header.keyHi == key.hi &&
+            header.payloadSize > 0 &&
+            header.payloadSize + sizeof(header) == entryIt->second.size) {
+            outBytecode.resize(static_cast<size_t>(header.payloadSize));
+            valid = static_cast<bool>(file.read(reinterpret_cast<char*>(outBytecode.data()), static_cast<std::streamsize>(outBytecode.size()))) &&
+                    HashBytes(14695981039346656037ull, outBytecode.data(), outBytecode.size()) == header.payloadHash;
+        }
+    }
+
+    if (!valid) {
+        outBytecode.clear();
+        RemoveLocked(name);
+        ++m_stats.misses;
+        return false;
+    }
+
+    TouchLocked(entryIt->second);
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    ++m_stats.hits;
+    return true;
+}
+
+bool ShaderBytecodeCache::Store(const Key& key, std::span<const uint8_t> bytecode) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_directory.empty() || bytecode.empty()) {
+        return false;
+    }
+
+    EntryHeader header = {};
+    std::memcpy(header.magic, kEntryMagic, sizeof(kEntryMagic));
+    header.version = kEntryVersion;
+    header.keyLo = key.lo;
+    header.keyHi = key.hi;
+    header.payloadSize = bytecode.size();
+    header.payloadHash = HashBytes(14695981039346656037ull, bytecode.data(), bytecode.size());
+
+    const std::string name = KeyToName(key);
+    const fs::path finalPath = fs::path(m_directory) / name;
+    const fs::path tempPath = fs::path(m_directory) / (name + ".tmp" + std::to_string(++m_tempCounter));
+
+    bool written = false;
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (file.is_open()) {
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(bytecode.data()), static_cast<std::streamsize>(bytecode.size()));
+            file.flush();
+            written = file.good();
+        }
+    }
+
+    std::error_code ec;
+    if (written) {
+        fs::rename(tempPath, finalPath, ec);
+    }
+    if (!written || ec) {
+        fs::remove(tempPath, ec);
+        return false;
+    }
+
+    const uint64_t size = sizeof(header) + bytecode.size();
+    auto entryIt = m_entries.find(name);
+    if (entryIt != m_entries.end()) {
+        m_totalBytes -= entryIt->second.size;
+        entryIt->second.size = size;
+        TouchLocked(entryIt->second);
+    } else {
+        m_recency.push_front(name);
+        m_entries[name] = Entry{size, m_recency.begin()};
+    }
+    m_totalBytes += size;
+    ++m_stats.stores;
+
+    EvictLocked();
+    return true;
+}
+
+ShaderBytecodeCacheStats ShaderBytecodeCache::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ShaderBytecodeCacheStats stats = m_stats;
+    stats.entryCount = m_entries.size();
+    stats.bytesOnDisk = m_totalBytes;
+    return stats;
+}
+
+void ShaderBytecodeCache::TouchLocked(Entry& entry) {
+    m_recency.splice(m_recency.begin(), m_recency, entry.recency);
+}
+
+void ShaderBytecodeCache::RemoveLocked(const std::string& name) {
+    auto entryIt = m_entries.find(name);
+    if (entryIt == m_entries.end()) {
+        return;
+    }
+    std::error_code ec;
+    fs::remove(fs::path(m_directory) / name, ec);
+    m_totalBytes -= entryIt->second.size;
+    m_recency.erase(entryIt->second.recency);
+    m_entries.erase(entryIt);
+}
+
+void ShaderBytecodeCache::EvictLocked() {
+    // Keep the most recent entry even if it alone exceeds the budget.
+    while (m_totalBytes > m_maxBytes && m_entries.size() > 1) {
+        const std::string victim = m_recency.back();
+        RemoveLocked(victim);
+        ++m_stats.evictions;
+    }
+}
+
+}
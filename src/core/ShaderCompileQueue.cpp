@@ -0,0 +1,208 @@
+#include "ShaderLab/Core/ShaderCompileQueue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace ShaderLab {
+
+ShaderCompileQueue::~ShaderCompileQueue() {
+    Stop();
+}
+
+void ShaderCompileQueue::Start(ICompilationService* service, uint32_t workerCount) {
+    Stop();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_service = service;
+    m_workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&ShaderCompileQueue::WorkerLoop, this);
+    }
+}
+
+void ShaderCompileQueue::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_workers.clear();
+    m_queue.clear();
+    m_latestGeneration.clear();
+    m_running.clear();
+    m_finished.clear();
+    m_stopping = false;
+}
+
+uint64_t ShaderCompileQueue::Submit(ShaderCompileRequest request) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const uint64_t generation = ++m_nextGeneration;
+    const uint64_t target = request.target;
+    m_latestGeneration[target] = generation;
+    ++m_stats.submitted;
+
+    auto queued = std::find_if(m_queue.begin(), m_queue.end(), [&](const Job& job) {
+        return job.request.target == target;
+    });
+    if (queued != m_queue.end()) {
+        queued->generation = generation;
+        queued->request = std::move(request);
+        ++m_stats.coalesced;
+        return generation;
+    }
+
+    // Live compiles are what the user waits on; they go ahead of queued Build compiles.
+    auto insertAt = m_queue.end();
+    if (request.mode == ShaderCompileMode::Live) {
+        insertAt = std::find_if(m_queue.begin(), m_queue.end(), [](const Job& job) {
+            return job.request.mode != ShaderCompileMode::Live;
+        });
+    }
+    m_queue.insert(insertAt, {generation, std::move(request)});
+    m_workAvailable.notify_one();
+    return generation;
+}
+
+void ShaderCompileQueue::Cancel(uint64_t target) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const size_t before = m_queue.size();
+    m_queue.erase(std::remove_if(m_queue.begin(), m_queue.end(), [&](const Job& job) {
+        return job.request.target == target;
+    }), m_queue.end());
+    m_stats.discarded += before - m_queue.size();
+    // A running compile for this target is now stale and will be dropped when it finishes.
+    m_latestGeneration[target] = ++m_nextGeneration;
+    m_finished.erase(std::remove_if(m_finished.begin(), m_finished.end(), [&](const ShaderCompileOutput& output) {
+        return output.target == target;
+    }), m_finished.end());
+}
+
+bool ShaderCompileQueue::IsPending(uint64_t target) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto latest = m_latestGeneration.find(target);
+    if (latest == m_latestGeneration.end()) {
+        return false;
+    }
+    for (const Job& job : m_queue) {
+        if (job.request.target == target) {
+            return true;
+        }
+    }
+    for (const auto& running : m_running) {
+        if (running.first == target && running.second == latest->second) {
+            return true;
+        }
+    }
+    for (const auto& output : m_finished) {
+        if (output.target == target && output.generation == latest->second) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t ShaderCompileQueue::Poll(std::vector<ShaderCompileOutput>& outResults) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_workers.empty()) {
+        // Inline mode: the caller's thread compiles everything queued.
+        while (!m_queue.empty()) {
+            Job job = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_running.emplace_back(job.request.target, job.generation);
+            lock.unlock();
+            ShaderCompileOutput output = Run(job);
+            lock.lock();
+            FinishLocked(std::move(output));
+        }
+    }
+
+    size_t delivered = 0;
+    for (auto& output : m_finished) {
+        // Superseded after it finished but before this poll.
+        if (m_latestGeneration[output.target] != output.generation) {
+            ++m_stats.discarded;
+            continue;
+        }
+        outResults.push_back(std::move(output));
+        ++delivered;
+    }
+    m_finished.clear();
+    m_stats.delivered += delivered;
+    return delivered;
+}
+
+ShaderCompileQueueStats ShaderCompileQueue::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void ShaderCompileQueue::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_workAvailable.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+        if (m_stopping) {
+            return;
+        }
+        Job job = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_running.emplace_back(job.request.target, job.generation);
+        lock.unlock();
+
+        ShaderCompileOutput output = Run(job);
+
+        lock.lock();
+        if (m_stopping) {
+            return;
+        }
+        FinishLocked(std::move(output));
+    }
+}
+
+ShaderCompileOutput ShaderCompileQueue::Run(Job& job) {
+    ShaderCompileOutput output;
+    output.target = job.request.target;
+    output.generation = job.generation;
+    output.source = std::move(job.request.source);
+
+    const auto startTime = std::chrono::steady_clock::now();
+    if (!m_service) {
+        output.error = "Compilation service unavailable.";
+    } else {
+        output.result = m_service->CompilePreviewShader(output.source,
+                                                        job.request.bindings,
+                                                        false,
+                                                        job.request.entryPoint,
+                                                        job.request.sourceName,
+                                                        job.request.mode);
+        if (output.result.success && job.request.finalize && !job.request.finalize(output) && output.error.empty()) {
+            output.error = "Compiled shader could not be used.";
+        }
+    }
+    output.compileSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return output;
+}
+
+void ShaderCompileQueue::FinishLocked(ShaderCompileOutput&& output) {
+    const auto running = std::find(m_running.begin(), m_running.end(), std::make_pair(output.target, output.generation));
+    if (running != m_running.end()) {
+        m_running.erase(running);
+    }
+    m_stats.lastCompileSeconds = output.compileSeconds;
+
+    const auto latest = m_latestGeneration.find(output.target);
+    if (latest == m_latestGeneration.end() || latest->second != output.generation) {
+        ++m_stats.discarded;
+        return;
+    }
+    m_finished.push_back(std::move(output));
+}
+
+} // namespace ShaderLab
@@ -0,0 +1,275 @@
+#include "ShaderLab/Core/TextureBake.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ShaderLab {
+
+namespace {
+
+constexpr char kContainerMagic[4] = {'S', 'L', 'T', 'X'};
+constexpr uint32_t kContainerVersion = 1;
+constexpr uint32_t kFormatRgba8Unorm = 0;
+
+struct ContainerHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t layout;
+    uint32_t format;
+    uint32_t width;
+    uint32_t height;
+    uint32_t depthOrArraySize;
+    uint32_t mipLevels;
+    uint32_t subresourceCount;
+    uint32_t reserved;
+    uint64_t payloadOffset; // From the start of the container
+    uint64_t payloadSize;
+};
+static_assert(sizeof(ContainerHeader) == 56, "Baked texture header layout changed");
+
+struct SubresourceRecord {
+    uint64_t offset;
+    uint32_t width;
+    uint32_t height;
+    uint32_t depth;
+    uint32_t rowPitch;
+};
+static_assert(sizeof(SubresourceRecord) == 24, "Baked texture subresource layout changed");
+
+uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Tightly packed RGBA8 volume (depth 1 for 2D images).
+struct Image {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t depth = 1;
+    std::vector<uint8_t> pixels;
+};
+
+Image CropTile(const uint8_t* rgba, uint32_t stripWidth, uint32_t tileX, uint32_t tileSize) {
+    Image tile;
+    tile.width = tileSize;
+    tile.height = tileSize;
+    tile.pixels.resize(static_cast<size_t>(tileSize) * tileSize * 4u);
+    for (uint32_t y = 0; y < tileSize; ++y) {
+        const uint8_t* src = rgba + (static_cast<size_t>(y) * stripWidth + static_cast<size_t>(tileX) * tileSize) * 4u;
+        std::memcpy(tile.pixels.data() + static_cast<size_t>(y) * tileSize * 4u, src, static_cast<size_t>(tileSize) * 4u);
+    }
+    return tile;
+}
+
+// Box filter over the 2x2(x2) block each texel covers; odd edges reuse their last texel.
+Image Downsample(const Image& source, bool volume) {
+    Image result;
+    result.width = (std::max)(1u, source.width / 2);
+    result.height = (std::max)(1u, source.height / 2);
+    result.depth = volume ? (std::max)(1u, source.depth / 2) : 1u;
+    result.pixels.resize(static_cast<size_t>(result.width) * result.height * result.depth * 4u);
+
+    const auto texel = [&](uint32_t x, uint32_t y, uint32_t z) {
+        x = (std::min)(x, source.width - 1);
+        y = (std::min)(y, source.height - 1);
+        z = (std::min)(z, source.depth - 1);
+        return source.pixels.data() + ((static_cast<size_t>(z) * source.height + y) * source.width + x) * 4u;
+    };
+
+    const uint32_t zTaps = volume ? 2u : 1u;
+    const uint32_t taps = 4u * zTaps;
+    uint8_t* out = result.pixels.data();
+    for (uint32_t z = 0; z < result.depth; ++z) {
+        for (uint32_t y = 0; y < result.height; ++y) {
+            for (uint32_t x = 0; x < result.width; ++x) {
+                uint32_t sum[4] = {};
+                for (uint32_t dz = 0; dz < zTaps; ++dz) {
+                    for (uint32_t dy = 0; dy < 2; ++dy) {
+                        for (uint32_t dx = 0; dx < 2; ++dx) {
+                            const uint8_t* t = texel(x * 2 + dx, y * 2 + dy, z * zTaps + dz);
+                            for (int c = 0; c < 4; ++c) {
+                                sum[c] += t[c];
+                            }
+                        }
+                    }
+                }
+                for (int c = 0; c < 4; ++c) {
+                    *out++ = static_cast<uint8_t>((sum[c] + taps / 2) / taps);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+void AppendSubresource(const Image& image, std::vector<SubresourceRecord>& records, std::vector<uint8_t>& payload) {
+    SubresourceRecord record = {};
+    record.offset = AlignUp(payload.size(), TextureBake::kPlacementAlignment);
+    record.width = image.width;
+    record.height = image.height;
+    record.depth = image.depth;
+    record.rowPitch = static_cast<uint32_t>(AlignUp(static_cast<uint64_t>(image.width) * 4u, TextureBake::kRowPitchAlignment));
+
+    const size_t rowBytes = static_cast<size_t>(image.width) * 4u;
+    const size_t rows = static_cast<size_t>(image.height) * image.depth;
+    payload.resize(static_cast<size_t>(record.offset) + rows * record.rowPitch, 0);
+    for (size_t row = 0; row < rows; ++row) {
+        std::memcpy(payload.data() + record.offset + row * record.rowPitch, image.pixels.data() + row * rowBytes, rowBytes);
+    }
+    records.push_back(record);
+}
+
+} // namespace
+
+namespace TextureBake {
+
+uint32_t MipCount(uint32_t width, uint32_t height, uint32_t depth) {
+    uint32_t largest = (std::max)({width, height, depth, 1u});
+    uint32_t count = 1;
+    while (largest > 1) {
+        largest /= 2;
+        ++count;
+    }
+    return count;
+}
+
+bool Bake(const uint8_t* rgba, uint32_t width, uint32_t height, BakedTextureLayout layout,
+          std::vector<uint8_t>& outContainer, std::string& outError) {
+    outContainer.clear();
+    if (!rgba || width == 0 || height == 0) {
+        outError = "empty image";
+        return false;
+    }
+
+    // Each array slice starts as its own top-level image (volumes are a single slice).
+    std::vector<Image> slices;
+    uint32_t depthOrArraySize = 1;
+    bool volume = false;
+    if (layout == BakedTextureLayout::Texture2D) {
+        Image image;
+        image.width = width;
+        image.height = height;
+        image.pixels.assign(rgba, rgba + static_cast<size_t>(width) * height * 4u);
+        slices.push_back(std::move(image));
+    } else if (layout == BakedTextureLayout::TextureCube) {
+        if (width != height * 6) {
+            outError = "cube source must be a 6:1 strip of faces (got " + std::to_string(width) + "x" + std::to_string(height) + ")";
+            return false;
+        }
+        depthOrArraySize = 6;
+        for (uint32_t face = 0; face < 6; ++face) {
+            slices.push_back(CropTile(rgba, width, face, height));
+        }
+    } else {
+        if (width % height != 0) {
+            outError = "3D source must be a strip of square slices (got " + std::to_string(width) + "x" + std::to_string(height) + ")";
+            return false;
+        }
+        volume = true;
+        depthOrArraySize = width / height;
+        Image image;
+        image.width = height;
+        image.height = height;
+        image.depth = depthOrArraySize;
+        image.pixels.resize(static_cast<size_t>(height) * height * depthOrArraySize * 4u);
+        for (uint32_t z = 0; z < depthOrArraySize; ++z) {
+            const Image tile = CropTile(rgba, width, z, height);
+            std::memcpy(image.pixels.data() + static_cast<size_t>(z) * tile.pixels.size(), tile.pixels.data(), tile.pixels.size());
+        }
+        slices.push_back(std::move(image));
+    }
+
+    const Image& top = slices.front();
+    const uint32_t mipLevels = MipCount(top.width, top.height, volume ? top.depth : 1u);
+
+    std::vector<SubresourceRecord> records;
+    std::vector<uint8_t> payload;
+    for (const Image& slice : slices) {
+        Image level = slice;
+        AppendSubresource(level, records, payload);
+        for (uint32_t mip = 1; mip < mipLevels; ++mip) {
+            level = Downsample(level, volume);
+            AppendSubresource(level, records, payload);
+        }
+    }
+
+    ContainerHeader header = {};
+    std::memcpy(header.magic, kContainerMagic, sizeof(kContainerMagic));
+    header.version = kContainerVersion;
+    header.layout = static_cast<uint32_t>(layout);
+    header.format = kFormatRgba8Unorm;
+    header.width = top.width;
+    header.height = top.height;
+    header.depthOrArraySize = depthOrArraySize;
+    header.mipLevels = mipLevels;
+    header.subresourceCount = static_cast<uint32_t>(records.size());
+    header.payloadOffset = AlignUp(sizeof(header) + records.size() * sizeof(SubresourceRecord), 16);
+    header.payloadSize = payload.size();
+
+    outContainer.resize(static_cast<size_t>(header.payloadOffset + header.payloadSize), 0);
+    std::memcpy(outContainer.data(), &header, sizeof(header));
+    std::memcpy(outContainer.data() + sizeof(header), records.data(), records.size() * sizeof(SubresourceRecord));
+    std::memcpy(outContainer.data() + header.payloadOffset, payload.data(), payload.size());
+    return true;
+}
+
+bool Parse(std::span<const uint8_t> container, BakedTextureView& outView) {
+    outView = BakedTextureView{};
+    ContainerHeader header = {};
+    if (container.size() < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, container.data(), sizeof(header));
+    if (std::memcmp(header.magic, kContainerMagic, sizeof(kContainerMagic)) != 0 ||
+        header.version != kContainerVersion ||
+        header.format != kFormatRgba8Unorm ||
+        header.layout > static_cast<uint32_t>(BakedTextureLayout::Texture3D) ||
+        header.width == 0 || header.height == 0 || header.depthOrArraySize == 0 || header.mipLevels == 0) {
+        return false;
+    }
+    const bool cube = header.layout == static_cast<uint32_t>(BakedTextureLayout::TextureCube);
+    const bool volume = header.layout == static_cast<uint32_t>(BakedTextureLayout::Texture3D);
+    const uint32_t arraySlices = cube ? 6u : 1u;
+    const uint32_t depth = volume ? header.depthOrArraySize : 1u;
+    if ((cube ? header.depthOrArraySize != 6 || header.width != header.height : !volume && header.depthOrArraySize != 1) ||
+        header.mipLevels > TextureBake::MipCount(header.width, header.height, depth) ||
+        header.subresourceCount != header.mipLevels * arraySlices ||
+        header.payloadOffset < sizeof(header) + static_cast<uint64_t>(header.subresourceCount) * sizeof(SubresourceRecord) ||
+        header.payloadOffset > container.size() ||
+        header.payloadSize > container.size() - header.payloadOffset) {
+        return false;
+    }
+
+    outView.subresources.resize(header.subresourceCount);
+    for (uint32_t i = 0; i < header.subresourceCount; ++i) {
+        SubresourceRecord record = {};
+        std::memcpy(&record, container.data() + sizeof(header) + i * sizeof(SubresourceRecord), sizeof(record));
+        // Every subresource must be exactly the mip the header implies, laid out the way
+        // Bake writes it, so the upload can trust these fields for its copy footprints.
+        const uint32_t mip = i % header.mipLevels;
+        const uint64_t rowPitch = AlignUp(static_cast<uint64_t>((std::max)(1u, header.width >> mip)) * 4u, TextureBake::kRowPitchAlignment);
+        const uint64_t rows = static_cast<uint64_t>(record.height) * record.depth;
+        if (record.width != (std::max)(1u, header.width >> mip) ||
+            record.height != (std::max)(1u, header.height >> mip) ||
+            record.depth != (std::max)(1u, depth >> mip) ||
+            record.rowPitch != rowPitch ||
+            record.offset % TextureBake::kPlacementAlignment != 0 ||
+            record.offset > header.payloadSize ||
+            rows > (header.payloadSize - record.offset) / rowPitch) {
+            outView = BakedTextureView{};
+            return false;
+        }
+        outView.subresources[i] = {record.offset, record.width, record.height, record.depth, record.rowPitch};
+    }
+
+    outView.layout = static_cast<BakedTextureLayout>(header.layout);
+    outView.width = header.width;
+    outView.height = header.height;
+    outView.depthOrArraySize = header.depthOrArraySize;
+    outView.mipLevels = header.mipLevels;
+    outView.payload = container.subspan(static_cast<size_t>(header.payloadOffset), static_cast<size_t>(header.payloadSize));
+    return true;
+}
+
+} // namespace TextureBake
+
+} // namespace ShaderLab
@@ -9,12 +9,13 @@ CommandQueue::~CommandQueue() {
     Shutdown();
 }
 
-bool CommandQueue::Initialize(Device* device, D3D12_COMMAND_LIST_TYPE type) {
+bool CommandQueue::Initialize(Device* device, D3D12_COMMAND_LIST_TYPE type, uint32_t framesInFlight) {
     if (!device || !device->IsValid()) {
         return false;
     }
 
     ID3D12Device* d3dDevice = device->GetDevice();
+    m_frameRing.Reset(framesInFlight);
 
     // Create command queue
     D3D12_COMMAND_QUEUE_DESC queueDesc = {};
@@ -26,14 +27,16 @@ bool CommandQueue::Initialize(Device* device, D3D12_COMMAND_LIST_TYPE type) {
         return false;
     }
 
-    // Create command allocator
-    hr = d3dDevice->CreateCommandAllocator(type, IID_PPV_ARGS(&m_commandAllocator));
-    if (FAILED(hr)) {
-        return false;
+    // One allocator per frame slot; an allocator can only be reset once its frame has retired
+    for (uint32_t slot = 0; slot < m_frameRing.GetFramesInFlight(); ++slot) {
+        hr = d3dDevice->CreateCommandAllocator(type, IID_PPV_ARGS(&m_commandAllocators[slot]));
+        if (FAILED(hr)) {
+            return false;
+        }
     }
 
     // Create command list
-    hr = d3dDevice->CreateCommandList(0, type, m_commandAllocator.Get(), 
+    hr = d3dDevice->CreateCommandList(0, type, m_commandAllocators[0].Get(), 
                                       nullptr, IID_PPV_ARGS(&m_commandList));
     if (FAILED(hr)) {
         return false;
@@ -58,6 +61,8 @@ bool CommandQueue::Initialize(Device* device, D3D12_COMMAND_LIST_TYPE type) {
 
 void CommandQueue::Shutdown() {
     WaitForGPU();
+    m_retiredThisFrame.clear();
+    m_retired.Clear();
 
     if (m_fenceEvent) {
         CloseHandle(m_fenceEvent);
@@ -66,13 +71,27 @@ void CommandQueue::Shutdown() {
 
     m_fence.Reset();
     m_commandList.Reset();
-    m_commandAllocator.Reset();
+    for (auto& allocator : m_commandAllocators) {
+        allocator.Reset();
+    }
     m_queue.Reset();
 }
 
+void CommandQueue::BeginFrame() {
+    WaitForFenceValue(m_frameRing.GetSlotWaitValue());
+    m_retired.Collect(GetCompletedFenceValue());
+    m_frameBegun = true;
+}
+
 void CommandQueue::ResetCommandList() {
-    m_commandAllocator->Reset();
-    m_commandList->Reset(m_commandAllocator.Get(), nullptr);
+    // The slot's allocator may only be reset once its previous frame has retired.
+    if (!m_frameBegun) {
+        BeginFrame();
+    }
+
+    ID3D12CommandAllocator* allocator = m_commandAllocators[m_frameRing.GetCurrentSlot()].Get();
+    allocator->Reset();
+    m_commandList->Reset(allocator, nullptr);
 }
 
 void CommandQueue::ExecuteCommandList() {
@@ -82,13 +101,59 @@ void CommandQueue::ExecuteCommandList() {
     m_queue->ExecuteCommandLists(1, commandLists);
 }
 
+uint64_t CommandQueue::EndFrame() {
+    if (!m_queue || !m_fence) {
+        return 0;
+    }
+
+    const uint64_t fenceValue = SignalFence();
+    for (ComPtr<IUnknown>& object : m_retiredThisFrame) {
+        m_retired.Push(fenceValue, std::move(object));
+    }
+    m_retiredThisFrame.clear();
+    m_frameRing.EndFrame(fenceValue);
+    m_frameBegun = false;
+    m_retired.Collect(GetCompletedFenceValue());
+    return fenceValue;
+}
+
 void CommandQueue::WaitForGPU() {
     if (!m_queue || !m_fence) {
         return;
     }
 
+    const uint64_t fenceValue = SignalFence();
+    WaitForFenceValue(fenceValue);
+    m_retired.Collect(fenceValue);
+}
+
+uint64_t CommandQueue::SignalFence() {
     const uint64_t fenceValue = ++m_fenceValue;
     m_queue->Signal(m_fence.Get(), fenceValue);
+    return fenceValue;
+}
+
+uint64_t CommandQueue::GetCompletedFenceValue() const {
+    return m_fence ? m_fence->GetCompletedValue() : 0;
+}
+
+void CommandQueue::RetireWhenComplete(ComPtr<IUnknown> object) {
+    if (!object) {
+        return;
+    }
+    // Without a fence nothing can be in flight.
+    if (!m_fence) {
+        return;
+    }
+    // Tagged in EndFrame rather than with the next fence value: a WaitForGPU earlier in the
+    // frame signals too, and must not free what this frame's commands still reference.
+    m_retiredThisFrame.push_back(std::move(object));
+}
+
+void CommandQueue::WaitForFenceValue(uint64_t fenceValue) {
+    if (!m_fence || fenceValue == 0) {
+        return;
+    }
 
     if (m_fence->GetCompletedValue() < fenceValue) {
         m_fence->SetEventOnCompletion(fenceValue, m_fenceEvent);
@@ -96,10 +161,4 @@ void CommandQueue::WaitForGPU() {
     }
 }
 
-uint64_t CommandQueue::SignalFence() {
-    const uint64_t fenceValue = ++m_fenceValue;
-    m_queue->Signal(m_fence.Get(), fenceValue);
-    return fenceValue;
-}
-
 } // namespace ShaderLab
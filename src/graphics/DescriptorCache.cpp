@@ -0,0 +1,201 @@
+#include "ShaderLab/Graphics/DescriptorCache.h"
+
+#include <algorithm>
+
+namespace ShaderLab {
+
+void DescriptorCache::Initialize(IDescriptorWriter* writer, uint32_t stableCapacity, uint32_t ringCapacity) {
+    m_writer = writer;
+    m_stableCapacity = stableCapacity;
+    m_ringCapacity = ringCapacity;
+    Reset();
+}
+
+void DescriptorCache::Reset() {
+    if (m_writer && GetCapacity() > 0) {
+        m_writer->ReleaseDescriptors(0, GetCapacity());
+    }
+    m_tables.clear();
+    m_freeRanges.clear();
+    if (m_stableCapacity > 0) {
+        m_freeRanges.emplace_back(0u, m_stableCapacity);
+    }
+    m_ringHead = 0;
+    m_ringTail = 0;
+    m_ringFrames.clear();
+    m_framesInFlight = 1;
+    m_frameIndex = 1;
+    m_stats = {};
+    m_lastFrameStats = {};
+}
+
+void DescriptorCache::BeginFrame(uint32_t framesInFlight) {
+    m_ringFrames.emplace_back(m_frameIndex, m_ringHead);
+    m_stats.stableTables = static_cast<uint32_t>(m_tables.size());
+    m_stats.ringDescriptorsInUse = static_cast<uint32_t>(m_ringHead - m_ringTail);
+    m_lastFrameStats = m_stats;
+    m_stats = {};
+
+    ++m_frameIndex;
+    m_framesInFlight = (std::max)(1u, framesInFlight);
+    RetireRing();
+
+    for (auto it = m_tables.begin(); it != m_tables.end();) {
+        const Table& table = it->second;
+        if (m_frameIndex - table.lastUsedFrame > kMaxIdleFrames && !IsInFlight(table.lastUsedFrame)) {
+            const uint32_t count = static_cast<uint32_t>(table.bindings.size());
+            FreeStable(table.first, count);
+            m_writer->ReleaseDescriptors(table.first, count);
+            it = m_tables.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+uint32_t DescriptorCache::AcquireTable(uint64_t key, const DescriptorBinding* bindings, uint32_t count) {
+    if (!m_writer || !bindings || count == 0) {
+        return kInvalidIndex;
+    }
+
+    auto it = m_tables.find(key);
+    if (it != m_tables.end()) {
+        Table& table = it->second;
+        const bool sameSize = table.bindings.size() == count;
+        if (sameSize && std::equal(table.bindings.begin(), table.bindings.end(), bindings)) {
+            table.lastUsedFrame = m_frameIndex;
+            ++m_stats.tableHits;
+            return table.first;
+        }
+        if (IsInFlight(table.lastUsedFrame)) {
+            return AllocateDynamic(bindings, count);
+        }
+        if (sameSize) {
+            // Only the views that changed are rewritten.
+            for (uint32_t i = 0; i < count; ++i) {
+                if (table.bindings[i] != bindings[i]) {
+                    m_writer->WriteDescriptor(table.first + i, bindings[i]);
+                    table.bindings[i] = bindings[i];
+                    ++m_stats.descriptorWrites;
+                }
+            }
+            table.lastUsedFrame = m_frameIndex;
+            ++m_stats.tableMisses;
+            return table.first;
+        }
+        const uint32_t oldCount = static_cast<uint32_t>(table.bindings.size());
+        FreeStable(table.first, oldCount);
+        m_writer->ReleaseDescriptors(table.first, oldCount);
+        m_tables.erase(it);
+    }
+
+    const uint32_t first = AllocateStable(count);
+    if (first == kInvalidIndex) {
+        return AllocateDynamic(bindings, count);
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        m_writer->WriteDescriptor(first + i, bindings[i]);
+    }
+    m_stats.descriptorWrites += count;
+    ++m_stats.tableMisses;
+
+    Table& table = m_tables[key];
+    table.first = first;
+    table.lastUsedFrame = m_frameIndex;
+    table.bindings.assign(bindings, bindings + count);
+    return first;
+}
+
+uint32_t DescriptorCache::AllocateDynamic(const DescriptorBinding* bindings, uint32_t count) {
+    if (!m_writer || !bindings || count == 0) {
+        return kInvalidIndex;
+    }
+    const uint32_t first = AllocateRing(count);
+    if (first == kInvalidIndex) {
+        ++m_stats.failedTables;
+        return kInvalidIndex;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        m_writer->WriteDescriptor(first + i, bindings[i]);
+    }
+    m_stats.descriptorWrites += count;
+    ++m_stats.ringTables;
+    return first;
+}
+
+uint64_t DescriptorCache::MakeKey(const void* owner, uint32_t variant) {
+    uint64_t key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(owner)) ^ (static_cast<uint64_t>(variant) * 0x9E3779B97F4A7C15ull);
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDull;
+    key ^= key >> 33;
+    return key;
+}
+
+uint32_t DescriptorCache::AllocateStable(uint32_t count) {
+    for (auto it = m_freeRanges.begin(); it != m_freeRanges.end(); ++it) {
+        if (it->second < count) {
+            continue;
+        }
+        const uint32_t first = it->first;
+        it->first += count;
+        it->second -= count;
+        if (it->second == 0) {
+            m_freeRanges.erase(it);
+        }
+        return first;
+    }
+    return kInvalidIndex;
+}
+
+void DescriptorCache::FreeStable(uint32_t first, uint32_t count) {
+    auto it = std::lower_bound(m_freeRanges.begin(), m_freeRanges.end(), std::make_pair(first, 0u));
+    it = m_freeRanges.insert(it, std::make_pair(first, count));
+    // Merge with the following range, then with the preceding one.
+    auto next = it + 1;
+    if (next != m_freeRanges.end() && it->first + it->second == next->first) {
+        it->second += next->second;
+        m_freeRanges.erase(next);
+    }
+    if (it != m_freeRanges.begin()) {
+        auto prev = it - 1;
+        if (prev->first + prev->second == it->first) {
+            prev->second += it->second;
+            m_freeRanges.erase(it);
+        }
+    }
+}
+
+uint32_t DescriptorCache::AllocateRing(uint32_t count) {
+    if (count > m_ringCapacity) {
+        return kInvalidIndex;
+    }
+    // Tables must be contiguous, so a table that would straddle the end starts over at 0.
+    const uint64_t offset = m_ringHead % m_ringCapacity;
+    const uint64_t skip = (offset + count > m_ringCapacity) ? (m_ringCapacity - offset) : 0;
+    if (m_ringHead + skip + count - m_ringTail > m_ringCapacity) {
+        return kInvalidIndex;
+    }
+    m_ringHead += skip;
+    const uint32_t first = m_stableCapacity + static_cast<uint32_t>(m_ringHead % m_ringCapacity);
+    m_ringHead += count;
+    return first;
+}
+
+void DescriptorCache::RetireRing() {
+    while (!m_ringFrames.empty() && !IsInFlight(m_ringFrames.front().first)) {
+        ReleaseRingRange(m_ringTail, m_ringFrames.front().second);
+        m_ringTail = m_ringFrames.front().second;
+        m_ringFrames.pop_front();
+    }
+}
+
+void DescriptorCache::ReleaseRingRange(uint64_t begin, uint64_t end) {
+    while (begin < end) {
+        const uint64_t offset = begin % m_ringCapacity;
+        const uint64_t count = (std::min)(end - begin, m_ringCapacity - offset);
+        m_writer->ReleaseDescriptors(m_stableCapacity + static_cast<uint32_t>(offset), static_cast<uint32_t>(count));
+        begin += count;
+    }
+}
+
+} // namespace ShaderLab
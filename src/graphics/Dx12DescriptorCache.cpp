@@ -0,0 +1,124 @@
+#include "ShaderLab/Graphics/Dx12DescriptorCache.h"
+#include "ShaderLab/Graphics/Device.h"
+
+namespace ShaderLab {
+
+bool Dx12DescriptorCache::Initialize(Device* device, uint32_t stableDescriptors, uint32_t ringDescriptors) {
+    Shutdown();
+    if (!device || !device->GetDevice() || stableDescriptors + ringDescriptors == 0) {
+        return false;
+    }
+
+    D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
+    heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+    heapDesc.NumDescriptors = stableDescriptors + ringDescriptors;
+    heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+    if (FAILED(device->GetDevice()->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&m_heap)))) {
+        return false;
+    }
+
+    m_device = device->GetDevice();
+    m_cpuStart = m_heap->GetCPUDescriptorHandleForHeapStart();
+    m_gpuStart = m_heap->GetGPUDescriptorHandleForHeapStart();
+    m_step = m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    m_referenced.assign(heapDesc.NumDescriptors, nullptr);
+    m_cache.Initialize(this, stableDescriptors, ringDescriptors);
+    return true;
+}
+
+void Dx12DescriptorCache::Shutdown() {
+    m_cache.Initialize(nullptr, 0, 0);
+    m_referenced.clear();
+    m_heap.Reset();
+    m_device = nullptr;
+    m_step = 0;
+}
+
+bool Dx12DescriptorCache::AcquireTable(uint64_t key, const DescriptorBinding* bindings, uint32_t count, D3D12_GPU_DESCRIPTOR_HANDLE& outTable) {
+    const uint32_t first = m_cache.AcquireTable(key, bindings, count);
+    if (first == DescriptorCache::kInvalidIndex) {
+        return false;
+    }
+    outTable = GpuHandle(first);
+    return true;
+}
+
+bool Dx12DescriptorCache::AllocateDynamic(const DescriptorBinding* bindings, uint32_t count, D3D12_GPU_DESCRIPTOR_HANDLE& outTable) {
+    const uint32_t first = m_cache.AllocateDynamic(bindings, count);
+    if (first == DescriptorCache::kInvalidIndex) {
+        return false;
+    }
+    outTable = GpuHandle(first);
+    return true;
+}
+
+DescriptorBinding Dx12DescriptorCache::TextureView(ID3D12Resource* resource, DescriptorViewKind kind, DXGI_FORMAT format) {
+    DescriptorBinding binding;
+    binding.source = reinterpret_cast<uint64_t>(resource);
+    binding.detail = static_cast<uint32_t>(format);
+    binding.kind = kind;
+    return binding;
+}
+
+DescriptorBinding Dx12DescriptorCache::ConstantBufferView(ID3D12Resource* buffer, uint32_t sizeInBytes) {
+    DescriptorBinding binding;
+    binding.source = reinterpret_cast<uint64_t>(buffer);
+    binding.detail = sizeInBytes;
+    binding.kind = DescriptorViewKind::ConstantBuffer;
+    return binding;
+}
+
+void Dx12DescriptorCache::WriteDescriptor(uint32_t heapIndex, const DescriptorBinding& binding) {
+    if (!m_device || heapIndex >= m_referenced.size()) {
+        return;
+    }
+    D3D12_CPU_DESCRIPTOR_HANDLE dest = m_cpuStart;
+    dest.ptr += static_cast<SIZE_T>(m_step) * heapIndex;
+    ID3D12Resource* resource = reinterpret_cast<ID3D12Resource*>(binding.source);
+    m_referenced[heapIndex] = resource;
+
+    if (binding.kind == DescriptorViewKind::ConstantBuffer) {
+        D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = {};
+        cbvDesc.BufferLocation = resource ? resource->GetGPUVirtualAddress() : 0;
+        cbvDesc.SizeInBytes = resource ? binding.detail : 0;
+        m_device->CreateConstantBufferView(&cbvDesc, dest);
+        return;
+    }
+
+    if (binding.kind == DescriptorViewKind::RWTexture2D) {
+        D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
+        uavDesc.Format = static_cast<DXGI_FORMAT>(binding.detail);
+        uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
+        m_device->CreateUnorderedAccessView(resource, nullptr, &uavDesc, dest);
+        return;
+    }
+
+    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+    srvDesc.Format = static_cast<DXGI_FORMAT>(binding.detail);
+    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    if (binding.kind == DescriptorViewKind::TextureCube) {
+        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
+        srvDesc.TextureCube.MipLevels = 1;
+    } else if (binding.kind == DescriptorViewKind::Texture3D) {
+        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE3D;
+        srvDesc.Texture3D.MipLevels = 1;
+    } else {
+        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+        srvDesc.Texture2D.MipLevels = 1;
+    }
+    m_device->CreateShaderResourceView(resource, &srvDesc, dest);
+}
+
+void Dx12DescriptorCache::ReleaseDescriptors(uint32_t firstIndex, uint32_t count) {
+    for (uint32_t i = 0; i < count && firstIndex + i < m_referenced.size(); ++i) {
+        m_referenced[firstIndex + i].Reset();
+    }
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE Dx12DescriptorCache::GpuHandle(uint32_t heapIndex) const {
+    D3D12_GPU_DESCRIPTOR_HANDLE handle = m_gpuStart;
+    handle.ptr += static_cast<UINT64>(m_step) * heapIndex;
+    return handle;
+}
+
+} // namespace ShaderLab
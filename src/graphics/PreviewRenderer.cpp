@@ -1,4 +1,5 @@
 #include "ShaderLab/Graphics/PreviewRenderer.h"
+#include "ShaderLab/Graphics/CommandQueue.h"
 #include "ShaderLab/Graphics/Device.h"
 #include "ShaderLab/Shader/ShaderBase.h"
 #include "ShaderLab/Shader/ShaderBaseVertex.h"
@@ -18,6 +19,8 @@
 namespace ShaderLab {
 
 namespace {
+
+constexpr uint32_t kTimestampsPerFrame = 2; // Start and end
 #if !SHADERLAB_TINY_PLAYER
 std::string GetShaderLabLogPath() {
     char tempPath[MAX_PATH] = {};
@@ -92,12 +95,12 @@ bool PreviewRenderer::Initialize(Device* device, ShaderCompiler* compiler, DXGI_
 #if !SHADERLAB_TINY_PLAYER
     D3D12_QUERY_HEAP_DESC queryHeapDesc = {};
     queryHeapDesc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
-    queryHeapDesc.Count = 2; // Start and End
+    queryHeapDesc.Count = kTimestampsPerFrame * CommandQueue::kMaxFramesInFlight;
     m_device->GetDevice()->CreateQueryHeap(&queryHeapDesc, IID_PPV_ARGS(&m_queryHeap));
 
     D3D12_RESOURCE_DESC bufferDesc = {};
     bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-    bufferDesc.Width = sizeof(uint64_t) * 2;
+    bufferDesc.Width = sizeof(uint64_t) * kTimestampsPerFrame * CommandQueue::kMaxFramesInFlight;
     bufferDesc.Height = 1;
     bufferDesc.DepthOrArraySize = 1;
     bufferDesc.MipLevels = 1;
@@ -235,6 +238,39 @@ ComPtr<ID3D12PipelineState> PreviewRenderer::CreatePSOFromBytecode(const std::ve
     return nullptr;
 }
 
+void PreviewRenderer::BeginFrame(CommandQueue* queue) {
+#if !SHADERLAB_TINY_PLAYER
+    if (!queue || !m_queryResultBuffer) {
+        return;
+    }
+    if (m_gpuFrequency == 0 && queue->GetQueue()) {
+        queue->GetQueue()->GetTimestampFrequency(&m_gpuFrequency);
+    }
+
+    // The queue just waited for this slot's previous frame, so its region is resolved and the
+    // GPU is not writing it; the other slots may still be in flight.
+    m_queryFrameSlot = queue->GetFrameSlot();
+    if (m_gpuFrequency == 0) {
+        return;
+    }
+    const size_t firstByte = sizeof(uint64_t) * kTimestampsPerFrame * m_queryFrameSlot;
+    const D3D12_RANGE readRange = { firstByte, firstByte + sizeof(uint64_t) * kTimestampsPerFrame };
+    uint8_t* mapped = nullptr;
+    if (SUCCEEDED(m_queryResultBuffer->Map(0, &readRange, reinterpret_cast<void**>(&mapped)))) {
+        const uint64_t* times = reinterpret_cast<const uint64_t*>(mapped + firstByte);
+        const uint64_t start = times[0];
+        const uint64_t end = times[1];
+        if (end > start) {
+            m_lastGPUTimeMs = (float)(end - start) / (float)m_gpuFrequency * 1000.0f;
+        }
+        const D3D12_RANGE writtenRange = { 0, 0 };
+        m_queryResultBuffer->Unmap(0, &writtenRange);
+    }
+#else
+    (void)queue;
+#endif
+}
+
 void PreviewRenderer::Render(ID3D12GraphicsCommandList* commandList,
                               ID3D12PipelineState* pipelineState,
                               ID3D12Resource* renderTarget,
@@ -251,27 +287,9 @@ void PreviewRenderer::Render(ID3D12GraphicsCommandList* commandList,
         return;
     }
 
-    // Readback previous frame timestamps if permitted
-    // NOTE: This causes CPU stall if we do it for the CURRENT frame which we don't here.
-    // If we have a ring buffer of queries, no stall. With single buffer, we might read old data or stall?
-    // Doing simple blocking read for now for simplicity as this is a tool.
-    // Ideally we'd buffer N frames.
 #if !SHADERLAB_TINY_PLAYER
-    if (m_queryResultBuffer && m_gpuFrequency > 0) {
-        uint64_t* times = nullptr;
-        D3D12_RANGE readRange = { 0, sizeof(uint64_t) * 2 };
-        if (SUCCEEDED(m_queryResultBuffer->Map(0, &readRange, (void**)&times))) {
-            uint64_t start = times[0];
-            uint64_t end = times[1];
-            if (end > start) {
-                m_lastGPUTimeMs = (float)(end - start) / (float)m_gpuFrequency * 1000.0f;
-            }
-            m_queryResultBuffer->Unmap(0, nullptr);
-        }
-    }
-
     if (m_queryHeap) {
-        commandList->EndQuery(m_queryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, 0);
+        commandList->EndQuery(m_queryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, m_queryFrameSlot * kTimestampsPerFrame);
     }
 #endif
 
@@ -322,8 +340,10 @@ void PreviewRenderer::Render(ID3D12GraphicsCommandList* commandList,
     commandList->DrawInstanced(3, 1, 0, 0);
 #if !SHADERLAB_TINY_PLAYER
     if (m_queryHeap && m_queryResultBuffer) {
-        commandList->EndQuery(m_queryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, 1);
-        commandList->ResolveQueryData(m_queryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, 0, 2, m_queryResultBuffer.Get(), 0);
+        const uint32_t firstQuery = m_queryFrameSlot * kTimestampsPerFrame;
+        commandList->EndQuery(m_queryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, firstQuery + 1);
+        commandList->ResolveQueryData(m_queryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, firstQuery, kTimestampsPerFrame,
+                                      m_queryResultBuffer.Get(), sizeof(uint64_t) * firstQuery);
     }
 #endif
 }
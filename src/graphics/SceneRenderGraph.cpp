@@ -0,0 +1,127 @@
+#include "ShaderLab/Graphics/SceneRenderGraph.h"
+
+#include <algorithm>
+
+namespace ShaderLab {
+
+namespace {
+enum VisitState : uint8_t {
+    Unvisited = 0,
+    OnPath,
+    Done
+};
+
+bool IsValidScene(const std::vector<std::vector<int>>& dependencies, int index) {
+    return index >= 0 && index < static_cast<int>(dependencies.size());
+}
+}
+
+bool SceneRenderGraph::Sync(const std::vector<std::vector<int>>& dependencies) {
+    if (m_built && dependencies == m_dependencies) {
+        return false;
+    }
+
+    m_dependencies = dependencies;
+    m_schedules.clear();
+    m_renderedTime.assign(m_dependencies.size(), 0.0);
+    m_renderedThisFrame.assign(m_dependencies.size(), 0);
+    FindCycleEdges();
+    m_stats.cycleEdges = static_cast<uint32_t>(m_cycleEdges.size());
+    ++m_stats.graphRebuilds;
+    m_built = true;
+    return true;
+}
+
+void SceneRenderGraph::FindCycleEdges() {
+    m_cycleEdges.clear();
+    std::vector<uint8_t> state(m_dependencies.size(), Unvisited);
+    // Iterative DFS; frames are (scene, next dependency slot).
+    std::vector<std::pair<int, size_t>> stack;
+    for (int start = 0; start < static_cast<int>(m_dependencies.size()); ++start) {
+        if (state[start] != Unvisited) {
+            continue;
+        }
+        state[start] = OnPath;
+        stack.emplace_back(start, 0);
+        while (!stack.empty()) {
+            auto& frame = stack.back();
+            const auto& deps = m_dependencies[frame.first];
+            if (frame.second >= deps.size()) {
+                state[frame.first] = Done;
+                stack.pop_back();
+                continue;
+            }
+            const int dep = deps[frame.second++];
+            if (!IsValidScene(m_dependencies, dep)) {
+                continue;
+            }
+            if (state[dep] == OnPath) {
+                m_cycleEdges.emplace_back(frame.first, dep);
+            } else if (state[dep] == Unvisited) {
+                state[dep] = OnPath;
+                stack.emplace_back(dep, 0);
+            }
+        }
+    }
+}
+
+const std::vector<int>& SceneRenderGraph::GetSchedule(int root) {
+    auto cached = m_schedules.find(root);
+    if (cached != m_schedules.end()) {
+        return cached->second;
+    }
+
+    std::vector<int>& schedule = m_schedules[root];
+    if (!IsValidScene(m_dependencies, root)) {
+        return schedule;
+    }
+
+    // Post-order DFS from root. Unlike the cycle search this is per root, because which
+    // edge of a cycle gets dropped depends on where the walk enters it.
+    std::vector<uint8_t> state(m_dependencies.size(), Unvisited);
+    std::vector<std::pair<int, size_t>> stack;
+    state[root] = OnPath;
+    stack.emplace_back(root, 0);
+    while (!stack.empty()) {
+        auto& frame = stack.back();
+        const auto& deps = m_dependencies[frame.first];
+        if (frame.second >= deps.size()) {
+            state[frame.first] = Done;
+            schedule.push_back(frame.first);
+            stack.pop_back();
+            continue;
+        }
+        const int dep = deps[frame.second++];
+        if (IsValidScene(m_dependencies, dep) && state[dep] == Unvisited) {
+            state[dep] = OnPath;
+            stack.emplace_back(dep, 0);
+        }
+    }
+    return schedule;
+}
+
+void SceneRenderGraph::BeginFrame() {
+    m_lastFrameStats = m_stats;
+    m_stats.passesRequested = 0;
+    m_stats.passesRendered = 0;
+    m_stats.passesSkipped = 0;
+    std::fill(m_renderedThisFrame.begin(), m_renderedThisFrame.end(), static_cast<uint8_t>(0));
+}
+
+bool SceneRenderGraph::BeginPass(int sceneIndex, double time) {
+    ++m_stats.passesRequested;
+    if (!IsValidScene(m_dependencies, sceneIndex)) {
+        ++m_stats.passesRendered;
+        return true;
+    }
+    if (m_renderedThisFrame[sceneIndex] && m_renderedTime[sceneIndex] == time) {
+        ++m_stats.passesSkipped;
+        return false;
+    }
+    m_renderedThisFrame[sceneIndex] = 1;
+    m_renderedTime[sceneIndex] = time;
+    ++m_stats.passesRendered;
+    return true;
+}
+
+} // namespace ShaderLab
@@ -0,0 +1,348 @@
+#include "ShaderLab/Graphics/TextureUploadQueue.h"
+#include "ShaderLab/Graphics/Device.h"
+#include "ShaderLab/Graphics/Dx12ResourceService.h"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace ShaderLab {
+
+TextureUploadQueue::~TextureUploadQueue() {
+    Shutdown();
+}
+
+bool TextureUploadQueue::Initialize(Device* device, uint64_t stagingBytes) {
+    Shutdown();
+    if (!device || !device->IsValid() || stagingBytes == 0) {
+        return false;
+    }
+    ID3D12Device* d3dDevice = device->GetDevice();
+
+    D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+    queueDesc.Type = D3D12_COMMAND_LIST_TYPE_COPY;
+    queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+    if (FAILED(d3dDevice->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&m_queue)))) {
+        return false;
+    }
+
+    if (FAILED(d3dDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_fence)))) {
+        Shutdown();
+        return false;
+    }
+    m_fenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    if (!m_fenceEvent) {
+        Shutdown();
+        return false;
+    }
+
+    Dx12ResourceService resourceService(d3dDevice);
+    ResourceBufferAllocationRequest stagingRequest{};
+    stagingRequest.sizeBytes = stagingBytes;
+    stagingRequest.heapType = D3D12_HEAP_TYPE_UPLOAD;
+    stagingRequest.initialState = D3D12_RESOURCE_STATE_GENERIC_READ;
+    if (!resourceService.AllocateBuffer(stagingRequest, m_staging) ||
+        FAILED(m_staging->Map(0, nullptr, reinterpret_cast<void**>(&m_stagingMapped)))) {
+        Shutdown();
+        return false;
+    }
+
+    m_device = device;
+    m_ring.Reset(stagingBytes);
+    return true;
+}
+
+void TextureUploadQueue::Shutdown() {
+    if (m_queue && m_fence) {
+        if (m_recording) {
+            m_commandList->Close();
+            m_recording = false;
+        }
+        if (!m_inFlight.empty()) {
+            WaitForFenceValue(m_inFlight.back().fenceValue);
+        }
+    }
+    m_inFlight.clear();
+    m_open = Batch{};
+    m_freeAllocators.clear();
+    m_commandList.Reset();
+
+    if (m_staging && m_stagingMapped) {
+        m_staging->Unmap(0, nullptr);
+    }
+    m_stagingMapped = nullptr;
+    m_staging.Reset();
+    m_ring.Reset(0);
+
+    if (m_fenceEvent) {
+        CloseHandle(m_fenceEvent);
+        m_fenceEvent = nullptr;
+    }
+    m_fence.Reset();
+    m_queue.Reset();
+    m_fenceValue = 0;
+    m_device = nullptr;
+}
+
+bool TextureUploadQueue::QueueTexture2D(const void* rgba, uint32_t width, uint32_t height,
+                                        ComPtr<ID3D12Resource>& outTexture, ReadyCallback onReady) {
+    outTexture.Reset();
+    if (!IsInitialized() || !rgba || width == 0 || height == 0) {
+        return false;
+    }
+    ID3D12Device* device = m_device->GetDevice();
+    Dx12ResourceService resourceService(device);
+
+    TextureAllocationRequest textureRequest{};
+    textureRequest.width = width;
+    textureRequest.height = height;
+    textureRequest.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    textureRequest.initialState = D3D12_RESOURCE_STATE_COMMON;
+    if (!resourceService.AllocateTexture2D(textureRequest, outTexture)) {
+        return false;
+    }
+
+    const D3D12_RESOURCE_DESC texDesc = outTexture->GetDesc();
+    D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint = {};
+    UINT numRows = 0;
+    UINT64 rowSizeInBytes = 0;
+    UINT64 totalBytes = 0;
+    device->GetCopyableFootprints(&texDesc, 0, 1, 0, &footprint, &numRows, &rowSizeInBytes, &totalBytes);
+
+    ID3D12Resource* source = nullptr;
+    uint8_t* destination = nullptr;
+    uint64_t baseOffset = 0;
+    if (!AcquireStaging(totalBytes, source, destination, baseOffset)) {
+        outTexture.Reset();
+        return false;
+    }
+    footprint.Offset = baseOffset;
+
+    const uint8_t* srcData = static_cast<const uint8_t*>(rgba);
+    const size_t srcPitch = static_cast<size_t>(width) * 4;
+    for (UINT row = 0; row < numRows; ++row) {
+        std::memcpy(destination + footprint.Footprint.RowPitch * row, srcData + srcPitch * row, srcPitch);
+    }
+    return RecordTextureCopies(source, outTexture, &footprint, 1, totalBytes, std::move(onReady));
+}
+
+bool TextureUploadQueue::QueueBakedTexture(const BakedTextureView& baked,
+                                           ComPtr<ID3D12Resource>& outTexture, ReadyCallback onReady) {
+    static_assert(TextureBake::kRowPitchAlignment == D3D12_TEXTURE_DATA_PITCH_ALIGNMENT, "Baked row pitch must match D3D12 copy rules");
+    static_assert(TextureBake::kPlacementAlignment == D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, "Baked placement must match D3D12 copy rules");
+
+    outTexture.Reset();
+    if (!IsInitialized() || baked.payload.empty() || baked.subresources.empty()) {
+        return false;
+    }
+    Dx12ResourceService resourceService(m_device->GetDevice());
+
+    TextureResourceAllocationRequest textureRequest{};
+    textureRequest.dimension = baked.layout == BakedTextureLayout::Texture3D
+        ? D3D12_RESOURCE_DIMENSION_TEXTURE3D
+        : D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+    textureRequest.width = baked.width;
+    textureRequest.height = baked.height;
+    textureRequest.depthOrArraySize = static_cast<uint16_t>(baked.depthOrArraySize);
+    textureRequest.mipLevels = static_cast<uint16_t>(baked.mipLevels);
+    textureRequest.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    textureRequest.initialState = D3D12_RESOURCE_STATE_COMMON;
+    if (!resourceService.AllocateTexture(textureRequest, outTexture)) {
+        return false;
+    }
+
+    ID3D12Resource* source = nullptr;
+    uint8_t* destination = nullptr;
+    uint64_t baseOffset = 0;
+    if (!AcquireStaging(baked.payload.size(), source, destination, baseOffset)) {
+        outTexture.Reset();
+        return false;
+    }
+    std::memcpy(destination, baked.payload.data(), baked.payload.size());
+
+    std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> footprints(baked.subresources.size());
+    for (size_t i = 0; i < footprints.size(); ++i) {
+        const BakedSubresource& subresource = baked.subresources[i];
+        footprints[i].Offset = baseOffset + subresource.offset;
+        footprints[i].Footprint.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+        footprints[i].Footprint.Width = subresource.width;
+        footprints[i].Footprint.Height = subresource.height;
+        footprints[i].Footprint.Depth = subresource.depth;
+        footprints[i].Footprint.RowPitch = subresource.rowPitch;
+    }
+    return RecordTextureCopies(source, outTexture, footprints.data(), static_cast<uint32_t>(footprints.size()),
+                               baked.payload.size(), std::move(onReady));
+}
+
+bool TextureUploadQueue::AcquireStaging(uint64_t size, ID3D12Resource*& outSource, uint8_t*& outDestination, uint64_t& outBaseOffset) {
+    if (size > m_ring.GetCapacity()) {
+        // Larger than the whole ring: a one-off upload buffer that retires with this batch.
+        Dx12ResourceService resourceService(m_device->GetDevice());
+        ComPtr<ID3D12Resource> dedicated;
+        ResourceBufferAllocationRequest uploadRequest{};
+        uploadRequest.sizeBytes = size;
+        uploadRequest.heapType = D3D12_HEAP_TYPE_UPLOAD;
+        uploadRequest.initialState = D3D12_RESOURCE_STATE_GENERIC_READ;
+        if (!resourceService.AllocateBuffer(uploadRequest, dedicated) ||
+            FAILED(dedicated->Map(0, nullptr, reinterpret_cast<void**>(&outDestination)))) {
+            return false;
+        }
+        outSource = dedicated.Get();
+        outBaseOffset = 0;
+        m_open.dedicatedBuffers.push_back(dedicated);
+        ++m_stats.dedicatedUploads;
+        return true;
+    }
+
+    const uint64_t offset = AllocateStaging(size);
+    if (offset == UploadRingAllocator::kInvalidOffset) {
+        return false;
+    }
+    outSource = m_staging.Get();
+    outDestination = m_stagingMapped + offset;
+    outBaseOffset = offset;
+    return true;
+}
+
+bool TextureUploadQueue::RecordTextureCopies(ID3D12Resource* source, ComPtr<ID3D12Resource>& texture,
+                                             const D3D12_PLACED_SUBRESOURCE_FOOTPRINT* footprints, uint32_t count,
+                                             uint64_t stagedBytes, ReadyCallback onReady) {
+    if (source != m_staging.Get()) {
+        source->Unmap(0, nullptr);
+    }
+
+    if (!EnsureRecording()) {
+        // The staged bytes will never be read; tag them with a fence that has already been signalled.
+        m_ring.Submit(m_fenceValue);
+        m_open.dedicatedBuffers.clear();
+        texture.Reset();
+        return false;
+    }
+
+    for (uint32_t i = 0; i < count; ++i) {
+        D3D12_TEXTURE_COPY_LOCATION dst = {};
+        dst.pResource = texture.Get();
+        dst.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+        dst.SubresourceIndex = i;
+
+        D3D12_TEXTURE_COPY_LOCATION src = {};
+        src.pResource = source;
+        src.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+        src.PlacedFootprint = footprints[i];
+        m_commandList->CopyTextureRegion(&dst, 0, 0, 0, &src, nullptr);
+    }
+
+    m_open.uploads.push_back({texture, std::move(onReady)});
+    m_stats.bytesStaged += stagedBytes;
+    ++m_stats.texturesUploaded;
+    return true;
+}
+
+uint64_t TextureUploadQueue::Submit() {
+    if (!m_recording) {
+        return 0;
+    }
+    m_recording = false;
+    if (FAILED(m_commandList->Close())) {
+        // Nothing reached the GPU; the batch is dropped and its callbacks never run.
+        m_freeAllocators.push_back(std::move(m_open.allocator));
+        m_open = Batch{};
+        m_ring.Submit(m_fenceValue);
+        return 0;
+    }
+
+    ID3D12CommandList* lists[] = { m_commandList.Get() };
+    m_queue->ExecuteCommandLists(1, lists);
+    ++m_fenceValue;
+    m_queue->Signal(m_fence.Get(), m_fenceValue);
+
+    m_ring.Submit(m_fenceValue);
+    m_open.fenceValue = m_fenceValue;
+    m_inFlight.push_back(std::move(m_open));
+    m_open = Batch{};
+    ++m_stats.submissions;
+    return m_fenceValue;
+}
+
+void TextureUploadQueue::Poll() {
+    if (!IsInitialized()) {
+        return;
+    }
+    const uint64_t completed = m_fence->GetCompletedValue();
+    m_ring.Retire(completed);
+    while (!m_inFlight.empty() && m_inFlight.front().fenceValue <= completed) {
+        Batch batch = std::move(m_inFlight.front());
+        m_inFlight.pop_front();
+        m_freeAllocators.push_back(std::move(batch.allocator));
+        for (auto& upload : batch.uploads) {
+            if (upload.onReady) {
+                upload.onReady(upload.texture.Get());
+            }
+        }
+    }
+}
+
+void TextureUploadQueue::Flush() {
+    if (!IsInitialized()) {
+        return;
+    }
+    Submit();
+    if (!m_inFlight.empty()) {
+        WaitForFenceValue(m_inFlight.back().fenceValue);
+    }
+    Poll();
+}
+
+bool TextureUploadQueue::EnsureRecording() {
+    if (m_recording) {
+        return true;
+    }
+    ID3D12Device* device = m_device->GetDevice();
+
+    ComPtr<ID3D12CommandAllocator> allocator;
+    if (!m_freeAllocators.empty()) {
+        allocator = std::move(m_freeAllocators.back());
+        m_freeAllocators.pop_back();
+        allocator->Reset();
+    } else if (FAILED(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, IID_PPV_ARGS(&allocator)))) {
+        return false;
+    }
+
+    if (!m_commandList) {
+        if (FAILED(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_COPY, allocator.Get(), nullptr, IID_PPV_ARGS(&m_commandList)))) {
+            return false;
+        }
+    } else if (FAILED(m_commandList->Reset(allocator.Get(), nullptr))) {
+        return false;
+    }
+
+    m_open.allocator = std::move(allocator);
+    m_recording = true;
+    return true;
+}
+
+uint64_t TextureUploadQueue::AllocateStaging(uint64_t size) {
+    uint64_t offset = m_ring.Allocate(size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+    while (offset == UploadRingAllocator::kInvalidOffset) {
+        // Out of staging space: send what is recorded, then wait for the oldest copy to land.
+        Submit();
+        if (m_inFlight.empty()) {
+            return UploadRingAllocator::kInvalidOffset;
+        }
+        ++m_stats.stagingStalls;
+        WaitForFenceValue(m_ring.GetOldestFenceValue());
+        Poll();
+        offset = m_ring.Allocate(size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+    }
+    return offset;
+}
+
+void TextureUploadQueue::WaitForFenceValue(uint64_t fenceValue) {
+    if (fenceValue == 0 || m_fence->GetCompletedValue() >= fenceValue) {
+        return;
+    }
+    m_fence->SetEventOnCompletion(fenceValue, m_fenceEvent);
+    WaitForSingleObject(m_fenceEvent, INFINITE);
+}
+
+} // namespace ShaderLab
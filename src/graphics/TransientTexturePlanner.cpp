@@ -0,0 +1,54 @@
+#include "ShaderLab/Graphics/TransientTexturePlanner.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace ShaderLab {
+
+TransientTexturePlan PlanTransientTextures(const std::vector<TransientTextureRequest>& requests) {
+    TransientTexturePlan plan;
+    plan.slotOfRequest.assign(requests.size(), 0);
+
+    std::vector<uint32_t> order(requests.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return requests[a].firstPass < requests[b].firstPass;
+    });
+
+    // Last pass of the current occupant of each slot.
+    std::vector<uint32_t> slotBusyUntil;
+    for (uint32_t requestIndex : order) {
+        const auto& request = requests[requestIndex];
+        plan.naiveBytes += request.bytes;
+
+        // Reuse the compatible slot that has been free the longest.
+        int bestSlot = -1;
+        for (size_t slot = 0; slot < plan.slotKeys.size(); ++slot) {
+            if (plan.slotKeys[slot] != request.key || slotBusyUntil[slot] >= request.firstPass) {
+                continue;
+            }
+            if (bestSlot < 0 || slotBusyUntil[slot] < slotBusyUntil[static_cast<size_t>(bestSlot)]) {
+                bestSlot = static_cast<int>(slot);
+            }
+        }
+
+        if (bestSlot < 0) {
+            bestSlot = static_cast<int>(plan.slotKeys.size());
+            plan.slotKeys.push_back(request.key);
+            plan.slotBytes.push_back(0);
+            slotBusyUntil.push_back(0);
+        }
+
+        const size_t slot = static_cast<size_t>(bestSlot);
+        plan.slotOfRequest[requestIndex] = static_cast<uint32_t>(slot);
+        plan.slotBytes[slot] = (std::max)(plan.slotBytes[slot], request.bytes);
+        slotBusyUntil[slot] = (std::max)(request.firstPass, request.lastPass);
+    }
+
+    for (uint64_t bytes : plan.slotBytes) {
+        plan.pooledBytes += bytes;
+    }
+    return plan;
+}
+
+} // namespace ShaderLab
@@ -0,0 +1,106 @@
+#include "ShaderLab/Graphics/TransientTexturePool.h"
+#include "ShaderLab/Graphics/CommandQueue.h"
+#include "ShaderLab/Graphics/Device.h"
+
+#include <utility>
+
+namespace ShaderLab {
+
+void TransientTexturePool::Shutdown() {
+    m_entries.clear();
+    m_allocatedBytes = 0;
+    m_device = nullptr;
+}
+
+ID3D12Resource* TransientTexturePool::Acquire(uint32_t width, uint32_t height, DXGI_FORMAT format, D3D12_RESOURCE_FLAGS flags) {
+    if (!m_device || !m_device->GetDevice() || width == 0 || height == 0) {
+        return nullptr;
+    }
+
+    TransientTextureKey key;
+    key.width = width;
+    key.height = height;
+    key.format = static_cast<uint32_t>(format);
+    key.flags = static_cast<uint32_t>(flags);
+
+    for (auto& entry : m_entries) {
+        if (!entry.inUse && entry.key == key) {
+            entry.inUse = true;
+            entry.lastUsedFrame = m_frameIndex;
+            return entry.texture.Get();
+        }
+    }
+
+    D3D12_HEAP_PROPERTIES heapProps = { D3D12_HEAP_TYPE_DEFAULT };
+    D3D12_RESOURCE_DESC texDesc = {};
+    texDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+    texDesc.Width = width;
+    texDesc.Height = height;
+    texDesc.DepthOrArraySize = 1;
+    texDesc.MipLevels = 1;
+    texDesc.Format = format;
+    texDesc.SampleDesc.Count = 1;
+    texDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+    texDesc.Flags = flags;
+
+    D3D12_CLEAR_VALUE clearValue = {};
+    clearValue.Format = format;
+    clearValue.Color[3] = 1.0f;
+    const bool isRenderTarget = (flags & D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET) != 0;
+
+    ID3D12Device* device = m_device->GetDevice();
+    Entry entry;
+    if (FAILED(device->CreateCommittedResource(
+            &heapProps, D3D12_HEAP_FLAG_NONE, &texDesc,
+            D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+            isRenderTarget ? &clearValue : nullptr,
+            IID_PPV_ARGS(&entry.texture)))) {
+        return nullptr;
+    }
+
+    entry.key = key;
+    entry.bytes = device->GetResourceAllocationInfo(0, 1, &texDesc).SizeInBytes;
+    entry.lastUsedFrame = m_frameIndex;
+    entry.inUse = true;
+    m_allocatedBytes += entry.bytes;
+    if (m_allocatedBytes > m_peakAllocatedBytes) {
+        m_peakAllocatedBytes = m_allocatedBytes;
+    }
+    m_entries.push_back(std::move(entry));
+    return m_entries.back().texture.Get();
+}
+
+bool TransientTexturePool::Release(ID3D12Resource* texture) {
+    if (!texture) {
+        return false;
+    }
+    for (auto& entry : m_entries) {
+        if (entry.texture.Get() == texture) {
+            entry.inUse = false;
+            return true;
+        }
+    }
+    return false;
+}
+
+void TransientTexturePool::BeginFrame(CommandQueue* queue) {
+    ++m_frameIndex;
+    size_t kept = 0;
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        Entry& entry = m_entries[i];
+        entry.inUse = false;
+        // Without a queue to retire through, keep the texture rather than free it blind.
+        if (queue && m_frameIndex - entry.lastUsedFrame > kMaxIdleFrames) {
+            m_allocatedBytes -= entry.bytes;
+            queue->RetireWhenComplete(std::move(entry.texture));
+            continue;
+        }
+        if (kept != i) {
+            m_entries[kept] = std::move(entry);
+        }
+        ++kept;
+    }
+    m_entries.resize(kept);
+}
+
+} // namespace ShaderLab
@@ -0,0 +1,59 @@
+#include "ShaderLab/Graphics/UploadRingAllocator.h"
+
+namespace ShaderLab {
+
+void UploadRingAllocator::Reset(uint64_t capacity) {
+    m_capacity = capacity;
+    m_head = 0;
+    m_tail = 0;
+    m_submittedHead = 0;
+    m_submissions.clear();
+}
+
+uint64_t UploadRingAllocator::Allocate(uint64_t size, uint64_t alignment) {
+    if (size == 0 || size > m_capacity) {
+        return kInvalidOffset;
+    }
+    if (alignment == 0) {
+        alignment = 1;
+    }
+
+    // Align the buffer offset, not the position: the capacity need not be a multiple of
+    // the alignment, so an aligned position can map to an unaligned offset after a wrap.
+    const uint64_t headOffset = m_head % m_capacity;
+    uint64_t offset = (headOffset + alignment - 1) & ~(alignment - 1);
+    uint64_t position = m_head + (offset - headOffset);
+    if (offset + size > m_capacity) {
+        // Ranges are contiguous, so one that would straddle the end restarts at offset 0.
+        position = m_head + (m_capacity - headOffset);
+        offset = 0;
+    }
+    if (position + size - m_tail > m_capacity) {
+        return kInvalidOffset;
+    }
+    m_head = position + size;
+    return offset;
+}
+
+void UploadRingAllocator::Submit(uint64_t fenceValue) {
+    if (!HasPendingAllocations()) {
+        return;
+    }
+    m_submissions.emplace_back(fenceValue, m_head);
+    m_submittedHead = m_head;
+}
+
+void UploadRingAllocator::Retire(uint64_t completedFenceValue) {
+    while (!m_submissions.empty() && m_submissions.front().first <= completedFenceValue) {
+        m_tail = m_submissions.front().second;
+        m_submissions.pop_front();
+    }
+    if (m_submissions.empty() && !HasPendingAllocations()) {
+        // Idle: start over at offset 0 so the next batch gets the whole buffer contiguously.
+        m_head = 0;
+        m_tail = 0;
+        m_submittedHead = 0;
+    }
+}
+
+} // namespace ShaderLab
@@ -80,6 +80,25 @@ bool ShaderCompiler::Initialize() {
         return false;
     }
 
+    m_versionString = "dxc";
+    ComPtr<IDxcVersionInfo> versionInfo;
+    if (SUCCEEDED(m_compiler.As(&versionInfo))) {
+        UINT32 major = 0;
+        UINT32 minor = 0;
+        if (SUCCEEDED(versionInfo->GetVersion(&major, &minor))) {
+            m_versionString += " " + std::to_string(major) + "." + std::to_string(minor);
+        }
+        ComPtr<IDxcVersionInfo2> versionInfo2;
+        if (SUCCEEDED(versionInfo.As(&versionInfo2))) {
+            UINT32 commitCount = 0;
+            char* commitHash = nullptr;
+            if (SUCCEEDED(versionInfo2->GetCommitInfo(&commitCount, &commitHash)) && commitHash) {
+                m_versionString += " (" + std::to_string(commitCount) + ", " + commitHash + ")";
+                CoTaskMemFree(commitHash);
+            }
+        }
+    }
+
     return true;
 #else
     return false;
@@ -87,6 +106,7 @@ bool ShaderCompiler::Initialize() {
 }
 
 void ShaderCompiler::Shutdown() {
+    m_versionString.clear();
     m_includeHandler.Reset();
     m_compiler.Reset();
     m_utils.Reset();
@@ -432,6 +452,21 @@ void ShaderCompiler::ParseDiagnostics(IDxcBlobEncoding* errorBlob,
     }
 }
 
+std::string ShaderCompiler::GetCompileArgumentsText(ShaderCompileMode mode) {
+    std::string text;
+    const std::vector<std::wstring> args = GetCompileArguments(mode);
+    for (size_t i = 0; i < args.size(); ++i) {
+        if (i > 0 && (args[i - 1] == L"-E" || args[i - 1] == L"-T")) {
+            continue;
+        }
+        if (!text.empty()) {
+            text.push_back(' ');
+        }
+        text += WideToUtf8(args[i]);
+    }
+    return text;
+}
+
 std::vector<std::wstring> ShaderCompiler::GetCompileArguments(ShaderCompileMode mode) {
     std::vector<std::wstring> args;
 
@@ -108,8 +108,8 @@ void ShaderLabIDE::EnsureAboutScene(uint32_t width, uint32_t height) {
 
     if (needsCreate) {
         Dx12ResourceService resourceService(m_deviceRef->GetDevice());
-        m_aboutScene.texture.Reset();
-        m_aboutScene.srvHeap.Reset();
+        RetireGpuObject(std::move(m_aboutScene.texture));
+        RetireGpuObject(std::move(m_aboutScene.srvHeap));
         m_aboutScene.textureValid = false;
 
         TextureAllocationRequest textureRequest{};
@@ -191,8 +191,9 @@ void ShaderLabIDE::RenderAboutLogo(ID3D12GraphicsCommandList* commandList) {
 
     if (m_srvHeap && output) {
         UINT descriptorSize = m_deviceRef->GetDevice()->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        const UINT aboutIndex = GetImGuiFrameDescriptorIndex(static_cast<UINT>(kAboutSrvIndex));
         D3D12_CPU_DESCRIPTOR_HANDLE srvHandle = m_srvHeap->GetCPUDescriptorHandleForHeapStart();
-        srvHandle.ptr += descriptorSize * kAboutSrvIndex;
+        srvHandle.ptr += descriptorSize * aboutIndex;
 
         D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
         srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
@@ -202,7 +203,7 @@ void ShaderLabIDE::RenderAboutLogo(ID3D12GraphicsCommandList* commandList) {
         m_deviceRef->GetDevice()->CreateShaderResourceView(output, &srvDesc, srvHandle);
 
         D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle = m_srvHeap->GetGPUDescriptorHandleForHeapStart();
-        gpuHandle.ptr += descriptorSize * kAboutSrvIndex;
+        gpuHandle.ptr += descriptorSize * aboutIndex;
         m_aboutSrvGpuHandle = gpuHandle;
     }
 }
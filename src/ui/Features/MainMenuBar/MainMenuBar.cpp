@@ -146,6 +146,9 @@ void ShaderLabIDE::ShowMainMenuBar() {
         if (ImGui::BeginMenu("File")) {
             if (ImGui::MenuItem("New")) {
                 RefreshPresetService();
+                for (auto& scene : m_scenes) {
+                    RetireSceneGpuObjects(scene);
+                }
                 m_scenes.clear();
                 CreateDefaultScene();
                 m_activeSceneIndex = 0;
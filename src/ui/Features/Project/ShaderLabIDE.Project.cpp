@@ -492,6 +492,9 @@ void ShaderLabIDE::OpenProject() {
         m_currentProjectPath = szFile;
         ProjectData data;
         if (Serializer::LoadProject(m_currentProjectPath, data)) {
+            for (auto& scene : m_scenes) {
+                RetireSceneGpuObjects(scene);
+            }
             m_scenes = data.scenes;
             m_audioLibrary = data.audioLibrary;
             m_track = data.track;
@@ -513,7 +516,7 @@ void ShaderLabIDE::OpenProject() {
                 for(auto& scene : m_scenes) {
                     for(auto& bind : scene.bindings) {
                         if (bind.bindingType == BindingType::File && !bind.filePath.empty()) {
-                            LoadTextureFromFile(bind.filePath, bind.textureResource);
+                            RequestFileTexture(bind);
                         }
                     }
                 }
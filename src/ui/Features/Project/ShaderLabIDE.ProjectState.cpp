@@ -43,6 +43,7 @@ ProjectState ShaderLabIDE::CaptureState() {
         for (auto& binding : scene.bindings) {
              binding.textureResource.Reset();
              binding.fileTextureValid = false;
+             binding.fileDecodeTicket = 0;
         }
     }
 
@@ -50,6 +51,9 @@ ProjectState ShaderLabIDE::CaptureState() {
 }
 
 void ShaderLabIDE::RestoreState(const ProjectState& state) {
+    for (auto& scene : m_scenes) {
+        RetireSceneGpuObjects(scene);
+    }
     m_scenes = state.scenes;
     m_audioLibrary = state.audioLibrary;
     m_track = state.track;
@@ -83,11 +87,11 @@ void ShaderLabIDE::RestoreState(const ProjectState& state) {
 
         for (auto& binding : scene.bindings) {
             binding.textureResource = nullptr;
+            binding.fileTextureValid = false; // Set once the upload lands
+            binding.fileDecodeTicket = 0;
 
             if (binding.bindingType == BindingType::File && !binding.filePath.empty()) {
-                 if (LoadTextureFromFile(binding.filePath, binding.textureResource)) {
-                     binding.fileTextureValid = true;
-                 }
+                 RequestFileTexture(binding);
             }
         }
     }
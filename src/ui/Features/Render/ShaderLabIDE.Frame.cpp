@@ -26,6 +26,9 @@ struct PerformanceOverlayModel {
     double vramPercent = 0.0;
     int activeCompute = 0;
     bool showComputeLine = false;
+    uint32_t scenePasses = 0;
+    uint32_t scenePassesSkipped = 0;
+    uint32_t descriptorWrites = 0;
 };
 
 struct PerformanceOverlayStyle {
@@ -100,7 +103,13 @@ void DrawPerformanceOverlay(ImDrawList* drawList,
     std::snprintf(line0, sizeof(line0), "FPS: %.1f", model.fps);
     std::snprintf(line1, sizeof(line1), "Frame: %.2f ms", model.frameMs);
     std::snprintf(line2, sizeof(line2), "Preview: %ux%u", model.previewWidth, model.previewHeight);
-    std::snprintf(line3, sizeof(line3), "Mode: %s", model.modeName);
+    std::snprintf(line3,
+                  sizeof(line3),
+                  "Mode: %s | Passes: %u (%u reused) | Descriptor writes: %u",
+                  model.modeName,
+                  model.scenePasses,
+                  model.scenePassesSkipped,
+                  model.descriptorWrites);
     std::snprintf(line4,
                   sizeof(line4),
                   "VRAM: %.2f / %.2f GB (%.1f%%)",
@@ -223,6 +232,13 @@ std::string FormatScreenKeyEntry(ImGuiKey key, const ImGuiIO& io) {
 }
 
 void ShaderLabIDE::BeginFrame() {
+    // Decoded images go to the copy queue; textures whose copies finished become bindable this frame
+    PumpFileTextureDecodes();
+    m_textureUploads.Poll();
+    // Finished scene compiles swap their pipeline states in here, between frames
+    PumpSceneCompiles();
+    SampleScenePreviewTierTiming();
+
     ImGui_ImplDX12_NewFrame();
     ImGui_ImplWin32_NewFrame();
     ImGui::NewFrame();
@@ -428,6 +444,9 @@ void ShaderLabIDE::BeginFrame() {
             overlayModel.frameMs = (overlayModel.fps > 0.0f) ? (1000.0f / overlayModel.fps) : 0.0f;
             overlayModel.previewWidth = m_previewTextureWidth;
             overlayModel.previewHeight = m_previewTextureHeight;
+            overlayModel.scenePasses = m_sceneRenderGraph.GetLastFrameStats().passesRendered;
+            overlayModel.scenePassesSkipped = m_sceneRenderGraph.GetLastFrameStats().passesSkipped;
+            overlayModel.descriptorWrites = m_descriptorCache.GetLastFrameStats().descriptorWrites;
             if (m_deviceRef) {
                 const auto mem = m_deviceRef->GetVideoMemoryInfo();
                 constexpr double kBytesPerGB = 1024.0 * 1024.0 * 1024.0;
@@ -472,6 +491,8 @@ void ShaderLabIDE::BeginFrame() {
 
 void ShaderLabIDE::EndFrame() {
     ImGui::Render();
+    // Everything queued this frame (e.g. a whole project's file textures) goes out as one copy batch
+    m_textureUploads.Submit();
 }
 
 } // namespace ShaderLab
@@ -1,6 +1,7 @@
 #include "ShaderLab/UI/ShaderLabIDE.h"
 #include "ShaderLab/UI/UISystemDemoUtils.h"
 #include "ShaderLab/UI/UISystemAssets.h"
+#include "ShaderLab/Graphics/CommandQueue.h"
 #include "ShaderLab/Graphics/Device.h"
 #include "ShaderLab/Graphics/Swapchain.h"
 #include "ShaderLab/Graphics/Dx12ResourceService.h"
@@ -23,7 +24,9 @@ namespace ShaderLab {
 
 namespace {
 constexpr uint32_t kComputeHistorySlots = 8;
-constexpr uint32_t kComputeDescriptorCount = 11; // t0 + t1..t8 + u0 + b0
+constexpr uint32_t kComputeDescriptorCount = 10; // t0 + t1..t8 + u0; b0 is a root CBV
+constexpr uint32_t kMaxComputeDispatchesPerFrame = 64;
+constexpr uint32_t kPostFxTableDescriptors = 8;
 
 struct ComputeDispatchParams {
     float param0;
@@ -45,9 +48,10 @@ struct UiComputeSceneResources {
 };
 
 ComPtr<ID3D12RootSignature> g_uiComputeRootSignature;
-ComPtr<ID3D12DescriptorHeap> g_uiComputeDescriptorHeap;
 ComPtr<ID3D12Resource> g_uiComputeParamsBuffer;
 uint8_t* g_uiComputeParamsMapped = nullptr;
+uint32_t g_uiComputeParamsFrameSlot = 0;
+uint32_t g_uiComputeParamsUsed = 0;
 ID3D12Device* g_uiComputeDevice = nullptr;
 std::unordered_map<int, UiComputeSceneResources> g_uiComputeSceneResources;
 std::unordered_map<Scene::ComputeEffect*, ID3D12Device*> g_uiComputePipelineDeviceMap;
@@ -59,7 +63,6 @@ void ResetUiComputeDeviceState() {
 
     g_uiComputeParamsMapped = nullptr;
     g_uiComputeParamsBuffer.Reset();
-    g_uiComputeDescriptorHeap.Reset();
     g_uiComputeRootSignature.Reset();
     g_uiComputeSceneResources.clear();
     g_uiComputePipelineDeviceMap.clear();
@@ -74,6 +77,23 @@ uint32_t Align256(uint32_t value) {
     return (value + 255u) & ~255u;
 }
 
+// Dispatch constants live in one 256-byte slice per dispatch, kMaxComputeDispatchesPerFrame
+// slices per frame slot; a slot is only reused after its previous frame has completed.
+void BeginUiComputeParamsFrame(uint32_t frameSlot) {
+    g_uiComputeParamsFrameSlot = frameSlot;
+    g_uiComputeParamsUsed = 0;
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS WriteUiComputeParams(const ComputeDispatchParams& params) {
+    if (!g_uiComputeParamsMapped || !g_uiComputeParamsBuffer || g_uiComputeParamsUsed >= kMaxComputeDispatchesPerFrame) {
+        return 0;
+    }
+    const uint32_t stride = Align256(static_cast<uint32_t>(sizeof(ComputeDispatchParams)));
+    const uint32_t slice = g_uiComputeParamsFrameSlot * kMaxComputeDispatchesPerFrame + g_uiComputeParamsUsed++;
+    std::memcpy(g_uiComputeParamsMapped + static_cast<size_t>(slice) * stride, &params, sizeof(params));
+    return g_uiComputeParamsBuffer->GetGPUVirtualAddress() + static_cast<UINT64>(slice) * stride;
+}
+
 bool EnsureUiComputeRootSignature(Device* deviceRef) {
     if (!deviceRef) return false;
     ID3D12Device* device = deviceRef->GetDevice();
@@ -100,11 +120,6 @@ bool EnsureUiComputeRootSignature(Device* deviceRef) {
     outputRange.NumDescriptors = 1;
     outputRange.BaseShaderRegister = 0;
 
-    D3D12_DESCRIPTOR_RANGE cbvRange = {};
-    cbvRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_CBV;
-    cbvRange.NumDescriptors = 1;
-    cbvRange.BaseShaderRegister = 0;
-
     D3D12_ROOT_PARAMETER rootParams[4] = {};
     rootParams[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
     rootParams[0].DescriptorTable.NumDescriptorRanges = 1;
@@ -121,9 +136,8 @@ bool EnsureUiComputeRootSignature(Device* deviceRef) {
     rootParams[2].DescriptorTable.pDescriptorRanges = &outputRange;
     rootParams[2].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
 
-    rootParams[3].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
-    rootParams[3].DescriptorTable.NumDescriptorRanges = 1;
-    rootParams[3].DescriptorTable.pDescriptorRanges = &cbvRange;
+    rootParams[3].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+    rootParams[3].Descriptor.ShaderRegister = 0;
     rootParams[3].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
 
     D3D12_ROOT_SIGNATURE_DESC rootDesc = {};
@@ -155,23 +169,14 @@ bool EnsureUiComputeDispatchResources(Device* deviceRef) {
         g_uiComputeDevice = device;
     }
 
-    if (!g_uiComputeDescriptorHeap) {
-        D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
-        heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-        heapDesc.NumDescriptors = kComputeDescriptorCount;
-        heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-        if (FAILED(device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(g_uiComputeDescriptorHeap.ReleaseAndGetAddressOf())))) {
-            return false;
-        }
-    }
-
     if (!g_uiComputeParamsBuffer) {
         D3D12_HEAP_PROPERTIES heapProps = {};
         heapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
 
         D3D12_RESOURCE_DESC bufferDesc = {};
         bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-        bufferDesc.Width = Align256(static_cast<uint32_t>(sizeof(ComputeDispatchParams)));
+        bufferDesc.Width = static_cast<UINT64>(Align256(static_cast<uint32_t>(sizeof(ComputeDispatchParams)))) *
+                           kMaxComputeDispatchesPerFrame * CommandQueue::kMaxFramesInFlight;
         bufferDesc.Height = 1;
         bufferDesc.DepthOrArraySize = 1;
         bufferDesc.MipLevels = 1;
@@ -286,19 +291,9 @@ void ShaderLabIDE::EnsureSceneTexture(int sceneIndex, uint32_t width, uint32_t h
         }
     }
 
-    // Safety check: ensure heap is size 8
-    if (scene.srvHeap && scene.srvHeap->GetDesc().NumDescriptors != 8) {
-         scene.srvHeap.Reset();
-         // If heap is invalid, we MUST continue to create it
-         needsCreate = true;
-         scene.texture.Reset();
-         scene.textureValid = false;
-    }
-
     if (needsCreate) {
         Dx12ResourceService resourceService(m_deviceRef->GetDevice());
-        scene.texture.Reset();
-        scene.srvHeap.Reset();
+        RetireGpuObject(std::move(scene.texture));
         scene.textureValid = false;
 
         TextureAllocationRequest textureRequest{};
@@ -310,17 +305,6 @@ void ShaderLabIDE::EnsureSceneTexture(int sceneIndex, uint32_t width, uint32_t h
         if (!resourceService.AllocateTexture2D(textureRequest, scene.texture)) {
             return;
         }
-
-        // Create descriptor heap for this scene's inputs (4 textures table for the shader to use)
-        // NOT the SRV for the texture itself (we'll just use transient handles or copy descriptors when needed)
-        // Wait, different concept: When rendering THIS scene, what does it bind?
-        // It binds a table of 4 textures. We need a GPU descriptor heap for that table.
-
-        D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
-        heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-        heapDesc.NumDescriptors = 8;
-        heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-        m_deviceRef->GetDevice()->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&scene.srvHeap));
     }
 }
 
@@ -351,9 +335,8 @@ void ShaderLabIDE::EnsurePostFxResources(Scene& scene, uint32_t width, uint32_t
 
     if (!needsCreate) return;
 
-    scene.postFxTextureA.Reset();
-    scene.postFxTextureB.Reset();
-    scene.postFxSrvHeap.Reset();
+    RetireGpuObject(std::move(scene.postFxTextureA));
+    RetireGpuObject(std::move(scene.postFxTextureB));
     scene.postFxRtvHeap.Reset();
     scene.postFxValid = false;
 
@@ -373,12 +356,6 @@ void ShaderLabIDE::EnsurePostFxResources(Scene& scene, uint32_t width, uint32_t
         return;
     }
 
-    D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
-    heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-    heapDesc.NumDescriptors = 8 * kMaxPostFxChain;
-    heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-    m_deviceRef->GetDevice()->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&scene.postFxSrvHeap));
-
     D3D12_DESCRIPTOR_HEAP_DESC rtvHeapDesc = {};
     rtvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
     rtvHeapDesc.NumDescriptors = 1;
@@ -396,9 +373,8 @@ void ShaderLabIDE::EnsurePostFxPreviewResources(uint32_t width, uint32_t height)
     }
     if (!needsCreate) return;
 
-    m_postFxPreviewTextureA.Reset();
-    m_postFxPreviewTextureB.Reset();
-    m_postFxPreviewSrvHeap.Reset();
+    RetireGpuObject(std::move(m_postFxPreviewTextureA));
+    RetireGpuObject(std::move(m_postFxPreviewTextureB));
     m_postFxPreviewRtvHeap.Reset();
 
     Dx12ResourceService resourceService(m_deviceRef->GetDevice());
@@ -417,12 +393,6 @@ void ShaderLabIDE::EnsurePostFxPreviewResources(uint32_t width, uint32_t height)
         return;
     }
 
-    D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
-    heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-    heapDesc.NumDescriptors = 8 * kMaxPostFxChain;
-    heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-    m_deviceRef->GetDevice()->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&m_postFxPreviewSrvHeap));
-
     D3D12_DESCRIPTOR_HEAP_DESC rtvHeapDesc = {};
     rtvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
     rtvHeapDesc.NumDescriptors = 1;
@@ -444,6 +414,9 @@ void ShaderLabIDE::EnsurePostFxHistory(Scene::PostFXEffect& effect, uint32_t wid
 
     if (!needsCreate) return;
 
+    for (auto& texture : effect.historyTextures) {
+        RetireGpuObject(std::move(texture));
+    }
     effect.historyTextures.clear();
     effect.historyTextures.resize(kPostFxHistoryCount);
     effect.historyIndex = 0;
@@ -481,7 +454,7 @@ bool ShaderLabIDE::CompileComputePipeline(Scene::ComputeEffect& effect) {
         {});
 
     if (!compileResult.success) {
-        effect.pipelineState.Reset();
+        RetireGpuObject(std::move(effect.pipelineState));
         effect.compiledShaderBytes = 0;
         return false;
     }
@@ -492,11 +465,12 @@ bool ShaderLabIDE::CompileComputePipeline(Scene::ComputeEffect& effect) {
 
     ComPtr<ID3D12PipelineState> pipeline;
     if (FAILED(device->CreateComputePipelineState(&desc, IID_PPV_ARGS(pipeline.GetAddressOf())))) {
-        effect.pipelineState.Reset();
+        RetireGpuObject(std::move(effect.pipelineState));
         effect.compiledShaderBytes = 0;
         return false;
     }
 
+    RetireGpuObject(std::move(effect.pipelineState));
     effect.pipelineState = pipeline;
     effect.compiledShaderBytes = compileResult.bytecode.size();
     effect.isDirty = false;
@@ -510,6 +484,9 @@ void ShaderLabIDE::EnsureComputeHistory(Scene::ComputeEffect& effect, uint32_t w
 
     const int historyCount = (std::max)(0, (std::min)(effect.historyCount, static_cast<int>(kComputeHistorySlots)));
     if (historyCount <= 0) {
+        for (auto& texture : effect.historyTextures) {
+            RetireGpuObject(std::move(texture));
+        }
         effect.historyTextures.clear();
         effect.historyInitialized = false;
         effect.historyIndex = 0;
@@ -524,6 +501,9 @@ void ShaderLabIDE::EnsureComputeHistory(Scene::ComputeEffect& effect, uint32_t w
 
     if (!needsCreate) return;
 
+    for (auto& texture : effect.historyTextures) {
+        RetireGpuObject(std::move(texture));
+    }
     effect.historyTextures.clear();
     effect.historyTextures.resize(static_cast<size_t>(historyCount));
     effect.historyInitialized = false;
@@ -572,6 +552,8 @@ ID3D12Resource* ShaderLabIDE::ApplyComputeEffectChain(ID3D12GraphicsCommandList*
     auto& resources = g_uiComputeSceneResources[sceneIndex];
     const bool recreate = !resources.textureA || !resources.textureB || resources.width != width || resources.height != height || resources.ownerDevice != device;
     if (recreate) {
+        RetireGpuObject(std::move(resources.textureA));
+        RetireGpuObject(std::move(resources.textureB));
         resources = {};
         Dx12ResourceService resourceService(m_deviceRef->GetDevice());
         TextureAllocationRequest req{};
@@ -590,9 +572,10 @@ ID3D12Resource* ShaderLabIDE::ApplyComputeEffectChain(ID3D12GraphicsCommandList*
         resources.ownerDevice = device;
     }
 
+    if (!EnsureDescriptorCache()) {
+        return inputTexture;
+    }
     const UINT step = DescriptorStep(device);
-    const auto heapCpu = g_uiComputeDescriptorHeap->GetCPUDescriptorHandleForHeapStart();
-    const auto heapGpu = g_uiComputeDescriptorHeap->GetGPUDescriptorHandleForHeapStart();
 
     ID3D12Resource* currentInput = inputTexture;
     ID3D12Resource* outputA = resources.textureA.Get();
@@ -604,10 +587,13 @@ ID3D12Resource* ShaderLabIDE::ApplyComputeEffectChain(ID3D12GraphicsCommandList*
         auto fxDeviceIt = g_uiComputePipelineDeviceMap.find(&fx);
         const bool pipelineDeviceMismatch = (fxDeviceIt == g_uiComputePipelineDeviceMap.end()) || (fxDeviceIt->second != device);
         if (pipelineDeviceMismatch) {
-            fx.pipelineState.Reset();
+            RetireGpuObject(std::move(fx.pipelineState));
             fx.isDirty = true;
             fx.historyIndex = 0;
             fx.historyInitialized = false;
+            for (auto& texture : fx.historyTextures) {
+                RetireGpuObject(std::move(texture));
+            }
             fx.historyTextures.clear();
         }
         if (fx.isDirty || !fx.pipelineState) {
@@ -618,27 +604,11 @@ ID3D12Resource* ShaderLabIDE::ApplyComputeEffectChain(ID3D12GraphicsCommandList*
 
         EnsureComputeHistory(fx, width, height);
 
-        D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-        srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-        srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-        srvDesc.Texture2D.MipLevels = 1;
-
-        D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
-        uavDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-        uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
-
-        D3D12_CPU_DESCRIPTOR_HANDLE inputCpu = heapCpu;
-        device->CreateShaderResourceView(currentInput, &srvDesc, inputCpu);
-
-        D3D12_CPU_DESCRIPTOR_HANDLE fallbackHistoryCpu = heapCpu;
-        fallbackHistoryCpu.ptr += static_cast<SIZE_T>(step) * 1;
-        device->CreateShaderResourceView(currentInput, &srvDesc, fallbackHistoryCpu);
-
+        // t0 input, t1..t8 history (newest first), u0 output. History rotates each frame, so
+        // one table is kept per history phase and steady-state frames write nothing.
+        DescriptorBinding views[kComputeDescriptorCount];
+        views[0] = Dx12DescriptorCache::TextureView(currentInput);
         for (uint32_t i = 0; i < kComputeHistorySlots; ++i) {
-            D3D12_CPU_DESCRIPTOR_HANDLE histCpu = heapCpu;
-            histCpu.ptr += static_cast<SIZE_T>(step) * (1 + i);
-
             ID3D12Resource* historyRes = nullptr;
             const int historyCount = static_cast<int>(fx.historyTextures.size());
             if (historyCount > 0) {
@@ -647,22 +617,15 @@ ID3D12Resource* ShaderLabIDE::ApplyComputeEffectChain(ID3D12GraphicsCommandList*
                 readIndex %= historyCount;
                 historyRes = fx.historyTextures[static_cast<size_t>(readIndex)].Get();
             }
-            if (!historyRes) {
-                if (i > 0) {
-                    device->CopyDescriptorsSimple(1, histCpu, fallbackHistoryCpu, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-                    continue;
-                }
-                historyRes = currentInput;
-            }
-            device->CreateShaderResourceView(historyRes, &srvDesc, histCpu);
+            if (!historyRes) historyRes = currentInput;
+            views[1 + i] = Dx12DescriptorCache::TextureView(historyRes);
         }
+        views[9] = Dx12DescriptorCache::TextureView(currentOutput, DescriptorViewKind::RWTexture2D);
 
-        D3D12_CPU_DESCRIPTOR_HANDLE outputCpu = heapCpu;
-        outputCpu.ptr += static_cast<SIZE_T>(step) * 9;
-        device->CreateUnorderedAccessView(currentOutput, nullptr, &uavDesc, outputCpu);
-
-        if (!g_uiComputeParamsMapped || !g_uiComputeParamsBuffer) {
-            return currentInput;
+        D3D12_GPU_DESCRIPTOR_HANDLE tableGpu = {};
+        const uint64_t tableKey = DescriptorCache::MakeKey(&fx, static_cast<uint32_t>(fx.historyIndex));
+        if (!m_descriptorCache.AcquireTable(tableKey, views, kComputeDescriptorCount, tableGpu)) {
+            continue;
         }
 
         ComputeDispatchParams params{};
@@ -674,14 +637,10 @@ ID3D12Resource* ShaderLabIDE::ApplyComputeEffectChain(ID3D12GraphicsCommandList*
         params.invWidth = width > 0 ? 1.0f / static_cast<float>(width) : 0.0f;
         params.invHeight = height > 0 ? 1.0f / static_cast<float>(height) : 0.0f;
         params.frame = static_cast<uint32_t>(m_transport.timeSeconds * 60.0);
-        std::memcpy(g_uiComputeParamsMapped, &params, sizeof(params));
-
-        D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = {};
-        cbvDesc.BufferLocation = g_uiComputeParamsBuffer->GetGPUVirtualAddress();
-        cbvDesc.SizeInBytes = Align256(static_cast<uint32_t>(sizeof(ComputeDispatchParams)));
-        D3D12_CPU_DESCRIPTOR_HANDLE cbvCpu = heapCpu;
-        cbvCpu.ptr += static_cast<SIZE_T>(step) * 10;
-        device->CreateConstantBufferView(&cbvDesc, cbvCpu);
+        const D3D12_GPU_VIRTUAL_ADDRESS paramsAddress = WriteUiComputeParams(params);
+        if (paramsAddress == 0) {
+            return currentInput;
+        }
 
         D3D12_RESOURCE_BARRIER beginBarriers[2] = {};
         beginBarriers[0].Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
@@ -697,23 +656,21 @@ ID3D12Resource* ShaderLabIDE::ApplyComputeEffectChain(ID3D12GraphicsCommandList*
         beginBarriers[1].Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
         commandList->ResourceBarrier(2, beginBarriers);
 
-        ID3D12DescriptorHeap* heaps[] = { g_uiComputeDescriptorHeap.Get() };
+        ID3D12DescriptorHeap* heaps[] = { m_descriptorCache.GetHeap() };
         commandList->SetDescriptorHeaps(1, heaps);
         commandList->SetComputeRootSignature(g_uiComputeRootSignature.Get());
         commandList->SetPipelineState(fx.pipelineState.Get());
 
-        D3D12_GPU_DESCRIPTOR_HANDLE inputGpu = heapGpu;
-        D3D12_GPU_DESCRIPTOR_HANDLE historyGpu = heapGpu;
+        D3D12_GPU_DESCRIPTOR_HANDLE inputGpu = tableGpu;
+        D3D12_GPU_DESCRIPTOR_HANDLE historyGpu = tableGpu;
         historyGpu.ptr += static_cast<UINT64>(step) * 1;
-        D3D12_GPU_DESCRIPTOR_HANDLE outputGpu = heapGpu;
+        D3D12_GPU_DESCRIPTOR_HANDLE outputGpu = tableGpu;
         outputGpu.ptr += static_cast<UINT64>(step) * 9;
-        D3D12_GPU_DESCRIPTOR_HANDLE cbvGpu = heapGpu;
-        cbvGpu.ptr += static_cast<UINT64>(step) * 10;
 
         commandList->SetComputeRootDescriptorTable(0, inputGpu);
         commandList->SetComputeRootDescriptorTable(1, historyGpu);
         commandList->SetComputeRootDescriptorTable(2, outputGpu);
-        commandList->SetComputeRootDescriptorTable(3, cbvGpu);
+        commandList->SetComputeRootConstantBufferView(3, paramsAddress);
 
         const uint32_t tgx = (std::max)(1u, fx.threadGroupX);
         const uint32_t tgy = (std::max)(1u, fx.threadGroupY);
@@ -800,6 +757,7 @@ bool ShaderLabIDE::CompilePostFxEffect(Scene::PostFXEffect& effect, std::vector<
         }
     }
 
+    RetireGpuObject(std::move(effect.pipelineState));
     if (pso) {
         effect.pipelineState = pso;
         effect.compiledShaderBytes = compileResult.bytecode.size();
@@ -807,7 +765,6 @@ bool ShaderLabIDE::CompilePostFxEffect(Scene::PostFXEffect& effect, std::vector<
         effect.lastCompiledCode = effect.shaderCode;
         return true;
     }
-    effect.pipelineState = nullptr;
     effect.compiledShaderBytes = 0;
     return false;
 }
@@ -829,64 +786,43 @@ ID3D12Resource* ShaderLabIDE::ApplyPostFxChain(ID3D12GraphicsCommandList* comman
 
     ID3D12Resource* ping = nullptr;
     ID3D12Resource* pong = nullptr;
-    ID3D12DescriptorHeap* srvHeap = nullptr;
     ID3D12DescriptorHeap* rtvHeap = nullptr;
 
     if (usePreviewResources) {
         EnsurePostFxPreviewResources(width, height);
         ping = m_postFxPreviewTextureA.Get();
         pong = m_postFxPreviewTextureB.Get();
-        srvHeap = m_postFxPreviewSrvHeap.Get();
         rtvHeap = m_postFxPreviewRtvHeap.Get();
     } else {
         EnsurePostFxResources(scene, width, height);
         ping = scene.postFxTextureA.Get();
         pong = scene.postFxTextureB.Get();
-        srvHeap = scene.postFxSrvHeap.Get();
         rtvHeap = scene.postFxRtvHeap.Get();
     }
 
-    if (!ping || !pong || !srvHeap || !rtvHeap) return inputTexture;
+    if (!ping || !pong || !rtvHeap || !EnsureDescriptorCache()) return inputTexture;
 
-    auto device = m_deviceRef->GetDevice();
-    auto handleStep = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-    auto startHandle = srvHeap->GetCPUDescriptorHandleForHeapStart();
-
-    auto bindInput = [&](ID3D12Resource* src, Scene::PostFXEffect& fx, int baseSlot) {
-        D3D12_CPU_DESCRIPTOR_HANDLE dest = startHandle;
-        dest.ptr += baseSlot * handleStep;
-        D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-        srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-        srvDesc.Texture2D.MipLevels = 1;
-        srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-        device->CreateShaderResourceView(src, &srvDesc, dest);
+    // t0 input, t1.. history (newest first), dummy views for the remaining slots.
+    auto bindInput = [&](ID3D12Resource* src, Scene::PostFXEffect& fx, D3D12_GPU_DESCRIPTOR_HANDLE& outTable) {
+        DescriptorBinding views[kPostFxTableDescriptors];
+        views[0] = Dx12DescriptorCache::TextureView(src);
 
         for (int i = 1; i <= kPostFxHistoryCount; ++i) {
-            int historySlot = i;
             int historyIndex = fx.historyIndex - (i - 1);
             while (historyIndex < 0) historyIndex += kPostFxHistoryCount;
             ID3D12Resource* historyRes = nullptr;
             if (!fx.historyTextures.empty()) {
                 historyRes = fx.historyTextures[historyIndex].Get();
             }
-
-            D3D12_CPU_DESCRIPTOR_HANDLE histDest = startHandle;
-            histDest.ptr += (baseSlot + historySlot) * handleStep;
-            if (historyRes) {
-                device->CreateShaderResourceView(historyRes, &srvDesc, histDest);
-            } else if (m_dummySrvHeap) {
-                device->CopyDescriptorsSimple(1, histDest, m_dummySrvHeap->GetCPUDescriptorHandleForHeapStart(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-            }
+            views[i] = Dx12DescriptorCache::TextureView(historyRes ? historyRes : m_dummyTexture.Get());
         }
 
-        for (int i = kPostFxHistoryCount + 1; i < 8; ++i) {
-            D3D12_CPU_DESCRIPTOR_HANDLE dummyDest = startHandle;
-            dummyDest.ptr += (baseSlot + i) * handleStep;
-            if (m_dummySrvHeap) {
-                device->CopyDescriptorsSimple(1, dummyDest, m_dummySrvHeap->GetCPUDescriptorHandleForHeapStart(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-            }
+        for (int i = kPostFxHistoryCount + 1; i < static_cast<int>(kPostFxTableDescriptors); ++i) {
+            views[i] = Dx12DescriptorCache::TextureView(m_dummyTexture.Get());
         }
+
+        const uint64_t tableKey = DescriptorCache::MakeKey(&fx, static_cast<uint32_t>(fx.historyIndex));
+        return m_descriptorCache.AcquireTable(tableKey, views, kPostFxTableDescriptors, outTable);
     };
 
     ID3D12Resource* currentInput = inputTexture;
@@ -937,9 +873,11 @@ ID3D12Resource* ShaderLabIDE::ApplyPostFxChain(ID3D12GraphicsCommandList* comman
         commandList->ResourceBarrier(1, &barrier);
 
         // Bind input SRV
-        int baseSlot = passIndex * 8;
-        bindInput(currentInput, fx, baseSlot);
-        ID3D12DescriptorHeap* heaps[] = { srvHeap };
+        D3D12_GPU_DESCRIPTOR_HANDLE srvGpu = {};
+        if (!bindInput(currentInput, fx, srvGpu)) {
+            break;
+        }
+        ID3D12DescriptorHeap* heaps[] = { m_descriptorCache.GetHeap() };
         commandList->SetDescriptorHeaps(1, heaps);
 
         // RTV
@@ -947,8 +885,6 @@ ID3D12Resource* ShaderLabIDE::ApplyPostFxChain(ID3D12GraphicsCommandList* comman
         m_deviceRef->GetDevice()->CreateRenderTargetView(currentOutput, nullptr, rtvHandle);
 
         // Render pass
-        D3D12_GPU_DESCRIPTOR_HANDLE srvGpu = srvHeap->GetGPUDescriptorHandleForHeapStart();
-        srvGpu.ptr += baseSlot * handleStep;
         float iBeat = 0.0f;
         float iBar = 0.0f;
         float fBeat = 0.0f;
@@ -1031,144 +967,124 @@ ID3D12Resource* ShaderLabIDE::GetSceneFinalTexture(ID3D12GraphicsCommandList* co
 }
 
 void ShaderLabIDE::RenderScene(ID3D12GraphicsCommandList* commandList, int sceneIndex, uint32_t width, uint32_t height, double time) {
-    // Basic cycle protection using a stack
-    for(int s : m_renderStack) {
-        if(s == sceneIndex) return; // Cycle detected
+    // 1. Render input scenes first; the graph orders them and drops passes already done this frame
+    m_sceneDependencies.resize(m_scenes.size());
+    for (size_t i = 0; i < m_scenes.size(); ++i) {
+        auto& deps = m_sceneDependencies[i];
+        deps.clear();
+        for (const auto& binding : m_scenes[i].bindings) {
+            if (binding.enabled && binding.sourceSceneIndex != -1 && binding.sourceSceneIndex != static_cast<int>(i)) {
+                deps.push_back(binding.sourceSceneIndex);
+            }
+        }
+    }
+    if (m_sceneRenderGraph.Sync(m_sceneDependencies)) {
+        for (const auto& edge : m_sceneRenderGraph.GetCycleEdges()) {
+            AppendDemoLog("[render] Scene binding cycle: scene " + std::to_string(edge.first) +
+                      " -> scene " + std::to_string(edge.second) + " is ignored");
+        }
     }
-    m_renderStack.push_back(sceneIndex);
 
+    if (sceneIndex < 0 || sceneIndex >= (int)m_scenes.size()) {
+        return;
+    }
+    for (int passIndex : m_sceneRenderGraph.GetSchedule(sceneIndex)) {
+        if (m_sceneRenderGraph.BeginPass(passIndex, time)) {
+            RenderScenePass(commandList, passIndex, width, height, time);
+        }
+    }
+}
+
+void ShaderLabIDE::RenderScenePass(ID3D12GraphicsCommandList* commandList, int sceneIndex, uint32_t width, uint32_t height, double time) {
     EnsureSceneTexture(sceneIndex, width, height);
     if (sceneIndex < 0 || sceneIndex >= (int)m_scenes.size()) {
-        m_renderStack.pop_back();
         return;
     }
     auto& scene = m_scenes[sceneIndex];
     if (!scene.texture) {
-        // We must pop the stack if we return early!
-        m_renderStack.pop_back();
         return;
     }
 
-    // 1. Process dependencies first (render input textures)
-    for (const auto& binding : scene.bindings) {
-        if (binding.enabled && binding.sourceSceneIndex != -1 && binding.sourceSceneIndex != sceneIndex) {
-             RenderScene(commandList, binding.sourceSceneIndex, width, height, time);
-        }
-    }
-
     // 2. Setup Descriptor Table for THIS scene's inputs
-    // We need to copy descriptors from source scenes into this scene's heap
-    // Or create new views pointing to source resources.
-    if (scene.srvHeap) {
-        auto device = m_deviceRef->GetDevice();
-        auto handleStep = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-        auto startHandle = scene.srvHeap->GetCPUDescriptorHandleForHeapStart();
-
-        for (int i=0; i<8; ++i) {
-            D3D12_CPU_DESCRIPTOR_HANDLE dest = startHandle;
-            dest.ptr += i * handleStep;
-
-            bool bound = false;
-            // Find binding for slot i
-            for(const auto& b : scene.bindings) {
-                if (b.channelIndex == i && b.enabled) {
-                    if (b.bindingType == BindingType::Scene) {
-                        if (b.sourceSceneIndex != -1 && b.sourceSceneIndex != sceneIndex) {
-                             // Validate index BEFORE access to prevent crash
-                             if (b.sourceSceneIndex < 0 || b.sourceSceneIndex >= (int)m_scenes.size()) {
-                                 continue;
-                             }
-                             // Get source texture
-                             auto& srcScene = m_scenes[b.sourceSceneIndex];
-                             bool compatible = false;
-                             if(srcScene.texture) {
-                                D3D12_RESOURCE_DESC desc = srcScene.texture->GetDesc();
-
-                                D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-                                srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-
-                                // Strict type checking
-                                if (b.type == TextureType::TextureCube) {
-                                    if (desc.DepthOrArraySize == 6 && desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE2D) {
-                                        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
-                                        srvDesc.TextureCube.MipLevels = 1;
-                                        srvDesc.TextureCube.MostDetailedMip = 0;
-                                        srvDesc.TextureCube.ResourceMinLODClamp = 0.0f;
-                                        compatible = true;
-                                    }
-                                } else if (b.type == TextureType::Texture3D) {
-                                     if (desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D) {
-                                         srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE3D;
-                                         srvDesc.Texture3D.MipLevels = 1;
-                                         srvDesc.Texture3D.MostDetailedMip = 0;
-                                         srvDesc.Texture3D.ResourceMinLODClamp = 0.0f;
-                                         compatible = true;
-                                     }
-                                } else {
-                                    // 2D
-                                    if (desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE2D && desc.DepthOrArraySize == 1) {
-                                        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-                                        srvDesc.Texture2D.MipLevels = 1;
-                                        srvDesc.Texture2D.MostDetailedMip = 0;
-                                        srvDesc.Texture2D.PlaneSlice = 0;
-                                        srvDesc.Texture2D.ResourceMinLODClamp = 0.0f;
-                                        compatible = true;
-                                    }
+    // The channel views live in a stable table of the shared descriptor cache; it is only
+    // rewritten when a bound resource changes, not every frame.
+    DescriptorBinding channels[8];
+    for (int i=0; i<8; ++i) {
+        bool bound = false;
+        // Find binding for slot i
+        for(const auto& b : scene.bindings) {
+            if (b.channelIndex == i && b.enabled) {
+                if (b.bindingType == BindingType::Scene) {
+                    if (b.sourceSceneIndex != -1 && b.sourceSceneIndex != sceneIndex) {
+                         // Validate index BEFORE access to prevent crash
+                         if (b.sourceSceneIndex < 0 || b.sourceSceneIndex >= (int)m_scenes.size()) {
+                             continue;
+                         }
+                         // Get source texture
+                         auto& srcScene = m_scenes[b.sourceSceneIndex];
+                         if(srcScene.texture) {
+                            D3D12_RESOURCE_DESC desc = srcScene.texture->GetDesc();
+
+                            // Strict type checking
+                            if (b.type == TextureType::TextureCube) {
+                                if (desc.DepthOrArraySize == 6 && desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE2D) {
+                                    channels[i] = Dx12DescriptorCache::TextureView(srcScene.texture.Get(), DescriptorViewKind::TextureCube);
+                                    bound = true;
                                 }
-
-                                if (compatible) {
-                                    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-                                    device->CreateShaderResourceView(srcScene.texture.Get(), &srvDesc, dest);
+                            } else if (b.type == TextureType::Texture3D) {
+                                 if (desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D) {
+                                     channels[i] = Dx12DescriptorCache::TextureView(srcScene.texture.Get(), DescriptorViewKind::Texture3D);
+                                     bound = true;
+                                 }
+                            } else {
+                                // 2D
+                                if (desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE2D && desc.DepthOrArraySize == 1) {
+                                    channels[i] = Dx12DescriptorCache::TextureView(srcScene.texture.Get(), DescriptorViewKind::Texture2D);
                                     bound = true;
                                 }
-                             }
-                        }
-                    } else if (b.bindingType == BindingType::File) {
-                        if (b.fileTextureValid && b.textureResource) {
-                            D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-                            srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-                            srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-                            srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-                            srvDesc.Texture2D.MipLevels = 1;
-                            srvDesc.Texture2D.MostDetailedMip = 0;
-                            srvDesc.Texture2D.PlaneSlice = 0;
-                            srvDesc.Texture2D.ResourceMinLODClamp = 0.0f;
-
-                            device->CreateShaderResourceView(b.textureResource.Get(), &srvDesc, dest);
-                            bound = true;
-                        }
+                            }
+                         }
+                    }
+                } else if (b.bindingType == BindingType::File) {
+                    if (b.fileTextureValid && b.textureResource) {
+                        channels[i] = Dx12DescriptorCache::TextureView(b.textureResource.Get(), DescriptorViewKind::Texture2D);
+                        bound = true;
                     }
                 }
             }
+        }
 
-            if (!bound) {
-                // Bind dummy texture appropriate for the channel type
-                // We need to look at what the shader expects. That's determined by iterating scene bindings.
-                // But here we are iterating slot i=0..7.
-
-                // Find what type slot i expects
-                TextureType type = TextureType::Texture2D;
-                for(const auto& b : scene.bindings) {
-                    if (b.channelIndex == i) {
-                        type = b.type;
-                        break;
-                    }
+        if (!bound) {
+            // Bind dummy texture appropriate for the channel type
+            // Find what type slot i expects
+            TextureType type = TextureType::Texture2D;
+            for(const auto& b : scene.bindings) {
+                if (b.channelIndex == i) {
+                    type = b.type;
+                    break;
                 }
+            }
 
-                if (type == TextureType::TextureCube && m_dummySrvHeapCube) {
-                    device->CopyDescriptorsSimple(1, dest, m_dummySrvHeapCube->GetCPUDescriptorHandleForHeapStart(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-                } else if (type == TextureType::Texture3D && m_dummySrvHeap3D) {
-                    device->CopyDescriptorsSimple(1, dest, m_dummySrvHeap3D->GetCPUDescriptorHandleForHeapStart(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-                } else if (m_dummySrvHeap) {
-                    device->CopyDescriptorsSimple(1, dest, m_dummySrvHeap->GetCPUDescriptorHandleForHeapStart(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-                }
+            if (type == TextureType::TextureCube) {
+                channels[i] = Dx12DescriptorCache::TextureView(m_dummyTextureCube.Get(), DescriptorViewKind::TextureCube);
+            } else if (type == TextureType::Texture3D) {
+                channels[i] = Dx12DescriptorCache::TextureView(m_dummyTexture3D.Get(), DescriptorViewKind::Texture3D);
+            } else {
+                channels[i] = Dx12DescriptorCache::TextureView(m_dummyTexture.Get(), DescriptorViewKind::Texture2D);
             }
         }
     }
 
+    if (!EnsureDescriptorCache()) {
+        return;
+    }
+    D3D12_GPU_DESCRIPTOR_HANDLE channelTable = {};
+    if (!m_descriptorCache.AcquireTable(DescriptorCache::MakeKey(&scene, 0), channels, 8, channelTable)) {
+        return;
+    }
+
     if (scene.isDirty || !scene.pipelineState) {
         if (!CompileScene(sceneIndex)) {
-            m_renderStack.pop_back();
             return;
         }
     }
@@ -1217,10 +1133,8 @@ void ShaderLabIDE::RenderScene(ID3D12GraphicsCommandList* commandList, int scene
     // (If we want recursive rendering, we need PSOs per scene).
 
     if (scene.pipelineState) {
-         if (scene.srvHeap) {
-             ID3D12DescriptorHeap* heaps[] = { scene.srvHeap.Get() };
-             commandList->SetDescriptorHeaps(1, heaps);
-         }
+         ID3D12DescriptorHeap* heaps[] = { m_descriptorCache.GetHeap() };
+         commandList->SetDescriptorHeaps(1, heaps);
 
             float iBeat = 0.0f;
             float iBar = 0.0f;
@@ -1233,7 +1147,7 @@ void ShaderLabIDE::RenderScene(ID3D12GraphicsCommandList* commandList, int scene
             scene.pipelineState.Get(),
             scene.texture.Get(),
             rtvHandle,
-            scene.srvHeap ? scene.srvHeap->GetGPUDescriptorHandleForHeapStart() : D3D12_GPU_DESCRIPTOR_HANDLE{},
+            channelTable,
             width, height,
             static_cast<float>(time),
             iBeat,
@@ -1249,7 +1163,6 @@ void ShaderLabIDE::RenderScene(ID3D12GraphicsCommandList* commandList, int scene
     commandList->ResourceBarrier(1, &barrier);
 
     scene.textureValid = true;
-    m_renderStack.pop_back(); // Always pop at the end
 }
 
 bool ShaderLabIDE::RenderPreviewTexture(ID3D12GraphicsCommandList* commandList) {
@@ -1260,8 +1173,14 @@ bool ShaderLabIDE::RenderPreviewTexture(ID3D12GraphicsCommandList* commandList)
         return false;
     }
 
-    // Clear render stack
-    m_renderStack.clear();
+    // New frame: every scene may render once more
+    m_sceneRenderGraph.BeginFrame();
+    CommandQueue* frameQueue = m_swapchainRef ? m_swapchainRef->GetCommandQueue() : nullptr;
+    if (m_descriptorCache.IsInitialized()) {
+        m_descriptorCache.BeginFrame(frameQueue ? frameQueue->GetFramesInFlight() : 1);
+    }
+    BeginUiComputeParamsFrame(frameQueue ? frameQueue->GetFrameSlot() : 0);
+    m_previewRenderer->BeginFrame(frameQueue);
 
     // --- Post FX Mode Preview (Draft Chain) ---
     if (m_currentMode == UIMode::PostFX) {
@@ -1364,6 +1283,7 @@ bool ShaderLabIDE::RenderPreviewTexture(ID3D12GraphicsCommandList* commandList)
                 };
                 std::string code = GetEditorTransitionShaderSourceByStem(effectiveStem);
                 std::vector<std::string> errs;
+                RetireGpuObject(std::move(m_transitionPSO));
                 m_transitionPSO = m_previewRenderer->CompileShader(code, decls, errs);
                 m_compiledTransitionStem = effectiveStem;
             }
@@ -1374,7 +1294,7 @@ bool ShaderLabIDE::RenderPreviewTexture(ID3D12GraphicsCommandList* commandList)
             if (m_transitionFromIndex < 0 || m_transitionFromIndex >= (int)m_scenes.size()) m_transitionFromIndex = -1;
             if (m_transitionToIndex < 0 || m_transitionToIndex >= (int)m_scenes.size()) m_transitionToIndex = -1;
 
-            if (m_transitionPSO && validIndices) {
+            if (m_transitionPSO && validIndices && EnsureDescriptorCache()) {
                 ID3D12Resource* fromTex = nullptr;
                 ID3D12Resource* toTex = nullptr;
                 const double fromTime = SceneTimeSeconds(exactBeat, m_transitionFromStartBeat, m_transitionFromOffset, m_transport.bpm);
@@ -1389,33 +1309,17 @@ bool ShaderLabIDE::RenderPreviewTexture(ID3D12GraphicsCommandList* commandList)
                 if (!fromTex) fromTex = m_dummyTexture.Get();
                 if (!toTex) toTex = m_dummyTexture.Get();
 
-                // Determine textures to bind
-                 // Create Heap if needed
-                 if (!m_transitionSrvHeap) {
-                    D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
-                    heapDesc.NumDescriptors = 8;
-                    heapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-                    heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-                    m_deviceRef->GetDevice()->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&m_transitionSrvHeap));
+                // t0 from, t1 to; the table changes every frame, so take it from the ring.
+                 DescriptorBinding views[kPostFxTableDescriptors];
+                 views[0] = Dx12DescriptorCache::TextureView(fromTex);
+                 views[1] = Dx12DescriptorCache::TextureView(toTex);
+                 for (uint32_t i = 2; i < kPostFxTableDescriptors; ++i) {
+                    views[i] = Dx12DescriptorCache::TextureView(m_dummyTexture.Get());
+                 }
+                 D3D12_GPU_DESCRIPTOR_HANDLE transitionTable = {};
+                 if (!m_descriptorCache.AllocateDynamic(views, kPostFxTableDescriptors, transitionTable)) {
+                    return false;
                  }
-
-                 auto device = m_deviceRef->GetDevice();
-                 auto handleStep = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-                 auto startCpu = m_transitionSrvHeap->GetCPUDescriptorHandleForHeapStart();
-
-                 auto Bind = [&](ID3D12Resource* res, int slot) {
-                    D3D12_CPU_DESCRIPTOR_HANDLE dest = startCpu;
-                    dest.ptr += slot * handleStep;
-                    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-                    srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-                    srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-                    srvDesc.Texture2D.MipLevels = 1;
-                    srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-                    device->CreateShaderResourceView(res, &srvDesc, dest);
-                 };
-
-                 Bind(fromTex, 0); // t0
-                 Bind(toTex, 1);   // t1
 
                  // Resource Barrier: Transition m_previewTexture to RENDER_TARGET
                  D3D12_RESOURCE_BARRIER barrier = {};
@@ -1427,7 +1331,7 @@ bool ShaderLabIDE::RenderPreviewTexture(ID3D12GraphicsCommandList* commandList)
                  commandList->ResourceBarrier(1, &barrier);
 
                  // Set the descriptor heap for transition resources
-                 ID3D12DescriptorHeap* heaps[] = { m_transitionSrvHeap.Get() };
+                 ID3D12DescriptorHeap* heaps[] = { m_descriptorCache.GetHeap() };
                  commandList->SetDescriptorHeaps(1, heaps);
 
                  // Render Transition
@@ -1442,7 +1346,7 @@ bool ShaderLabIDE::RenderPreviewTexture(ID3D12GraphicsCommandList* commandList)
                     m_transitionPSO.Get(),
                     m_previewTexture.Get(),
                     m_previewRtvHandle,
-                    m_transitionSrvHeap->GetGPUDescriptorHandleForHeapStart(),
+                    transitionTable,
                     m_previewTextureWidth, m_previewTextureHeight,
                           (float)progress,
                           iBeat,
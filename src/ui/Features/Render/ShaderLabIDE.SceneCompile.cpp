@@ -1,5 +1,6 @@
 #include "ShaderLab/UI/ShaderLabIDE.h"
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -9,14 +10,9 @@
 
 namespace ShaderLab {
 
-bool ShaderLabIDE::CompileScene(int sceneIndex) {
-    if (sceneIndex < 0 || sceneIndex >= (int)m_scenes.size()) return false;
-    auto& scene = m_scenes[sceneIndex];
-
-    // Only compile if we have a renderer
-    if (!m_previewRenderer || !m_compilationService) return false;
+namespace {
 
-    // Collect texture declarations
+std::vector<CompilationTextureBinding> CollectSceneCompileBindings(const Scene& scene) {
     std::vector<CompilationTextureBinding> bindings;
     for(const auto& b : scene.bindings) {
         if (!b.enabled) continue;
@@ -30,10 +26,50 @@ bool ShaderLabIDE::CompileScene(int sceneIndex) {
 
         bindings.push_back(binding);
     }
+    return bindings;
+}
+
+// Queue targets: the scene index for the Live tier, with this bit set for the Build tier.
+constexpr uint64_t kOptimizeTargetBit = 1ull << 32;
+
+constexpr float kTierGpuTimeSmoothing = 0.1f;
+
+size_t HashSceneSource(const std::string& source) {
+    return std::hash<std::string>{}(source);
+}
+
+ShaderCompileRequest MakeSceneCompileRequest(const Scene& scene, PreviewRenderer* renderer) {
+    ShaderCompileRequest request;
+    request.source = scene.shaderCode;
+    request.bindings = CollectSceneCompileBindings(scene);
+    request.sourceName = L"scene.hlsl";
+    request.finalize = [renderer](ShaderCompileOutput& output) {
+        output.pipelineState = renderer->CreatePSOFromBytecode(output.result.bytecode);
+        if (!output.pipelineState) {
+            output.error = "Failed to create graphics pipeline state from compiled scene shader.";
+            return false;
+        }
+        return true;
+    };
+    return request;
+}
+
+} // namespace
+
+bool ShaderLabIDE::CompileScene(int sceneIndex) {
+    if (sceneIndex < 0 || sceneIndex >= (int)m_scenes.size()) return false;
+    auto& scene = m_scenes[sceneIndex];
+
+    // Only compile if we have a renderer
+    if (!m_previewRenderer || !m_compilationService) return false;
+
+    // A background compile of older text must not land on top of this one
+    CancelSceneCompiles(sceneIndex);
+
+    // Collect texture declarations
+    const std::vector<CompilationTextureBinding> bindings = CollectSceneCompileBindings(scene);
 
     // Compile
-    std::vector<ShaderDiagnostic> compileDiagnostics;
-    std::vector<std::string> errors;
     const ShaderCompileResult compileResult = m_compilationService->CompilePreviewShader(
         scene.shaderCode,
         bindings,
@@ -42,11 +78,7 @@ bool ShaderLabIDE::CompileScene(int sceneIndex) {
         L"scene.hlsl",
         ShaderCompileMode::Live);
 
-    for (const auto& diagnostic : compileResult.diagnostics) {
-        compileDiagnostics.push_back(diagnostic);
-        errors.push_back(diagnostic.message);
-    }
-
+    std::vector<std::string> errors;
     ComPtr<ID3D12PipelineState> pso;
     if (compileResult.success) {
         pso = m_previewRenderer->CreatePSOFromBytecode(compileResult.bytecode);
@@ -55,14 +87,100 @@ bool ShaderLabIDE::CompileScene(int sceneIndex) {
         }
     }
 
+    return ApplySceneCompileResult(sceneIndex, scene.shaderCode, compileResult, pso, errors,
+                                   sceneIndex == m_activeSceneIndex);
+}
+
+bool ShaderLabIDE::SubmitSceneCompile(int sceneIndex) {
+    if (sceneIndex < 0 || sceneIndex >= (int)m_scenes.size()) return false;
+    if (!m_previewRenderer || !m_sceneCompileService) return false;
+
+    // The optimized build of the previous text is stale from here on
+    m_sceneCompiles.Cancel(static_cast<uint64_t>(sceneIndex) | kOptimizeTargetBit);
+
+    ShaderCompileRequest request = MakeSceneCompileRequest(m_scenes[sceneIndex], m_previewRenderer);
+    request.target = static_cast<uint64_t>(sceneIndex);
+    request.mode = ShaderCompileMode::Live;
+    m_sceneCompiles.Submit(std::move(request));
+    return true;
+}
+
+void ShaderLabIDE::SubmitSceneOptimizeCompile(int sceneIndex) {
+    if (sceneIndex < 0 || sceneIndex >= (int)m_scenes.size()) return;
+    if (!m_previewRenderer || !m_sceneCompileService) return;
+
+    ShaderCompileRequest request = MakeSceneCompileRequest(m_scenes[sceneIndex], m_previewRenderer);
+    request.target = static_cast<uint64_t>(sceneIndex) | kOptimizeTargetBit;
+    request.mode = ShaderCompileMode::Build;
+    m_sceneCompiles.Submit(std::move(request));
+}
+
+void ShaderLabIDE::CancelSceneCompiles(int sceneIndex) {
+    m_sceneCompiles.Cancel(static_cast<uint64_t>(sceneIndex));
+    m_sceneCompiles.Cancel(static_cast<uint64_t>(sceneIndex) | kOptimizeTargetBit);
+}
+
+void ShaderLabIDE::PumpSceneCompiles() {
+    std::vector<ShaderCompileOutput> outputs;
+    if (m_sceneCompiles.Poll(outputs) == 0) return;
+
+    for (auto& output : outputs) {
+        const int sceneIndex = static_cast<int>(output.target & ~kOptimizeTargetBit);
+        // Scenes can be removed or edited while a compile runs; stale results are dropped.
+        if (sceneIndex < 0 || sceneIndex >= (int)m_scenes.size() ||
+            m_scenes[sceneIndex].shaderCode != output.source) {
+            continue;
+        }
+
+        if (output.target & kOptimizeTargetBit) {
+            ApplySceneOptimizeResult(sceneIndex, output);
+            continue;
+        }
+
+        std::vector<std::string> errors;
+        if (!output.error.empty()) {
+            errors.push_back(output.error);
+        }
+        const bool shownInEditor = sceneIndex == m_activeSceneIndex ||
+                                   (sceneIndex == m_editingSceneIndex && m_currentMode != UIMode::PostFX);
+        ApplySceneCompileResult(sceneIndex, output.source, output.result, output.pipelineState, errors, shownInEditor);
+    }
+}
+
+bool ShaderLabIDE::ApplySceneCompileResult(int sceneIndex,
+                                           const std::string& source,
+                                           const ShaderCompileResult& compileResult,
+                                           const ComPtr<ID3D12PipelineState>& pso,
+                                           const std::vector<std::string>& extraErrors,
+                                           bool updateEditorState) {
+    auto& scene = m_scenes[sceneIndex];
+
+    std::vector<ShaderDiagnostic> compileDiagnostics;
+    std::vector<std::string> errors;
+    for (const auto& diagnostic : compileResult.diagnostics) {
+        compileDiagnostics.push_back(diagnostic);
+        errors.push_back(diagnostic.message);
+    }
+    errors.insert(errors.end(), extraErrors.begin(), extraErrors.end());
+
     bool success = (pso != nullptr);
 
     // Update Scene state
     if (success) {
+        // A replaced pipeline may still be referenced by frames the GPU has not finished.
+        if (scene.pipelineState && scene.pipelineState != pso) {
+            RetireGpuObject(std::move(scene.pipelineState));
+        }
         scene.pipelineState = pso;
         scene.compiledShaderBytes = compileResult.bytecode.size();
-        scene.isDirty = false;
+        scene.pipelineOptimized = false;
+        scene.pipelineSourceHash = HashSceneSource(source);
+        scene.isDirty = (scene.shaderCode != source);
         m_playbackBlockedByCompileError = false;
+        // Live output renders now; the optimized build of the same text follows in the background
+        if (!scene.isDirty) {
+            SubmitSceneOptimizeCompile(sceneIndex);
+        }
     } else {
         scene.compiledShaderBytes = 0;
         m_playbackBlockedByCompileError = true;
@@ -75,8 +193,8 @@ bool ShaderLabIDE::CompileScene(int sceneIndex) {
         }
     }
 
-    // If this is the active scene, update the editor UI state too
-    if (sceneIndex == m_activeSceneIndex) {
+    // If the editor shows this scene, update its UI state too
+    if (updateEditorState) {
         m_shaderState.status = success ? CompileStatus::Success : CompileStatus::Error;
         m_shaderState.diagnostics.clear();
         for (const auto& diag : compileDiagnostics) {
@@ -98,11 +216,46 @@ bool ShaderLabIDE::CompileScene(int sceneIndex) {
         }
 
         if (success) {
-            m_shaderState.lastCompiledText = scene.shaderCode;
+            m_shaderState.lastCompiledText = source;
         }
     }
 
     return success;
 }
 
+void ShaderLabIDE::ApplySceneOptimizeResult(int sceneIndex, ShaderCompileOutput& output) {
+    auto& scene = m_scenes[sceneIndex];
+    // Only replaces the Live pipeline of exactly this source; anything else was superseded.
+    if (!scene.pipelineState || scene.pipelineSourceHash != HashSceneSource(output.source)) {
+        return;
+    }
+    if (!output.pipelineState) {
+        // The Live pipeline already reported diagnostics and keeps rendering.
+        AppendDemoLog("[shader] Optimized compile of scene '" + scene.name + "' failed; keeping the Live build");
+        return;
+    }
+
+    RetireGpuObject(std::move(scene.pipelineState));
+    scene.pipelineState = output.pipelineState;
+    scene.compiledShaderBytes = output.result.bytecode.size();
+    scene.pipelineOptimized = true;
+}
+
+void ShaderLabIDE::SampleScenePreviewTierTiming() {
+    if (!m_previewRenderer || m_currentMode != UIMode::Scene) return;
+    if (m_activeSceneIndex < 0 || m_activeSceneIndex >= (int)m_scenes.size()) return;
+
+    const Scene& scene = m_scenes[m_activeSceneIndex];
+    if (scene.pipelineSourceHash != m_scenePreviewTierSourceHash) {
+        m_scenePreviewTierSourceHash = scene.pipelineSourceHash;
+        m_scenePreviewTierGpuMs[0] = 0.0f;
+        m_scenePreviewTierGpuMs[1] = 0.0f;
+    }
+
+    const float gpuMs = m_previewRenderer->GetLastGPUTimeMs();
+    if (gpuMs <= 0.0f) return;
+    float& tierMs = m_scenePreviewTierGpuMs[scene.pipelineOptimized ? 1 : 0];
+    tierMs = (tierMs <= 0.0f) ? gpuMs : tierMs + (gpuMs - tierMs) * kTierGpuTimeSmoothing;
+}
+
 } // namespace ShaderLab
@@ -6,13 +6,77 @@
 #include <system_error>
 #include <vector>
 
+#include "ShaderLab/Graphics/CommandQueue.h"
 #include "ShaderLab/Graphics/Device.h"
 #include "ShaderLab/Graphics/Dx12ResourceService.h"
+#include "ShaderLab/Graphics/Swapchain.h"
 
 namespace ShaderLab {
 
 namespace fs = std::filesystem;
 
+void ShaderLabIDE::RetireGpuObject(ComPtr<IUnknown> object) {
+    if (!object) {
+        return;
+    }
+    CommandQueue* queue = m_swapchainRef ? m_swapchainRef->GetCommandQueue() : nullptr;
+    if (queue) {
+        queue->RetireWhenComplete(std::move(object));
+    }
+}
+
+void ShaderLabIDE::RetireSceneGpuObjects(Scene& scene) {
+    RetireGpuObject(std::move(scene.texture));
+    RetireGpuObject(std::move(scene.srvHeap));
+    RetireGpuObject(std::move(scene.pipelineState));
+    RetireGpuObject(std::move(scene.postFxTextureA));
+    RetireGpuObject(std::move(scene.postFxTextureB));
+    RetireGpuObject(std::move(scene.postFxSrvHeap));
+    RetireGpuObject(std::move(scene.postFxRtvHeap));
+    for (auto& fx : scene.postFxChain) {
+        RetireEffectGpuObjects(fx);
+    }
+    for (auto& fx : scene.computeEffectChain) {
+        RetireEffectGpuObjects(fx);
+    }
+    for (auto& binding : scene.bindings) {
+        RetireGpuObject(std::move(binding.textureResource));
+    }
+}
+
+void ShaderLabIDE::RetireEffectGpuObjects(Scene::PostFXEffect& effect) {
+    RetireGpuObject(std::move(effect.pipelineState));
+    for (auto& texture : effect.historyTextures) {
+        RetireGpuObject(std::move(texture));
+    }
+    effect.historyTextures.clear();
+}
+
+void ShaderLabIDE::RetireEffectGpuObjects(Scene::ComputeEffect& effect) {
+    RetireGpuObject(std::move(effect.pipelineState));
+    for (auto& texture : effect.historyTextures) {
+        RetireGpuObject(std::move(texture));
+    }
+    effect.historyTextures.clear();
+}
+
+void ShaderLabIDE::WaitForGpuIdle() {
+    CommandQueue* queue = m_swapchainRef ? m_swapchainRef->GetCommandQueue() : nullptr;
+    if (queue) {
+        queue->WaitForGPU();
+    }
+}
+
+bool ShaderLabIDE::EnsureDescriptorCache() {
+    return m_descriptorCache.IsInitialized() || (m_deviceRef && m_descriptorCache.Initialize(m_deviceRef));
+}
+
+UINT ShaderLabIDE::GetImGuiFrameDescriptorIndex(UINT index) const {
+    CommandQueue* queue = m_swapchainRef ? m_swapchainRef->GetCommandQueue() : nullptr;
+    const UINT slot = queue ? queue->GetFrameSlot() : 0;
+    return kImGuiFixedDescriptors * (1 + slot) + index;
+}
+
 void ShaderLabIDE::CreateTitlebarIconTexture() {
     m_titlebarIconTexture.Reset();
     m_titlebarIconSrvGpuHandle = {};
@@ -145,7 +209,9 @@ void ShaderLabIDE::CreatePreviewTexture(uint32_t width, uint32_t height) {
         return;
     }
 
-    m_previewTexture.Reset();
+    // Descriptor index 1 is rewritten in place, so no submitted frame may still sample it.
+    WaitForGpuIdle();
+    RetireGpuObject(std::move(m_previewTexture));
     m_previewRtvHeap.Reset();
 
     // Create render target texture
@@ -577,7 +577,7 @@ void ShaderLabIDE::SaveUiThemeSettings() const {
 void ShaderLabIDE::EnsureThemeBackgroundTexture() {
     std::string requestedPath = m_uiThemeColors.BackgroundImage;
     if (requestedPath.empty()) {
-        m_themeBackgroundTexture.Reset();
+        RetireGpuObject(std::move(m_themeBackgroundTexture));
         m_themeBackgroundSrvGpuHandle = {};
         m_themeBackgroundWidth = 0;
         m_themeBackgroundHeight = 0;
@@ -596,7 +596,7 @@ void ShaderLabIDE::EnsureThemeBackgroundTexture() {
         return;
     }
 
-    m_themeBackgroundTexture.Reset();
+    RetireGpuObject(std::move(m_themeBackgroundTexture));
     m_themeBackgroundSrvGpuHandle = {};
     m_themeBackgroundWidth = 0;
     m_themeBackgroundHeight = 0;
@@ -621,6 +621,8 @@ void ShaderLabIDE::EnsureThemeBackgroundTexture() {
         return;
     }
 
+    // Slot 126 is rewritten in place; let submitted frames finish sampling the old view.
+    WaitForGpuIdle();
     constexpr UINT kThemeBackgroundSrvIndex = 126;
     const UINT descriptorSize = m_deviceRef->GetDevice()->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
@@ -124,6 +124,9 @@ void ShaderLabIDE::ShowTransportControls() {
                             if (!CompilePostFxEffect(fx, errors)) {
                                 m_currentMode = UIMode::PostFX;
                                 m_postFxSourceSceneIndex = i;
+                                for (auto& draft : m_postFxDraftChain) {
+                                    RetireEffectGpuObjects(draft);
+                                }
                                 m_postFxDraftChain = m_scenes[i].postFxChain;
                                 m_postFxSelectedIndex = m_postFxDraftChain.empty() ? -1 : 0;
                                 SyncPostFxEditorToSelection();
@@ -195,6 +198,7 @@ void ShaderLabIDE::ShowTransportControls() {
                         StopAudioAndClearMusicState();
                     }
                 }
+                RefreshOneShotBank();
                 m_transport.state = TransportState::Playing;
                 m_transport.lastFrameWallSeconds = 0.0;
                 if (m_currentMode == UIMode::Demo) {
@@ -205,6 +209,7 @@ void ShaderLabIDE::ShowTransportControls() {
                     auto& clip = m_audioLibrary[m_activeMusicIndex];
                     m_audioSystem->LoadAudio(clip.path);
                     m_audioSystem->Play();
+                    m_transport.audioOriginSeconds = m_transport.timeSeconds;
                 }
             }
         }
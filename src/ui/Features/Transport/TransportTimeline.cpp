@@ -4,6 +4,8 @@
 #include "ShaderLab/Audio/AudioSystem.h"
 #include "ShaderLab/Core/PlaybackService.h"
 
+#include <fstream>
+#include <iterator>
 #include <sstream>
 #include <vector>
 
@@ -44,6 +46,55 @@ void ShaderLabIDE::StopAudioAndClearMusicState() {
     m_activeMusicIndex = -1;
 }
 
+void ShaderLabIDE::RefreshOneShotBank() {
+    if (!m_audioSystem) {
+        return;
+    }
+
+    std::string key;
+    for (size_t i = 0; i < m_audioLibrary.size(); ++i) {
+        if (m_audioLibrary[i].type == AudioType::OneShot) {
+            key += std::to_string(i) + ":" + m_audioLibrary[i].path + "\n";
+        }
+    }
+    if (key == m_oneShotBankKey) {
+        return;
+    }
+    m_oneShotBankKey = key;
+
+    // Decoded once here so triggers during playback do no file I/O.
+    std::vector<std::vector<uint8_t>> fileBytes;
+    std::vector<OneShotSource> sources;
+    fileBytes.reserve(m_audioLibrary.size());
+    for (size_t i = 0; i < m_audioLibrary.size(); ++i) {
+        const AudioClip& clip = m_audioLibrary[i];
+        if (clip.type != AudioType::OneShot) {
+            continue;
+        }
+        std::ifstream file(clip.path, std::ios::binary);
+        if (!file.is_open()) {
+            AppendDemoLog("[audio] One-shot not found: " + clip.path);
+            continue;
+        }
+        fileBytes.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        OneShotSource source;
+        source.index = static_cast<int>(i);
+        source.name = clip.name.empty() ? clip.path : clip.name;
+        source.encoded = fileBytes.back();
+        sources.push_back(std::move(source));
+    }
+
+    if (sources.empty()) {
+        m_audioSystem->UnloadOneShots();
+        return;
+    }
+    std::string errors;
+    m_audioSystem->LoadOneShots(sources, errors);
+    if (!errors.empty()) {
+        AppendDemoLog("[audio] One-shot decode failed: " + errors);
+    }
+}
+
 void ShaderLabIDE::ApplyPlaybackActiveScene(int index) {
     if (m_currentMode == UIMode::Demo) {
         SetActiveScene(index);
@@ -83,14 +134,14 @@ void ShaderLabIDE::BeginSceneTransition(int beat,
 }
 
 void ShaderLabIDE::UpdateTransport(double wallNowSeconds, float dtSeconds) {
-    PlaybackService playback;
+    PlaybackService& playback = m_playbackService;
+    if (m_transport.state != TransportState::Playing || m_transport.freezeTime) {
+        m_audioClock.Reset();
+    }
     if (m_transport.state == TransportState::Playing && !m_transport.freezeTime) {
-        // Sync with Audio if available
-        if (m_audioSystem && m_audioSystem->IsPlaying()) {
-            m_transport.timeSeconds = (double)m_audioSystem->GetPlaybackTime();
-        } else {
-            playback.AdvanceClock(m_transport, wallNowSeconds, dtSeconds);
-        }
+        // Follow the music's device clock while it plays, the wall clock otherwise
+        const AudioClockSample audioClock = m_audioSystem ? m_audioSystem->SampleClock() : AudioClockSample{};
+        playback.AdvanceClockFromAudio(m_transport, m_audioClock, audioClock, wallNowSeconds, dtSeconds);
 
         // Demo Track Logic
         // Check triggers
@@ -153,6 +204,8 @@ void ShaderLabIDE::UpdateTransport(double wallNowSeconds, float dtSeconds) {
                 return;
             }
 
+            // Music rows re-trigger from the top; left running, the music clock would pull time past the end again
+            StopAudioAndClearMusicState();
             playback.SeekToBeat(m_transport, track, 0);
             ResetTransitionState(false);
             m_pendingActiveScene = -2;
@@ -229,6 +282,7 @@ void ShaderLabIDE::UpdateTransport(double wallNowSeconds, float dtSeconds) {
                              if (m_transport.state == TransportState::Playing) {
                                  m_audioSystem->Play();
                              }
+                             m_transport.audioOriginSeconds = playback.BeatToSeconds(static_cast<double>(b), m_transport.bpm);
                              m_activeMusicIndex = event.musicIndex;
                              // Propagate BPM
                              if (clip.bpm > 0.0f) {
@@ -248,7 +302,9 @@ void ShaderLabIDE::UpdateTransport(double wallNowSeconds, float dtSeconds) {
                 if (event.type == PlaybackEventType::OneShot) {
                         // One Shot
                         if (event.oneShotIndex >= 0 && event.oneShotIndex < (int)m_audioLibrary.size() && m_audioSystem) {
-                            m_audioSystem->PlayOneShot(m_audioLibrary[event.oneShotIndex].path);
+                            if (!m_audioSystem->TriggerOneShot(event.oneShotIndex)) {
+                                m_audioSystem->PlayOneShot(m_audioLibrary[event.oneShotIndex].path);
+                            }
                             std::ostringstream msg;
                             msg << "[beat " << b << "] OneShot " << event.oneShotIndex;
                             AppendDemoLog(msg.str());
@@ -291,7 +347,7 @@ void ShaderLabIDE::UpdateTransport(double wallNowSeconds, float dtSeconds) {
 }
 
 void ShaderLabIDE::SeekToBeat(int beat) {
-    PlaybackService playback;
+    PlaybackService& playback = m_playbackService;
     auto& track = m_track;
     if (track.lengthBeats <= 0) return;
 
@@ -301,56 +357,56 @@ void ShaderLabIDE::SeekToBeat(int beat) {
     ResetTransitionState(true);
     int ignoreSceneBeat = -1;
 
-    for (int b = 0; b <= seekBeat; ++b) {
-        for (const auto& row : track.rows) {
-            if (row.rowId != b) continue;
-
-            if (!row.transitionPresetStem.empty() && row.transitionDuration > 0.0f) {
-                PlaybackEvent event;
-                event.type = PlaybackEventType::SceneCommand;
-                event.beat = b;
-                event.rowId = row.rowId;
-                event.sceneIndex = row.sceneIndex;
-                event.transitionPresetStem = row.transitionPresetStem;
-                event.transitionDuration = row.transitionDuration;
-                event.timeOffset = row.timeOffset;
-                const SceneTransitionResolution target = playback.ResolveSceneTransitionTarget(
-                    track,
-                    event,
-                    m_activeSceneIndex,
-                    m_activeSceneOffset,
-                    m_activeSceneStartBeat);
-
-                BeginSceneTransition(
-                    b,
-                    static_cast<double>(row.transitionDuration),
-                    target.targetSceneIndex,
-                    target.targetOffset,
-                    target.targetStartBeat,
-                    row.transitionPresetStem);
-
-                const double transitionEndBeat = m_transitionStartBeat + m_transitionDurationBeats;
-                if (seekBeat > transitionEndBeat && m_pendingActiveScene != -2) {
-                    m_transitionActive = false;
-                    ApplyPlaybackActiveScene(m_pendingActiveScene);
-                    m_activeSceneStartBeat = m_transitionToStartBeat;
-                    m_activeSceneOffset = (m_pendingActiveScene >= 0) ? m_transitionToOffset : 0.0f;
-                    m_pendingActiveScene = -2;
-                    ignoreSceneBeat = static_cast<int>(transitionEndBeat);
-                }
-            } else if (row.sceneIndex >= 0) {
-                if (ignoreSceneBeat == row.rowId && row.sceneIndex == m_activeSceneIndex) {
-                    continue;
-                }
-                if (m_transitionActive && row.sceneIndex == m_pendingActiveScene) {
-                    continue;
-                }
+    std::vector<std::pair<int, const TrackerRow*>> seekRows;
+    playback.CollectTriggeredRows(track, -1, seekBeat, seekRows);
+    for (const auto& seekRow : seekRows) {
+        const int b = seekRow.first;
+        const TrackerRow& row = *seekRow.second;
+        if (!row.transitionPresetStem.empty() && row.transitionDuration > 0.0f) {
+            PlaybackEvent event;
+            event.type = PlaybackEventType::SceneCommand;
+            event.beat = b;
+            event.rowId = row.rowId;
+            event.sceneIndex = row.sceneIndex;
+            event.transitionPresetStem = row.transitionPresetStem;
+            event.transitionDuration = row.transitionDuration;
+            event.timeOffset = row.timeOffset;
+            const SceneTransitionResolution target = playback.ResolveSceneTransitionTarget(
+                track,
+                event,
+                m_activeSceneIndex,
+                m_activeSceneOffset,
+                m_activeSceneStartBeat);
+
+            BeginSceneTransition(
+                b,
+                static_cast<double>(row.transitionDuration),
+                target.targetSceneIndex,
+                target.targetOffset,
+                target.targetStartBeat,
+                row.transitionPresetStem);
+
+            const double transitionEndBeat = m_transitionStartBeat + m_transitionDurationBeats;
+            if (seekBeat > transitionEndBeat && m_pendingActiveScene != -2) {
                 m_transitionActive = false;
+                ApplyPlaybackActiveScene(m_pendingActiveScene);
+                m_activeSceneStartBeat = m_transitionToStartBeat;
+                m_activeSceneOffset = (m_pendingActiveScene >= 0) ? m_transitionToOffset : 0.0f;
                 m_pendingActiveScene = -2;
-                m_activeSceneIndex = row.sceneIndex;
-                m_activeSceneStartBeat = static_cast<double>(b);
-                m_activeSceneOffset = row.timeOffset;
+                ignoreSceneBeat = static_cast<int>(transitionEndBeat);
             }
+        } else if (row.sceneIndex >= 0) {
+            if (ignoreSceneBeat == row.rowId && row.sceneIndex == m_activeSceneIndex) {
+                continue;
+            }
+            if (m_transitionActive && row.sceneIndex == m_pendingActiveScene) {
+                continue;
+            }
+            m_transitionActive = false;
+            m_pendingActiveScene = -2;
+            m_activeSceneIndex = row.sceneIndex;
+            m_activeSceneStartBeat = static_cast<double>(b);
+            m_activeSceneOffset = row.timeOffset;
         }
     }
 
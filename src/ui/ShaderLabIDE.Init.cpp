@@ -8,6 +8,7 @@
 
 #include "ShaderLab/UI/UIConfig.h"
 #include "ShaderLab/Graphics/Device.h"
+#include "ShaderLab/Graphics/FrameFenceRing.h"
 #include "ShaderLab/Graphics/Swapchain.h"
 #include "ShaderLab/Core/DxcCompilationService.h"
 
@@ -161,6 +162,11 @@ bool ShaderLabIDE::Initialize(HWND hwnd, Device* device, Swapchain* swapchain) {
     m_deviceRef = device;
     m_swapchainRef = swapchain;
     m_compilationService = std::make_unique<DxcCompilationService>();
+    m_sceneCompileService = std::make_unique<DxcCompilationService>();
+    m_compilationService->SetBytecodeCache(&m_shaderBytecodeCache);
+    m_sceneCompileService->SetBytecodeCache(&m_shaderBytecodeCache);
+    m_sceneCompiles.Start(m_sceneCompileService.get(), 1);
+    ConfigureShaderBytecodeCache();
     CreateTitlebarIconTexture();
 
     if (m_workspaceSelectionPromptPending) {
@@ -178,7 +184,8 @@ bool ShaderLabIDE::Initialize(HWND hwnd, Device* device, Swapchain* swapchain) {
 void ShaderLabIDE::CreateDescriptorHeap(Device* device) {
     D3D12_DESCRIPTOR_HEAP_DESC desc = {};
     desc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-    desc.NumDescriptors = 128;  // ImGui font (0), Preview (1), Thumbnails (2+)
+    // Fixed descriptors, then one copy of the per-frame range for every frame slot
+    desc.NumDescriptors = kImGuiFixedDescriptors * (1 + FrameFenceRing::kMaxFramesInFlight);
     desc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
     device->GetDevice()->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&m_srvHeap));
 }
@@ -101,16 +101,33 @@ void ShaderLabIDE::EnsureWorkspaceFolders() {
     const fs::path projectsDir = workspaceRoot / "projects";
     const fs::path snippetsDir = workspaceRoot / "snippets";
     const fs::path postFxDir = workspaceRoot / "postfx";
+    const fs::path shaderCacheDir = workspaceRoot / "cache" / "shaders";
 
     std::error_code ec;
     fs::create_directories(workspaceRoot, ec);
     fs::create_directories(projectsDir, ec);
     fs::create_directories(snippetsDir, ec);
     fs::create_directories(postFxDir, ec);
+    fs::create_directories(shaderCacheDir, ec);
 
     m_workspaceProjectsPath = projectsDir.lexically_normal().string();
     m_workspaceSnippetsPath = snippetsDir.lexically_normal().string();
     m_workspacePostFxPath = postFxDir.lexically_normal().string();
+    m_workspaceShaderCachePath = shaderCacheDir.lexically_normal().string();
+    ConfigureShaderBytecodeCache();
+}
+
+void ShaderLabIDE::ConfigureShaderBytecodeCache() {
+    if (!m_compilationService || m_workspaceShaderCachePath.empty()) {
+        return;
+    }
+    if (!m_shaderBytecodeCache.Open(m_workspaceShaderCachePath, ShaderBytecodeCache::kDefaultMaxBytes)) {
+        AppendDemoLog(std::string("[shader-cache] Disabled; cannot use ") + m_workspaceShaderCachePath);
+        return;
+    }
+    const ShaderBytecodeCacheStats stats = m_shaderBytecodeCache.GetStats();
+    AppendDemoLog("[shader-cache] " + std::to_string(stats.entryCount) + " entries (" +
+                  std::to_string(stats.bytesOnDisk / 1024) + " KB) in " + m_workspaceShaderCachePath);
 }
 
 ShaderLabIDE::ShaderLabIDE() {
@@ -178,7 +195,14 @@ void ShaderLabIDE::Shutdown() {
     m_loadedThemeBackgroundPath.clear();
     m_previewRtvHeap.Reset();
     m_srvHeap.Reset();
+    m_descriptorCache.Shutdown();
+    m_imageDecodes.Stop();
+    m_imageDecodesStarted = false;
+    m_textureUploads.Shutdown();
+    m_sceneCompiles.Stop();
+    m_sceneCompileService.reset();
     m_compilationService.reset();
+    m_shaderBytecodeCache.Close();
     m_initialized = false;
 }
 
@@ -129,6 +129,7 @@ void ShaderLabIDE::ShowShaderEditorSearchReplaceBar() {
                 } else if (m_editingSceneIndex >= 0 && m_editingSceneIndex < (int)m_scenes.size() &&
                            m_activeSceneIndex == m_editingSceneIndex) {
                     m_scenes[m_editingSceneIndex].shaderCode = text;
+                    CancelSceneCompiles(m_editingSceneIndex);
                 }
                 m_shaderState.status = CompileStatus::Dirty;
             }
@@ -167,6 +168,42 @@ void ShaderLabIDE::ShowShaderEditorStatusBar() {
     ImGui::TextUnformatted("|");
     ImGui::SameLine();
     ImGui::TextUnformatted(m_textEditor.IsOverwrite() ? "Ovr" : "Ins");
+
+    if (m_currentMode == UIMode::Scene && m_activeSceneIndex >= 0 && m_activeSceneIndex < (int)m_scenes.size() &&
+        m_scenes[m_activeSceneIndex].pipelineState) {
+        const bool optimized = m_scenes[m_activeSceneIndex].pipelineOptimized;
+        ImGui::SameLine();
+        ImGui::TextUnformatted(optimized ? "| O3" : "| Od");
+        ImGui::SameLine();
+        PushNumericFont();
+        ImGui::Text("%.2f ms", m_scenePreviewTierGpuMs[optimized ? 1 : 0]);
+        PopNumericFont();
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Preview tier: %s\nGPU time Live (-Od): %.2f ms\nGPU time Build (-O3): %.2f ms",
+                              optimized ? "Build (-O3)" : "Live (-Od)",
+                              m_scenePreviewTierGpuMs[0],
+                              m_scenePreviewTierGpuMs[1]);
+        }
+    }
+
+    if (m_shaderBytecodeCache.IsOpen()) {
+        const ShaderBytecodeCacheStats cacheStats = m_shaderBytecodeCache.GetStats();
+        if (cacheStats.hits + cacheStats.misses > 0) {
+            ImGui::SameLine();
+            ImGui::TextUnformatted("| Cache");
+            ImGui::SameLine();
+            PushNumericFont();
+            ImGui::Text("%llu/%llu", static_cast<unsigned long long>(cacheStats.hits),
+                        static_cast<unsigned long long>(cacheStats.hits + cacheStats.misses));
+            PopNumericFont();
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("Shader bytecode cache: %llu hits, %llu misses, %llu entries",
+                                  static_cast<unsigned long long>(cacheStats.hits),
+                                  static_cast<unsigned long long>(cacheStats.misses),
+                                  static_cast<unsigned long long>(cacheStats.entryCount));
+            }
+        }
+    }
 }
 
 void ShaderLabIDE::GetShaderEditorCompileStatusDisplay(const char*& statusText, ImVec4& statusColor) const {
@@ -387,18 +424,11 @@ void ShaderLabIDE::CompileShaderEditorSelection() {
         m_scenes[m_editingSceneIndex].shaderCode = m_shaderState.text;
         m_scenes[m_editingSceneIndex].isDirty = true;
 
-        if (CompileScene(m_editingSceneIndex)) {
-            m_shaderState.status = CompileStatus::Success;
-            m_shaderState.lastCompiledText = m_shaderState.text;
-            m_playbackBlockedByCompileError = false;
-        } else {
-            if (m_editingSceneIndex >= 0 && m_editingSceneIndex < (int)m_scenes.size()) {
-                m_scenes[m_editingSceneIndex].compiledShaderBytes = 0;
-            } else {
-                Diagnostic diag;
-                diag.message = "No active scene selected.";
-                m_shaderState.diagnostics.push_back(diag);
-            }
+        // Result and diagnostics arrive through PumpSceneCompiles; the UI keeps running meanwhile
+        if (!SubmitSceneCompile(m_editingSceneIndex)) {
+            Diagnostic diag;
+            diag.message = "Scene compiler unavailable.";
+            m_shaderState.diagnostics.push_back(diag);
             m_shaderState.status = CompileStatus::Error;
             m_playbackBlockedByCompileError = true;
         }
@@ -523,6 +553,11 @@ void ShaderLabIDE::ShowShaderEditorBody(bool editorFocused, bool ctrlEnterPresse
                 (m_currentMode != UIMode::Scene || m_activeSceneIndex == m_editingSceneIndex)) {
                 m_scenes[m_editingSceneIndex].shaderCode = m_shaderState.text;
                 m_scenes[m_editingSceneIndex].isDirty = true;
+                // A compile of the previous text is now stale
+                CancelSceneCompiles(m_editingSceneIndex);
+                if (m_shaderState.status == CompileStatus::Compiling) {
+                    m_shaderState.status = CompileStatus::Dirty;
+                }
             }
         }
         if (m_shaderState.text != m_shaderState.lastCompiledText) {
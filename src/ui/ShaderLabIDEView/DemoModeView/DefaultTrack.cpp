@@ -12,6 +12,7 @@ void ShaderLabIDE::CreateDefaultTrack() {
     startRow.rowId = 0;
     startRow.sceneIndex = 0;
     m_track.rows.push_back(startRow);
+    m_track.MarkRowsChanged();
 }
 
 } // namespace ShaderLab
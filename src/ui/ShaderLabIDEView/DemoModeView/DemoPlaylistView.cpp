@@ -207,6 +207,7 @@ void ShaderLabIDE::RenderPlaylistSceneColumn(int beat,
     if (ImGui::Combo("##Scene", &comboIdx, sceneNames.data(), (int)sceneNames.size())) {
         row = EnsurePlaylistRowByBeat(beat);
         row->sceneIndex = comboIdx - 1;
+        m_track.MarkRowsChanged();
     }
     MarkPlaylistFocusedRow(beat, focusedBeatThisFrame);
 
@@ -398,6 +399,7 @@ TrackerRow* ShaderLabIDE::EnsurePlaylistRowByBeat(int targetBeat) {
     TrackerRow newRow;
     newRow.rowId = targetBeat;
     m_track.rows.push_back(newRow);
+    m_track.MarkRowsChanged();
     return &m_track.rows.back();
 }
 
@@ -596,6 +598,7 @@ void ShaderLabIDE::ShowDemoPlaylist() {
     if (m_track.rows.empty()) {
         TrackerRow startRow; startRow.rowId = 0;
         m_track.rows.push_back(startRow);
+        m_track.MarkRowsChanged();
     }
 
     if (ImGui::Begin("Demo: Playlist")) {
@@ -84,6 +84,7 @@ void ShaderLabIDE::ShowPostFxChainWindow() {
                     }
                     ImGui::SameLine();
                     if (LabeledActionButton("RemoveFx", OpenFontIcons::kTrash2, "Del", "Remove effect", ImVec2(90.0f, 0.0f))) {
+                        RetireEffectGpuObjects(m_postFxDraftChain[i]);
                         m_postFxDraftChain.erase(m_postFxDraftChain.begin() + i);
                         if (m_postFxSelectedIndex >= (int)m_postFxDraftChain.size()) {
                             m_postFxSelectedIndex = (int)m_postFxDraftChain.size() - 1;
@@ -173,6 +174,9 @@ void ShaderLabIDE::ShowPostFxChainWindow() {
                         fx.historyCount = historyCount;
                         fx.historyInitialized = false;
                         fx.historyIndex = 0;
+                        for (auto& texture : fx.historyTextures) {
+                            RetireGpuObject(std::move(texture));
+                        }
                         fx.historyTextures.clear();
                         RefreshPresetService();
                     };
@@ -214,6 +218,7 @@ void ShaderLabIDE::ShowPostFxChainWindow() {
                     }
                     ImGui::SameLine();
                     if (LabeledActionButton("RemoveCompute", OpenFontIcons::kTrash2, "Del", "Remove effect", ImVec2(90.0f, 0.0f))) {
+                        RetireEffectGpuObjects(m_computeEffectDraftChain[i]);
                         m_computeEffectDraftChain.erase(m_computeEffectDraftChain.begin() + i);
                         if (m_computeEffectSelectedIndex >= (int)m_computeEffectDraftChain.size()) {
                             m_computeEffectSelectedIndex = (int)m_computeEffectDraftChain.size() - 1;
@@ -28,6 +28,12 @@ void ShaderLabIDE::ShowPostFxSourceWindow() {
             int newIndex = sourceIndex - 1;
             if (newIndex != m_postFxSourceSceneIndex) {
                 m_postFxSourceSceneIndex = newIndex;
+                for (auto& fx : m_postFxDraftChain) {
+                    RetireEffectGpuObjects(fx);
+                }
+                for (auto& fx : m_computeEffectDraftChain) {
+                    RetireEffectGpuObjects(fx);
+                }
                 if (m_postFxSourceSceneIndex >= 0 && m_postFxSourceSceneIndex < (int)m_scenes.size()) {
                     m_postFxDraftChain = m_scenes[m_postFxSourceSceneIndex].postFxChain;
                     m_computeEffectDraftChain = m_scenes[m_postFxSourceSceneIndex].computeEffectChain;
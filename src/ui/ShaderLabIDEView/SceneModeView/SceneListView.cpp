@@ -79,6 +79,7 @@ float4 main(float2 fragCoord, float2 iResolution, float iTime) {
                     RefreshPresetService();
                 }
                 if (ImGui::MenuItem("Delete", nullptr, false, m_scenes.size() > 1)) {
+                    RetireSceneGpuObjects(m_scenes[i]);
                     m_scenes.erase(m_scenes.begin() + i);
                     if (m_activeSceneIndex >= (int)m_scenes.size()) {
                         m_activeSceneIndex = (int)m_scenes.size() - 1;
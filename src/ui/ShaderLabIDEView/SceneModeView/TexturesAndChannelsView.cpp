@@ -58,8 +58,7 @@ void ShaderLabIDE::ShowSceneTexturesAndChannels() {
 
                 if (GetOpenFileNameA(&ofn)) {
                     binding.filePath = ImportAssetIntoProject(szFile);
-                    LoadTextureFromFile(binding.filePath, binding.textureResource);
-                    binding.fileTextureValid = binding.textureResource != nullptr;
+                    RequestFileTexture(binding);
                 }
             };
 
@@ -170,7 +169,7 @@ void ShaderLabIDE::ShowSceneTexturesAndChannels() {
                     if (binding.enabled && m_deviceRef && m_srvHeap) {
                         ID3D12Resource* res = nullptr;
                         if (binding.bindingType == BindingType::File) {
-                            res = binding.textureResource.Get();
+                            res = binding.fileTextureValid ? binding.textureResource.Get() : nullptr;
                         } else if (binding.bindingType == BindingType::Scene && binding.sourceSceneIndex != -1) {
                             if (binding.sourceSceneIndex >= 0 && binding.sourceSceneIndex < (int)m_scenes.size()) {
                                 res = m_scenes[binding.sourceSceneIndex].texture.Get();
@@ -179,7 +178,8 @@ void ShaderLabIDE::ShowSceneTexturesAndChannels() {
 
                         if (res) {
                             D3D12_CPU_DESCRIPTOR_HANDLE dest = cpuStart;
-                            dest.ptr += thumbnailIdx * handleStep;
+                            const UINT descriptorIndex = GetImGuiFrameDescriptorIndex(static_cast<UINT>(thumbnailIdx));
+                            dest.ptr += descriptorIndex * handleStep;
 
                             D3D12_RESOURCE_DESC desc = res->GetDesc();
                             D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
@@ -200,7 +200,7 @@ void ShaderLabIDE::ShowSceneTexturesAndChannels() {
                             }
 
                             m_deviceRef->GetDevice()->CreateShaderResourceView(res, &srvDesc, dest);
-                            texID = (ImTextureID)(gpuStart.ptr + thumbnailIdx * handleStep);
+                            texID = (ImTextureID)(gpuStart.ptr + descriptorIndex * handleStep);
                             thumbnailIdx++;
                         }
                     }
@@ -300,8 +300,7 @@ void ShaderLabIDE::ShowSceneTexturesAndChannels() {
                             if (ImGui::InputText("File Path", pathBuf, sizeof(pathBuf))) {
                                 binding.filePath = pathBuf;
                                 if (!binding.filePath.empty()) {
-                                    LoadTextureFromFile(binding.filePath, binding.textureResource);
-                                    binding.fileTextureValid = binding.textureResource != nullptr;
+                                    RequestFileTexture(binding);
                                 }
                             }
                             if (LabeledActionButton("BrowseTexture", OpenFontIcons::kFolder, "Browse", "Browse texture file", ImVec2(120.0f * dpiScale, 0.0f))) {
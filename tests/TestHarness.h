@@ -0,0 +1,73 @@
+#pragma once
+
+// Minimal headless test harness: TEST_CASE registers a function, CHECK records a
+// failure and keeps going, REQUIRE stops the current case. TestMain.cpp runs every
+// registered case, or only those whose name contains argv[1].
+
+#include <cstdio>
+#include <filesystem>
+#include <system_error>
+#include <vector>
+
+namespace ShaderLabTest {
+
+struct TestCase {
+    const char* name;
+    void (*function)();
+};
+
+inline std::vector<TestCase>& Registry() {
+    static std::vector<TestCase> cases;
+    return cases;
+}
+
+inline int& FailureCount() {
+    static int failures = 0;
+    return failures;
+}
+
+struct Registrar {
+    Registrar(const char* name, void (*function)()) { Registry().push_back({name, function}); }
+};
+
+struct RequireFailed {};
+
+inline void ReportFailure(const char* file, int line, const char* expression) {
+    ++FailureCount();
+    std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", file, line, expression);
+}
+
+// Fresh, empty directory under the system temp path for files a case writes.
+inline std::filesystem::path ScratchDirectory(const char* name) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "shaderlab_tests" / name;
+    std::error_code ec;
+    std::filesystem::remove_all(path, ec);
+    std::filesystem::create_directories(path, ec);
+    return path;
+}
+
+} // namespace ShaderLabTest
+
+#define SHADERLAB_TEST_CONCAT_INNER(a, b) a##b
+#define SHADERLAB_TEST_CONCAT(a, b) SHADERLAB_TEST_CONCAT_INNER(a, b)
+
+#define TEST_CASE(name)                                                                              \
+    static void SHADERLAB_TEST_CONCAT(TestFunction_, __LINE__)();                                    \
+    static ::ShaderLabTest::Registrar SHADERLAB_TEST_CONCAT(TestRegistrar_, __LINE__)(               \
+        name, &SHADERLAB_TEST_CONCAT(TestFunction_, __LINE__));                                      \
+    static void SHADERLAB_TEST_CONCAT(TestFunction_, __LINE__)()
+
+#define CHECK(expression)                                                                            \
+    do {                                                                                             \
+        if (!(expression)) {                                                                         \
+            ::ShaderLabTest::ReportFailure(__FILE__, __LINE__, #expression);                         \
+        }                                                                                            \
+    } while (false)
+
+#define REQUIRE(expression)                                                                          \
+    do {                                                                                             \
+        if (!(expression)) {                                                                         \
+            ::ShaderLabTest::ReportFailure(__FILE__, __LINE__, #expression);                         \
+            throw ::ShaderLabTest::RequireFailed{};                                                  \
+        }                                                                                            \
+    } while (false)
@@ -0,0 +1,30 @@
+#include "TestHarness.h"
+
+#include <cstring>
+#include <exception>
+
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+    int ran = 0;
+    int failedCases = 0;
+    for (const auto& testCase : ShaderLabTest::Registry()) {
+        if (filter && !std::strstr(testCase.name, filter)) {
+            continue;
+        }
+        const int failuresBefore = ShaderLabTest::FailureCount();
+        try {
+            testCase.function();
+        } catch (const ShaderLabTest::RequireFailed&) {
+        } catch (const std::exception& e) {
+            ++ShaderLabTest::FailureCount();
+            std::fprintf(stderr, "%s: unexpected exception: %s\n", testCase.name, e.what());
+        }
+        ++ran;
+        if (ShaderLabTest::FailureCount() != failuresBefore) {
+            ++failedCases;
+            std::fprintf(stderr, "[FAIL] %s\n", testCase.name);
+        }
+    }
+    std::printf("%d test cases, %d failed\n", ran, failedCases);
+    return failedCases == 0 && ran > 0 ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Audio/AudioByteStream.h"
+
+#include <cstdint>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+std::vector<uint8_t> Sequence(size_t size) {
+    std::vector<uint8_t> bytes(size);
+    for (size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+    return bytes;
+}
+
+} // namespace
+
+TEST_CASE("AudioByteStream reads a view without copying it") {
+    const std::vector<uint8_t> bytes = Sequence(300);
+    AudioByteStream stream;
+    REQUIRE(stream.OpenView(bytes));
+    CHECK(stream.Size() == 300);
+    CHECK(stream.GetResidentBytes() == 0);
+
+    uint8_t out[256] = {};
+    CHECK(stream.Read(out, 100) == 100);
+    CHECK(out[99] == 99);
+    CHECK(stream.Read(out, 256) == 200);
+    CHECK(out[0] == 100);
+    CHECK(stream.Read(out, 16) == 0);
+    CHECK(stream.Tell() == 300);
+}
+
+TEST_CASE("AudioByteStream seeks from every origin and rejects out-of-range targets") {
+    AudioByteStream stream;
+    REQUIRE(stream.OpenOwned(Sequence(64)));
+    CHECK(stream.GetResidentBytes() == 64);
+
+    uint8_t value = 0;
+    CHECK(stream.Seek(10, AudioByteStream::Origin::Start));
+    CHECK(stream.Read(&value, 1) == 1);
+    CHECK(value == 10);
+    CHECK(stream.Seek(5, AudioByteStream::Origin::Current));
+    CHECK(stream.Read(&value, 1) == 1);
+    CHECK(value == 16);
+    CHECK(stream.Seek(-4, AudioByteStream::Origin::End));
+    CHECK(stream.Read(&value, 1) == 1);
+    CHECK(value == 60);
+
+    CHECK(!stream.Seek(-1, AudioByteStream::Origin::Start));
+    CHECK(!stream.Seek(1, AudioByteStream::Origin::End));
+    CHECK(stream.Tell() == 61);
+    CHECK(stream.Seek(0, AudioByteStream::Origin::End));
+    CHECK(stream.Read(&value, 1) == 0);
+}
+
+TEST_CASE("AudioByteStream refuses empty sources and releases owned bytes on close") {
+    AudioByteStream stream;
+    CHECK(!stream.OpenView({}));
+    CHECK(!stream.OpenOwned({}));
+
+    REQUIRE(stream.OpenOwned(Sequence(32)));
+    stream.Close();
+    CHECK(stream.Size() == 0);
+    CHECK(stream.GetResidentBytes() == 0);
+    uint8_t value = 0;
+    CHECK(stream.Read(&value, 1) == 0);
+}
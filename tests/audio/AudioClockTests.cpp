@@ -0,0 +1,194 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Audio/AudioClock.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+
+using namespace ShaderLab;
+
+namespace {
+
+constexpr uint32_t kSampleRate = 48000;
+constexpr uint32_t kPeriodFrames = 480;       // 10 ms device period
+constexpr double kFrameSeconds = 1.0 / 60.0;  // Render rate, unrelated to the period
+
+// An audio device that mixes whole periods: the cursor jumps by kPeriodFrames at a time
+// and runs `speed` times faster than the wall clock.
+struct SteppedCursor {
+    double speed = 1.0;
+
+    AudioClockSample At(double wallSeconds) const {
+        const uint64_t frames = static_cast<uint64_t>(wallSeconds * speed * kSampleRate);
+        AudioClockSample sample;
+        sample.valid = true;
+        sample.cursorFrames = frames / kPeriodFrames * kPeriodFrames;
+        sample.sampleRate = kSampleRate;
+        return sample;
+    }
+};
+
+} // namespace
+
+TEST_CASE("AudioClockFilter locks onto the first audible reading") {
+    AudioClockFilter filter;
+    CHECK(!filter.IsLocked());
+    CHECK(filter.Update(10.0, 2.0, 0.03) == 2.0 - 0.03);
+    CHECK(filter.IsLocked());
+    CHECK(filter.GetTelemetry().latencySeconds == 0.03);
+    CHECK(filter.GetTelemetry().updates == 1);
+}
+
+TEST_CASE("AudioClockFilter smooths a cursor that advances in device periods") {
+    AudioClockFilter filter;
+    const SteppedCursor cursor;
+    double previous = 0.0;
+    double worstRawError = 0.0;
+    double worstFilteredError = 0.0;
+    double worstStep = 0.0;
+    for (int frame = 0; frame < 600; ++frame) {
+        const double wall = frame * kFrameSeconds;
+        const double raw = cursor.At(wall).CursorSeconds();
+        const double filtered = filter.Update(wall, raw, 0.0);
+        if (frame >= 120) {
+            // Settled: compare both against the true (continuous) audio time.
+            worstRawError = (std::max)(worstRawError, std::abs(raw - wall));
+            worstFilteredError = (std::max)(worstFilteredError, std::abs(filtered - wall));
+            worstStep = (std::max)(worstStep, std::abs((filtered - previous) - kFrameSeconds));
+        }
+        previous = filtered;
+    }
+    CHECK(worstRawError > 0.009);
+    CHECK(worstFilteredError < 0.007);
+    CHECK(worstFilteredError < worstRawError);
+    // Visuals advance by nearly a constant step per frame.
+    CHECK(worstStep < 0.002);
+    CHECK(filter.GetTelemetry().resyncs == 0);
+    CHECK(filter.GetTelemetry().jitterSeconds < 0.01);
+}
+
+TEST_CASE("AudioClockFilter follows a device clock that runs fast") {
+    AudioClockFilter filter;
+    SteppedCursor cursor;
+    cursor.speed = 1.005;
+    double error = 0.0;
+    for (int frame = 0; frame < 60 * 120; ++frame) {
+        const double wall = frame * kFrameSeconds;
+        const double filtered = filter.Update(wall, cursor.At(wall).CursorSeconds(), 0.0);
+        error = filtered - wall * cursor.speed;
+    }
+    CHECK(std::abs(filter.GetTelemetry().rate - 1.005) < 0.001);
+    CHECK(std::abs(error) < 0.01);
+    CHECK(std::abs(filter.GetTelemetry().driftSeconds) < 0.005);
+    CHECK(filter.GetTelemetry().resyncs == 0);
+}
+
+TEST_CASE("AudioClockFilter snaps on a seek instead of slewing") {
+    AudioClockFilter filter;
+    for (int frame = 0; frame < 60; ++frame) {
+        filter.Update(frame * kFrameSeconds, frame * kFrameSeconds, 0.0);
+    }
+    const double wall = 60 * kFrameSeconds;
+    CHECK(filter.Update(wall, 30.0, 0.0) == 30.0);
+    CHECK(filter.GetTelemetry().resyncs == 1);
+    CHECK(filter.GetTelemetry().rate == 1.0);
+
+    // Going backwards (a loop) snaps as well.
+    CHECK(filter.Update(wall + kFrameSeconds, 0.5, 0.0) == 0.5);
+    CHECK(filter.GetTelemetry().resyncs == 2);
+}
+
+TEST_CASE("AudioClockFilter never bends the rate past its limit") {
+    AudioClockFilter::Settings settings;
+    settings.maxRateDeviation = 0.02;
+    AudioClockFilter filter(settings);
+    SteppedCursor cursor;
+    cursor.speed = 1.2;
+    for (int frame = 0; frame < 600; ++frame) {
+        const double wall = frame * kFrameSeconds;
+        filter.Update(wall, cursor.At(wall).CursorSeconds(), 0.0);
+        CHECK(filter.GetTelemetry().rate <= 1.02 + 1e-12);
+        CHECK(filter.GetTelemetry().rate >= 0.98 - 1e-12);
+    }
+    // The phase correction absorbs what the clamped rate cannot.
+    const double wall = 600 * kFrameSeconds;
+    CHECK(std::abs(filter.Update(wall, cursor.At(wall).CursorSeconds(), 0.0) - wall * cursor.speed) < 0.05);
+}
+
+TEST_CASE("AudioClockFilter reset unlocks but keeps the resync count") {
+    AudioClockFilter filter;
+    filter.Update(0.0, 0.0, 0.0);
+    filter.Update(0.1, 5.0, 0.0);
+    REQUIRE(filter.GetTelemetry().resyncs == 1);
+
+    filter.Reset();
+    CHECK(!filter.IsLocked());
+    CHECK(filter.GetTelemetry().updates == 0);
+    CHECK(filter.GetTelemetry().resyncs == 1);
+    CHECK(filter.Update(3.0, 1.0, 0.0) == 1.0);
+}
+
+TEST_CASE("AudioClockSnapshot extrapolates only while playing") {
+    AudioClockSnapshot snapshot;
+    snapshot.timeSeconds = 4.0;
+    snapshot.wallSeconds = 10.0;
+    snapshot.rate = 1.01;
+    snapshot.playing = true;
+    CHECK(std::abs(snapshot.TimeAt(12.0) - 6.02) < 1e-9);
+    snapshot.playing = false;
+    CHECK(snapshot.TimeAt(12.0) == 4.0);
+
+    AudioClockSample sample;
+    CHECK(sample.CursorSeconds() == 0.0);
+    sample.sampleRate = kSampleRate;
+    sample.cursorFrames = kSampleRate * 3;
+    CHECK(sample.CursorSeconds() == 3.0);
+}
+
+TEST_CASE("AudioClockPublisher never hands a reader a torn snapshot") {
+    AudioClockPublisher publisher;
+    CHECK(!publisher.Read().playing);
+
+    // Every field of snapshot i is derived from i, so a mix of two writes shows up.
+    const auto make = [](uint32_t i) {
+        AudioClockSnapshot snapshot;
+        snapshot.timeSeconds = i;
+        snapshot.wallSeconds = i * 2.0;
+        snapshot.rate = i * 3.0;
+        snapshot.bpm = static_cast<float>(i % 1000);
+        snapshot.playing = (i & 1u) != 0;
+        return snapshot;
+    };
+
+    constexpr uint32_t kWrites = 200000;
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (uint32_t i = 1; i <= kWrites; ++i) {
+            publisher.Publish(make(i));
+        }
+        done.store(true);
+    });
+
+    uint32_t torn = 0;
+    double lastTime = 0.0;
+    bool wentBackwards = false;
+    while (!done.load()) {
+        const AudioClockSnapshot read = publisher.Read();
+        const uint32_t i = static_cast<uint32_t>(read.timeSeconds);
+        const AudioClockSnapshot expected = make(i);
+        if (i != 0 && (read.wallSeconds != expected.wallSeconds || read.rate != expected.rate ||
+                       read.bpm != expected.bpm || read.playing != expected.playing)) {
+            ++torn;
+        }
+        wentBackwards = wentBackwards || read.timeSeconds < lastTime;
+        lastTime = read.timeSeconds;
+    }
+    writer.join();
+
+    CHECK(torn == 0);
+    CHECK(!wentBackwards);
+    CHECK(publisher.Read().timeSeconds == kWrites);
+}
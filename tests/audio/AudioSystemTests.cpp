@@ -0,0 +1,116 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Audio/AudioSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+constexpr uint32_t kSampleRate = 48000;
+constexpr uint32_t kChannels = 2;
+
+void AppendU32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+void AppendU16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back(static_cast<uint8_t>(value));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+// 16-bit stereo WAV holding a constant level, so mixed output is easy to check.
+std::vector<uint8_t> MakeWav(uint32_t frames, int16_t level) {
+    const uint32_t dataBytes = frames * kChannels * 2u;
+    std::vector<uint8_t> wav;
+    wav.insert(wav.end(), {'R', 'I', 'F', 'F'});
+    AppendU32(wav, 36u + dataBytes);
+    wav.insert(wav.end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+    AppendU32(wav, 16);
+    AppendU16(wav, 1); // PCM
+    AppendU16(wav, kChannels);
+    AppendU32(wav, kSampleRate);
+    AppendU32(wav, kSampleRate * kChannels * 2u);
+    AppendU16(wav, kChannels * 2u);
+    AppendU16(wav, 16);
+    wav.insert(wav.end(), {'d', 'a', 't', 'a'});
+    AppendU32(wav, dataBytes);
+    for (uint32_t i = 0; i < frames * kChannels; ++i) {
+        AppendU16(wav, static_cast<uint16_t>(level));
+    }
+    return wav;
+}
+
+float Peak(const std::vector<float>& samples) {
+    float peak = 0.0f;
+    for (float sample : samples) {
+        peak = (std::max)(peak, std::fabs(sample));
+    }
+    return peak;
+}
+
+} // namespace
+
+TEST_CASE("AudioSystem decodes a streamed view without an output device") {
+    const std::vector<uint8_t> wav = MakeWav(kSampleRate, 16384);
+    AudioSystem audio;
+    REQUIRE(audio.InitializeWithoutDevice(kSampleRate, kChannels));
+    REQUIRE(audio.LoadAudioFromView(wav));
+    CHECK(audio.GetStreamResidentBytes() == 0);
+    CHECK(std::fabs(audio.GetDuration() - 1.0f) < 1.0e-3f);
+
+    std::vector<float> mixed(1024 * kChannels);
+    // Nothing is mixed until the sound starts.
+    CHECK(audio.ReadFrames(mixed.data(), 1024) == 1024);
+    CHECK(Peak(mixed) == 0.0f);
+
+    audio.Play();
+    CHECK(audio.ReadFrames(mixed.data(), 1024) == 1024);
+    CHECK(Peak(mixed) > 0.25f);
+    CHECK(std::fabs(audio.GetPlaybackTime() - 1024.0f / kSampleRate) < 1.0e-3f);
+
+    // Seeking pulls from the middle of the stream.
+    audio.Seek(0.5f);
+    CHECK(audio.ReadFrames(mixed.data(), 1024) == 1024);
+    CHECK(Peak(mixed) > 0.25f);
+    CHECK(std::fabs(audio.GetPlaybackTime() - (0.5f + 1024.0f / kSampleRate)) < 1.0e-3f);
+}
+
+TEST_CASE("AudioSystem keeps only an inflated buffer resident") {
+    std::vector<uint8_t> wav = MakeWav(4800, -8192);
+    const size_t wavBytes = wav.size();
+    AudioSystem audio;
+    REQUIRE(audio.InitializeWithoutDevice(kSampleRate, kChannels));
+    REQUIRE(audio.LoadAudioFromBuffer(std::move(wav)));
+    CHECK(audio.GetStreamResidentBytes() == wavBytes);
+
+    // Play past the end: the mix falls silent.
+    audio.Play();
+    std::vector<float> mixed(4096 * kChannels);
+    for (int block = 0; block < 3; ++block) {
+        audio.ReadFrames(mixed.data(), 4096);
+    }
+    CHECK(audio.ReadFrames(mixed.data(), 4096) == 4096);
+    CHECK(Peak(mixed) == 0.0f);
+
+    // Loading the next track releases the previous buffer.
+    const std::vector<uint8_t> next = MakeWav(480, 100);
+    REQUIRE(audio.LoadAudioFromView(next));
+    CHECK(audio.GetStreamResidentBytes() == 0);
+}
+
+TEST_CASE("AudioSystem rejects bytes that are not audio") {
+    const std::vector<uint8_t> garbage(512, 0x5A);
+    AudioSystem audio;
+    REQUIRE(audio.InitializeWithoutDevice(kSampleRate, kChannels));
+    CHECK(!audio.LoadAudioFromView(garbage));
+    CHECK(audio.GetStreamResidentBytes() == 0);
+    CHECK(!audio.LoadAudioFromView({}));
+}
@@ -0,0 +1,156 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Audio/OneShotVoice.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+constexpr uint32_t kChannels = 2;
+
+OneShotSample MakeSample(uint64_t frames, float level) {
+    OneShotSample sample;
+    sample.frames = frames;
+    sample.pcm.assign(static_cast<size_t>(frames) * kChannels, level);
+    return sample;
+}
+
+// Pulls `frames` frames the way the mixer does and returns whether a trigger was picked up.
+bool Pull(OneShotVoice& voice, std::vector<float>& out, uint64_t frames) {
+    out.assign(static_cast<size_t>(frames) * kChannels, -1.0f);
+    int64_t triggerNs = 0;
+    return voice.Read(out.data(), frames, triggerNs);
+}
+
+} // namespace
+
+TEST_CASE("OneShotVoice outputs silence while idle") {
+    OneShotVoice voice;
+    voice.Configure(kChannels);
+    std::vector<float> out;
+    CHECK(!Pull(voice, out, 64));
+    CHECK(!voice.IsSounding());
+    for (float value : out) {
+        CHECK(value == 0.0f);
+    }
+}
+
+TEST_CASE("OneShotVoice plays a trigger once and frees itself at the end") {
+    const OneShotSample sample = MakeSample(100, 0.5f);
+    OneShotVoice voice;
+    voice.Configure(kChannels);
+
+    voice.Trigger(&sample, 0.5f, 1234);
+    CHECK(voice.IsSounding());
+
+    std::vector<float> out(64 * kChannels);
+    int64_t triggerNs = 0;
+    CHECK(voice.Read(out.data(), 64, triggerNs));
+    CHECK(triggerNs == 1234);
+    CHECK(out.front() == 0.25f);
+    CHECK(out.back() == 0.25f);
+    CHECK(voice.IsSounding());
+
+    // The remaining 36 frames, then silence; the trigger is not picked up twice.
+    CHECK(!Pull(voice, out, 64));
+    CHECK(out[35 * kChannels] == 0.25f);
+    CHECK(out[36 * kChannels] == 0.0f);
+    CHECK(!voice.IsSounding());
+}
+
+TEST_CASE("OneShotVoice restarts when retriggered while sounding") {
+    const OneShotSample first = MakeSample(100, 1.0f);
+    const OneShotSample second = MakeSample(10, 2.0f);
+    OneShotVoice voice;
+    voice.Configure(kChannels);
+    std::vector<float> out;
+
+    voice.Trigger(&first, 1.0f, 0);
+    CHECK(Pull(voice, out, 50));
+    voice.Trigger(&second, 0.25f, 0);
+    CHECK(Pull(voice, out, 20));
+    CHECK(out[0] == 0.5f);
+    CHECK(out[10 * kChannels] == 0.0f);
+    CHECK(!voice.IsSounding());
+}
+
+TEST_CASE("OneShotVoice stop silences pending and playing hits but not later ones") {
+    const OneShotSample sample = MakeSample(100, 1.0f);
+    OneShotVoice voice;
+    voice.Configure(kChannels);
+    std::vector<float> out;
+
+    voice.Trigger(&sample, 1.0f, 0);
+    CHECK(Pull(voice, out, 10));
+    voice.Stop();
+    Pull(voice, out, 10);
+    CHECK(out[0] == 0.0f);
+    CHECK(!voice.IsSounding());
+
+    // Triggered but never mixed before the stop: dropped as well.
+    voice.Trigger(&sample, 1.0f, 0);
+    voice.Stop();
+    Pull(voice, out, 10);
+    CHECK(out[0] == 0.0f);
+    CHECK(!voice.IsSounding());
+
+    voice.Trigger(&sample, 1.0f, 0);
+    CHECK(Pull(voice, out, 10));
+    CHECK(out[0] == 1.0f);
+}
+
+TEST_CASE("OneShotVoice never loses a hit that lands as the previous one ends") {
+    // Short samples read in blocks that end them mid-callback, so triggers keep landing
+    // between the mixer finishing a hit and the voice being reported free.
+    const OneShotSample quiet = MakeSample(3, 1.0f);
+    const OneShotSample loud = MakeSample(3, 2.0f);
+    OneShotVoice voice;
+    voice.Configure(kChannels);
+
+    constexpr uint32_t kTriggers = 5000;
+    std::atomic<bool> triggersDone{false};
+    std::atomic<uint32_t> pickups{0};
+    std::atomic<uint32_t> wrongLevel{0};
+
+    std::thread mixer([&] {
+        std::vector<float> out(2 * kChannels);
+        for (;;) {
+            const bool finished = triggersDone.load(std::memory_order_acquire) && !voice.IsSounding();
+            int64_t triggerNs = 0;
+            if (voice.Read(out.data(), 2, triggerNs)) {
+                pickups.fetch_add(1, std::memory_order_relaxed);
+            }
+            // Each sample is published with the volume that brings it to 1.0.
+            for (float value : out) {
+                if (value != 0.0f && value != 1.0f) {
+                    wrongLevel.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            if (finished) {
+                return;
+            }
+            std::this_thread::yield();
+        }
+    });
+
+    for (uint32_t i = 0; i < kTriggers; ++i) {
+        while (voice.IsSounding()) {
+            std::this_thread::yield();
+        }
+        if (i & 1u) {
+            voice.Trigger(&loud, 0.5f, i);
+        } else {
+            voice.Trigger(&quiet, 1.0f, i);
+        }
+    }
+    triggersDone.store(true, std::memory_order_release);
+    mixer.join();
+
+    CHECK(pickups.load() == kTriggers);
+    CHECK(wrongLevel.load() == 0);
+}
@@ -0,0 +1,113 @@
+// Throughput of the pack build's HLSL passes: lexing, function discovery and the full
+// module transform (entrypoint remap, helper scoping, compaction), on the creative/shaders
+// samples and on synthetic modules of increasing size. Pass --smoke for a tiny run (used
+// by ctest).
+
+#include "ShaderLab/DevKit/HlslModuleTransform.h"
+#include "ShaderLab/DevKit/HlslTokenizer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ShaderLab;
+namespace fs = std::filesystem;
+
+namespace {
+
+// One helper per block, each calling the previous one, plus comments, a directive and a
+// string so every token kind shows up.
+std::string MakeSyntheticModule(size_t targetBytes) {
+    std::string source = "#define STEPS 64\n// Synthetic benchmark module\n";
+    for (int i = 0; source.size() < targetBytes; ++i) {
+        source += "float helper" + std::to_string(i) + "(float2 p, float t) /* block comment */ {\n";
+        source += "    float2 q = float2(p.x * 1.500000 + t, p.y - 0.250000);\n";
+        source += "    for (int k = 0; k < STEPS; ++k) { q = abs(q) / dot(q, q) - 0.75; }\n";
+        if (i > 0) {
+            source += "    q.x += helper" + std::to_string(i - 1) + "(q, t * 0.5);\n";
+        }
+        source += "    return length(q) + sin(t); // trailing comment\n}\n\n";
+    }
+    source += "float4 main(float2 fragCoord, float2 iResolution, float iTime) {\n";
+    source += "    return float4(helper0(fragCoord / iResolution, iTime).xxx, 1.0);\n}\n";
+    return source;
+}
+
+std::string ReadText(const fs::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+double MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <class Function>
+double AverageMs(int iterations, Function&& function) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        function();
+    }
+    return MillisecondsSince(start) / iterations;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool smoke = argc > 1 && std::strcmp(argv[1], "--smoke") == 0;
+
+    std::vector<std::pair<std::string, std::string>> modules;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(SHADERLAB_BENCH_SHADER_DIR, ec)) {
+        if (entry.path().extension() == ".hlsl") {
+            modules.emplace_back(entry.path().filename().string(), ReadText(entry.path()));
+        }
+    }
+    for (const size_t bytes : {size_t(16) << 10, size_t(270) << 10, size_t(2) << 20}) {
+        if (smoke && bytes > (size_t(16) << 10)) {
+            break;
+        }
+        modules.emplace_back("synthetic " + std::to_string(bytes >> 10) + " KB", MakeSyntheticModule(bytes));
+    }
+
+    ModuleSourceTransform transform;
+    transform.entrypointName = "s0";
+    transform.remapEntrypoint = true;
+    transform.scopeLocalFunctions = true;
+    transform.compact = true;
+
+    std::printf("%-24s %10s %8s %10s %10s %10s %10s\n", "module", "bytes", "tokens", "lex ms", "find ms", "transform", "MB/s lex");
+    for (const auto& [name, source] : modules) {
+        const int iterations = smoke ? 1 : (source.size() > (size_t(1) << 20) ? 5 : (source.size() > 32768 ? 20 : 500));
+
+        size_t tokens = 0;
+        const double lexMs = AverageMs(iterations, [&] {
+            const HlslTokenStream stream(source);
+            tokens = stream.Tokens().size();
+        });
+        const HlslTokenStream stream(source);
+        size_t functions = 0;
+        const double findMs = AverageMs(iterations, [&] {
+            functions = FindHlslFunctions(stream).size();
+        });
+        std::string output;
+        const double transformMs = AverageMs(iterations, [&] {
+            output = TransformModuleSource(source, transform);
+        });
+        if (functions == 0 || output.empty() || output.find("s0(") == std::string::npos) {
+            std::fprintf(stderr, "%s: transform lost the entrypoint\n", name.c_str());
+            return 1;
+        }
+
+        const double megabytesPerSecond = lexMs > 0.0 ? (source.size() / 1048576.0) / (lexMs / 1000.0) : 0.0;
+        std::printf("%-24s %10zu %8zu %10.3f %10.3f %10.3f %10.1f\n", name.c_str(), source.size(), tokens, lexMs, findMs,
+                    transformMs, megabytesPerSecond);
+    }
+    return 0;
+}
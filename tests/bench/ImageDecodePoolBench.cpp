@@ -0,0 +1,214 @@
+// Throughput of ImageDecodePool on in-memory PNGs, against decoding the same images
+// one after another on the calling thread the way the texture loader used to, and
+// with a budget small enough that workers have to wait for memory.
+// Pass --smoke for a tiny run (used by ctest).
+
+#include "ShaderLab/Core/ImageDecodePool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+double MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void AppendBigEndian(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(static_cast<uint8_t>(value >> 24));
+    out.push_back(static_cast<uint8_t>(value >> 16));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+uint32_t Crc32(const uint8_t* data, size_t size) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+void AppendChunk(std::vector<uint8_t>& png, const char type[4], const std::vector<uint8_t>& data) {
+    AppendBigEndian(png, static_cast<uint32_t>(data.size()));
+    const size_t typeOffset = png.size();
+    png.insert(png.end(), type, type + 4);
+    png.insert(png.end(), data.begin(), data.end());
+    AppendBigEndian(png, Crc32(png.data() + typeOffset, png.size() - typeOffset));
+}
+
+// RGBA8 PNG with Sub-filtered rows in stored deflate blocks: no compressor needed,
+// and the decoder still has to inflate, unfilter and convert every row.
+std::vector<uint8_t> EncodePng(uint32_t width, uint32_t height, uint32_t seed) {
+    std::vector<uint8_t> raw;
+    raw.reserve(static_cast<size_t>(height) * (1 + width * 4));
+    uint32_t state = seed * 2654435761u + 1u;
+    for (uint32_t y = 0; y < height; ++y) {
+        raw.push_back(1); // Sub
+        uint8_t previous[4] = {};
+        for (uint32_t x = 0; x < width; ++x) {
+            state = state * 1664525u + 1013904223u;
+            const uint8_t pixel[4] = {
+                static_cast<uint8_t>(x + (state >> 28)),
+                static_cast<uint8_t>(y + (state >> 29)),
+                static_cast<uint8_t>((x ^ y) + seed),
+                255,
+            };
+            for (int c = 0; c < 4; ++c) {
+                raw.push_back(static_cast<uint8_t>(pixel[c] - previous[c]));
+                previous[c] = pixel[c];
+            }
+        }
+    }
+
+    std::vector<uint8_t> zlib = {0x78, 0x01};
+    uint32_t adlerA = 1;
+    uint32_t adlerB = 0;
+    for (size_t offset = 0; offset < raw.size();) {
+        const size_t blockSize = (std::min)(raw.size() - offset, static_cast<size_t>(65535));
+        const bool last = offset + blockSize == raw.size();
+        zlib.push_back(last ? 1 : 0);
+        zlib.push_back(static_cast<uint8_t>(blockSize));
+        zlib.push_back(static_cast<uint8_t>(blockSize >> 8));
+        zlib.push_back(static_cast<uint8_t>(~blockSize));
+        zlib.push_back(static_cast<uint8_t>(~blockSize >> 8));
+        zlib.insert(zlib.end(), raw.begin() + static_cast<std::ptrdiff_t>(offset),
+                    raw.begin() + static_cast<std::ptrdiff_t>(offset + blockSize));
+        for (size_t i = offset; i < offset + blockSize; ++i) {
+            adlerA = (adlerA + raw[i]) % 65521u;
+            adlerB = (adlerB + adlerA) % 65521u;
+        }
+        offset += blockSize;
+    }
+    AppendBigEndian(zlib, (adlerB << 16) | adlerA);
+
+    std::vector<uint8_t> header;
+    AppendBigEndian(header, width);
+    AppendBigEndian(header, height);
+    header.insert(header.end(), {8, 6, 0, 0, 0}); // 8-bit RGBA, no interlace
+
+    std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    AppendChunk(png, "IHDR", header);
+    AppendChunk(png, "IDAT", zlib);
+    AppendChunk(png, "IEND", {});
+    return png;
+}
+
+struct RunResult {
+    double ms = 0.0;
+    size_t decoded = 0;
+    uint64_t checksum = 0;
+    ImageDecodeStats stats;
+};
+
+void Accumulate(RunResult& result, const DecodedImage& image) {
+    if (image.success) {
+        ++result.decoded;
+        result.checksum += image.rgba[image.rgba.size() / 2] + image.width;
+    }
+}
+
+RunResult RunInline(const std::vector<std::vector<uint8_t>>& encoded) {
+    RunResult result;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < encoded.size(); ++i) {
+        ImageDecodeJob job;
+        job.id = i;
+        job.path = "image_" + std::to_string(i) + ".png";
+        job.encoded = encoded[i];
+        Accumulate(result, ImageDecodePool::Decode(job));
+    }
+    result.ms = MillisecondsSince(start);
+    return result;
+}
+
+RunResult RunPool(const std::vector<std::vector<uint8_t>>& encoded, uint32_t workers, uint64_t maxBytesInFlight) {
+    RunResult result;
+    ImageDecodePool pool;
+    pool.Start(workers, maxBytesInFlight);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < encoded.size(); ++i) {
+        ImageDecodeJob job;
+        job.id = i;
+        job.path = "image_" + std::to_string(i) + ".png";
+        job.encoded = encoded[i];
+        pool.Submit(std::move(job));
+    }
+    // Consume one image at a time, as the loader uploads them.
+    DecodedImage image;
+    while (pool.WaitNext(image)) {
+        Accumulate(result, image);
+    }
+    result.ms = MillisecondsSince(start);
+    result.stats = pool.GetStats();
+    pool.Stop();
+    return result;
+}
+
+void Report(const char* label, const RunResult& result, size_t imageCount, uint64_t decodedBytes) {
+    const double seconds = result.ms / 1000.0;
+    std::printf("%-28s %8.2f ms  %7.1f images/s  %7.1f MB/s decoded",
+                label, result.ms, static_cast<double>(imageCount) / seconds,
+                static_cast<double>(decodedBytes) / (1024.0 * 1024.0) / seconds);
+    if (result.stats.imagesDecoded > 0) {
+        std::printf("  waits %llu  peak %.1f MB",
+                    static_cast<unsigned long long>(result.stats.budgetWaits),
+                    static_cast<double>(result.stats.peakBytesInFlight) / (1024.0 * 1024.0));
+    }
+    std::printf("\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool smoke = argc > 1 && std::strcmp(argv[1], "--smoke") == 0;
+    const size_t imageCount = smoke ? 8 : 48;
+    const uint32_t imageSize = smoke ? 64 : 1024;
+
+    std::vector<std::vector<uint8_t>> encoded;
+    uint64_t encodedBytes = 0;
+    for (size_t i = 0; i < imageCount; ++i) {
+        encoded.push_back(EncodePng(imageSize, imageSize, static_cast<uint32_t>(i)));
+        encodedBytes += encoded.back().size();
+    }
+    const uint64_t imageBytes = static_cast<uint64_t>(imageSize) * imageSize * 4ull;
+    const uint64_t decodedBytes = imageBytes * imageCount;
+    const uint32_t workers = ImageDecodePool::DefaultWorkerCount();
+
+    const RunResult inlineRun = RunInline(encoded);
+    const RunResult inlinePool = RunPool(encoded, 0, ImageDecodePool::kDefaultMaxBytesInFlight);
+    const RunResult pooled = RunPool(encoded, workers, ImageDecodePool::kDefaultMaxBytesInFlight);
+    // Room for about two images (encoded plus decoded): workers queue behind the consumer.
+    const RunResult budgeted = RunPool(encoded, workers, 2 * (imageBytes + encoded.front().size()));
+
+    std::printf("%zu images %ux%u, %.1f MB encoded, %.1f MB decoded, %u workers\n",
+                imageCount, imageSize, imageSize,
+                static_cast<double>(encodedBytes) / (1024.0 * 1024.0),
+                static_cast<double>(decodedBytes) / (1024.0 * 1024.0), workers);
+    Report("Decode, calling thread:", inlineRun, imageCount, decodedBytes);
+    Report("pool, 0 workers:", inlinePool, imageCount, decodedBytes);
+    Report("pool, default budget:", pooled, imageCount, decodedBytes);
+    Report("pool, two-image budget:", budgeted, imageCount, decodedBytes);
+    std::printf("checksum %llu\n", static_cast<unsigned long long>(inlineRun.checksum));
+
+    const RunResult* runs[] = {&inlineRun, &inlinePool, &pooled, &budgeted};
+    for (const RunResult* run : runs) {
+        if (run->decoded != imageCount || run->checksum != inlineRun.checksum) {
+            std::fprintf(stderr, "decode mismatch\n");
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,118 @@
+// Startup and lookup cost of the mapped PackageManager on a pack written by
+// Serializer::PackExecutable, against reading the whole file the way the loader
+// used to. Pass --smoke for a tiny run (used by ctest).
+
+#include "ShaderLab/Core/PackageManager.h"
+#include "ShaderLab/Core/Serializer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace ShaderLab;
+namespace fs = std::filesystem;
+
+namespace {
+
+double MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool smoke = argc > 1 && std::strcmp(argv[1], "--smoke") == 0;
+    const size_t entryCount = smoke ? 8 : 128;
+    const size_t entryBytes = smoke ? 16 * 1024 : 1024 * 1024;
+    const int lookupRounds = smoke ? 10 : 2000;
+
+    const fs::path dir = fs::temp_directory_path() / "shaderlab_bench" / "package_manager";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    fs::create_directories(dir, ec);
+
+    {
+        std::ofstream exe(dir / "player.exe", std::ios::binary);
+        exe << std::string(64 * 1024, 'x');
+    }
+    std::vector<Serializer::PackedExtraFile> extraFiles;
+    std::vector<char> payload(entryBytes);
+    for (size_t i = 0; i < entryCount; ++i) {
+        uint32_t state = static_cast<uint32_t>(i) * 2654435761u + 1u;
+        for (char& c : payload) {
+            state = state * 1664525u + 1013904223u;
+            c = static_cast<char>(state >> 24);
+        }
+        const fs::path source = dir / ("asset_" + std::to_string(i) + ".bin");
+        std::ofstream out(source, std::ios::binary);
+        out.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+        extraFiles.push_back({source.string(), "assets/asset_" + std::to_string(i) + ".bin"});
+    }
+
+    Serializer::PackOptions options;
+    options.includeProjectManifest = false;
+    const fs::path packPath = dir / "packed.exe";
+    if (!Serializer::PackExecutable((dir / "player.exe").string(), packPath.string(), "", extraFiles, options)) {
+        std::fprintf(stderr, "PackExecutable failed\n");
+        return 1;
+    }
+    const uint64_t packBytes = fs::file_size(packPath, ec);
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        std::ifstream in(packPath, std::ios::binary);
+        std::vector<uint8_t> whole((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        if (whole.size() != packBytes) {
+            return 1;
+        }
+    }
+    const double wholeReadMs = MillisecondsSince(start);
+
+    PackageManager& manager = PackageManager::Get();
+    start = std::chrono::steady_clock::now();
+    if (!manager.InitializeFromFile(packPath.string())) {
+        std::fprintf(stderr, "InitializeFromFile failed\n");
+        return 1;
+    }
+    const double initializeMs = MillisecondsSince(start);
+
+    size_t found = 0;
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < lookupRounds; ++round) {
+        for (const auto& file : extraFiles) {
+            found += manager.HasFile(file.packedPath) ? 1 : 0;
+        }
+    }
+    const double lookupNs = MillisecondsSince(start) * 1.0e6 / static_cast<double>(lookupRounds * extraFiles.size());
+
+    uint64_t checksum = 0;
+    start = std::chrono::steady_clock::now();
+    for (const auto& file : extraFiles) {
+        const std::span<const uint8_t> view = manager.GetFileView(file.packedPath);
+        for (size_t i = 0; i < view.size(); i += 4096) {
+            checksum += view[i];
+        }
+    }
+    const double viewMs = MillisecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (const auto& file : extraFiles) {
+        const std::vector<uint8_t> copy = manager.GetFile(file.packedPath);
+        checksum += copy.empty() ? 0 : copy.back();
+    }
+    const double copyMs = MillisecondsSince(start);
+
+    std::printf("pack: %zu entries, %.1f MB\n", entryCount, static_cast<double>(packBytes) / (1024.0 * 1024.0));
+    std::printf("read whole file:       %8.3f ms\n", wholeReadMs);
+    std::printf("mapped initialize:     %8.3f ms\n", initializeMs);
+    std::printf("hashed lookup:         %8.1f ns/entry (%zu hits)\n", lookupNs, found);
+    std::printf("GetFileView, touch:    %8.3f ms\n", viewMs);
+    std::printf("GetFile, copy:         %8.3f ms\n", copyMs);
+    std::printf("checksum %llu\n", static_cast<unsigned long long>(checksum));
+    return found == static_cast<size_t>(lookupRounds) * extraFiles.size() ? 0 : 1;
+}
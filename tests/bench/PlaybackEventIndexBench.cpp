@@ -0,0 +1,117 @@
+// Seek cost on a long track: collecting the rows a seek or stalled frame skips over and
+// finding the next scene row, with PlaybackEventIndex against the beat-by-beat scan it
+// replaced. "cold" includes the index rebuild a row edit triggers before the seek. Pass
+// --smoke for a tiny run (used by ctest).
+
+#include "ShaderLab/Core/PlaybackEventIndex.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+using TriggeredRows = std::vector<std::pair<int, const TrackerRow*>>;
+
+// The scan PlaybackEventIndex replaces: every beat in the range, every row in track order.
+void LinearCollect(const DemoTrack& track, int fromBeatExclusive, int toBeatInclusive, TriggeredRows& rows) {
+    rows.clear();
+    for (int beat = fromBeatExclusive + 1; beat <= toBeatInclusive; ++beat) {
+        for (const auto& row : track.rows) {
+            if (row.rowId == beat) {
+                rows.emplace_back(beat, &row);
+            }
+        }
+    }
+}
+
+const TrackerRow* LinearNextSceneRow(const DemoTrack& track, int afterBeat) {
+    const TrackerRow* best = nullptr;
+    for (const auto& row : track.rows) {
+        if (row.sceneIndex >= 0 && row.rowId > afterBeat && (!best || row.rowId < best->rowId)) {
+            best = &row;
+        }
+    }
+    return best;
+}
+
+// Unsorted beats with duplicates, as the playlist editor produces them.
+DemoTrack MakeTrack(int rowCount, int lengthBeats) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> beat(0, lengthBeats - 1);
+    std::uniform_int_distribution<int> scene(-1, 7);
+    DemoTrack track;
+    track.lengthBeats = lengthBeats;
+    track.rows.resize(static_cast<size_t>(rowCount));
+    for (auto& row : track.rows) {
+        row.rowId = beat(rng);
+        row.sceneIndex = scene(rng);
+    }
+    track.MarkRowsChanged();
+    return track;
+}
+
+double MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <class Function>
+double AverageMs(int iterations, Function&& function) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        function();
+    }
+    return MillisecondsSince(start) / iterations;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool smoke = argc > 1 && std::strcmp(argv[1], "--smoke") == 0;
+    const int rowCount = smoke ? 500 : 10000;
+    const int lengthBeats = smoke ? 256 : 8192;
+    const DemoTrack track = MakeTrack(rowCount, lengthBeats);
+
+    PlaybackEventIndex index;
+    const double buildMs = AverageMs(smoke ? 1 : 50, [&] { index.Build(track); });
+    std::printf("%d rows over %d beats, index build %.3f ms\n\n", rowCount, lengthBeats, buildMs);
+
+    std::printf("%12s %8s %12s %12s %12s %12s %10s\n", "seek beats", "rows", "scan ms", "index ms", "cold ms", "next scan", "next idx");
+    const int spans[] = {1, 16, 500, 2000, 4000, 8000};
+    for (const int span : spans) {
+        if (span >= lengthBeats) {
+            break;
+        }
+        const int from = (lengthBeats - span) / 2;
+        const int to = from + span;
+        // Single-beat steps are a normal frame; keep their averages meaningful.
+        const int scanIterations = smoke ? 1 : (span >= 500 ? 3 : 200);
+        const int indexIterations = smoke ? 1 : 2000;
+
+        TriggeredRows scanned;
+        TriggeredRows indexed;
+        const double scanMs = AverageMs(scanIterations, [&] { LinearCollect(track, from, to, scanned); });
+        const double indexMs = AverageMs(indexIterations, [&] { index.CollectRows(track, from, to, indexed); });
+        const double coldMs = AverageMs(smoke ? 1 : 50, [&] {
+            index.Build(track);
+            index.CollectRows(track, from, to, indexed);
+        });
+        const TrackerRow* scannedNext = nullptr;
+        const TrackerRow* indexedNext = nullptr;
+        const double nextScanMs = AverageMs(indexIterations / 10 + 1, [&] { scannedNext = LinearNextSceneRow(track, to); });
+        const double nextIndexMs = AverageMs(indexIterations, [&] { indexedNext = index.FindNextSceneRow(track, to); });
+        if (indexed != scanned || indexedNext != scannedNext) {
+            std::fprintf(stderr, "seek of %d beats: index and scan disagree\n", span);
+            return 1;
+        }
+
+        std::printf("%12d %8zu %12.3f %12.4f %12.3f %12.4f %10.5f\n", span, indexed.size(), scanMs, indexMs, coldMs,
+                    nextScanMs, nextIndexMs);
+    }
+    return 0;
+}
@@ -0,0 +1,127 @@
+// Load time of project.json against the binary project encoding (ProjectBinary.h)
+// for synthetic projects with 10, 100 and 1000 scenes, from disk and from bytes
+// already in memory (the packed-player path). Pass --smoke for a tiny run.
+
+#include "ShaderLab/Core/Serializer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace ShaderLab;
+namespace fs = std::filesystem;
+
+namespace {
+
+ProjectData MakeProject(int sceneCount) {
+    ProjectData project;
+    project.demoTitle = "Bench";
+    project.track.bpm = 128.0f;
+    for (int i = 0; i < sceneCount; ++i) {
+        Scene scene("scene" + std::to_string(i),
+                    std::string(4000, static_cast<char>('a' + i % 26)) + "\nfloat4 main(float2 fragCoord, float2 iResolution, float iTime) { return 0; }\n");
+        scene.description = "Scene " + std::to_string(i);
+        scene.precompiledPath = "assets/shaders/scene_" + std::to_string(i) + ".cso";
+        for (int channel = 0; channel < 4; ++channel) {
+            TextureBinding binding;
+            binding.channelIndex = channel;
+            binding.enabled = channel < 2;
+            binding.bindingType = channel == 0 ? BindingType::File : BindingType::Scene;
+            binding.filePath = channel == 0 ? "assets/tex" + std::to_string(i % 7) + ".png" : "";
+            binding.sourceSceneIndex = channel;
+            scene.bindings.push_back(binding);
+        }
+        scene.postFxChain.emplace_back("fx", std::string(1500, 'f'));
+        Scene::ComputeEffect effect("effect", Scene::ComputeEffect::Type::Temporal, "code" + std::to_string(i));
+        effect.historyCount = 1;
+        project.scenes.push_back(std::move(scene));
+        project.scenes.back().computeEffectChain.push_back(effect);
+
+        TrackerRow row;
+        row.rowId = i;
+        row.sceneIndex = i;
+        row.transitionPresetStem = "fade";
+        row.stop = i % 3 == 0;
+        project.track.rows.push_back(row);
+    }
+    AudioClip clip;
+    clip.name = "music";
+    clip.path = "assets/music.ogg";
+    project.audioLibrary.push_back(clip);
+    return project;
+}
+
+std::vector<uint8_t> ReadFile(const fs::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+template <class Function>
+double AverageMs(int iterations, Function&& function) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        if (!function()) {
+            return -1.0;
+        }
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool smoke = argc > 1 && std::strcmp(argv[1], "--smoke") == 0;
+    const fs::path dir = fs::temp_directory_path() / "shaderlab_bench" / "project_load";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    fs::create_directories(dir, ec);
+
+    std::printf("scenes   json bytes  binary bytes   json file   binary file   json mem   binary mem\n");
+    for (const int sceneCount : {10, 100, 1000}) {
+        if (smoke && sceneCount > 10) {
+            break;
+        }
+        const ProjectData project = MakeProject(sceneCount);
+        const fs::path jsonPath = dir / "project.json";
+        const fs::path binaryPath = dir / "project.bin";
+        if (!Serializer::SaveProject(project, jsonPath.string()) || !Serializer::SaveProjectBinary(project, binaryPath.string())) {
+            std::fprintf(stderr, "failed to write the project\n");
+            return 1;
+        }
+        const std::vector<uint8_t> jsonBytes = ReadFile(jsonPath);
+        const std::vector<uint8_t> binaryBytes = ReadFile(binaryPath);
+        const int iterations = smoke ? 1 : (sceneCount >= 1000 ? 5 : 50);
+
+        ProjectData loaded;
+        const double jsonFileMs = AverageMs(iterations, [&] {
+            loaded = ProjectData{};
+            return Serializer::LoadProject(jsonPath.string(), loaded);
+        });
+        const double binaryFileMs = AverageMs(iterations, [&] {
+            loaded = ProjectData{};
+            return Serializer::LoadProjectBinary(binaryPath.string(), loaded);
+        });
+        const double jsonMemoryMs = AverageMs(iterations, [&] {
+            loaded = ProjectData{};
+            return Serializer::LoadProjectFromJson(std::string(jsonBytes.begin(), jsonBytes.end()), loaded);
+        });
+        const double binaryMemoryMs = AverageMs(iterations, [&] {
+            loaded = ProjectData{};
+            return Serializer::LoadProjectFromBinary(binaryBytes, loaded);
+        });
+        if (jsonFileMs < 0.0 || binaryFileMs < 0.0 || jsonMemoryMs < 0.0 || binaryMemoryMs < 0.0 ||
+            loaded.scenes.size() != project.scenes.size() || loaded.scenes.back().shaderCode != project.scenes.back().shaderCode) {
+            std::fprintf(stderr, "load failed or round trip mismatch at %d scenes\n", sceneCount);
+            return 1;
+        }
+
+        std::printf("%6d %12zu %13zu %9.3f ms %10.3f ms %7.3f ms %9.3f ms\n", sceneCount, jsonBytes.size(), binaryBytes.size(),
+                    jsonFileMs, binaryFileMs, jsonMemoryMs, binaryMemoryMs);
+    }
+    return 0;
+}
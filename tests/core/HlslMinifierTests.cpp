@@ -0,0 +1,124 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/DevKit/HlslMinifier.h"
+
+#include <string>
+#include <unordered_set>
+
+using namespace ShaderLab;
+
+namespace {
+
+std::string Minify(const std::string& source, const HlslMinifyOptions& options = {}, HlslMinifyStats* stats = nullptr) {
+    return MinifyHlsl(source, options, stats);
+}
+
+HlslMinifyOptions Preserving(std::unordered_set<std::string> names) {
+    HlslMinifyOptions options;
+    options.preserveNames = std::move(names);
+    return options;
+}
+
+} // namespace
+
+TEST_CASE("ShortenHlslFloatLiteral drops redundant digits") {
+    CHECK(ShortenHlslFloatLiteral("0.500000") == ".5");
+    CHECK(ShortenHlslFloatLiteral("0.0") == "0.");
+    CHECK(ShortenHlslFloatLiteral("1.0") == "1.");
+    CHECK(ShortenHlslFloatLiteral("10.0") == "10.");
+    CHECK(ShortenHlslFloatLiteral("1000.0") == "1e3");
+    CHECK(ShortenHlslFloatLiteral("1.0e+03") == "1e3");
+    CHECK(ShortenHlslFloatLiteral("2.50e-003") == "2.5e-3");
+    CHECK(ShortenHlslFloatLiteral("0.250f") == ".25f");
+    CHECK(ShortenHlslFloatLiteral("1.5000h") == "1.5h");
+}
+
+TEST_CASE("ShortenHlslFloatLiteral leaves integers, hex and short spellings alone") {
+    CHECK(ShortenHlslFloatLiteral("100").empty());
+    CHECK(ShortenHlslFloatLiteral("0x1E").empty());
+    CHECK(ShortenHlslFloatLiteral("0xFFu").empty());
+    CHECK(ShortenHlslFloatLiteral(".5").empty());
+    CHECK(ShortenHlslFloatLiteral("1e3").empty());
+    CHECK(ShortenHlslFloatLiteral("10.").empty()); // 1e1 is not shorter
+    CHECK(ShortenHlslFloatLiteral("1.0e").empty()); // Malformed exponent
+    CHECK(ShortenHlslFloatLiteral("1.5u").empty()); // Not a float suffix
+}
+
+TEST_CASE("MinifyHlsl keeps a space where the tokens would otherwise merge") {
+    CHECK(Minify("static const float a = 0x1E - 1;") == "static const float a=0x1E -1;");
+    CHECK(Minify("static const float b = 0x2e + 3;") == "static const float b=0x2e +3;");
+    CHECK(Minify("static const float c = 1.0e-3 - 1.0;") == "static const float c=1e-3-1.;");
+    CHECK(Minify("static const float d = x - -1.0;") == "static const float d=x- -1.;");
+}
+
+TEST_CASE("MinifyHlsl renames helpers, parameters and locals, most used first") {
+    const std::string source =
+        "float helper(float value) { float scaled = value * 2.0; return scaled + scaled; }\n"
+        "float4 s0(float2 fragCoord, float2 iResolution, float iTime) {\n"
+        "    float x = helper(iTime);\n"
+        "    return float4(x, x, x, 1.0);\n"
+        "}\n";
+    HlslMinifyStats stats;
+    const std::string out = Minify(source, Preserving({"s0"}), &stats);
+    CHECK(out ==
+          "float a(float c){float b=c*2.;return b+b;}"
+          "float4 s0(float2 c,float2 iResolution,float iTime){float b=a(iTime);return float4(b,b,b,1.);}");
+    CHECK(stats.renamedHelpers == 1);
+    CHECK(stats.renamedLocals == 4);
+    CHECK(stats.shortenedNumbers == 2);
+    CHECK(stats.inputBytes == source.size());
+    CHECK(stats.outputBytes == out.size());
+
+    // Deterministic.
+    CHECK(Minify(source, Preserving({"s0"})) == out);
+}
+
+TEST_CASE("MinifyHlsl never renames engine names, intrinsics, members or macro users") {
+    const std::string source =
+        "#define SCALE(v) (v * kScale)\n"
+        "struct Hit { float dist; };\n"
+        "static const float kScale = 2.0;\n"
+        "float length(float3 v) { return v.x; }\n"
+        "float tweak(float dist) { Hit hit; hit.dist = dist; return SCALE(hit.dist); }\n"
+        "float4 t1(float2 fragCoord, float2 iResolution, float iTime) {\n"
+        "    float v = tweak(iTime) + iChannel0.Sample(iSampler0, fragCoord).x;\n"
+        "    return float4(v, length(float3(1, 2, 3)), 0, 1);\n"
+        "}\n";
+    const std::string out = Minify(source, Preserving({"t1"}));
+    // Used inside a macro body: v keeps its name in both functions.
+    CHECK(out.find("#define SCALE(v) (v * kScale)\n") == 0);
+    CHECK(out.find("float v=") != std::string::npos);
+    CHECK(out.find("static const float kScale=2.;") != std::string::npos);
+    CHECK(out.find("struct Hit{float dist;};") != std::string::npos);
+    CHECK(out.find("float length(float3 v)") != std::string::npos);
+    CHECK(out.find("b.dist=c;return SCALE(b.dist);") != std::string::npos);
+    CHECK(out.find("iChannel0.Sample(iSampler0,") != std::string::npos);
+    CHECK(out.find("float4 t1(") != std::string::npos);
+    CHECK(out.find("tweak") == std::string::npos);
+}
+
+TEST_CASE("MinifyHlsl honours names reserved by the other modules") {
+    const std::string source =
+        "float helper(float p) { return p; }\n"
+        "float4 s1(float2 fragCoord, float2 iResolution, float iTime) { return helper(iTime); }\n";
+    const std::unordered_set<std::string> globals = {"a"};
+    const std::unordered_set<std::string> macros = {"b"};
+    HlslMinifyOptions options = Preserving({"s1"});
+    options.reservedGlobalNames = &globals;
+    options.reservedMacroNames = &macros;
+    // The helper skips a (another module's global) and b (a macro); parameters may reuse a
+    // global name because they only shadow it, but never a macro.
+    CHECK(Minify(source, options) ==
+          "float c(float a){return a;}float4 s1(float2 a,float2 iResolution,float iTime){return c(iTime);}");
+}
+
+TEST_CASE("MinifyHlsl developer builds keep every name") {
+    const std::string source = "float helper(float value) { return value * 0.50; }";
+    HlslMinifyOptions options;
+    options.renameHelpers = false;
+    options.renameLocals = false;
+    HlslMinifyStats stats;
+    CHECK(Minify(source, options, &stats) == "float helper(float value){return value*.5;}");
+    CHECK(stats.renamedHelpers == 0);
+    CHECK(stats.renamedLocals == 0);
+}
@@ -0,0 +1,248 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/DevKit/HlslModuleTransform.h"
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+ModuleSourceTransform Remap(const std::string& entrypoint) {
+    ModuleSourceTransform transform;
+    transform.entrypointName = entrypoint;
+    transform.remapEntrypoint = true;
+    return transform;
+}
+
+ModuleSourceTransform Scope(const std::string& entrypoint) {
+    ModuleSourceTransform transform = Remap(entrypoint);
+    transform.scopeLocalFunctions = true;
+    return transform;
+}
+
+// Helpers followed by entrypoint sN returning body.
+std::string SceneModule(const std::string& helpers, size_t index, const std::string& body) {
+    std::string module = helpers;
+    module.append("float4 s").append(std::to_string(index));
+    module.append("(float2 fragCoord, float2 iResolution, float iTime) { return ").append(body).append("; }\n");
+    return module;
+}
+
+// s0, s1, ... as the pack build names scene modules.
+std::vector<std::string> Entrypoints(size_t count) {
+    std::vector<std::string> names;
+    for (size_t i = 0; i < count; ++i) {
+        names.push_back(std::string("s").append(std::to_string(i)));
+    }
+    return names;
+}
+
+} // namespace
+
+TEST_CASE("TransformModuleSource renames main and leaves everything else verbatim") {
+    const std::string source =
+        "// main() is the entry\n"
+        "float4 main(float2 fragCoord, float2 iResolution, float iTime) {\n"
+        "    return float4(fragCoord / iResolution, 0, 1);\n"
+        "}\n";
+    std::string expected = source;
+    expected.replace(expected.find("float4 main(") + 7, 4, "s0");
+    CHECK(TransformModuleSource(source, Remap("s0")) == expected);
+
+    // Already declared: untouched.
+    CHECK(TransformModuleSource(expected, Remap("s0")) == expected);
+}
+
+TEST_CASE("TransformModuleSource renames the definition, not text in comments or strings") {
+    // Old behaviour: the first "float4 main(" in the text was renamed, here the comment.
+    const std::string source =
+        "/* float4 main() { } */\n"
+        "static const string kName = \"float4 main(\";\n"
+        "float4 main(float4 p : SV_Position) : SV_Target { return p; }\n";
+    const std::string out = TransformModuleSource(source, Remap("p1"));
+    CHECK(out.find("/* float4 main() { } */") == 0);
+    CHECK(out.find("\"float4 main(\"") != std::string::npos);
+    CHECK(out.find("float4 p1(float4 p : SV_Position) : SV_Target") != std::string::npos);
+    CHECK(out.find("return main(") == std::string::npos);
+}
+
+TEST_CASE("TransformModuleSource adapts friendly entrypoints and falls back to a stub") {
+    const std::string mainImage = "float4 mainImage(float2 c, float2 r, float t) { return 1; }";
+    CHECK(TransformModuleSource(mainImage, Remap("s2")) ==
+          mainImage + "\nfloat4 s2(float2 fragCoord, float2 iResolution, float iTime){ return mainImage(fragCoord, iResolution, iTime); }\n");
+
+    // No friendly name: the first float4 function is used.
+    const std::string other = "float3 a() { return 0; }\nfloat4 shade(float2 c, float2 r, float t) { return 0; }";
+    CHECK(TransformModuleSource(other, Remap("t0")).find("{ return shade(fragCoord, iResolution, iTime); }") != std::string::npos);
+
+    const std::string none = "float3 a() { return 0; }";
+    CHECK(TransformModuleSource(none, Remap("t0")).find("return float4(1.0, 0.0, 1.0, 1.0);") != std::string::npos);
+}
+
+TEST_CASE("TransformModuleSource scopes helpers at free call sites only") {
+    const std::string source =
+        "float hash(float x) { return frac(sin(x) * 43758.5); }\n"
+        "float keep(float x) { return x; }\n"
+        "float4 main(float2 fragCoord, float2 iResolution, float iTime) {\n"
+        "    Noise n; float h = n.hash(1.0); // hash(2.0)\n"
+        "    return hash(iTime) + keep(h) + float4(0, 0, 0, 0);\n"
+        "}\n";
+    const std::unordered_set<std::string> preserve = {"keep"};
+    ModuleSourceTransform transform = Scope("s3");
+    transform.preserveGlobalNames = &preserve;
+    const std::string out = TransformModuleSource(source, transform);
+    CHECK(out.find("float __s3_hash(float x)") == 0);
+    CHECK(out.find("return __s3_hash(iTime) + keep(h)") != std::string::npos);
+    CHECK(out.find("float keep(float x)") != std::string::npos);
+    CHECK(out.find("float4 s3(") != std::string::npos);
+    // Old behaviour renamed the member call and the commented call too.
+    CHECK(out.find("n.hash(1.0); // hash(2.0)") != std::string::npos);
+}
+
+TEST_CASE("TransformModuleSource removes byte ranges and compacts") {
+    const std::string source =
+        "#define K 2.0\n"
+        "float drop() { return 0; }\n"
+        "float4 s4(float2 fragCoord, float2 iResolution, float iTime) {   // body\n"
+        "    return K;\n"
+        "}\n";
+    ModuleSourceTransform transform = Remap("s4");
+    const size_t begin = source.find("float drop");
+    const size_t end = source.find("float4");
+    transform.removeRanges.emplace_back(begin, end);
+    transform.removeRanges.emplace_back(begin + 1, end); // Not on a token boundary: ignored
+    transform.compact = true;
+    // Old behaviour joined the directive with the next line when compacting.
+    CHECK(TransformModuleSource(source, transform) ==
+          "#define K 2.0\nfloat4 s4(float2 fragCoord, float2 iResolution, float iTime) { return K; }");
+}
+
+TEST_CASE("DeduplicateMicroHelpers shares a renamed duplicate under the first module's name") {
+    std::vector<std::string> modules = {
+        "float hash(float x) { return frac(sin(x) * 43758.5); }\n"
+        "float4 s0(float2 fragCoord, float2 iResolution, float iTime) { return hash(iTime); }\n",
+        "float rnd(float x) { return frac(sin(x) * 43758.5); }\n"
+        "float4 s1(float2 fragCoord, float2 iResolution, float iTime) { return rnd(iTime) + rnd(fragCoord.x); }\n",
+    };
+    const std::vector<std::string> original = modules;
+    MicroHelperDedupStats stats;
+    const std::unordered_set<std::string> shared = DeduplicateMicroHelpers(modules, Entrypoints(2), &stats);
+    CHECK(shared == std::unordered_set<std::string>{"hash"});
+    CHECK(modules[0] == original[0]);
+    CHECK(modules[1].find("rnd") == std::string::npos);
+    CHECK(modules[1].find("float hash(") == std::string::npos);
+    CHECK(modules[1].find("return hash(iTime) + hash(fragCoord.x);") != std::string::npos);
+    CHECK(stats.sharedHelpers == 1);
+    CHECK(stats.removedCopies == 1);
+    CHECK(stats.bytesBefore == original[0].size() + original[1].size());
+    CHECK(stats.bytesAfter == modules[0].size() + modules[1].size());
+    CHECK(stats.bytesAfter < stats.bytesBefore);
+}
+
+TEST_CASE("DeduplicateMicroHelpers keeps helpers that read module globals or macros") {
+    // Same text, but kScale and K may hold different values in each module.
+    const std::string module =
+        "#define K 3.0\n"
+        "static const float kScale = 2.0;\n"
+        "float scaled(float x) { return x * kScale; }\n"
+        "float tripled(float x) { return x * K; }\n"
+        "float outer(float x) { return scaled(x) + 1.0; }\n";
+    std::vector<std::string> modules = {
+        SceneModule(module, 0, "outer(iTime) + tripled(iTime)"),
+        SceneModule(module, 1, "outer(iTime) + tripled(iTime)"),
+    };
+    const std::vector<std::string> original = modules;
+    MicroHelperDedupStats stats;
+    CHECK(DeduplicateMicroHelpers(modules, Entrypoints(2), &stats).empty());
+    CHECK(modules == original);
+    CHECK(stats.sharedHelpers == 0);
+    CHECK(stats.removedCopies == 0);
+}
+
+TEST_CASE("DeduplicateMicroHelpers leaves name clashes between modules alone") {
+    const std::string wave = "float wave(float x) { return sin(x); }\n";
+
+    // Another module's global has the helper's name.
+    std::vector<std::string> modules = {
+        SceneModule(wave, 0, "wave(iTime)"),
+        SceneModule(wave, 1, "wave(iTime)"),
+        SceneModule("static const float wave = 0.5;\n", 2, "wave"),
+    };
+    std::vector<std::string> original = modules;
+    CHECK(DeduplicateMicroHelpers(modules, Entrypoints(3)).empty());
+    CHECK(modules == original);
+
+    // A macro of that name.
+    modules[2] = SceneModule("#define wave 0.5\n", 2, "wave");
+    original = modules;
+    CHECK(DeduplicateMicroHelpers(modules, Entrypoints(3)).empty());
+    CHECK(modules == original);
+
+    // A different helper of that name.
+    modules[2] = SceneModule("float wave(float x) { return cos(x); }\n", 2, "wave(iTime)");
+    original = modules;
+    CHECK(DeduplicateMicroHelpers(modules, Entrypoints(3)).empty());
+    CHECK(modules == original);
+
+    // A renamed copy whose module already uses the shared name for something else keeps its
+    // own name; the other copies are still shared.
+    modules = {
+        SceneModule(wave, 0, "wave(iTime)"),
+        SceneModule(wave, 1, "wave(iTime)"),
+        "float ripple(float x) { return sin(x); }\n"
+        "float4 s2(float2 fragCoord, float2 iResolution, float iTime) { float wave = iTime; return ripple(wave); }\n",
+    };
+    original = modules;
+    CHECK(DeduplicateMicroHelpers(modules, Entrypoints(3)) == std::unordered_set<std::string>{"wave"});
+    CHECK(modules[1].find("float wave(") == std::string::npos);
+    CHECK(modules[2] == original[2]);
+}
+
+TEST_CASE("DeduplicateMicroHelpers keeps overloaded helpers per module") {
+    const std::string rot =
+        "float2 rot(float2 p, float a) { return float2(p.x * cos(a) - p.y * sin(a), p.x * sin(a) + p.y * cos(a)); }\n"
+        "float3 rot(float3 p, float a) { return float3(rot(p.xy, a), p.z); }\n"
+        "float spin(float a) { return rot(float2(1, 0), a).x; }\n";
+    std::vector<std::string> modules = {
+        SceneModule(rot, 0, "spin(iTime)"),
+        SceneModule(rot, 1, "spin(iTime)"),
+    };
+    const std::vector<std::string> original = modules;
+    // Calls cannot tell which overload they match, so neither the overloads nor their callers move.
+    CHECK(DeduplicateMicroHelpers(modules, Entrypoints(2)).empty());
+    CHECK(modules == original);
+}
+
+TEST_CASE("DeduplicateMicroHelpers shares a caller only when its callees are shared") {
+    std::vector<std::string> modules = {
+        "float sq0(float x) { return x * x; }\n"
+        "float lift0(float x) { return sq0(x) + 1.0; }\n"
+        "float4 s0(float2 fragCoord, float2 iResolution, float iTime) { return lift0(iTime); }\n",
+        "float sq1(float x) { return x * x; }\n"
+        "float lift1(float x) { return sq1(x) + 1.0; }\n"
+        "float4 s1(float2 fragCoord, float2 iResolution, float iTime) { return lift1(iTime) + sq1(2.0); }\n",
+        // Same caller text, but its callee differs.
+        "float sq2(float x) { return x * x * x; }\n"
+        "float lift2(float x) { return sq2(x) + 1.0; }\n"
+        "float4 s2(float2 fragCoord, float2 iResolution, float iTime) { return lift2(iTime); }\n",
+        // Same chain, but the callee reads a module global.
+        "static const float kBias = 0.0;\n"
+        "float sq3(float x) { return x * x + kBias; }\n"
+        "float lift3(float x) { return sq3(x) + 1.0; }\n"
+        "float4 s3(float2 fragCoord, float2 iResolution, float iTime) { return lift3(iTime); }\n",
+    };
+    const std::vector<std::string> original = modules;
+    MicroHelperDedupStats stats;
+    CHECK(DeduplicateMicroHelpers(modules, Entrypoints(4), &stats) == (std::unordered_set<std::string>{"sq0", "lift0"}));
+    CHECK(stats.sharedHelpers == 2);
+    CHECK(stats.removedCopies == 2);
+    CHECK(modules[0] == original[0]);
+    CHECK(modules[1].find("sq1") == std::string::npos);
+    CHECK(modules[1].find("lift1") == std::string::npos);
+    CHECK(modules[1].find("return lift0(iTime) + sq0(2.0);") != std::string::npos);
+    CHECK(modules[2] == original[2]);
+    CHECK(modules[3] == original[3]);
+}
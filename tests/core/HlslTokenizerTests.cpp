@@ -0,0 +1,173 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/DevKit/HlslTokenizer.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+std::vector<std::string> CodeTexts(const HlslTokenStream& stream) {
+    std::vector<std::string> texts;
+    for (size_t i = 0; i < stream.CodeCount(); ++i) {
+        texts.emplace_back(stream.Code(i).text);
+    }
+    return texts;
+}
+
+size_t FindCode(const HlslTokenStream& stream, std::string_view text, size_t from = 0) {
+    for (size_t i = from; i < stream.CodeCount(); ++i) {
+        if (stream.Code(i).text == text) {
+            return i;
+        }
+    }
+    return HlslTokenStream::npos;
+}
+
+std::string Emit(std::string_view source, HlslRewriter::Layout layout) {
+    const HlslTokenStream stream(source);
+    return HlslRewriter(stream).Emit(layout);
+}
+
+} // namespace
+
+TEST_CASE("HlslTokenStream covers every byte and Preserve round-trips") {
+    const std::string sources[] = {
+        "",
+        "float4 main() : SV_Target { return 1.0e-3; }",
+        "// line comment\r\n#define X(a) \\\r\n  (a * 2)\r\nfloat f = X(1); /* block */\r\n",
+        "#include \"common.hlsl\"\n  #ifdef FOO\nstatic const string s = \"a\\\"b // not a comment\";\n#endif",
+        "float a = b /* unterminated",
+        "char c = '\\''; float d = .5f + 0x1Fu;\t\v\f",
+        "a<<=b>>=c->d::e&&f||g++ --h",
+    };
+    for (const std::string& source : sources) {
+        const HlslTokenStream stream(source);
+        std::string joined;
+        uint32_t offset = 0;
+        for (const HlslToken& token : stream.Tokens()) {
+            CHECK(token.offset == offset);
+            CHECK(!token.text.empty());
+            joined.append(token.text);
+            offset += static_cast<uint32_t>(token.text.size());
+        }
+        CHECK(joined == source);
+        CHECK(HlslRewriter(stream).Emit(HlslRewriter::Layout::Preserve) == source);
+    }
+}
+
+TEST_CASE("HlslTokenStream classifies tokens") {
+    const HlslTokenStream stream("#define K 2\nfloat x = 1.0e-3 + 0x1E-1; // c\ny <<= a->b; s = \"#no\"; # stray");
+    CHECK(stream.Tokens().front().kind == HlslTokenKind::Directive);
+    CHECK(stream.Tokens().front().text == "#define K 2");
+    CHECK(CodeTexts(stream) == (std::vector<std::string>{
+        "float", "x", "=", "1.0e-3", "+", "0x1E", "-", "1", ";",
+        "y", "<<=", "a", "->", "b", ";", "s", "=", "\"#no\"", ";", "#", "stray"}));
+    CHECK(stream.Code(3).kind == HlslTokenKind::Number);
+    CHECK(stream.Code(5).kind == HlslTokenKind::Number);
+    CHECK(stream.Code(17).kind == HlslTokenKind::String);
+    // '#' only starts a directive at the beginning of a line.
+    CHECK(stream.Code(19).kind == HlslTokenKind::Punctuator);
+}
+
+TEST_CASE("HlslTokenStream matches brackets and tracks brace depth") {
+    const HlslTokenStream stream("void f(float a[2]) { if (a[0]) { g(); } }");
+    const size_t open = FindCode(stream, "{");
+    REQUIRE(open != HlslTokenStream::npos);
+    CHECK(stream.MatchingBracket(open) == stream.CodeCount() - 1);
+    CHECK(stream.MatchingBracket(stream.CodeCount() - 1) == open);
+    CHECK(stream.MatchingBracket(2) == FindCode(stream, ")"));
+    CHECK(stream.BraceDepth(open) == 0);
+    CHECK(stream.BraceDepth(open + 1) == 1);
+    CHECK(stream.BraceDepth(FindCode(stream, "g")) == 2);
+    CHECK(stream.BraceDepth(stream.CodeCount() - 1) == 0);
+}
+
+TEST_CASE("HlslTokenStream recovers from unbalanced brackets") {
+    // The ) closes the ( and abandons the [ opened inside it; the ] then has no partner.
+    const HlslTokenStream crossed("( [ ) ]");
+    CHECK(crossed.MatchingBracket(0) == 2);
+    CHECK(crossed.MatchingBracket(2) == 0);
+    CHECK(crossed.MatchingBracket(1) == HlslTokenStream::npos);
+    CHECK(crossed.MatchingBracket(3) == HlslTokenStream::npos);
+
+    // A stray closing brace neither matches nor drives the depth negative.
+    const HlslTokenStream stray("} { x ( }");
+    CHECK(stray.MatchingBracket(0) == HlslTokenStream::npos);
+    CHECK(stray.BraceDepth(0) == 0);
+    CHECK(stray.MatchingBracket(1) == 4);
+    CHECK(stray.MatchingBracket(3) == HlslTokenStream::npos);
+    CHECK(stray.BraceDepth(2) == 1);
+
+    // Never closed.
+    const HlslTokenStream open("float f() { return (1;");
+    CHECK(open.MatchingBracket(FindCode(open, "{")) == HlslTokenStream::npos);
+    CHECK(open.MatchingBracket(FindCode(open, "(", 4)) == HlslTokenStream::npos);
+}
+
+TEST_CASE("FindHlslFunctions finds definitions only") {
+    const std::string source =
+        "float helper(float x);\n"                                  // Prototype
+        "struct S { float m() { return 1; } };\n"                   // Member function
+        "float helper(float x) { return x * call(x); }\n"
+        "// float commented(float x) { return x; }\n"
+        "float4 main(float4 p : SV_Position) : SV_Target { return helper(p.x); }\n"
+        "cbuffer C : register(b0) { float t; };\n"
+        "float3 tail(float2 uv) { return 0; }";
+    const HlslTokenStream stream(source);
+    const std::vector<HlslFunction> functions = FindHlslFunctions(stream);
+    REQUIRE(functions.size() == 3);
+    CHECK(stream.Code(functions[0].name).text == "helper");
+    CHECK(stream.Code(functions[0].openBrace).Is("{"));
+    CHECK(stream.Code(functions[0].closeBrace).offset == source.find("}\n// float"));
+    CHECK(stream.Code(functions[1].returnType).text == "float4");
+    CHECK(stream.Code(functions[1].name).text == "main");
+    CHECK(stream.CodeIs(functions[1].closeParen + 1, ":"));
+    CHECK(stream.Code(functions[2].name).text == "tail");
+    CHECK(functions[2].closeBrace == stream.CodeCount() - 1);
+
+    // An unterminated body ends the search instead of running past the source.
+    const HlslTokenStream broken("float a() { return 1; } float b() { return 2;");
+    CHECK(FindHlslFunctions(broken).size() == 1);
+}
+
+TEST_CASE("IsHlslFreeCall skips member calls") {
+    const HlslTokenStream stream("f(x) + o.f(y) + f;");
+    CHECK(IsHlslFreeCall(stream, 0));
+    CHECK(!IsHlslFreeCall(stream, FindCode(stream, "f", 1)));
+    CHECK(!IsHlslFreeCall(stream, stream.CodeCount() - 2));
+}
+
+TEST_CASE("HlslRewriter applies edits in one pass") {
+    const std::string source = "float a = b; // note\nfloat c = d;";
+    const HlslTokenStream stream(source);
+    HlslRewriter rewriter(stream);
+    rewriter.Replace(stream.TokenIndex(FindCode(stream, "b")), "first");
+    rewriter.Replace(stream.TokenIndex(FindCode(stream, "b")), "second"); // Later edit wins
+    const size_t secondFloat = FindCode(stream, "float", 1);
+    rewriter.Remove(stream.TokenIndex(secondFloat), stream.TokenIndex(stream.CodeCount() - 1));
+    rewriter.Replace(stream.TokenIndex(FindCode(stream, "d")), "ignored"); // Inside the removal
+    rewriter.Append("\nfloat e;");
+    CHECK(rewriter.Emit(HlslRewriter::Layout::Preserve) == "float a = second; // note\n\nfloat e;");
+    CHECK(rewriter.Emit(HlslRewriter::Layout::Compact) == "float a = second; float e;");
+}
+
+TEST_CASE("HlslRewriter compact layouts keep directives and token boundaries") {
+    const std::string source =
+        "#define SCALE 2.0\n"
+        "float f(float x) /* doc */ {\n"
+        "    return x * SCALE - -x + y / /* c */ /z; // done\n"
+        "}\n";
+    CHECK(Emit(source, HlslRewriter::Layout::Compact) ==
+          "#define SCALE 2.0\nfloat f(float x) { return x * SCALE - -x + y / /z; }");
+    CHECK(Emit(source, HlslRewriter::Layout::Minimal) ==
+          "#define SCALE 2.0\nfloat f(float x){return x*SCALE- -x+y/ /z;}");
+
+    // Minimal keeps exactly the spaces that separate tokens.
+    CHECK(Emit("a + +b; c - -d; e & &f; 1 .x; x . 5; g < <h; i = =j;", HlslRewriter::Layout::Minimal) ==
+          "a+ +b;c- -d;e& &f;1 .x;x. 5;g< <h;i= =j;");
+    CHECK(Emit("float x = 1.0f ; int y = - 1 ;", HlslRewriter::Layout::Minimal) == "float x=1.0f;int y=-1;");
+}
@@ -0,0 +1,177 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Core/PackCodec.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+constexpr PackCodec::Level kLevels[] = { PackCodec::Level::Fast, PackCodec::Level::High };
+
+std::vector<uint8_t> Noise(size_t size, uint32_t seed) {
+    std::vector<uint8_t> bytes(size);
+    uint32_t state = seed;
+    for (auto& byte : bytes) {
+        state = state * 1664525u + 1013904223u;
+        byte = static_cast<uint8_t>(state >> 24);
+    }
+    return bytes;
+}
+
+std::vector<uint8_t> Repetitive(size_t size) {
+    static const char pattern[] = "float4 main(float2 uv) { return float4(uv, 0.5, 1.0); }\n";
+    std::vector<uint8_t> bytes(size);
+    for (size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<uint8_t>(pattern[i % (sizeof(pattern) - 1)]);
+    }
+    return bytes;
+}
+
+bool BlockRoundTrips(const std::vector<uint8_t>& input, PackCodec::Level level) {
+    std::vector<uint8_t> block(PackCodec::CompressBound(input.size()));
+    const size_t blockSize = PackCodec::CompressBlock(input.data(), input.size(), block.data(), block.size(), level);
+    if (blockSize == 0) {
+        return false;
+    }
+    // Exact-size buffers, so a sanitizer build catches any read past the block.
+    block.resize(blockSize);
+    std::vector<uint8_t> decoded(input.size());
+    return PackCodec::DecompressBlock(block.data(), block.size(), decoded.data(), decoded.size()) && decoded == input;
+}
+
+std::vector<uint8_t> CompressedFrame(const std::vector<uint8_t>& input, PackCodec::Level level) {
+    std::vector<uint8_t> frame;
+    REQUIRE(PackCodec::Compress(input, level, frame));
+    return frame;
+}
+
+void PokeU32(std::vector<uint8_t>& bytes, size_t offset, uint32_t value) {
+    std::memcpy(bytes.data() + offset, &value, sizeof(value));
+}
+
+} // namespace
+
+TEST_CASE("PackCodec blocks round-trip empty, small, incompressible and repetitive input") {
+    for (const PackCodec::Level level : kLevels) {
+        CHECK(BlockRoundTrips({}, level));
+        CHECK(BlockRoundTrips({42}, level));
+        CHECK(BlockRoundTrips(Noise(13, 1), level));
+        CHECK(BlockRoundTrips(Noise(255, 2), level));
+        CHECK(BlockRoundTrips(Repetitive(200), level));
+        CHECK(BlockRoundTrips(Noise(70000, 3), level));
+        CHECK(BlockRoundTrips(Repetitive(300000), level));
+        CHECK(BlockRoundTrips(std::vector<uint8_t>(100000, 0), level));
+    }
+}
+
+TEST_CASE("PackCodec frames repetitive input and declines input that does not shrink") {
+    for (const PackCodec::Level level : kLevels) {
+        std::vector<uint8_t> frame;
+        CHECK(!PackCodec::Compress({}, level, frame));
+        CHECK(frame.empty());
+        CHECK(!PackCodec::Compress(Noise(200, 4), level, frame));
+        CHECK(!PackCodec::Compress(Noise(65536, 5), level, frame));
+        CHECK(frame.empty());
+
+        const std::vector<uint8_t> input = Repetitive(100000);
+        frame = CompressedFrame(input, level);
+        CHECK(frame.size() < input.size() / 10);
+
+        PackCodec::FrameHeader header;
+        REQUIRE(PackCodec::ReadFrameHeader(frame, header));
+        CHECK(header.codec == (level == PackCodec::Level::High ? PackCodec::kCodecLz4High : PackCodec::kCodecLz4Fast));
+        CHECK(header.rawSize == input.size());
+        CHECK(header.compressedSize + PackCodec::kHeaderSize == frame.size());
+
+        std::vector<uint8_t> decoded;
+        CHECK(PackCodec::Decompress(frame, decoded));
+        CHECK(decoded == input);
+    }
+
+    // The search-heavy level never does worse on the same input.
+    const std::vector<uint8_t> input = Repetitive(100000);
+    CHECK(CompressedFrame(input, PackCodec::Level::High).size() <= CompressedFrame(input, PackCodec::Level::Fast).size());
+}
+
+TEST_CASE("PackCodec rejects truncated frames") {
+    const std::vector<uint8_t> frame = CompressedFrame(Repetitive(5000), PackCodec::Level::High);
+    std::vector<uint8_t> decoded;
+    for (size_t size = 0; size < frame.size(); ++size) {
+        const std::vector<uint8_t> truncated(frame.begin(), frame.begin() + size);
+        CHECK(!PackCodec::Decompress(truncated, decoded));
+        CHECK(decoded.empty());
+    }
+
+    // The header still matches, but the block stops short.
+    for (size_t size = PackCodec::kHeaderSize + 1; size < frame.size(); size += 7) {
+        std::vector<uint8_t> truncated(frame.begin(), frame.begin() + size);
+        PokeU32(truncated, 12, static_cast<uint32_t>(size - PackCodec::kHeaderSize));
+        CHECK(!PackCodec::Decompress(truncated, decoded));
+    }
+}
+
+TEST_CASE("PackCodec rejects a bad header") {
+    const std::vector<uint8_t> good = CompressedFrame(Repetitive(5000), PackCodec::Level::Fast);
+    std::vector<uint8_t> decoded;
+    REQUIRE(PackCodec::Decompress(good, decoded));
+
+    std::vector<uint8_t> bytes = good;
+    bytes[3] = '1'; // SLZ1
+    CHECK(!PackCodec::Decompress(bytes, decoded));
+
+    for (const uint8_t codec : {uint8_t(0), uint8_t(3), uint8_t(255)}) {
+        bytes = good;
+        bytes[4] = codec;
+        CHECK(!PackCodec::Decompress(bytes, decoded));
+    }
+
+    bytes = good;
+    PokeU32(bytes, 8, 0);
+    CHECK(!PackCodec::Decompress(bytes, decoded));
+
+    // A raw size that disagrees with what the block decodes to.
+    bytes = good;
+    PokeU32(bytes, 8, 4999);
+    CHECK(!PackCodec::Decompress(bytes, decoded));
+    PokeU32(bytes, 8, 5001);
+    CHECK(!PackCodec::Decompress(bytes, decoded));
+
+    bytes = good;
+    bytes.push_back(0); // Compressed size no longer matches the frame
+    CHECK(!PackCodec::Decompress(bytes, decoded));
+    CHECK(decoded.empty());
+}
+
+TEST_CASE("PackCodec rejects match offsets outside the decoded output") {
+    uint8_t out[16] = {};
+    // One literal, then a 4-byte match: token 0x10, 'a', offset (little endian), then the
+    // trailing literal sequence 0x10 'b'.
+    const uint8_t valid[] = {0x10, 'a', 0x01, 0x00, 0x10, 'b'};
+    CHECK(PackCodec::DecompressBlock(valid, sizeof(valid), out, 6));
+    CHECK(std::memcmp(out, "aaaaab", 6) == 0);
+
+    const uint8_t zeroOffset[] = {0x10, 'a', 0x00, 0x00, 0x10, 'b'};
+    CHECK(!PackCodec::DecompressBlock(zeroOffset, sizeof(zeroOffset), out, 6));
+
+    const uint8_t beforeStart[] = {0x10, 'a', 0x02, 0x00, 0x10, 'b'};
+    CHECK(!PackCodec::DecompressBlock(beforeStart, sizeof(beforeStart), out, 6));
+
+    const uint8_t farBack[] = {0x10, 'a', 0xFF, 0xFF, 0x10, 'b'};
+    CHECK(!PackCodec::DecompressBlock(farBack, sizeof(farBack), out, 6));
+
+    // A match running past the declared output size.
+    const uint8_t tooLong[] = {0x1F, 'a', 0x01, 0x00, 0x00, 0x10, 'b'};
+    CHECK(!PackCodec::DecompressBlock(tooLong, sizeof(tooLong), out, sizeof(out)));
+
+    // A literal run longer than the block.
+    const uint8_t shortLiterals[] = {0x50, 'a', 'b'};
+    CHECK(!PackCodec::DecompressBlock(shortLiterals, sizeof(shortLiterals), out, 5));
+
+    // A length continuation that runs off the end.
+    const uint8_t openLength[] = {0xF0, 0xFF};
+    CHECK(!PackCodec::DecompressBlock(openLength, sizeof(openLength), out, sizeof(out)));
+}
@@ -0,0 +1,167 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Core/PackCodec.h"
+#include "ShaderLab/Core/PackageManager.h"
+#include "ShaderLab/Core/Serializer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace ShaderLab;
+namespace fs = std::filesystem;
+
+namespace {
+
+void WriteFile(const fs::path& path, const std::vector<uint8_t>& bytes) {
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+std::vector<uint8_t> ReadFile(const fs::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+std::vector<uint8_t> Pattern(size_t size, uint32_t seed, bool compressible) {
+    std::vector<uint8_t> bytes(size);
+    uint32_t state = seed * 2654435761u + 1u;
+    for (size_t i = 0; i < size; ++i) {
+        state = state * 1664525u + 1013904223u;
+        bytes[i] = compressible ? static_cast<uint8_t>("shaderlab"[(i / 7 + seed) % 9]) : static_cast<uint8_t>(state >> 24);
+    }
+    return bytes;
+}
+
+struct PackFixture {
+    fs::path dir;
+    fs::path packPath;
+    std::vector<std::pair<std::string, std::vector<uint8_t>>> entries; // packed path, payload
+};
+
+PackFixture BuildPack(const char* name, Serializer::PackCompression compression) {
+    PackFixture fixture;
+    fixture.dir = ShaderLabTest::ScratchDirectory(name);
+    const fs::path exePath = fixture.dir / "player.exe";
+    WriteFile(exePath, Pattern(4096, 99, false));
+
+    std::vector<Serializer::PackedExtraFile> extraFiles;
+    for (uint32_t i = 0; i < 40; ++i) {
+        const std::string packedPath = "assets/file_" + std::to_string(i) + ".bin";
+        std::vector<uint8_t> payload = Pattern(1 + i * 257, i, (i % 2) == 0);
+        const fs::path sourcePath = fixture.dir / ("src_" + std::to_string(i) + ".bin");
+        WriteFile(sourcePath, payload);
+        extraFiles.push_back({sourcePath.string(), packedPath});
+        fixture.entries.emplace_back(packedPath, std::move(payload));
+    }
+
+    Serializer::PackOptions options;
+    options.includeProjectManifest = false;
+    options.compression = compression;
+    options.workerThreads = 2;
+    fixture.packPath = fixture.dir / "packed.exe";
+    REQUIRE(Serializer::PackExecutable(exePath.string(), fixture.packPath.string(), "", extraFiles, options));
+    return fixture;
+}
+
+} // namespace
+
+TEST_CASE("PackageManager resolves every entry of an uncompressed pack") {
+    const PackFixture fixture = BuildPack("pm_uncompressed", Serializer::PackCompression::None);
+    PackageManager& manager = PackageManager::Get();
+    REQUIRE(manager.InitializeFromFile(fixture.packPath.string()));
+    CHECK(manager.IsPacked());
+
+    for (const auto& [path, payload] : fixture.entries) {
+        CHECK(manager.HasFile(path));
+        CHECK(manager.GetFile(path) == payload);
+        const std::span<const uint8_t> view = manager.GetFileView(path);
+        CHECK(view.size() == payload.size());
+        CHECK(std::equal(view.begin(), view.end(), payload.begin(), payload.end()));
+    }
+    CHECK(!manager.HasFile("assets/missing.bin"));
+    CHECK(manager.GetFile("assets/missing.bin").empty());
+    CHECK(manager.GetFileView("assets/missing.bin").empty());
+}
+
+TEST_CASE("PackageManager normalizes backslashes in lookups") {
+    const PackFixture fixture = BuildPack("pm_backslash", Serializer::PackCompression::None);
+    PackageManager& manager = PackageManager::Get();
+    REQUIRE(manager.InitializeFromFile(fixture.packPath.string()));
+    CHECK(manager.HasFile("assets\\file_3.bin"));
+    CHECK(manager.GetFile("assets\\file_3.bin") == fixture.entries[3].second);
+}
+
+TEST_CASE("PackageManager decompresses entries and gives no view for them") {
+    for (const auto compression : {Serializer::PackCompression::Fast, Serializer::PackCompression::High}) {
+        const PackFixture fixture = BuildPack("pm_compressed", compression);
+        PackageManager& manager = PackageManager::Get();
+        REQUIRE(manager.InitializeFromFile(fixture.packPath.string()));
+
+        size_t compressedEntries = 0;
+        for (const auto& [path, payload] : fixture.entries) {
+            CHECK(manager.GetFile(path) == payload);
+            const std::span<const uint8_t> view = manager.GetFileView(path);
+            if (view.empty()) {
+                ++compressedEntries;
+            } else {
+                CHECK(std::equal(view.begin(), view.end(), payload.begin(), payload.end()));
+            }
+        }
+        // Compressible payloads shrink and are stored framed; random ones stay raw.
+        CHECK(compressedEntries > 0);
+        CHECK(compressedEntries < fixture.entries.size());
+    }
+}
+
+TEST_CASE("PackageManager rejects files without a pack footer") {
+    const fs::path dir = ShaderLabTest::ScratchDirectory("pm_plain");
+    WriteFile(dir / "plain.exe", Pattern(1024, 5, false));
+    PackageManager& manager = PackageManager::Get();
+    CHECK(!manager.InitializeFromFile((dir / "plain.exe").string()));
+    CHECK(!manager.IsPacked());
+    CHECK(!manager.InitializeFromFile((dir / "does_not_exist.exe").string()));
+    CHECK(!manager.IsPacked());
+}
+
+TEST_CASE("PackageManager stays unpacked when the directory is truncated") {
+    const PackFixture fixture = BuildPack("pm_truncated", Serializer::PackCompression::None);
+    std::vector<uint8_t> bytes = ReadFile(fixture.packPath);
+    REQUIRE(bytes.size() > 22);
+
+    const size_t dirOffsetPos = bytes.size() - 14 - sizeof(uint64_t);
+    uint64_t dirOffset = 0;
+    std::memcpy(&dirOffset, bytes.data() + dirOffsetPos, sizeof(uint64_t));
+
+    // Claim one entry more than the directory holds.
+    std::vector<uint8_t> extraCount = bytes;
+    uint32_t count = 0;
+    std::memcpy(&count, extraCount.data() + dirOffset, sizeof(uint32_t));
+    ++count;
+    std::memcpy(extraCount.data() + dirOffset, &count, sizeof(uint32_t));
+    WriteFile(fixture.dir / "extra_count.exe", extraCount);
+
+    // Point the directory past the footer start.
+    std::vector<uint8_t> badOffset = bytes;
+    const uint64_t pastEnd = dirOffsetPos;
+    std::memcpy(badOffset.data() + dirOffsetPos, &pastEnd, sizeof(uint64_t));
+    WriteFile(fixture.dir / "bad_offset.exe", badOffset);
+
+    // Cut the last directory entry in half, keeping the footer intact.
+    std::vector<uint8_t> cut(bytes.begin(), bytes.begin() + static_cast<std::ptrdiff_t>(dirOffsetPos - 10));
+    cut.insert(cut.end(), bytes.begin() + static_cast<std::ptrdiff_t>(dirOffsetPos), bytes.end());
+    WriteFile(fixture.dir / "cut_entry.exe", cut);
+
+    PackageManager& manager = PackageManager::Get();
+    for (const char* name : {"extra_count.exe", "bad_offset.exe", "cut_entry.exe"}) {
+        REQUIRE(manager.InitializeFromFile(fixture.packPath.string()));
+        CHECK(!manager.InitializeFromFile((fixture.dir / name).string()));
+        CHECK(!manager.IsPacked());
+        CHECK(!manager.HasFile(fixture.entries[0].first));
+        CHECK(manager.GetFile(fixture.entries[0].first).empty());
+        CHECK(manager.GetFileView(fixture.entries[0].first).empty());
+    }
+}
@@ -0,0 +1,163 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Core/PlaybackEventIndex.h"
+#include "ShaderLab/Core/PlaybackService.h"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+using TriggeredRows = std::vector<std::pair<int, const TrackerRow*>>;
+
+// The scan PlaybackEventIndex replaces: every beat in the range, every row in track order.
+TriggeredRows LinearCollect(const DemoTrack& track, int fromBeatExclusive, int toBeatInclusive) {
+    TriggeredRows rows;
+    for (int beat = fromBeatExclusive + 1; beat <= toBeatInclusive; ++beat) {
+        for (const auto& row : track.rows) {
+            if (row.rowId == beat) {
+                rows.emplace_back(beat, &row);
+            }
+        }
+    }
+    return rows;
+}
+
+const TrackerRow* LinearNextSceneRow(const DemoTrack& track, int afterBeat) {
+    const TrackerRow* best = nullptr;
+    for (const auto& row : track.rows) {
+        if (row.sceneIndex >= 0 && row.rowId > afterBeat && (!best || row.rowId < best->rowId)) {
+            best = &row;
+        }
+    }
+    return best;
+}
+
+TrackerRow MakeRow(int beat, int sceneIndex) {
+    TrackerRow row;
+    row.rowId = beat;
+    row.sceneIndex = sceneIndex;
+    return row;
+}
+
+// Unsorted beats with duplicates, as the playlist editor produces them.
+DemoTrack MakeRandomTrack(uint32_t seed, int rowCount, int lengthBeats) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> beat(0, lengthBeats - 1);
+    std::uniform_int_distribution<int> scene(-1, 4);
+    DemoTrack track;
+    track.lengthBeats = lengthBeats;
+    for (int i = 0; i < rowCount; ++i) {
+        track.rows.push_back(MakeRow(beat(rng), scene(rng)));
+    }
+    track.MarkRowsChanged();
+    return track;
+}
+
+} // namespace
+
+TEST_CASE("PlaybackEventIndex matches the linear scan on random ranges") {
+    std::mt19937 rng(1234);
+    for (uint32_t seed = 1; seed <= 8; ++seed) {
+        const DemoTrack track = MakeRandomTrack(seed, 200, 256);
+        PlaybackEventIndex index;
+        index.Build(track);
+
+        std::uniform_int_distribution<int> beat(-4, 260);
+        for (int query = 0; query < 200; ++query) {
+            const int from = beat(rng);
+            const int to = beat(rng);
+            TriggeredRows indexed;
+            index.CollectRows(track, from, to, indexed);
+            CHECK(indexed == LinearCollect(track, from, to));
+            CHECK(index.FindNextSceneRow(track, from) == LinearNextSceneRow(track, from));
+        }
+    }
+}
+
+TEST_CASE("PlaybackEventIndex keeps track order for rows on the same beat") {
+    DemoTrack track;
+    track.rows = {MakeRow(4, -1), MakeRow(2, 1), MakeRow(4, 2), MakeRow(4, 3)};
+    track.MarkRowsChanged();
+    PlaybackEventIndex index;
+    index.Build(track);
+
+    TriggeredRows rows;
+    index.CollectRows(track, 0, 8, rows);
+    REQUIRE(rows.size() == 4);
+    CHECK(rows[0].second == &track.rows[1]);
+    CHECK(rows[1].second == &track.rows[0]);
+    CHECK(rows[2].second == &track.rows[2]);
+    CHECK(rows[3].second == &track.rows[3]);
+    CHECK(index.FindNextSceneRow(track, 2) == &track.rows[2]);
+    CHECK(index.FindNextSceneRow(track, 4) == nullptr);
+}
+
+TEST_CASE("PlaybackEventIndex rebuilds only when the rows version changes") {
+    DemoTrack track = MakeRandomTrack(7, 32, 64);
+    PlaybackEventIndex index;
+    CHECK(index.Sync(track));
+    CHECK(!index.Sync(track));
+
+    // Row contents the index does not depend on need no rebuild.
+    track.rows[0].musicIndex = 3;
+    CHECK(!index.Sync(track));
+
+    track.rows.push_back(MakeRow(63, 0));
+    track.MarkRowsChanged();
+    CHECK(index.Sync(track));
+    CHECK(!index.Sync(track));
+
+    // A copy shares the stamp and the rows, so the index stays valid for it.
+    const DemoTrack copy = track;
+    CHECK(!index.Sync(copy));
+
+    // A freshly loaded track gets a new stamp even with the same row count.
+    DemoTrack other = MakeRandomTrack(8, static_cast<int>(track.rows.size()), 64);
+    CHECK(index.Sync(other));
+}
+
+TEST_CASE("PlaybackService events follow track edits") {
+    PlaybackService service;
+    DemoTrack track;
+    track.rows = {MakeRow(0, 0), MakeRow(8, 1)};
+    track.MarkRowsChanged();
+
+    std::vector<PlaybackEvent> events;
+    service.BuildPlaybackEvents(track, -1, 16, events);
+    CHECK(events.size() == 2);
+
+    track.rows.push_back(MakeRow(4, 2));
+    track.MarkRowsChanged();
+    service.BuildPlaybackEvents(track, -1, 16, events);
+    REQUIRE(events.size() == 3);
+    CHECK(events[1].beat == 4);
+    CHECK(events[1].sceneIndex == 2);
+
+    track.rows[2].sceneIndex = 3;
+    track.MarkRowsChanged();
+    TriggeredRows rows;
+    service.CollectTriggeredRows(track, 3, 4, rows);
+    REQUIRE(rows.size() == 1);
+    CHECK(rows[0].second->sceneIndex == 3);
+}
+
+TEST_CASE("PlaybackService returns nothing for empty or reversed ranges") {
+    PlaybackService service;
+    DemoTrack track;
+    track.rows = {MakeRow(2, 0)};
+    track.MarkRowsChanged();
+
+    std::vector<PlaybackEvent> events = {PlaybackEvent{}};
+    service.BuildPlaybackEvents(track, 2, 2, events);
+    CHECK(events.empty());
+    service.BuildPlaybackEvents(track, 5, 1, events);
+    CHECK(events.empty());
+
+    TriggeredRows rows = {{0, nullptr}};
+    service.CollectTriggeredRows(track, 3, 3, rows);
+    CHECK(rows.empty());
+}
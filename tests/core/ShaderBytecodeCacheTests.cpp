@@ -0,0 +1,241 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Core/ShaderBytecodeCache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace ShaderLab;
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr uint64_t kEntryHeaderSize = 40;
+
+ShaderBytecodeCache::Key KeyFor(const std::string& source) {
+    return ShaderBytecodeCache::MakeKey(source, "PSMain", "ps_6_0", 0, "dxc-test");
+}
+
+std::vector<uint8_t> Bytecode(size_t size, uint8_t seed) {
+    std::vector<uint8_t> bytes(size);
+    for (size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<uint8_t>(seed + i * 31);
+    }
+    return bytes;
+}
+
+std::vector<fs::path> EntryFiles(const fs::path& dir) {
+    std::vector<fs::path> files;
+    for (const auto& entry : fs::directory_iterator(dir)) {
+        files.push_back(entry.path());
+    }
+    return files;
+}
+
+// Stores one entry and returns the file it landed in, without assuming a naming scheme.
+fs::path StoreAndLocate(ShaderBytecodeCache& cache, const fs::path& dir, const std::string& source, const std::vector<uint8_t>& bytecode) {
+    const std::vector<fs::path> before = EntryFiles(dir);
+    REQUIRE(cache.Store(KeyFor(source), bytecode));
+    for (const fs::path& path : EntryFiles(dir)) {
+        if (std::find(before.begin(), before.end(), path) == before.end()) {
+            return path;
+        }
+    }
+    REQUIRE(false);
+    return {};
+}
+
+void PokeByte(const fs::path& path, uint64_t offset, uint8_t value) {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(offset));
+    file.put(static_cast<char>(value));
+}
+
+bool Has(ShaderBytecodeCache& cache, const std::string& source) {
+    std::vector<uint8_t> bytes;
+    return cache.Load(KeyFor(source), bytes);
+}
+
+} // namespace
+
+TEST_CASE("ShaderBytecodeCache stores and loads bytecode by key") {
+    const fs::path dir = ShaderLabTest::ScratchDirectory("bytecode_store");
+    ShaderBytecodeCache cache;
+    CHECK(!cache.IsOpen());
+    CHECK(!cache.Store(KeyFor("a"), Bytecode(16, 1))); // Closed
+    CHECK(!cache.Open(""));
+    REQUIRE(cache.Open(dir.string()));
+    CHECK(cache.IsOpen());
+
+    const std::vector<uint8_t> bytecode = Bytecode(100, 7);
+    CHECK(cache.Store(KeyFor("a"), bytecode));
+    CHECK(!cache.Store(KeyFor("empty"), {}));
+
+    std::vector<uint8_t> loaded;
+    CHECK(cache.Load(KeyFor("a"), loaded));
+    CHECK(loaded == bytecode);
+    CHECK(!cache.Load(KeyFor("b"), loaded));
+    CHECK(loaded.empty());
+
+    // Overwriting an entry replaces it in place.
+    const std::vector<uint8_t> replacement = Bytecode(60, 9);
+    CHECK(cache.Store(KeyFor("a"), replacement));
+    CHECK(cache.Load(KeyFor("a"), loaded));
+    CHECK(loaded == replacement);
+
+    const ShaderBytecodeCacheStats stats = cache.GetStats();
+    CHECK(stats.hits == 2);
+    CHECK(stats.misses == 1);
+    CHECK(stats.stores == 2);
+    CHECK(stats.entryCount == 1);
+    CHECK(stats.bytesOnDisk == kEntryHeaderSize + replacement.size());
+    CHECK(EntryFiles(dir).size() == 1);
+}
+
+TEST_CASE("ShaderBytecodeCache keys cover every compile input") {
+    const auto base = ShaderBytecodeCache::MakeKey("src", "PSMain", "ps_6_0", 1, "v1");
+    CHECK(base == ShaderBytecodeCache::MakeKey("src", "PSMain", "ps_6_0", 1, "v1"));
+    CHECK(!(base == ShaderBytecodeCache::MakeKey("src2", "PSMain", "ps_6_0", 1, "v1")));
+    CHECK(!(base == ShaderBytecodeCache::MakeKey("src", "main", "ps_6_0", 1, "v1")));
+    CHECK(!(base == ShaderBytecodeCache::MakeKey("src", "PSMain", "ps_6_6", 1, "v1")));
+    CHECK(!(base == ShaderBytecodeCache::MakeKey("src", "PSMain", "ps_6_0", 2, "v1")));
+    CHECK(!(base == ShaderBytecodeCache::MakeKey("src", "PSMain", "ps_6_0", 1, "v2")));
+    // Field boundaries are part of the key.
+    CHECK(!(ShaderBytecodeCache::MakeKey("ab", "c", "t", 0, "v") == ShaderBytecodeCache::MakeKey("a", "bc", "t", 0, "v")));
+}
+
+TEST_CASE("ShaderBytecodeCache refuses sources that include other files") {
+    CHECK(ShaderBytecodeCache::IsCacheableSource(""));
+    CHECK(ShaderBytecodeCache::IsCacheableSource("float4 main() : SV_Target { return 1; }"));
+    CHECK(ShaderBytecodeCache::IsCacheableSource("#define INCLUDE_FOG 1\nfloat includeFog;"));
+    CHECK(ShaderBytecodeCache::IsCacheableSource("float a; // #include \"x.hlsl\""));
+    CHECK(!ShaderBytecodeCache::IsCacheableSource("#include \"common.hlsl\"\nfloat a;"));
+    CHECK(!ShaderBytecodeCache::IsCacheableSource("float a;\r\n  #  include <noise.hlsl>\r\n"));
+    CHECK(!ShaderBytecodeCache::IsCacheableSource("float a;\n\t#include \"last.hlsl\""));
+}
+
+TEST_CASE("ShaderBytecodeCache evicts the least recently used entries past its budget") {
+    const fs::path dir = ShaderLabTest::ScratchDirectory("bytecode_evict");
+    ShaderBytecodeCache cache;
+    REQUIRE(cache.Open(dir.string(), 3 * (kEntryHeaderSize + 100)));
+
+    CHECK(cache.Store(KeyFor("a"), Bytecode(100, 1)));
+    CHECK(cache.Store(KeyFor("b"), Bytecode(100, 2)));
+    CHECK(cache.Store(KeyFor("c"), Bytecode(100, 3)));
+    CHECK(cache.GetStats().evictions == 0);
+
+    // Touching a makes b the oldest.
+    CHECK(Has(cache, "a"));
+    CHECK(cache.Store(KeyFor("d"), Bytecode(100, 4)));
+    CHECK(cache.GetStats().evictions == 1);
+    CHECK(!Has(cache, "b"));
+    CHECK(Has(cache, "c"));
+    CHECK(Has(cache, "a"));
+    CHECK(Has(cache, "d"));
+
+    // Now c is the oldest; a larger entry pushes out c and then a.
+    CHECK(cache.Store(KeyFor("e"), Bytecode(200, 5)));
+    CHECK(cache.GetStats().evictions == 3);
+    CHECK(!Has(cache, "c"));
+    CHECK(!Has(cache, "a"));
+    CHECK(Has(cache, "d"));
+    CHECK(Has(cache, "e"));
+    CHECK(EntryFiles(dir).size() == 2);
+
+    // The newest entry stays even when it alone exceeds the budget.
+    CHECK(cache.Store(KeyFor("huge"), Bytecode(1000, 6)));
+    CHECK(Has(cache, "huge"));
+    CHECK(cache.GetStats().entryCount == 1);
+}
+
+TEST_CASE("ShaderBytecodeCache rejects and deletes corrupt entries") {
+    const fs::path dir = ShaderLabTest::ScratchDirectory("bytecode_corrupt");
+    ShaderBytecodeCache cache;
+    REQUIRE(cache.Open(dir.string()));
+    const fs::path flipped = StoreAndLocate(cache, dir, "flipped", Bytecode(100, 1));
+    const fs::path truncated = StoreAndLocate(cache, dir, "truncated", Bytecode(100, 2));
+    const fs::path swapped = StoreAndLocate(cache, dir, "swapped", Bytecode(100, 3));
+    const fs::path badMagic = StoreAndLocate(cache, dir, "badMagic", Bytecode(100, 4));
+    const fs::path intact = StoreAndLocate(cache, dir, "intact", Bytecode(100, 5));
+
+    // A payload byte no longer matches the stored hash.
+    PokeByte(flipped, kEntryHeaderSize + 50, 0xAA);
+    // Shorter than the header claims.
+    fs::resize_file(truncated, kEntryHeaderSize + 90);
+    // A valid entry filed under the wrong key.
+    fs::copy_file(intact, swapped, fs::copy_options::overwrite_existing);
+    PokeByte(badMagic, 0, 'X');
+
+    for (const char* source : {"flipped", "truncated", "swapped", "badMagic"}) {
+        CHECK(!Has(cache, source));
+    }
+    CHECK(!fs::exists(flipped));
+    CHECK(!fs::exists(truncated));
+    CHECK(!fs::exists(swapped));
+    CHECK(!fs::exists(badMagic));
+
+    std::vector<uint8_t> loaded;
+    CHECK(cache.Load(KeyFor("intact"), loaded));
+    CHECK(loaded == Bytecode(100, 5));
+
+    const ShaderBytecodeCacheStats stats = cache.GetStats();
+    CHECK(stats.misses == 4);
+    CHECK(stats.hits == 1);
+    CHECK(stats.entryCount == 1);
+    CHECK(stats.bytesOnDisk == kEntryHeaderSize + 100);
+}
+
+TEST_CASE("ShaderBytecodeCache keeps entries and recency across a reopen") {
+    const fs::path dir = ShaderLabTest::ScratchDirectory("bytecode_reopen");
+    const uint64_t entrySize = kEntryHeaderSize + 100;
+    ShaderBytecodeCache cache;
+    REQUIRE(cache.Open(dir.string()));
+    const fs::path a = StoreAndLocate(cache, dir, "a", Bytecode(100, 1));
+    const fs::path b = StoreAndLocate(cache, dir, "b", Bytecode(100, 2));
+    const fs::path c = StoreAndLocate(cache, dir, "c", Bytecode(100, 3));
+    cache.Close();
+    CHECK(!cache.IsOpen());
+
+    // Counters are per session; entries and sizes come back from the directory, and
+    // temporaries left by an interrupted write are cleaned up.
+    std::ofstream(dir / "deadbeef.dxil.tmp3") << "torn";
+    REQUIRE(cache.Open(dir.string()));
+    ShaderBytecodeCacheStats stats = cache.GetStats();
+    CHECK(stats.hits == 0);
+    CHECK(stats.misses == 0);
+    CHECK(stats.stores == 0);
+    CHECK(stats.evictions == 0);
+    CHECK(stats.entryCount == 3);
+    CHECK(stats.bytesOnDisk == 3 * entrySize);
+    CHECK(!fs::exists(dir / "deadbeef.dxil.tmp3"));
+    CHECK(Has(cache, "b"));
+    CHECK(cache.GetStats().hits == 1);
+    cache.Close();
+
+    // Recency comes back from file times: b is the oldest, so a smaller budget drops it.
+    const auto now = fs::file_time_type::clock::now();
+    fs::last_write_time(b, now - std::chrono::hours(3));
+    fs::last_write_time(a, now - std::chrono::hours(2));
+    fs::last_write_time(c, now - std::chrono::hours(1));
+    REQUIRE(cache.Open(dir.string(), 2 * entrySize));
+    stats = cache.GetStats();
+    CHECK(stats.evictions == 1);
+    CHECK(stats.entryCount == 2);
+    CHECK(stats.bytesOnDisk == 2 * entrySize);
+    CHECK(!fs::exists(b));
+    CHECK(Has(cache, "a"));
+    CHECK(Has(cache, "c"));
+    CHECK(!Has(cache, "b"));
+
+    // A later store evicts by the restored order: a was loaded before c, so a goes.
+    CHECK(Has(cache, "c"));
+    CHECK(cache.Store(KeyFor("d"), Bytecode(100, 4)));
+    CHECK(!Has(cache, "a"));
+    CHECK(Has(cache, "c"));
+    CHECK(Has(cache, "d"));
+}
@@ -0,0 +1,262 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Core/ShaderCompileQueue.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+// Echoes the source as bytecode. Sources starting with "bad" fail; a source equal to
+// `blockOn` waits until Release() so a test can act while that compile is running.
+class FakeCompilationService : public ICompilationService {
+public:
+    std::string blockOn;
+
+    ShaderCompileResult CompileFromSource(const std::string& source,
+                                          const std::string&,
+                                          const std::string&,
+                                          const std::wstring&,
+                                          ShaderCompileMode mode,
+                                          const std::vector<CompilationTextureBinding>&) override {
+        return Compile(source, mode);
+    }
+
+    ShaderCompileResult CompilePreviewShader(const std::string& shaderSource,
+                                             const std::vector<CompilationTextureBinding>&,
+                                             bool,
+                                             const std::string&,
+                                             const std::wstring&,
+                                             ShaderCompileMode mode) override {
+        return Compile(shaderSource, mode);
+    }
+
+    void WaitUntilCompiling(const std::string& source) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_changed.wait(lock, [&] {
+            for (const auto& compiled : m_compiled) {
+                if (compiled == source) {
+                    return true;
+                }
+            }
+            return false;
+        });
+    }
+
+    void Release() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_released = true;
+        m_changed.notify_all();
+    }
+
+    std::vector<std::string> Compiled() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_compiled;
+    }
+
+private:
+    ShaderCompileResult Compile(const std::string& source, ShaderCompileMode mode) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_compiled.push_back(source);
+            m_changed.notify_all();
+            if (source == blockOn) {
+                m_changed.wait(lock, [&] { return m_released; });
+            }
+        }
+        ShaderCompileResult result;
+        result.success = source.rfind("bad", 0) != 0;
+        if (result.success) {
+            result.bytecode.assign(source.begin(), source.end());
+            result.bytecode.push_back(mode == ShaderCompileMode::Live ? 'L' : 'B');
+        } else {
+            result.diagnostics.push_back({"syntax error", "shader.hlsl", 1, 1, true});
+        }
+        return result;
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::vector<std::string> m_compiled;
+    bool m_released = false;
+};
+
+ShaderCompileRequest MakeRequest(uint64_t target, const std::string& source,
+                                 ShaderCompileMode mode = ShaderCompileMode::Live) {
+    ShaderCompileRequest request;
+    request.target = target;
+    request.source = source;
+    request.mode = mode;
+    return request;
+}
+
+// Polls a threaded queue until it delivers something or the queue goes idle for `target`.
+std::vector<ShaderCompileOutput> PollUntilIdle(ShaderCompileQueue& queue, uint64_t target) {
+    std::vector<ShaderCompileOutput> results;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (std::chrono::steady_clock::now() < deadline) {
+        queue.Poll(results);
+        if (!queue.IsPending(target)) {
+            queue.Poll(results);
+            break;
+        }
+        std::this_thread::yield();
+    }
+    return results;
+}
+
+} // namespace
+
+TEST_CASE("ShaderCompileQueue compiles inline and runs finalize on success only") {
+    FakeCompilationService service;
+    ShaderCompileQueue queue;
+    queue.Start(&service, 0);
+
+    int finalized = 0;
+    ShaderCompileRequest good = MakeRequest(1, "good");
+    good.finalize = [&](ShaderCompileOutput& output) {
+        ++finalized;
+        return output.result.bytecode.size() == 5;
+    };
+    ShaderCompileRequest bad = MakeRequest(2, "bad");
+    bad.finalize = good.finalize;
+    const uint64_t generation = queue.Submit(std::move(good));
+    queue.Submit(std::move(bad));
+    CHECK(queue.IsPending(1));
+
+    std::vector<ShaderCompileOutput> results;
+    REQUIRE(queue.Poll(results) == 2);
+    CHECK(finalized == 1);
+    CHECK(results[0].target == 1);
+    CHECK(results[0].generation == generation);
+    CHECK(results[0].source == "good");
+    CHECK(results[0].result.success);
+    CHECK(results[0].error.empty());
+    CHECK(!results[1].result.success);
+    CHECK(results[1].result.diagnostics.size() == 1);
+    CHECK(!queue.IsPending(1));
+    CHECK(queue.GetStats().delivered == 2);
+}
+
+TEST_CASE("ShaderCompileQueue reports a finalize failure") {
+    FakeCompilationService service;
+    ShaderCompileQueue queue;
+    queue.Start(&service, 0);
+
+    ShaderCompileRequest request = MakeRequest(1, "good");
+    request.finalize = [](ShaderCompileOutput&) { return false; };
+    queue.Submit(std::move(request));
+
+    std::vector<ShaderCompileOutput> results;
+    REQUIRE(queue.Poll(results) == 1);
+    CHECK(results[0].result.success);
+    CHECK(!results[0].error.empty());
+}
+
+TEST_CASE("ShaderCompileQueue coalesces queued requests for the same target") {
+    FakeCompilationService service;
+    ShaderCompileQueue queue;
+    queue.Start(&service, 0);
+
+    queue.Submit(MakeRequest(1, "v1"));
+    queue.Submit(MakeRequest(1, "v2"));
+    const uint64_t latest = queue.Submit(MakeRequest(1, "v3"));
+
+    std::vector<ShaderCompileOutput> results;
+    REQUIRE(queue.Poll(results) == 1);
+    CHECK(results[0].source == "v3");
+    CHECK(results[0].generation == latest);
+    CHECK(service.Compiled() == std::vector<std::string>{"v3"});
+
+    const ShaderCompileQueueStats stats = queue.GetStats();
+    CHECK(stats.submitted == 3);
+    CHECK(stats.coalesced == 2);
+    CHECK(stats.discarded == 0);
+}
+
+TEST_CASE("ShaderCompileQueue runs Live requests ahead of queued Build requests") {
+    FakeCompilationService service;
+    ShaderCompileQueue queue;
+    queue.Start(&service, 0);
+
+    queue.Submit(MakeRequest(1, "build-a", ShaderCompileMode::Build));
+    queue.Submit(MakeRequest(2, "build-b", ShaderCompileMode::Build));
+    queue.Submit(MakeRequest(3, "live-c"));
+    queue.Submit(MakeRequest(4, "live-d"));
+
+    std::vector<ShaderCompileOutput> results;
+    CHECK(queue.Poll(results) == 4);
+    CHECK(service.Compiled() == (std::vector<std::string>{"live-c", "live-d", "build-a", "build-b"}));
+}
+
+TEST_CASE("ShaderCompileQueue cancel drops queued requests and finished results") {
+    FakeCompilationService service;
+    ShaderCompileQueue queue;
+    queue.Start(&service, 0);
+
+    queue.Submit(MakeRequest(1, "queued"));
+    queue.Submit(MakeRequest(2, "kept"));
+    queue.Cancel(1);
+    CHECK(!queue.IsPending(1));
+
+    std::vector<ShaderCompileOutput> results;
+    REQUIRE(queue.Poll(results) == 1);
+    CHECK(results[0].target == 2);
+    CHECK(service.Compiled() == std::vector<std::string>{"kept"});
+    CHECK(queue.GetStats().discarded == 1);
+
+    // Cancelling a target with nothing in flight is harmless, and it can be resubmitted.
+    queue.Cancel(3);
+    queue.Submit(MakeRequest(1, "again"));
+    results.clear();
+    REQUIRE(queue.Poll(results) == 1);
+    CHECK(results[0].source == "again");
+}
+
+TEST_CASE("ShaderCompileQueue drops a running compile that was superseded") {
+    FakeCompilationService service;
+    service.blockOn = "stale";
+    ShaderCompileQueue queue;
+    queue.Start(&service, 1);
+
+    queue.Submit(MakeRequest(1, "stale"));
+    service.WaitUntilCompiling("stale");
+    const uint64_t latest = queue.Submit(MakeRequest(1, "fresh"));
+    CHECK(queue.IsPending(1));
+    service.Release();
+
+    const std::vector<ShaderCompileOutput> results = PollUntilIdle(queue, 1);
+    REQUIRE(results.size() == 1);
+    CHECK(results[0].source == "fresh");
+    CHECK(results[0].generation == latest);
+    CHECK(service.Compiled() == (std::vector<std::string>{"stale", "fresh"}));
+    CHECK(queue.GetStats().discarded == 1);
+    queue.Stop();
+}
+
+TEST_CASE("ShaderCompileQueue never delivers a compile cancelled while running") {
+    FakeCompilationService service;
+    service.blockOn = "running";
+    ShaderCompileQueue queue;
+    queue.Start(&service, 1);
+
+    queue.Submit(MakeRequest(1, "running"));
+    service.WaitUntilCompiling("running");
+    queue.Cancel(1);
+    CHECK(!queue.IsPending(1));
+    service.Release();
+
+    // Let the worker finish, then make sure nothing for the cancelled target comes back.
+    queue.Submit(MakeRequest(2, "marker"));
+    const std::vector<ShaderCompileOutput> results = PollUntilIdle(queue, 2);
+    REQUIRE(results.size() == 1);
+    CHECK(results[0].target == 2);
+    CHECK(queue.GetStats().discarded == 1);
+    queue.Stop();
+}
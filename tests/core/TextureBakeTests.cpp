@@ -0,0 +1,111 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Core/TextureBake.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+// Offsets of the container fields the tests tamper with.
+constexpr size_t kHeaderBytes = 56;
+constexpr size_t kHeaderWidth = 16;
+constexpr size_t kHeaderDepthOrArraySize = 24;
+constexpr size_t kRecordBytes = 24;
+constexpr size_t kRecordWidth = 8;
+constexpr size_t kRecordRowPitch = 20;
+
+std::vector<uint8_t> BakeGradient(uint32_t width, uint32_t height, BakedTextureLayout layout) {
+    std::vector<uint8_t> rgba(static_cast<size_t>(width) * height * 4u);
+    for (size_t i = 0; i < rgba.size(); ++i) {
+        rgba[i] = static_cast<uint8_t>(i * 7u);
+    }
+    std::vector<uint8_t> container;
+    std::string error;
+    REQUIRE(TextureBake::Bake(rgba.data(), width, height, layout, container, error));
+    return container;
+}
+
+void PokeU32(std::vector<uint8_t>& bytes, size_t offset, uint32_t value) {
+    std::memcpy(bytes.data() + offset, &value, sizeof(value));
+}
+
+size_t RecordOffset(size_t index, size_t field) {
+    return kHeaderBytes + index * kRecordBytes + field;
+}
+
+} // namespace
+
+TEST_CASE("TextureBake round-trips a 2D mip chain") {
+    const std::vector<uint8_t> container = BakeGradient(40, 12, BakedTextureLayout::Texture2D);
+    BakedTextureView view;
+    REQUIRE(TextureBake::Parse(container, view));
+    CHECK(view.width == 40);
+    CHECK(view.height == 12);
+    CHECK(view.mipLevels == TextureBake::MipCount(40, 12, 1));
+    REQUIRE(view.subresources.size() == view.mipLevels);
+    CHECK(view.subresources[1].width == 20);
+    CHECK(view.subresources[1].height == 6);
+    CHECK(view.subresources.back().width == 1);
+    CHECK(view.subresources.back().height == 1);
+    for (const BakedSubresource& sub : view.subresources) {
+        CHECK(sub.rowPitch % TextureBake::kRowPitchAlignment == 0);
+        CHECK(sub.offset % TextureBake::kPlacementAlignment == 0);
+    }
+    // Level 0 keeps the source rows.
+    CHECK(view.payload[view.subresources[0].offset + 5] == 5 * 7);
+}
+
+TEST_CASE("TextureBake round-trips cube and volume layouts") {
+    BakedTextureView cube;
+    const std::vector<uint8_t> cubeBytes = BakeGradient(48, 8, BakedTextureLayout::TextureCube);
+    REQUIRE(TextureBake::Parse(cubeBytes, cube));
+    CHECK(cube.depthOrArraySize == 6);
+    CHECK(cube.subresources.size() == 6u * cube.mipLevels);
+
+    BakedTextureView volume;
+    const std::vector<uint8_t> volumeBytes = BakeGradient(32, 8, BakedTextureLayout::Texture3D);
+    REQUIRE(TextureBake::Parse(volumeBytes, volume));
+    CHECK(volume.depthOrArraySize == 4);
+    CHECK(volume.mipLevels == 4);
+    CHECK(volume.subresources[1].depth == 2);
+    CHECK(volume.subresources[3].depth == 1);
+}
+
+TEST_CASE("TextureBake rejects subresources that disagree with the header") {
+    const std::vector<uint8_t> good = BakeGradient(64, 64, BakedTextureLayout::Texture2D);
+    BakedTextureView view;
+    REQUIRE(TextureBake::Parse(good, view));
+
+    // A mip claiming to be larger than level 0 would make the upload copy out of bounds.
+    std::vector<uint8_t> bytes = good;
+    PokeU32(bytes, RecordOffset(2, kRecordWidth), 64);
+    CHECK(!TextureBake::Parse(bytes, view));
+    CHECK(view.subresources.empty());
+
+    bytes = good;
+    PokeU32(bytes, RecordOffset(0, kRecordRowPitch), 512);
+    CHECK(!TextureBake::Parse(bytes, view));
+
+    // A header that no longer matches its subresources.
+    bytes = good;
+    PokeU32(bytes, kHeaderWidth, 128);
+    CHECK(!TextureBake::Parse(bytes, view));
+
+    bytes = good;
+    PokeU32(bytes, kHeaderDepthOrArraySize, 6);
+    CHECK(!TextureBake::Parse(bytes, view));
+}
+
+TEST_CASE("TextureBake rejects a truncated payload") {
+    const std::vector<uint8_t> good = BakeGradient(64, 64, BakedTextureLayout::Texture2D);
+    BakedTextureView view;
+    std::vector<uint8_t> bytes(good.begin(), good.end() - 1);
+    CHECK(!TextureBake::Parse(bytes, view));
+    bytes.resize(kHeaderBytes - 1);
+    CHECK(!TextureBake::Parse(bytes, view));
+}
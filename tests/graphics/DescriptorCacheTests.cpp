@@ -0,0 +1,182 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Graphics/DescriptorCache.h"
+
+#include <cstdint>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+// Stands in for the D3D12 heap: counts writes and tracks which heap slots are live.
+class CountingWriter : public IDescriptorWriter {
+public:
+    explicit CountingWriter(uint32_t capacity) : slots(capacity) {}
+
+    void WriteDescriptor(uint32_t heapIndex, const DescriptorBinding& binding) override {
+        ++writes;
+        slots[heapIndex] = binding;
+        live[heapIndex] = true;
+    }
+
+    void ReleaseDescriptors(uint32_t firstIndex, uint32_t count) override {
+        released += count;
+        for (uint32_t i = firstIndex; i < firstIndex + count; ++i) {
+            live[i] = false;
+        }
+    }
+
+    uint32_t writes = 0;
+    uint32_t released = 0;
+    std::vector<DescriptorBinding> slots;
+    std::vector<bool> live = std::vector<bool>(slots.size(), false);
+};
+
+DescriptorBinding View(uint64_t source) {
+    DescriptorBinding binding;
+    binding.source = source;
+    binding.detail = 28; // DXGI_FORMAT_R8G8B8A8_UNORM
+    return binding;
+}
+
+constexpr uint32_t kStable = 16;
+constexpr uint32_t kRing = 16;
+
+} // namespace
+
+TEST_CASE("DescriptorCache reuses a stable table without writing") {
+    CountingWriter writer(kStable + kRing);
+    DescriptorCache cache;
+    cache.Initialize(&writer, kStable, kRing);
+
+    const DescriptorBinding views[] = {View(1), View(2), View(3)};
+    const uint64_t key = DescriptorCache::MakeKey(&writer, 0);
+    cache.BeginFrame(2);
+    const uint32_t first = cache.AcquireTable(key, views, 3);
+    REQUIRE(first != DescriptorCache::kInvalidIndex);
+    CHECK(first < kStable);
+    CHECK(writer.writes == 3);
+
+    for (int frame = 0; frame < 10; ++frame) {
+        cache.BeginFrame(2);
+        CHECK(cache.AcquireTable(key, views, 3) == first);
+    }
+    CHECK(writer.writes == 3);
+    CHECK(cache.GetStats().tableHits == 1);
+}
+
+TEST_CASE("DescriptorCache never rewrites a table a frame in flight may read") {
+    CountingWriter writer(kStable + kRing);
+    DescriptorCache cache;
+    cache.Initialize(&writer, kStable, kRing);
+    const uint64_t key = DescriptorCache::MakeKey(&writer, 1);
+
+    const DescriptorBinding before[] = {View(1), View(2)};
+    const DescriptorBinding after[] = {View(1), View(9)};
+    cache.BeginFrame(2);
+    const uint32_t stable = cache.AcquireTable(key, before, 2);
+
+    // The next frame changes one view while the previous frame may still be executing:
+    // the change goes to the ring and the stable copy keeps its old contents.
+    cache.BeginFrame(2);
+    const uint32_t dynamic = cache.AcquireTable(key, after, 2);
+    CHECK(dynamic >= kStable);
+    CHECK(writer.slots[stable + 1] == View(2));
+    CHECK(cache.GetStats().ringTables == 1);
+
+    // Once both earlier frames have retired, only the changed view is rewritten in place.
+    cache.BeginFrame(2);
+    cache.BeginFrame(2);
+    const uint32_t writesBefore = writer.writes;
+    CHECK(cache.AcquireTable(key, after, 2) == stable);
+    CHECK(writer.writes == writesBefore + 1);
+    CHECK(writer.slots[stable + 1] == View(9));
+}
+
+TEST_CASE("DescriptorCache reclaims ring space after framesInFlight frames") {
+    for (uint32_t framesInFlight = 1; framesInFlight <= 3; ++framesInFlight) {
+        CountingWriter writer(kStable + kRing);
+        DescriptorCache cache;
+        cache.Initialize(&writer, kStable, kRing);
+        const DescriptorBinding views[] = {View(1), View(2), View(3), View(4)};
+
+        // Four-descriptor tables; a 16-descriptor ring fits four of them, shared by the
+        // frames in flight.
+        std::vector<std::vector<uint32_t>> perFrame;
+        for (int frame = 0; frame < 12; ++frame) {
+            cache.BeginFrame(framesInFlight);
+            std::vector<uint32_t> tables;
+            const uint32_t perFrameTables = 4 / framesInFlight;
+            for (uint32_t i = 0; i < perFrameTables; ++i) {
+                const uint32_t first = cache.AllocateDynamic(views, 4);
+                CHECK(first != DescriptorCache::kInvalidIndex);
+                tables.push_back(first);
+            }
+            // Nothing written this frame may overlap a table from a frame still in flight.
+            for (uint32_t back = 1; back < framesInFlight && back <= perFrame.size(); ++back) {
+                for (uint32_t mine : tables) {
+                    for (uint32_t theirs : perFrame[perFrame.size() - back]) {
+                        CHECK(mine + 4 <= theirs || theirs + 4 <= mine);
+                    }
+                }
+            }
+            perFrame.push_back(tables);
+        }
+        CHECK(writer.released > 0);
+    }
+}
+
+TEST_CASE("DescriptorCache fails a ring allocation that would overwrite a frame in flight") {
+    CountingWriter writer(kStable + kRing);
+    DescriptorCache cache;
+    cache.Initialize(&writer, kStable, kRing);
+    const DescriptorBinding views[8] = {};
+
+    cache.BeginFrame(2);
+    CHECK(cache.AllocateDynamic(views, 8) != DescriptorCache::kInvalidIndex);
+    CHECK(cache.AllocateDynamic(views, 8) != DescriptorCache::kInvalidIndex);
+    CHECK(cache.AllocateDynamic(views, 8) == DescriptorCache::kInvalidIndex);
+    CHECK(cache.GetStats().failedTables == 1);
+
+    // Frame 1 is still in flight during frame 2.
+    cache.BeginFrame(2);
+    CHECK(cache.AllocateDynamic(views, 8) == DescriptorCache::kInvalidIndex);
+
+    // By frame 3 it has retired and its space is free again.
+    cache.BeginFrame(2);
+    CHECK(cache.AllocateDynamic(views, 8) != DescriptorCache::kInvalidIndex);
+}
+
+TEST_CASE("DescriptorCache evicts idle stable tables and releases their slots") {
+    CountingWriter writer(kStable + kRing);
+    DescriptorCache cache;
+    cache.Initialize(&writer, kStable, kRing);
+    const DescriptorBinding views[] = {View(5), View(6)};
+    const uint64_t key = DescriptorCache::MakeKey(&writer, 2);
+
+    cache.BeginFrame(2);
+    const uint32_t first = cache.AcquireTable(key, views, 2);
+    REQUIRE(first != DescriptorCache::kInvalidIndex);
+    CHECK(writer.live[first]);
+
+    for (uint32_t frame = 0; frame <= DescriptorCache::kMaxIdleFrames + 2; ++frame) {
+        cache.BeginFrame(2);
+    }
+    CHECK(!writer.live[first]);
+    CHECK(cache.GetLastFrameStats().stableTables == 0);
+}
+
+TEST_CASE("DescriptorCache falls back to the ring when the stable region is full") {
+    CountingWriter writer(kStable + kRing);
+    DescriptorCache cache;
+    cache.Initialize(&writer, kStable, kRing);
+    const DescriptorBinding views[8] = {};
+
+    cache.BeginFrame(2);
+    CHECK(cache.AcquireTable(DescriptorCache::MakeKey(&writer, 10), views, 8) < kStable);
+    CHECK(cache.AcquireTable(DescriptorCache::MakeKey(&writer, 11), views, 8) < kStable);
+    const uint32_t overflow = cache.AcquireTable(DescriptorCache::MakeKey(&writer, 12), views, 8);
+    CHECK(overflow >= kStable);
+    CHECK(overflow != DescriptorCache::kInvalidIndex);
+}
@@ -0,0 +1,208 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Graphics/FrameFenceRing.h"
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+// A single GPU queue reduced to its fence: Signal enqueues a value, the GPU completes
+// queued values in order when Advance is called, and WaitFor drains until a value lands.
+class SimulatedFence {
+public:
+    uint64_t Signal() {
+        m_pending.push_back(++m_lastSignalled);
+        return m_lastSignalled;
+    }
+
+    void Advance(size_t count = 1) {
+        while (count-- > 0 && !m_pending.empty()) {
+            m_completed = m_pending.front();
+            m_pending.pop_front();
+        }
+    }
+
+    // Returns true when the CPU had to block.
+    bool WaitFor(uint64_t value) {
+        if (value == 0 || m_completed >= value) {
+            return false;
+        }
+        while (m_completed < value) {
+            Advance();
+        }
+        return true;
+    }
+
+    uint64_t Completed() const { return m_completed; }
+
+private:
+    std::deque<uint64_t> m_pending;
+    uint64_t m_lastSignalled = 0;
+    uint64_t m_completed = 0;
+};
+
+// Mirrors CommandQueue: BeginFrame waits on the slot, EndFrame signals and tags the
+// objects retired during the frame, WaitForGPU signals and drains.
+class SimulatedQueue {
+public:
+    explicit SimulatedQueue(uint32_t framesInFlight) : m_ring(framesInFlight) {}
+
+    bool BeginFrame() {
+        const bool stalled = m_fence.WaitFor(m_ring.GetSlotWaitValue());
+        m_retired.Collect(m_fence.Completed());
+        return stalled;
+    }
+
+    uint64_t EndFrame() {
+        const uint64_t value = m_fence.Signal();
+        for (auto& object : m_retiredThisFrame) {
+            m_retired.Push(value, std::move(object));
+        }
+        m_retiredThisFrame.clear();
+        m_ring.EndFrame(value);
+        m_retired.Collect(m_fence.Completed());
+        return value;
+    }
+
+    void WaitForGPU() {
+        const uint64_t value = m_fence.Signal();
+        m_fence.WaitFor(value);
+        m_retired.Collect(value);
+    }
+
+    void Retire(std::shared_ptr<int> object) { m_retiredThisFrame.push_back(std::move(object)); }
+
+    FrameFenceRing& Ring() { return m_ring; }
+    SimulatedFence& Fence() { return m_fence; }
+    size_t PendingRetired() const { return m_retired.Size() + m_retiredThisFrame.size(); }
+
+private:
+    FrameFenceRing m_ring;
+    SimulatedFence m_fence;
+    FenceRetireQueue<std::shared_ptr<int>> m_retired;
+    std::vector<std::shared_ptr<int>> m_retiredThisFrame;
+};
+
+} // namespace
+
+TEST_CASE("FrameFenceRing clamps the frame count") {
+    CHECK(FrameFenceRing(0).GetFramesInFlight() == 1);
+    CHECK(FrameFenceRing(3).GetFramesInFlight() == 3);
+    CHECK(FrameFenceRing(FrameFenceRing::kMaxFramesInFlight + 5).GetFramesInFlight() == FrameFenceRing::kMaxFramesInFlight);
+}
+
+TEST_CASE("FrameFenceRing cycles slots and remembers each slot's fence") {
+    FrameFenceRing ring(3);
+    for (uint64_t frame = 1; frame <= 7; ++frame) {
+        const uint32_t slot = ring.GetCurrentSlot();
+        CHECK(slot == (frame - 1) % 3);
+        // A slot waits on the value signalled the last time it was recorded.
+        CHECK(ring.GetSlotWaitValue() == (frame > 3 ? frame - 3 : 0));
+        ring.EndFrame(frame);
+    }
+}
+
+TEST_CASE("FrameFenceRing single frame in flight waits for the previous frame") {
+    SimulatedQueue queue(1);
+    queue.BeginFrame();
+    queue.EndFrame();
+    CHECK(queue.BeginFrame());
+    CHECK(queue.Fence().Completed() == 1);
+}
+
+TEST_CASE("FrameFenceRing lets the CPU run ahead by framesInFlight - 1 frames") {
+    SimulatedQueue queue(2);
+    // GPU idle: the first two frames never block.
+    CHECK(!queue.BeginFrame());
+    queue.EndFrame();
+    CHECK(!queue.BeginFrame());
+    queue.EndFrame();
+
+    // Slot 0 again with frame 1 still queued: the CPU must block, but only on frame 1.
+    CHECK(queue.BeginFrame());
+    CHECK(queue.Fence().Completed() == 1);
+    queue.EndFrame();
+
+    // The GPU keeps pace from here on; no further stalls.
+    for (int frame = 0; frame < 16; ++frame) {
+        queue.Fence().Advance();
+        CHECK(!queue.BeginFrame());
+        queue.EndFrame();
+    }
+}
+
+TEST_CASE("FrameFenceRing never reuses a slot the GPU has not finished") {
+    for (uint32_t framesInFlight = 1; framesInFlight <= FrameFenceRing::kMaxFramesInFlight; ++framesInFlight) {
+        SimulatedQueue queue(framesInFlight);
+        std::vector<uint64_t> slotLastFence(framesInFlight, 0);
+        for (int frame = 0; frame < 64; ++frame) {
+            // A GPU that sometimes lags behind by several frames.
+            if (frame % 5 != 0) {
+                queue.Fence().Advance();
+            }
+            queue.BeginFrame();
+            const uint32_t slot = queue.Ring().GetCurrentSlot();
+            CHECK(queue.Fence().Completed() >= slotLastFence[slot]);
+            slotLastFence[slot] = queue.EndFrame();
+        }
+    }
+}
+
+TEST_CASE("FenceRetireQueue releases in fence order") {
+    FenceRetireQueue<std::shared_ptr<int>> retired;
+    auto a = std::make_shared<int>(1);
+    auto b = std::make_shared<int>(2);
+    std::weak_ptr<int> weakA = a;
+    std::weak_ptr<int> weakB = b;
+    retired.Push(3, std::move(a));
+    retired.Push(5, std::move(b));
+
+    CHECK(retired.Collect(2) == 0);
+    CHECK(retired.Collect(4) == 1);
+    CHECK(weakA.expired());
+    CHECK(!weakB.expired());
+    CHECK(retired.Collect(5) == 1);
+    CHECK(weakB.expired());
+    CHECK(retired.Size() == 0);
+}
+
+TEST_CASE("Retired objects outlive every frame in flight that may use them") {
+    SimulatedQueue queue(2);
+    queue.BeginFrame();
+    auto texture = std::make_shared<int>(7);
+    std::weak_ptr<int> weak = texture;
+    queue.Retire(std::move(texture));
+    queue.EndFrame(); // fence 1
+
+    queue.BeginFrame();
+    queue.EndFrame(); // fence 2, GPU has not started
+    CHECK(!weak.expired());
+
+    queue.Fence().Advance();
+    queue.BeginFrame();
+    CHECK(weak.expired());
+    queue.EndFrame();
+}
+
+TEST_CASE("A WaitForGPU mid-frame does not release objects retired by that frame") {
+    SimulatedQueue queue(2);
+    queue.BeginFrame();
+    auto pipeline = std::make_shared<int>(9);
+    std::weak_ptr<int> weak = pipeline;
+    queue.Retire(std::move(pipeline));
+
+    // The frame's commands are not submitted yet, so the drain must not cover them.
+    queue.WaitForGPU();
+    CHECK(!weak.expired());
+    CHECK(queue.PendingRetired() == 1);
+
+    queue.EndFrame();
+    CHECK(!weak.expired());
+    queue.WaitForGPU();
+    CHECK(weak.expired());
+    CHECK(queue.PendingRetired() == 0);
+}
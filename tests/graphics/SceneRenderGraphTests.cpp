@@ -0,0 +1,120 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Graphics/SceneRenderGraph.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+bool Contains(const std::vector<std::pair<int, int>>& edges, int from, int to) {
+    return std::find(edges.begin(), edges.end(), std::make_pair(from, to)) != edges.end();
+}
+
+size_t PositionOf(const std::vector<int>& schedule, int scene) {
+    return static_cast<size_t>(std::find(schedule.begin(), schedule.end(), scene) - schedule.begin());
+}
+
+} // namespace
+
+TEST_CASE("SceneRenderGraph schedules dependencies before the root") {
+    // 0 samples 1 and 2; 1 samples 3.
+    SceneRenderGraph graph;
+    graph.Sync({{1, 2}, {3}, {}, {}});
+
+    const std::vector<int>& schedule = graph.GetSchedule(0);
+    CHECK(schedule == std::vector<int>({3, 1, 2, 0}));
+    CHECK(graph.GetSchedule(1) == std::vector<int>({3, 1}));
+    CHECK(graph.GetSchedule(2) == std::vector<int>({2}));
+    CHECK(graph.GetCycleEdges().empty());
+}
+
+TEST_CASE("SceneRenderGraph schedules a shared dependency once") {
+    // Diamond: 0 samples 1 and 2, both sample 3.
+    SceneRenderGraph graph;
+    graph.Sync({{1, 2}, {3}, {3}, {}});
+
+    const std::vector<int>& schedule = graph.GetSchedule(0);
+    CHECK(schedule.size() == 4);
+    CHECK(std::count(schedule.begin(), schedule.end(), 3) == 1);
+    CHECK(PositionOf(schedule, 3) < PositionOf(schedule, 1));
+    CHECK(PositionOf(schedule, 3) < PositionOf(schedule, 2));
+    CHECK(schedule.back() == 0);
+}
+
+TEST_CASE("SceneRenderGraph drops the edge that closes a cycle") {
+    // 0 -> 1 -> 2 -> 0, plus a self-sample on 2.
+    SceneRenderGraph graph;
+    graph.Sync({{1}, {2}, {0, 2}});
+
+    CHECK(graph.GetCycleEdges().size() == 2);
+    CHECK(Contains(graph.GetCycleEdges(), 2, 0));
+    CHECK(Contains(graph.GetCycleEdges(), 2, 2));
+    CHECK(graph.GetStats().cycleEdges == 2);
+
+    // Which edge is dropped depends on where the walk enters the cycle.
+    CHECK(graph.GetSchedule(0) == std::vector<int>({2, 1, 0}));
+    CHECK(graph.GetSchedule(1) == std::vector<int>({0, 2, 1}));
+}
+
+TEST_CASE("SceneRenderGraph ignores bindings to missing scenes") {
+    SceneRenderGraph graph;
+    graph.Sync({{-1, 5, 1}, {}});
+    CHECK(graph.GetSchedule(0) == std::vector<int>({1, 0}));
+    CHECK(graph.GetSchedule(7).empty());
+    CHECK(graph.GetCycleEdges().empty());
+}
+
+TEST_CASE("SceneRenderGraph rebuilds only when edges change") {
+    SceneRenderGraph graph;
+    CHECK(graph.Sync({{1}, {}}));
+    CHECK(!graph.Sync({{1}, {}}));
+    CHECK(graph.GetStats().graphRebuilds == 1);
+
+    CHECK(graph.GetSchedule(0) == std::vector<int>({1, 0}));
+    CHECK(graph.Sync({{}, {0}}));
+    CHECK(graph.GetStats().graphRebuilds == 2);
+    // Cached schedules are dropped with the old edges.
+    CHECK(graph.GetSchedule(0) == std::vector<int>({0}));
+    CHECK(graph.GetSchedule(1) == std::vector<int>({0, 1}));
+}
+
+TEST_CASE("SceneRenderGraph skips passes already recorded this frame") {
+    SceneRenderGraph graph;
+    graph.Sync({{2}, {2}, {}});
+    graph.BeginFrame();
+
+    // Scenes 0 and 1 both sample 2 at the same time: 2 renders once.
+    for (int root : {0, 1}) {
+        for (int scene : graph.GetSchedule(root)) {
+            graph.BeginPass(scene, 1.5);
+        }
+    }
+    CHECK(graph.GetStats().passesRequested == 4);
+    CHECK(graph.GetStats().passesRendered == 3);
+    CHECK(graph.GetStats().passesSkipped == 1);
+
+    // A different scene time (a transition's other side) renders again.
+    CHECK(graph.BeginPass(2, 2.0));
+    CHECK(!graph.BeginPass(2, 2.0));
+
+    graph.BeginFrame();
+    CHECK(graph.GetLastFrameStats().passesRendered == 4);
+    CHECK(graph.GetLastFrameStats().passesSkipped == 2);
+    CHECK(graph.GetStats().passesRequested == 0);
+
+    // A new frame renders every scene again.
+    CHECK(graph.BeginPass(2, 2.0));
+}
+
+TEST_CASE("SceneRenderGraph always renders unknown scenes") {
+    SceneRenderGraph graph;
+    graph.Sync({{}});
+    graph.BeginFrame();
+    CHECK(graph.BeginPass(4, 0.0));
+    CHECK(graph.BeginPass(4, 0.0));
+    CHECK(graph.GetStats().passesSkipped == 0);
+}
@@ -0,0 +1,136 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Graphics/TransientTexturePlanner.h"
+
+#include <cstdint>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+constexpr uint32_t kRgba8 = 28;       // DXGI_FORMAT_R8G8B8A8_UNORM
+constexpr uint32_t kRgba16F = 10;     // DXGI_FORMAT_R16G16B16A16_FLOAT
+constexpr uint32_t kRenderTarget = 1; // D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET
+constexpr uint32_t kUnordered = 4;    // D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS
+
+TransientTextureKey Key(uint32_t width, uint32_t height, uint32_t format = kRgba8, uint32_t flags = kRenderTarget) {
+    TransientTextureKey key;
+    key.width = width;
+    key.height = height;
+    key.format = format;
+    key.flags = flags;
+    return key;
+}
+
+TransientTextureRequest Request(const TransientTextureKey& key, uint32_t firstPass, uint32_t lastPass, uint64_t bytes = 0) {
+    TransientTextureRequest request;
+    request.key = key;
+    request.bytes = bytes ? bytes : uint64_t(key.width) * key.height * 4;
+    request.firstPass = firstPass;
+    request.lastPass = lastPass;
+    return request;
+}
+
+} // namespace
+
+TEST_CASE("PlanTransientTextures shares one slot across disjoint lifetimes of a key") {
+    const TransientTextureKey key = Key(1920, 1080);
+    // Listed out of pass order; the planner sorts by first pass.
+    const std::vector<TransientTextureRequest> requests = {
+        Request(key, 4, 5),
+        Request(key, 0, 1),
+        Request(key, 2, 3, 1000),
+    };
+    const TransientTexturePlan plan = PlanTransientTextures(requests);
+    REQUIRE(plan.slotOfRequest.size() == 3);
+    CHECK(plan.slotKeys.size() == 1);
+    CHECK(plan.slotOfRequest[0] == 0);
+    CHECK(plan.slotOfRequest[1] == 0);
+    CHECK(plan.slotOfRequest[2] == 0);
+    CHECK(plan.slotKeys[0] == key);
+    // A slot is as large as the largest request it serves.
+    CHECK(plan.slotBytes[0] == requests[0].bytes);
+    CHECK(plan.naiveBytes == 2 * requests[0].bytes + 1000);
+    CHECK(plan.pooledBytes == requests[0].bytes);
+}
+
+TEST_CASE("PlanTransientTextures keeps a texture busy through its last pass") {
+    const TransientTextureKey key = Key(1280, 720);
+    // The second request starts in the pass where the first one ends, so both are alive there.
+    const std::vector<TransientTextureRequest> touching = {Request(key, 0, 2), Request(key, 2, 4)};
+    TransientTexturePlan plan = PlanTransientTextures(touching);
+    CHECK(plan.slotKeys.size() == 2);
+    CHECK(plan.slotOfRequest[0] != plan.slotOfRequest[1]);
+    CHECK(plan.pooledBytes == plan.naiveBytes);
+
+    // One pass later they can share.
+    plan = PlanTransientTextures({Request(key, 0, 2), Request(key, 3, 4)});
+    CHECK(plan.slotKeys.size() == 1);
+
+    // A single-pass request overlaps another single-pass request in the same pass.
+    plan = PlanTransientTextures({Request(key, 1, 1), Request(key, 1, 1), Request(key, 2, 2)});
+    CHECK(plan.slotKeys.size() == 2);
+    CHECK(plan.slotOfRequest[0] != plan.slotOfRequest[1]);
+}
+
+TEST_CASE("PlanTransientTextures never shares between different keys") {
+    const TransientTextureKey base = Key(1920, 1080);
+    const std::vector<TransientTextureRequest> requests = {
+        Request(base, 0, 0),
+        Request(Key(1921, 1080), 1, 1),
+        Request(Key(1920, 1079), 2, 2),
+        Request(Key(1920, 1080, kRgba16F), 3, 3, 1920ull * 1080 * 8),
+        Request(Key(1920, 1080, kRgba8, kUnordered), 4, 4),
+        Request(base, 5, 5),
+    };
+    const TransientTexturePlan plan = PlanTransientTextures(requests);
+    CHECK(plan.slotKeys.size() == 5);
+    for (size_t i = 0; i < 5; ++i) {
+        CHECK(plan.slotKeys[plan.slotOfRequest[i]] == requests[i].key);
+        for (size_t j = i + 1; j < 5; ++j) {
+            CHECK(plan.slotOfRequest[i] != plan.slotOfRequest[j]);
+        }
+    }
+    // Only the last request finds a compatible free slot.
+    CHECK(plan.slotOfRequest[5] == plan.slotOfRequest[0]);
+    CHECK(plan.pooledBytes == plan.naiveBytes - requests[5].bytes);
+}
+
+TEST_CASE("PlanTransientTextures pools a multi-scene frame") {
+    // Three scenes back to back, each a post-FX ping-pong at full resolution and a
+    // half-resolution compute output.
+    const TransientTextureKey full = Key(1920, 1080);
+    const TransientTextureKey half = Key(960, 540, kRgba8, kUnordered);
+    std::vector<TransientTextureRequest> requests;
+    for (uint32_t scene = 0; scene < 3; ++scene) {
+        const uint32_t pass = scene * 3;
+        requests.push_back(Request(full, pass, pass + 1));     // Ping
+        requests.push_back(Request(full, pass + 1, pass + 2)); // Pong
+        requests.push_back(Request(half, pass + 2, pass + 2)); // Compute
+    }
+    const uint64_t fullBytes = requests[0].bytes;
+    const uint64_t halfBytes = requests[2].bytes;
+
+    const TransientTexturePlan plan = PlanTransientTextures(requests);
+    CHECK(plan.naiveBytes == 3 * (2 * fullBytes + halfBytes));
+    // Ping and pong overlap in the middle pass, so two full-resolution textures, plus one compute output.
+    CHECK(plan.slotKeys.size() == 3);
+    CHECK(plan.pooledBytes == 2 * fullBytes + halfBytes);
+
+    uint64_t slotTotal = 0;
+    for (const uint64_t bytes : plan.slotBytes) {
+        slotTotal += bytes;
+    }
+    CHECK(slotTotal == plan.pooledBytes);
+
+    // Every scene reuses the first scene's textures; within a scene ping and pong differ.
+    for (uint32_t scene = 1; scene < 3; ++scene) {
+        CHECK(plan.slotOfRequest[scene * 3 + 2] == plan.slotOfRequest[2]);
+        CHECK(plan.slotOfRequest[scene * 3] != plan.slotOfRequest[scene * 3 + 1]);
+        CHECK(plan.slotKeys[plan.slotOfRequest[scene * 3]] == full);
+        CHECK(plan.slotKeys[plan.slotOfRequest[scene * 3 + 1]] == full);
+    }
+
+    CHECK(PlanTransientTextures({}).pooledBytes == 0);
+}
@@ -0,0 +1,147 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Graphics/UploadRingAllocator.h"
+
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+struct LiveRange {
+    uint64_t fenceValue;
+    uint64_t offset;
+    uint64_t size;
+};
+
+bool Overlaps(const LiveRange& a, uint64_t offset, uint64_t size) {
+    return offset < a.offset + a.size && a.offset < offset + size;
+}
+
+} // namespace
+
+TEST_CASE("UploadRingAllocator hands out aligned, contiguous ranges") {
+    UploadRingAllocator ring;
+    ring.Reset(1024);
+    CHECK(ring.Allocate(100, 256) == 0);
+    CHECK(ring.Allocate(100, 256) == 256);
+    CHECK(ring.Allocate(1, 1) == 356);
+    CHECK(ring.Allocate(600, 256) == UploadRingAllocator::kInvalidOffset);
+    CHECK(ring.Allocate(0, 256) == UploadRingAllocator::kInvalidOffset);
+    CHECK(ring.Allocate(2048, 256) == UploadRingAllocator::kInvalidOffset);
+}
+
+TEST_CASE("UploadRingAllocator aligns the offset after a wrap when capacity is not a multiple") {
+    // 1000 bytes with 512-byte alignment: positions aligned to 512 map to unaligned offsets
+    // once the ring has wrapped, so the offset itself must be aligned.
+    UploadRingAllocator ring;
+    ring.Reset(1000);
+    CHECK(ring.Allocate(300, 512) == 0);
+    ring.Submit(1);
+    CHECK(ring.Allocate(300, 512) == 512);
+    ring.Submit(2);
+    ring.Retire(1);
+
+    // Does not fit before the end: restarts at offset 0, which is free again.
+    const uint64_t wrapped = ring.Allocate(200, 512);
+    CHECK(wrapped == 0);
+    ring.Submit(3);
+    ring.Retire(2);
+
+    const uint64_t next = ring.Allocate(100, 512);
+    REQUIRE(next != UploadRingAllocator::kInvalidOffset);
+    CHECK(next % 512 == 0);
+}
+
+TEST_CASE("UploadRingAllocator never overwrites a submission the GPU has not finished") {
+    const uint64_t capacities[] = {4096, 3000, 1000};
+    for (uint64_t capacity : capacities) {
+        std::mt19937 rng(static_cast<uint32_t>(capacity));
+        std::uniform_int_distribution<uint64_t> size(1, capacity / 3);
+        std::uniform_int_distribution<int> alignmentShift(0, 9);
+
+        UploadRingAllocator ring;
+        ring.Reset(capacity);
+        std::deque<LiveRange> live;
+        uint64_t fenceValue = 0;
+        uint64_t completed = 0;
+
+        for (int step = 0; step < 2000; ++step) {
+            const uint64_t alignment = 1ull << alignmentShift(rng);
+            const uint64_t bytes = size(rng);
+            uint64_t offset = ring.Allocate(bytes, alignment);
+            while (offset == UploadRingAllocator::kInvalidOffset) {
+                // Out of space: submit what is pending, then let the GPU finish the oldest
+                // submission, as TextureUploadQueue does.
+                if (ring.HasPendingAllocations()) {
+                    ring.Submit(++fenceValue);
+                }
+                REQUIRE(ring.GetOldestFenceValue() != 0);
+                completed = ring.GetOldestFenceValue();
+                ring.Retire(completed);
+                while (!live.empty() && live.front().fenceValue <= completed) {
+                    live.pop_front();
+                }
+                offset = ring.Allocate(bytes, alignment);
+            }
+
+            CHECK(offset % alignment == 0);
+            CHECK(offset + bytes <= capacity);
+            for (const LiveRange& range : live) {
+                CHECK(!Overlaps(range, offset, bytes));
+            }
+            // Tagged with the fence of the submission it will ride on.
+            live.push_back({fenceValue + 1, offset, bytes});
+
+            if (step % 3 == 0) {
+                ring.Submit(++fenceValue);
+            }
+            // A GPU that sometimes lags several submissions behind.
+            if (step % 7 == 0 && completed < fenceValue) {
+                ring.Retire(++completed);
+                while (!live.empty() && live.front().fenceValue <= completed) {
+                    live.pop_front();
+                }
+            }
+            CHECK(ring.GetUsedBytes() <= capacity);
+        }
+    }
+}
+
+TEST_CASE("UploadRingAllocator restarts at offset 0 once idle") {
+    UploadRingAllocator ring;
+    ring.Reset(1024);
+    CHECK(ring.Allocate(700, 256) == 0);
+    ring.Submit(1);
+    CHECK(ring.GetOldestFenceValue() == 1);
+
+    ring.Retire(0);
+    CHECK(ring.GetUsedBytes() == 700);
+
+    ring.Retire(1);
+    CHECK(ring.GetUsedBytes() == 0);
+    CHECK(ring.GetOldestFenceValue() == 0);
+    // The whole buffer is available contiguously again.
+    CHECK(ring.Allocate(1024, 256) == 0);
+}
+
+TEST_CASE("UploadRingAllocator keeps unsubmitted allocations across Retire") {
+    UploadRingAllocator ring;
+    ring.Reset(1024);
+    ring.Allocate(512, 256);
+    ring.Submit(1);
+    ring.Allocate(256, 256);
+    CHECK(ring.HasPendingAllocations());
+
+    ring.Retire(1);
+    CHECK(ring.GetUsedBytes() == 256);
+    // The pending range is still held, so a full-size request cannot fit.
+    CHECK(ring.Allocate(1024, 256) == UploadRingAllocator::kInvalidOffset);
+    ring.Submit(2);
+    ring.Retire(2);
+    CHECK(ring.Allocate(1024, 256) == 0);
+}
@@ -0,0 +1,202 @@
+#include "TestHarness.h"
+
+#include "ShaderLab/Runtime/ShaderJobScheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ShaderLab;
+
+namespace {
+
+// Echoes the job label as bytecode. Jobs listed in blocked wait until Release();
+// delayMicros makes later jobs finish first when several workers run.
+class FakeCompiler : public IShaderJobCompiler {
+public:
+    std::vector<int> blocked;
+    bool reverseDelays = false;
+
+    ShaderJobResult Compile(const ShaderJob& job) override {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_compiled.push_back(job.sceneIndex);
+            m_changed.notify_all();
+            if (std::find(blocked.begin(), blocked.end(), job.sceneIndex) != blocked.end()) {
+                m_changed.wait(lock, [&] { return m_released; });
+            }
+        }
+        if (reverseDelays) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50 * (64 - job.sceneIndex % 64)));
+        }
+
+        ShaderJobResult result;
+        result.success = job.label.rfind("bad", 0) != 0;
+        if (result.success) {
+            result.bytecode.assign(job.label.begin(), job.label.end());
+        } else {
+            result.error = "error in " + job.label;
+        }
+        return result;
+    }
+
+    void Release() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_released = true;
+        m_changed.notify_all();
+    }
+
+    void WaitForCompiled(size_t count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_changed.wait(lock, [&] { return m_compiled.size() >= count; });
+    }
+
+    std::vector<int> Compiled() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_compiled;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::vector<int> m_compiled;
+    bool m_released = false;
+};
+
+std::vector<ShaderJob> MakeJobs(int count) {
+    std::vector<ShaderJob> jobs;
+    for (int i = 0; i < count; ++i) {
+        ShaderJob job;
+        job.kind = static_cast<ShaderJobKind>(i % 4);
+        job.sceneIndex = i;
+        job.label = (i % 5 == 3 ? "bad" : "job") + std::to_string(i);
+        jobs.push_back(job);
+    }
+    return jobs;
+}
+
+void CheckDeliveredInOrder(const std::vector<ShaderJobScheduler::Completed>& completed, int count) {
+    REQUIRE(completed.size() == static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        const auto& entry = completed[static_cast<size_t>(i)];
+        CHECK(entry.job.sceneIndex == i);
+        CHECK(entry.result.success == (i % 5 != 3));
+        if (entry.result.success) {
+            CHECK(std::string(entry.result.bytecode.begin(), entry.result.bytecode.end()) == entry.job.label);
+        } else {
+            CHECK(entry.result.error == "error in " + entry.job.label);
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("ShaderJobScheduler inline mode compiles lazily inside Poll") {
+    FakeCompiler compiler;
+    ShaderJobScheduler scheduler;
+    scheduler.Start(&compiler, MakeJobs(10), 0);
+    CHECK(compiler.Compiled().empty());
+
+    std::vector<ShaderJobScheduler::Completed> completed;
+    CHECK(scheduler.Poll(completed, 3) == 3);
+    CHECK(compiler.Compiled() == std::vector<int>({0, 1, 2}));
+    CHECK(scheduler.DeliveredCount() == 3);
+    CHECK(!scheduler.IsFinished());
+
+    while (!scheduler.IsFinished()) {
+        scheduler.Poll(completed, 4);
+    }
+    CheckDeliveredInOrder(completed, 10);
+    CHECK(scheduler.Poll(completed, 4) == 0);
+}
+
+TEST_CASE("ShaderJobScheduler delivers in submission order whatever finishes first") {
+    for (const uint32_t workers : {1u, 4u, 8u}) {
+        FakeCompiler compiler;
+        compiler.reverseDelays = true;
+        ShaderJobScheduler scheduler;
+        scheduler.Start(&compiler, MakeJobs(128), workers);
+
+        std::vector<ShaderJobScheduler::Completed> completed;
+        while (!scheduler.IsFinished()) {
+            scheduler.Poll(completed, 5);
+            std::this_thread::yield();
+        }
+        CheckDeliveredInOrder(completed, 128);
+        CHECK(compiler.Compiled().size() == 128);
+    }
+}
+
+TEST_CASE("ShaderJobScheduler holds later results behind an unfinished job") {
+    FakeCompiler compiler;
+    compiler.blocked = {0};
+    ShaderJobScheduler scheduler;
+    scheduler.Start(&compiler, MakeJobs(6), 2);
+
+    // Job 0 is stuck; the second worker finishes everything else meanwhile.
+    compiler.WaitForCompiled(6);
+    std::vector<ShaderJobScheduler::Completed> completed;
+    CHECK(scheduler.Poll(completed, 10) == 0);
+    CHECK(completed.empty());
+
+    compiler.Release();
+    while (!scheduler.IsFinished()) {
+        scheduler.Poll(completed, 10);
+        std::this_thread::yield();
+    }
+    CheckDeliveredInOrder(completed, 6);
+}
+
+TEST_CASE("ShaderJobScheduler cancel drops queued jobs and running results") {
+    FakeCompiler compiler;
+    compiler.blocked = {0};
+    ShaderJobScheduler scheduler;
+    scheduler.Start(&compiler, MakeJobs(20), 1);
+    compiler.WaitForCompiled(1);
+
+    // Cancel joins the worker, so job 0 has to be let go from another thread.
+    std::thread releaser([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        compiler.Release();
+    });
+    scheduler.Cancel();
+    releaser.join();
+
+    CHECK(scheduler.IsCancelled());
+    CHECK(scheduler.IsFinished());
+    CHECK(compiler.Compiled() == std::vector<int>({0}));
+    std::vector<ShaderJobScheduler::Completed> completed;
+    CHECK(scheduler.Poll(completed, 10) == 0);
+    CHECK(scheduler.DeliveredCount() == 0);
+}
+
+TEST_CASE("ShaderJobScheduler Start cancels the previous batch") {
+    FakeCompiler compiler;
+    ShaderJobScheduler scheduler;
+    scheduler.Start(&compiler, MakeJobs(50), 0);
+    std::vector<ShaderJobScheduler::Completed> completed;
+    scheduler.Poll(completed, 2);
+
+    completed.clear();
+    scheduler.Start(&compiler, MakeJobs(5), 2);
+    CHECK(!scheduler.IsCancelled());
+    CHECK(scheduler.TotalCount() == 5);
+    while (!scheduler.IsFinished()) {
+        scheduler.Poll(completed, 10);
+        std::this_thread::yield();
+    }
+    CheckDeliveredInOrder(completed, 5);
+}
+
+TEST_CASE("ShaderJobScheduler without a compiler is cancelled at once") {
+    ShaderJobScheduler scheduler;
+    scheduler.Start(nullptr, MakeJobs(3), 2);
+    CHECK(scheduler.IsCancelled());
+    CHECK(scheduler.IsFinished());
+    std::vector<ShaderJobScheduler::Completed> completed;
+    CHECK(scheduler.Poll(completed, 10) == 0);
+}
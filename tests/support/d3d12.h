@@ -0,0 +1,16 @@
+#pragma once
+
+// Headless test builds only: just enough of d3d12.h for headers that name D3D12
+// interfaces in data structures (ShaderLabData.h). Nothing here is ever called.
+
+#include <cstdint>
+
+struct ID3D12Resource;
+struct ID3D12PipelineState;
+struct ID3D12DescriptorHeap;
+struct ID3D12Device;
+struct ID3D12GraphicsCommandList;
+struct ID3D12CommandQueue;
+struct ID3D12CommandAllocator;
+struct ID3D12Fence;
+struct ID3D12RootSignature;
@@ -0,0 +1,9 @@
+#pragma once
+
+// Headless test builds only: the DXC interfaces ShaderCompiler.h holds pointers to.
+// Tests compile through a fake ICompilationService, so none of these is ever created.
+
+struct IDxcUtils;
+struct IDxcCompiler3;
+struct IDxcIncludeHandler;
+struct IDxcBlobEncoding;
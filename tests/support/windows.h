@@ -0,0 +1,15 @@
+#pragma once
+
+// Headless test builds only: the handful of Win32 typedefs that ShaderCompiler.h names in
+// declarations. Nothing here is ever called.
+
+#include <cstdint>
+
+#define WINAPI
+
+typedef int32_t HRESULT;
+typedef void* LPVOID;
+typedef struct HINSTANCE__* HMODULE;
+struct _GUID;
+typedef const _GUID& REFCLSID;
+typedef const _GUID& REFIID;
@@ -0,0 +1,36 @@
+#pragma once
+
+// Headless test builds only: a non-owning stand-in for Microsoft::WRL::ComPtr. The
+// tests never create COM objects, so every pointer held here stays null.
+
+#include <cstddef>
+
+namespace Microsoft {
+namespace WRL {
+
+template <class T>
+class ComPtr {
+public:
+    ComPtr() = default;
+    ComPtr(std::nullptr_t) {}
+    ComPtr& operator=(std::nullptr_t) {
+        m_ptr = nullptr;
+        return *this;
+    }
+
+    T* Get() const { return m_ptr; }
+    T* operator->() const { return m_ptr; }
+    T** GetAddressOf() { return &m_ptr; }
+    T** ReleaseAndGetAddressOf() {
+        m_ptr = nullptr;
+        return &m_ptr;
+    }
+    void Reset() { m_ptr = nullptr; }
+    explicit operator bool() const { return m_ptr != nullptr; }
+
+private:
+    T* m_ptr = nullptr;
+};
+
+} // namespace WRL
+} // namespace Microsoft